@@ -0,0 +1,152 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/rpc/RemoteFunctions.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "open3d/data/Dataset.h"
+#include "open3d/io/rpc/Connection.h"
+#include "open3d/io/rpc/DummyMessageProcessor.h"
+#include "open3d/io/rpc/PushConnection.h"
+#include "open3d/io/rpc/ZMQContext.h"
+#include "open3d/io/rpc/ZMQReceiver.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/PointCloudIO.h"
+
+namespace open3d {
+namespace benchmarks {
+
+using namespace open3d::io::rpc;
+
+// Measures the throughput for sending point clouds to a local receiver. Each
+// iteration sends 8 point clouds and waits until the receiver has processed
+// all of them. The batch size is the number of point clouds per message. To
+// run benchmarks in this file, run the following command from inside the build
+// directory: ./bin/benchmarks --benchmark_filter=".*RPC.*"
+
+#ifdef _WIN32
+static const std::string rpc_address = "tcp://127.0.0.1:51455";
+#else
+static const std::string rpc_address = "ipc:///tmp/open3d_benchmark_ipc";
+#endif
+
+namespace {
+
+/// Counts the received SetMeshData messages.
+class CountingMessageProcessor : public DummyMessageProcessor {
+public:
+    using DummyMessageProcessor::ProcessMessage;
+
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::SetMeshData& msg,
+            const msgpack::object_handle& obj) override {
+        ++count_;
+        return CreateStatusOKMsg();
+    }
+
+    void WaitForCount(int64_t count) {
+        while (count_.load() < count) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+
+private:
+    std::atomic<int64_t> count_{0};
+};
+
+}  // namespace
+
+enum class Transport { REQ, PUSH };
+
+static void RPCSendPointCloud(benchmark::State& state,
+                              Transport transport,
+                              int batch_size,
+                              bool compress) {
+    data::PLYPointCloud pointcloud_ply;
+    t::geometry::PointCloud pcd;
+    t::io::ReadPointCloud(pointcloud_ply.GetPath(), pcd);
+    const core::Tensor positions = pcd.GetPointPositions();
+    const core::Tensor colors = pcd.GetPointColors();
+    const int64_t pcd_bytes =
+            positions.NumElements() * positions.GetDtype().ByteSize() +
+            colors.NumElements() * colors.GetDtype().ByteSize();
+
+    auto processor = std::make_shared<CountingMessageProcessor>();
+    ZMQReceiver receiver(rpc_address, 10000,
+                         transport == Transport::PUSH
+                                 ? ZMQReceiver::SocketType::PULL
+                                 : ZMQReceiver::SocketType::REP);
+    receiver.SetMessageProcessor(processor);
+    receiver.Start();
+    {
+        std::shared_ptr<ConnectionBase> connection;
+        std::shared_ptr<PushConnection> push_connection;
+        if (transport == Transport::PUSH) {
+            push_connection = std::make_shared<PushConnection>(
+                    rpc_address, 5000, 10000, batch_size, compress);
+            connection = push_connection;
+        } else {
+            connection = std::make_shared<Connection>(rpc_address, 5000, 10000);
+        }
+
+        int64_t num_sent = 0;
+        for (auto _ : state) {
+            for (int i = 0; i < 8; ++i) {
+                SetMeshData("points", int(num_sent), "", positions,
+                            {{"colors", colors}},
+                            core::Tensor({0}, core::Int32), {},
+                            core::Tensor({0}, core::Int32), {}, "", {}, {}, {},
+                            "", connection);
+                ++num_sent;
+            }
+            if (push_connection) {
+                push_connection->Flush();
+            }
+            processor->WaitForCount(num_sent);
+        }
+        state.SetBytesProcessed(num_sent * pcd_bytes);
+    }
+    receiver.Stop();
+    DestroyZMQContext();
+}
+
+BENCHMARK_CAPTURE(RPCSendPointCloud, REQ, Transport::REQ, 1, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(RPCSendPointCloud, PUSH, Transport::PUSH, 1, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(RPCSendPointCloud, PUSH_BATCH_8, Transport::PUSH, 8, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(RPCSendPointCloud, PUSH_BATCH_8_LZF, Transport::PUSH, 8, true)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
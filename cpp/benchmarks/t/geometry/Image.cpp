@@ -0,0 +1,173 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/Image.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/data/Dataset.h"
+#include "open3d/t/io/ImageIO.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+// Compares the IPP and portable CPU image kernels (and NPP on CUDA) on the
+// Redwood sample images. The portable variants are run on IPP builds by
+// disabling IPP at runtime.
+
+static Image LoadColor(const core::Device& device) {
+    data::SampleRedwoodRGBDImages redwood_data;
+    return t::io::CreateImageFromFile(redwood_data.GetColorPaths()[0])
+            ->To(device);
+}
+
+static Image LoadDepth(const core::Device& device) {
+    data::SampleRedwoodRGBDImages redwood_data;
+    return t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[0])
+            ->To(device)
+            .To(core::Float32, false, 1.0 / 1000.0);
+}
+
+/// Runs func(image) in the benchmark loop, with IPP enabled or disabled for
+/// CPU images.
+template <typename func_t>
+static void RunImageBenchmark(benchmark::State& state,
+                              const Image& im,
+                              bool use_ipp,
+                              const func_t& func) {
+    if (use_ipp && !Image::HAVE_IPPICV) {
+        state.SkipWithError("Not built with IPP.");
+        return;
+    }
+    const bool ipp_enabled = Image::IsIPPEnabled();
+    Image::SetIPPEnabled(use_ipp);
+
+    // Warm up.
+    Image out = func(im);
+    (void)out;
+
+    for (auto _ : state) {
+        Image out = func(im);
+        core::cuda::Synchronize(im.GetDevice());
+    }
+    Image::SetIPPEnabled(ipp_enabled);
+}
+
+void ImageFilterGaussian(benchmark::State& state,
+                         const core::Device& device,
+                         bool use_ipp,
+                         int kernel_size) {
+    RunImageBenchmark(state, LoadColor(device), use_ipp, [&](const Image& im) {
+        return im.FilterGaussian(kernel_size);
+    });
+}
+
+void ImageFilter(benchmark::State& state,
+                 const core::Device& device,
+                 bool use_ipp) {
+    // A 5x5 kernel of rank 2, which is not separable.
+    core::Tensor kernel = core::Tensor::Ones({5, 5}, core::Float32, device) /
+                          25.0f;
+    kernel[2][2] = 0.5f;
+    RunImageBenchmark(state, LoadColor(device), use_ipp,
+                      [&](const Image& im) { return im.Filter(kernel); });
+}
+
+void ImageFilterBilateral(benchmark::State& state,
+                          const core::Device& device,
+                          bool use_ipp) {
+    RunImageBenchmark(state, LoadDepth(device), use_ipp, [&](const Image& im) {
+        return im.FilterBilateral(5, 0.05f, 2.0f);
+    });
+}
+
+void ImageFilterSobel(benchmark::State& state,
+                      const core::Device& device,
+                      bool use_ipp) {
+    RunImageBenchmark(state, LoadDepth(device), use_ipp, [&](const Image& im) {
+        return im.FilterSobel(3).first;
+    });
+}
+
+void ImageDilate(benchmark::State& state,
+                 const core::Device& device,
+                 bool use_ipp) {
+    RunImageBenchmark(state, LoadDepth(device), use_ipp,
+                      [&](const Image& im) { return im.Dilate(5); });
+}
+
+void ImageResize(benchmark::State& state,
+                 const core::Device& device,
+                 bool use_ipp,
+                 Image::InterpType interp_type) {
+    RunImageBenchmark(state, LoadColor(device), use_ipp, [&](const Image& im) {
+        return im.Resize(0.5f, interp_type);
+    });
+}
+
+void ImagePyrDown(benchmark::State& state,
+                  const core::Device& device,
+                  bool use_ipp) {
+    RunImageBenchmark(state, LoadDepth(device), use_ipp,
+                      [&](const Image& im) { return im.PyrDown(); });
+}
+
+#define ENUM_IMAGE_BENCHMARK_BACKENDS(FUNC, NAME, ...)                    \
+    BENCHMARK_CAPTURE(FUNC, IPP##NAME, core::Device("CPU:0"), true,       \
+                      ##__VA_ARGS__)                                      \
+            ->Unit(benchmark::kMillisecond);                              \
+    BENCHMARK_CAPTURE(FUNC, Portable##NAME, core::Device("CPU:0"), false, \
+                      ##__VA_ARGS__)                                      \
+            ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+#define ENUM_IMAGE_BENCHMARKS(FUNC, NAME, ...)                             \
+    ENUM_IMAGE_BENCHMARK_BACKENDS(FUNC, NAME, ##__VA_ARGS__)               \
+    BENCHMARK_CAPTURE(FUNC, NPP##NAME, core::Device("CUDA:0"), false,      \
+                      ##__VA_ARGS__)                                       \
+            ->Unit(benchmark::kMillisecond);
+#else
+#define ENUM_IMAGE_BENCHMARKS(FUNC, NAME, ...) \
+    ENUM_IMAGE_BENCHMARK_BACKENDS(FUNC, NAME, ##__VA_ARGS__)
+#endif
+
+ENUM_IMAGE_BENCHMARKS(ImageFilterGaussian, _3, 3)
+ENUM_IMAGE_BENCHMARKS(ImageFilterGaussian, _7, 7)
+ENUM_IMAGE_BENCHMARKS(ImageFilter, )
+ENUM_IMAGE_BENCHMARKS(ImageFilterBilateral, )
+ENUM_IMAGE_BENCHMARKS(ImageFilterSobel, )
+ENUM_IMAGE_BENCHMARKS(ImageDilate, )
+ENUM_IMAGE_BENCHMARKS(ImageResize, _Nearest, Image::InterpType::Nearest)
+ENUM_IMAGE_BENCHMARKS(ImageResize, _Linear, Image::InterpType::Linear)
+ENUM_IMAGE_BENCHMARKS(ImageResize, _Super, Image::InterpType::Super)
+ENUM_IMAGE_BENCHMARKS(ImagePyrDown, )
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include "benchmarks/benchmark_utilities/ShufflePoints.h"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/data/Dataset.h"
@@ -275,6 +276,94 @@ void LegacyRemoveRadiusOutliers(benchmark::State& state,
     }
 }
 
+void SortByMortonCode(benchmark::State& state, const core::Device& device) {
+    PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    pcd = benchmarks::ShufflePoints(pcd.To(device));
+
+    // Warm up.
+    PointCloud pcd_sorted = pcd.Clone();
+    pcd_sorted.SortByMortonCode();
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        pcd_sorted = pcd.Clone();
+        core::cuda::Synchronize(device);
+        state.ResumeTiming();
+
+        pcd_sorted.SortByMortonCode();
+        core::cuda::Synchronize(device);
+    }
+}
+
+void LegacySortByMortonCode(benchmark::State& state, const int no_use) {
+    PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    const open3d::geometry::PointCloud pcd_legacy =
+            benchmarks::ShufflePoints(pcd).ToLegacy();
+
+    // Warm up.
+    open3d::geometry::PointCloud pcd_sorted = pcd_legacy;
+    pcd_sorted.SortByMortonCode();
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        pcd_sorted = pcd_legacy;
+        state.ResumeTiming();
+
+        pcd_sorted.SortByMortonCode();
+    }
+}
+
+// Measures the effect of the memory order of the points on VoxelDownSample.
+// The points are shuffled, and then optionally sorted by their Morton codes.
+void VoxelDownSampleMortonOrder(benchmark::State& state,
+                                const core::Device& device,
+                                float voxel_size,
+                                bool sort_by_morton_code) {
+    PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    pcd = benchmarks::ShufflePoints(pcd.To(device));
+    if (sort_by_morton_code) {
+        pcd.SortByMortonCode();
+    }
+
+    // Warm up.
+    pcd.VoxelDownSample(voxel_size);
+
+    for (auto _ : state) {
+        pcd.VoxelDownSample(voxel_size);
+        core::cuda::Synchronize(device);
+    }
+}
+
+// Measures the effect of the memory order of the points on EstimateNormals.
+// The points are shuffled, and then optionally sorted by their Morton codes.
+void EstimateNormalsMortonOrder(benchmark::State& state,
+                                const core::Device& device,
+                                const double voxel_size,
+                                const int max_nn,
+                                const utility::optional<double> radius,
+                                bool sort_by_morton_code) {
+    PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    pcd = benchmarks::ShufflePoints(
+            pcd.To(device).VoxelDownSample(voxel_size));
+    if (pcd.HasPointNormals()) {
+        pcd.RemovePointAttr("normals");
+    }
+    if (sort_by_morton_code) {
+        pcd.SortByMortonCode();
+    }
+
+    // Warm up.
+    pcd.EstimateNormals(max_nn, radius);
+    for (auto _ : state) {
+        pcd.EstimateNormals(max_nn, radius);
+        core::cuda::Synchronize(device);
+    }
+}
+
 BENCHMARK_CAPTURE(FromLegacyPointCloud, CPU, core::Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
 
@@ -437,6 +526,42 @@ BENCHMARK_CAPTURE(EstimateNormals,
         ->Unit(benchmark::kMillisecond);
 #endif
 
+BENCHMARK_CAPTURE(SortByMortonCode, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LegacySortByMortonCode, Legacy, 1)
+        ->Unit(benchmark::kMillisecond);
+
+#define ENUM_MORTON_ORDER(DEVICE, DEVICE_NAME)                                 \
+    BENCHMARK_CAPTURE(VoxelDownSampleMortonOrder, DEVICE_NAME Shuffled_0_01,   \
+                      core::Device(DEVICE), 0.01, false)                       \
+            ->Unit(benchmark::kMillisecond);                                   \
+    BENCHMARK_CAPTURE(VoxelDownSampleMortonOrder, DEVICE_NAME Morton_0_01,     \
+                      core::Device(DEVICE), 0.01, true)                        \
+            ->Unit(benchmark::kMillisecond);                                   \
+    BENCHMARK_CAPTURE(EstimateNormalsMortonOrder,                              \
+                      DEVICE_NAME Shuffled Hybrid[0.02 | 30 | 0.06],           \
+                      core::Device(DEVICE), 0.02, 30, 0.06, false)             \
+            ->Unit(benchmark::kMillisecond);                                   \
+    BENCHMARK_CAPTURE(EstimateNormalsMortonOrder,                              \
+                      DEVICE_NAME Morton Hybrid[0.02 | 30 | 0.06],             \
+                      core::Device(DEVICE), 0.02, 30, 0.06, true)              \
+            ->Unit(benchmark::kMillisecond);                                   \
+    BENCHMARK_CAPTURE(EstimateNormalsMortonOrder,                              \
+                      DEVICE_NAME Shuffled KNN[0.02 | 30],                     \
+                      core::Device(DEVICE), 0.02, 30, utility::nullopt, false) \
+            ->Unit(benchmark::kMillisecond);                                   \
+    BENCHMARK_CAPTURE(EstimateNormalsMortonOrder,                              \
+                      DEVICE_NAME Morton KNN[0.02 | 30], core::Device(DEVICE), \
+                      0.02, 30, utility::nullopt, true)                        \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_MORTON_ORDER("CPU:0", CPU)
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(SortByMortonCode, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+ENUM_MORTON_ORDER("CUDA:0", CUDA)
+#endif
+
 BENCHMARK_CAPTURE(LegacyTransform, CPU, 1)->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(LegacySelectByIndex, CPU, 1)->Unit(benchmark::kMillisecond);
 
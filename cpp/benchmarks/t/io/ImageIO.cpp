@@ -0,0 +1,160 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/ImageIO.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/data/Dataset.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+// The `Read` benchmark functions are dependent on the corresponding `Write`
+// benchmark functions to generate the depth image file in the required
+// format. To run benchmarks in this file, run the following command from
+// inside the build directory: ./bin/benchmarks --benchmark_filter=".*Depth.*"
+
+static geometry::Image ReadSampleDepthImage() {
+    data::SampleRedwoodRGBDImages redwood_data;
+    geometry::Image depth;
+    ReadImage(redwood_data.GetDepthPaths()[0], depth);
+    return depth;
+}
+
+static void SetFileSizeCounter(benchmark::State& state,
+                               const std::string& file_name) {
+    utility::filesystem::CFile file;
+    if (file.Open(file_name, "rb")) {
+        state.counters["bytes"] = static_cast<double>(file.GetFileSize());
+    }
+}
+
+void IOWriteDepthImage(benchmark::State& state,
+                       const std::string& output_file_path,
+                       int quality) {
+    const geometry::Image depth = ReadSampleDepthImage();
+    WriteImage(output_file_path, depth, quality);
+    for (auto _ : state) {
+        WriteImage(output_file_path, depth, quality);
+    }
+    SetFileSizeCounter(state, output_file_path);
+}
+
+void IOWriteDepthImageToPNG(benchmark::State& state,
+                            const std::string& output_file_path,
+                            int compression_level,
+                            DepthPNGWriteOption::Filter filter,
+                            bool run_length) {
+    const geometry::Image depth = ReadSampleDepthImage();
+    DepthPNGWriteOption option;
+    option.compression_level = compression_level;
+    option.filter = filter;
+    option.run_length = run_length;
+    WriteDepthImageToPNG(output_file_path, depth, option);
+    for (auto _ : state) {
+        WriteDepthImageToPNG(output_file_path, depth, option);
+    }
+    SetFileSizeCounter(state, output_file_path);
+}
+
+void IOReadDepthImage(benchmark::State& state,
+                      const std::string& input_file_path) {
+    // Decoding reuses the memory of the previous image.
+    geometry::Image depth;
+    ReadImage(input_file_path, depth);
+    for (auto _ : state) {
+        ReadImage(input_file_path, depth);
+    }
+}
+
+BENCHMARK_CAPTURE(IOWriteDepthImage,
+                  PNG_DEFAULT,
+                  std::string("depth_default.png"),
+                  kOpen3DImageIODefaultQuality)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IOReadDepthImage,
+                  PNG_DEFAULT,
+                  std::string("depth_default.png"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IOWriteDepthImage,
+                  PNG_FAST,
+                  std::string("depth_fast.png"),
+                  1)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IOReadDepthImage, PNG_FAST, std::string("depth_fast.png"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IOWriteDepthImage,
+                  RVL,
+                  std::string("depth.rvl"),
+                  kOpen3DImageIODefaultQuality)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IOReadDepthImage, RVL, std::string("depth.rvl"))
+        ->Unit(benchmark::kMillisecond);
+
+// PNG compression levels and filters.
+BENCHMARK_CAPTURE(IOWriteDepthImageToPNG,
+                  LEVEL_0_NONE,
+                  std::string("depth_option.png"),
+                  0,
+                  DepthPNGWriteOption::Filter::None,
+                  false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IOWriteDepthImageToPNG,
+                  LEVEL_1_SUB_RLE,
+                  std::string("depth_option.png"),
+                  1,
+                  DepthPNGWriteOption::Filter::Sub,
+                  true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IOWriteDepthImageToPNG,
+                  LEVEL_1_UP_RLE,
+                  std::string("depth_option.png"),
+                  1,
+                  DepthPNGWriteOption::Filter::Up,
+                  true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IOWriteDepthImageToPNG,
+                  LEVEL_1_PAETH_RLE,
+                  std::string("depth_option.png"),
+                  1,
+                  DepthPNGWriteOption::Filter::Paeth,
+                  true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IOWriteDepthImageToPNG,
+                  LEVEL_3_ALL,
+                  std::string("depth_option.png"),
+                  3,
+                  DepthPNGWriteOption::Filter::All,
+                  false)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -32,6 +32,7 @@
 #include "open3d/data/Dataset.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/PointCloudStreamIO.h"
 
 namespace open3d {
 namespace t {
@@ -112,6 +113,17 @@ void IOReadTensorPointCloud(benchmark::State& state,
     }
 }
 
+void IOStreamTensorPointCloud(benchmark::State& state,
+                              const std::string& input_file_path,
+                              const int64_t batch_size) {
+    for (auto _ : state) {
+        t::io::PointCloudReader reader;
+        reader.Open(input_file_path);
+        while (!reader.Next(batch_size).IsEmpty()) {
+        }
+    }
+}
+
 #define ENUM_BM_IO_EXTENSION_FORMAT(EXTENSION_NAME, FILE_NAME, FORMAT_NAME,    \
                                     ASCII, COMPRESSED)                         \
     BENCHMARK_CAPTURE(IOWriteLegacyPointCloud, EXTENSION_NAME##_##FORMAT_NAME, \
@@ -147,6 +159,47 @@ ENUM_BM_IO_EXTENSION(PCD, ".pcd")
 ENUM_BM_IO_EXTENSION(PLY, ".ply")
 ENUM_BM_IO_EXTENSION(PTS, ".pts")
 
+// Batched reads of the files written by the tensor benchmarks above.
+BENCHMARK_CAPTURE(IOStreamTensorPointCloud,
+                  PLY_BINARY_UNCOMPRESSED,
+                  std::string("legacy_pcd_bin.ply"),
+                  10000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IOStreamTensorPointCloud,
+                  PCD_BINARY_UNCOMPRESSED,
+                  std::string("legacy_pcd_bin.pcd"),
+                  10000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IOStreamTensorPointCloud,
+                  PTS_ASCII_UNCOMPRESSED,
+                  std::string("legacy_pcd_ascii.pts"),
+                  10000)
+        ->Unit(benchmark::kMillisecond);
+
+// The native columnar format is only supported by the tensor point cloud IO.
+BENCHMARK_CAPTURE(IOWriteTensorPointCloud,
+                  O3DT_BINARY_UNCOMPRESSED,
+                  input_path_pcd,
+                  std::string("tensor_bin.o3dt"),
+                  false,
+                  false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IOReadTensorPointCloud,
+                  O3DT_BINARY_UNCOMPRESSED,
+                  std::string("tensor_bin.o3dt"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IOWriteTensorPointCloud,
+                  O3DT_BINARY_COMPRESSED,
+                  input_path_pcd,
+                  std::string("tensor_bin_compressed.o3dt"),
+                  false,
+                  true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IOReadTensorPointCloud,
+                  O3DT_BINARY_COMPRESSED,
+                  std::string("tensor_bin_compressed.o3dt"))
+        ->Unit(benchmark::kMillisecond);
+
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
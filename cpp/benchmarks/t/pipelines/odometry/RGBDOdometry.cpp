@@ -36,6 +36,7 @@
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/io/ImageIO.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/pipelines/odometry/RGBDPreprocessor.h"
 
 namespace open3d {
 namespace t {
@@ -169,6 +170,78 @@ static void RGBDOdometryMultiScale(
     }
 }
 
+// Builds the pyramid of one frame with the fused kernels, reusing buffers.
+static void RGBDPreprocessorProcess(
+        benchmark::State& state,
+        const core::Device& device,
+        const t::pipelines::odometry::Method& method) {
+    data::SampleRedwoodRGBDImages redwood_data;
+    t::geometry::RGBDImage rgbd;
+    rgbd.color_ = t::io::CreateImageFromFile(redwood_data.GetColorPaths()[0])
+                          ->To(device);
+    rgbd.depth_ = t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[0])
+                          ->To(device);
+
+    RGBDPreprocessor preprocessor(CreateIntrisicTensor(), 3, 1000.0, 3.0,
+                                  method, OdometryLossParams(0.07));
+    RGBDPyramid pyramid;
+    // Warm up
+    preprocessor.Process(rgbd, pyramid);
+
+    for (auto _ : state) {
+        preprocessor.Process(rgbd, pyramid);
+        core::cuda::Synchronize(device);
+    }
+}
+
+// Same workload as RGBDOdometryMultiScale, through the preprocessed pyramids.
+// In tracking, the source pyramid is the target pyramid of the previous frame,
+// so only the target frame is preprocessed per iteration.
+static void RGBDOdometryMultiScalePyramid(
+        benchmark::State& state,
+        const core::Device& device,
+        const t::pipelines::odometry::Method& method) {
+    const float depth_diff = 0.07;
+
+    data::SampleRedwoodRGBDImages redwood_data;
+    t::geometry::RGBDImage source, target;
+    source.color_ = t::io::CreateImageFromFile(redwood_data.GetColorPaths()[0])
+                            ->To(device);
+    source.depth_ = t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[0])
+                            ->To(device);
+    target.color_ = t::io::CreateImageFromFile(redwood_data.GetColorPaths()[0])
+                            ->To(device);
+    target.depth_ = t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[2])
+                            ->To(device);
+
+    OdometryLossParams loss(depth_diff);
+    std::vector<OdometryConvergenceCriteria> criteria{
+            OdometryConvergenceCriteria(10, 1e-12, 1e-12),
+            OdometryConvergenceCriteria(5, 1e-12, 1e-12),
+            OdometryConvergenceCriteria(3, 1e-12, 1e-12)};
+
+    RGBDPreprocessor preprocessor(CreateIntrisicTensor(), 3, 1000.0, 3.0,
+                                  method, loss);
+    RGBDPyramid source_pyramid = preprocessor.Process(source);
+    RGBDPyramid target_pyramid;
+
+    // Warm up
+    preprocessor.Process(target, target_pyramid);
+    RGBDOdometryMultiScale(
+            source_pyramid, target_pyramid,
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+            criteria, method, loss);
+
+    for (auto _ : state) {
+        preprocessor.Process(target, target_pyramid);
+        RGBDOdometryMultiScale(
+                source_pyramid, target_pyramid,
+                core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+                criteria, method, loss);
+        core::cuda::Synchronize(device);
+    }
+}
+
 BENCHMARK_CAPTURE(ComputeOdometryResultPointToPlane, CPU, core::Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
 #ifdef BUILD_CUDA_MODULE
@@ -211,6 +284,26 @@ BENCHMARK_CAPTURE(RGBDOdometryMultiScale,
                   t::pipelines::odometry::Method::PointToPlane)
         ->Unit(benchmark::kMillisecond);
 #endif
+
+#define ODOMETRY_PYRAMID_BENCHMARKS(FUNC, DEVICE_NAME, DEVICE)                \
+    BENCHMARK_CAPTURE(FUNC, Hybrid_##DEVICE_NAME, core::Device(DEVICE),       \
+                      t::pipelines::odometry::Method::Hybrid)                 \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(FUNC, Intensity_##DEVICE_NAME, core::Device(DEVICE),    \
+                      t::pipelines::odometry::Method::Intensity)              \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(FUNC, PointToPlane_##DEVICE_NAME, core::Device(DEVICE), \
+                      t::pipelines::odometry::Method::PointToPlane)           \
+            ->Unit(benchmark::kMillisecond);
+
+ODOMETRY_PYRAMID_BENCHMARKS(RGBDPreprocessorProcess, CPU, "CPU:0")
+ODOMETRY_PYRAMID_BENCHMARKS(RGBDOdometryMultiScalePyramid, CPU, "CPU:0")
+#ifdef BUILD_CUDA_MODULE
+ODOMETRY_PYRAMID_BENCHMARKS(RGBDPreprocessorProcess, CUDA, "CUDA:0")
+ODOMETRY_PYRAMID_BENCHMARKS(RGBDOdometryMultiScalePyramid, CUDA, "CUDA:0")
+#endif
+#undef ODOMETRY_PYRAMID_BENCHMARKS
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace t
@@ -28,6 +28,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include "benchmarks/benchmark_utilities/ShufflePoints.h"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/data/Dataset.h"
@@ -137,6 +138,52 @@ static void BenchmarkICP(benchmark::State& state,
     }
 }
 
+// Measures the effect of the memory order of the points on ICP. The points
+// are shuffled, and then optionally sorted by their Morton codes.
+static void BenchmarkICPMortonOrder(benchmark::State& state,
+                                    const core::Device& device,
+                                    const TransformationEstimationType& type,
+                                    bool sort_by_morton_code) {
+    utility::SetVerbosityLevel(utility::VerbosityLevel::Error);
+    data::DemoICPPointClouds demo_icp_pointclouds;
+    geometry::PointCloud source, target;
+    std::tie(source, target) = LoadTensorPointCloudFromFile(
+            demo_icp_pointclouds.GetPaths(0), demo_icp_pointclouds.GetPaths(1),
+            voxel_downsampling_factor, core::Float32, device);
+    source = benchmarks::ShufflePoints(source);
+    target = benchmarks::ShufflePoints(target);
+    if (sort_by_morton_code) {
+        source.SortByMortonCode();
+        target.SortByMortonCode();
+    }
+
+    std::shared_ptr<TransformationEstimation> estimation;
+    if (type == TransformationEstimationType::PointToPlane) {
+        estimation = std::make_shared<TransformationEstimationPointToPlane>();
+    } else {
+        estimation = std::make_shared<TransformationEstimationPointToPoint>();
+    }
+
+    core::Tensor init_trans = core::Tensor(initial_transform_flat, {4, 4},
+                                           core::Float32, device);
+
+    RegistrationResult reg_result(init_trans);
+
+    // Warm up.
+    reg_result = ICP(source, target, max_correspondence_distance, init_trans,
+                     *estimation,
+                     ICPConvergenceCriteria(relative_fitness, relative_rmse,
+                                            max_iterations));
+
+    for (auto _ : state) {
+        reg_result = ICP(source, target, max_correspondence_distance,
+                         init_trans, *estimation,
+                         ICPConvergenceCriteria(relative_fitness, relative_rmse,
+                                                max_iterations));
+        core::cuda::Synchronize(device);
+    }
+}
+
 #define ENUM_ICP_METHOD_DEVICE(METHOD_NAME, TRANSFORMATION_TYPE, DEVICE) \
     BENCHMARK_CAPTURE(BenchmarkICP, DEVICE METHOD_NAME##_Float32,        \
                       core::Device(DEVICE), core::Float32,               \
@@ -157,6 +204,21 @@ ENUM_ICP_METHOD_DEVICE(ColoredICP,
                        TransformationEstimationType::ColoredICP,
                        "CPU:0")
 
+#define ENUM_ICP_MORTON_ORDER(METHOD_NAME, TRANSFORMATION_TYPE, DEVICE)   \
+    BENCHMARK_CAPTURE(BenchmarkICPMortonOrder, DEVICE METHOD_NAME##_Shuffled, \
+                      core::Device(DEVICE), TRANSFORMATION_TYPE, false)       \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(BenchmarkICPMortonOrder, DEVICE METHOD_NAME##_Morton,   \
+                      core::Device(DEVICE), TRANSFORMATION_TYPE, true)        \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_ICP_MORTON_ORDER(PointToPoint,
+                      TransformationEstimationType::PointToPoint,
+                      "CPU:0")
+ENUM_ICP_MORTON_ORDER(PointToPlane,
+                      TransformationEstimationType::PointToPlane,
+                      "CPU:0")
+
 #ifdef BUILD_CUDA_MODULE
 ENUM_ICP_METHOD_DEVICE(PointToPoint,
                        TransformationEstimationType::PointToPoint,
@@ -167,6 +229,12 @@ ENUM_ICP_METHOD_DEVICE(PointToPlane,
 ENUM_ICP_METHOD_DEVICE(ColoredICP,
                        TransformationEstimationType::ColoredICP,
                        "CUDA:0")
+ENUM_ICP_MORTON_ORDER(PointToPoint,
+                      TransformationEstimationType::PointToPoint,
+                      "CUDA:0")
+ENUM_ICP_MORTON_ORDER(PointToPlane,
+                      TransformationEstimationType::PointToPlane,
+                      "CUDA:0")
 #endif
 
 }  // namespace registration
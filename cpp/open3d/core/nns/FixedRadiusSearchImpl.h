@@ -27,8 +27,11 @@
 #pragma once
 
 #include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
-#include <set>
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 #include "open3d/core/Atomic.h"
 #include "open3d/core/nns/NeighborSearchCommon.h"
@@ -43,6 +46,9 @@ namespace impl {
 
 namespace {
 
+/// Minimum number of points processed by a thread when building the hash table.
+constexpr size_t kMinPointsPerChunk = 4096;
+
 /// Builds a spatial hash table for a fixed radius search of 3D points.
 ///
 /// \param num_points    The number of points.
@@ -91,11 +97,18 @@ void BuildSpatialHashTableCPU(const size_t num_points,
     const int batch_size = points_row_splits_size - 1;
     const T voxel_size = 2 * radius;
     const T inv_voxel_size = 1 / voxel_size;
+    const size_t num_cells = hash_table_cell_splits_size - 1;
 
-    memset(&hash_table_cell_splits[0], 0,
-           sizeof(uint32_t) * hash_table_cell_splits_size);
+    // without points or cells all cells are empty, e.g. for row splits without
+    // batch items
+    if (num_points == 0 || num_cells == 0) {
+        memset(&hash_table_cell_splits[0], 0,
+               sizeof(uint32_t) * hash_table_cell_splits_size);
+        return;
+    }
 
-    // compute number of points that map to each hash
+    // compute the cell of each point once, both passes below reuse it
+    std::vector<uint32_t> point_cells(num_points);
     for (int i = 0; i < batch_size; ++i) {
         const size_t hash_table_size =
                 hash_table_splits[i + 1] - hash_table_splits[i];
@@ -111,47 +124,65 @@ void BuildSpatialHashTableCPU(const size_t num_points,
                                 ComputeVoxelIndex(pos, inv_voxel_size);
                         size_t hash =
                                 SpatialHash(voxel_index) % hash_table_size;
-
-                        // note the +1 because we want the first
-                        // element to be 0
-                        core::AtomicFetchAddRelaxed(
-                                &hash_table_cell_splits[first_cell_idx + hash +
-                                                        1],
-                                1);
+                        point_cells[i] = uint32_t(first_cell_idx + hash);
                     }
                 });
     }
+
+    // Counting sort of the points into the cells. The points are split into
+    // contiguous chunks and each chunk counts into its own histogram, which
+    // avoids atomics and keeps the points of each cell in ascending order.
+    // The number of chunks is also limited such that the histograms do not
+    // need much more memory than the points.
+    const size_t max_threads = tbb::this_task_arena::max_concurrency();
+    const size_t num_chunks = std::max<size_t>(
+            1, std::min<size_t>({max_threads, num_points / kMinPointsPerChunk,
+                                 4 * num_points / num_cells}));
+    std::vector<uint32_t> histograms(num_chunks * num_cells, 0);
+    auto chunk_begin = [&](size_t chunk) {
+        return num_points * chunk / num_chunks;
+    };
+
+    tbb::parallel_for(size_t(0), num_chunks, [&](size_t chunk) {
+        uint32_t* histogram = &histograms[chunk * num_cells];
+        for (size_t i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i) {
+            ++histogram[point_cells[i]];
+        }
+    });
+
+    // turn the histograms into per chunk offsets within each cell and store
+    // the number of points per cell. note the +1 because we want the first
+    // element to be 0
+    hash_table_cell_splits[0] = 0;
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_cells),
+                      [&](const tbb::blocked_range<size_t>& r) {
+                          for (size_t cell = r.begin(); cell != r.end();
+                               ++cell) {
+                              uint32_t count = 0;
+                              for (size_t chunk = 0; chunk < num_chunks;
+                                   ++chunk) {
+                                  uint32_t& h =
+                                          histograms[chunk * num_cells + cell];
+                                  const uint32_t chunk_count = h;
+                                  h = count;
+                                  count += chunk_count;
+                              }
+                              hash_table_cell_splits[cell + 1] = count;
+                          }
+                      });
     InclusivePrefixSum(&hash_table_cell_splits[0],
                        &hash_table_cell_splits[hash_table_cell_splits_size],
                        &hash_table_cell_splits[0]);
 
-    std::vector<uint32_t> count_tmp(hash_table_cell_splits_size - 1, 0);
-
     // now compute the indices for hash_table_index
-    for (int i = 0; i < batch_size; ++i) {
-        const size_t hash_table_size =
-                hash_table_splits[i + 1] - hash_table_splits[i];
-        const size_t first_cell_idx = hash_table_splits[i];
-        tbb::parallel_for(
-                tbb::blocked_range<size_t>(points_row_splits[i],
-                                           points_row_splits[i + 1]),
-                [&](const tbb::blocked_range<size_t>& r) {
-                    for (size_t i = r.begin(); i != r.end(); ++i) {
-                        Vec3_t pos(points + 3 * i);
-
-                        auto voxel_index =
-                                ComputeVoxelIndex(pos, inv_voxel_size);
-                        size_t hash =
-                                SpatialHash(voxel_index) % hash_table_size;
-
-                        hash_table_index
-                                [hash_table_cell_splits[hash + first_cell_idx] +
-                                 core::AtomicFetchAddRelaxed(
-                                         &count_tmp[hash + first_cell_idx],
-                                         1)] = i;
-                    }
-                });
-    }
+    tbb::parallel_for(size_t(0), num_chunks, [&](size_t chunk) {
+        uint32_t* offsets = &histograms[chunk * num_cells];
+        for (size_t i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i) {
+            const uint32_t cell = point_cells[i];
+            hash_table_index[hash_table_cell_splits[cell] + offsets[cell]++] =
+                    uint32_t(i);
+        }
+    });
 }
 
 /// Vectorized distance computation. This function computes the distance to
@@ -189,6 +220,110 @@ Eigen::Array<typename TDerived::Scalar, VECSIZE, 1> NeighborsDist(
     return dist;
 }
 
+// number of elements for vectorization
+#define VECSIZE 8
+
+/// Computes the hash table cells which may contain neighbors of \p pos within
+/// \p radius.
+///
+/// \param bins    Output array with space for 9 cells.
+///
+/// \return Returns the number of unique cells written to \p bins.
+template <class T>
+int ComputeBinsToVisit(const utility::MiniVec<T, 3>& pos,
+                       const T radius,
+                       const T inv_voxel_size,
+                       const size_t hash_table_size,
+                       const size_t first_cell_idx,
+                       size_t* bins) {
+    typedef utility::MiniVec<T, 3> Vec3_t;
+
+    auto voxel_index = ComputeVoxelIndex(pos, inv_voxel_size);
+    bins[0] = first_cell_idx + SpatialHash(voxel_index) % hash_table_size;
+    int num_bins = 1;
+
+    for (int dz = -1; dz <= 1; dz += 2)
+        for (int dy = -1; dy <= 1; dy += 2)
+            for (int dx = -1; dx <= 1; dx += 2) {
+                Vec3_t p = pos + radius * Vec3_t(T(dx), T(dy), T(dz));
+                voxel_index = ComputeVoxelIndex(p, inv_voxel_size);
+                const size_t bin = first_cell_idx +
+                                   SpatialHash(voxel_index) % hash_table_size;
+                // insert without duplicates
+                if (std::find(bins, bins + num_bins, bin) == bins + num_bins) {
+                    bins[num_bins++] = bin;
+                }
+            }
+    return num_bins;
+}
+
+/// Calls \p fn(idx, dist) for each point stored in the cells \p bins whose
+/// distance to \p pos is within \p threshold. The distances are computed for
+/// VECSIZE points at once.
+///
+/// \tparam METRIC    The distance metric. One of L1, L2, Linf.
+///
+/// \tparam IGNORE_QUERY_POINT    If true then points with the same position as
+///         \p pos will be ignored.
+///
+/// \param fn    Function with signature void(uint32_t idx, T dist). Note that
+///        for the metric L2 dist is the squared distance.
+template <int METRIC, bool IGNORE_QUERY_POINT, class T, class FN>
+void ForEachNeighbor(const utility::MiniVec<T, 3>& pos,
+                     const T* const points,
+                     const size_t* const bins,
+                     const int num_bins,
+                     const uint32_t* const hash_table_cell_splits,
+                     const uint32_t* const hash_table_index,
+                     const T threshold,
+                     FN fn) {
+    typedef Eigen::Array<T, VECSIZE, 1> Vec_t;
+    typedef Eigen::Array<uint32_t, VECSIZE, 1> Veci_t;
+    typedef Eigen::Array<T, 3, 1> Pos_t;
+    typedef Eigen::Array<T, VECSIZE, 3> Poslist_t;
+
+    const Pos_t pos_arr(pos[0], pos[1], pos[2]);
+    Poslist_t xyz;
+    Veci_t idx_vec;
+    int vec_i = 0;
+
+    auto test_candidates = [&]() {
+        Vec_t dist = NeighborsDist<METRIC, Pos_t, VECSIZE>(pos_arr, xyz);
+        for (int k = 0; k < vec_i; ++k) {
+            if (dist(k) <= threshold) {
+                fn(idx_vec(k), dist(k));
+            }
+        }
+        vec_i = 0;
+    };
+
+    for (int bin_i = 0; bin_i < num_bins; ++bin_i) {
+        const size_t begin_idx = hash_table_cell_splits[bins[bin_i]];
+        const size_t end_idx = hash_table_cell_splits[bins[bin_i] + 1];
+
+        for (size_t j = begin_idx; j < end_idx; ++j) {
+            const uint32_t idx = hash_table_index[j];
+            const T* const p = points + size_t(idx) * 3;
+            if (IGNORE_QUERY_POINT) {
+                if (p[0] == pos[0] && p[1] == pos[1] && p[2] == pos[2])
+                    continue;
+            }
+            xyz(vec_i, 0) = p[0];
+            xyz(vec_i, 1) = p[1];
+            xyz(vec_i, 2) = p[2];
+            idx_vec(vec_i) = idx;
+            ++vec_i;
+            if (VECSIZE == vec_i) {
+                test_candidates();
+            }
+        }
+    }
+    // process the tail
+    if (vec_i) {
+        test_candidates();
+    }
+}
+
 /// Implementation of FixedRadiusSearchCPU with template params for metrics
 /// and boolean options.
 template <class T,
@@ -211,18 +346,10 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
                            const size_t hash_table_cell_splits_size,
                            const uint32_t* const hash_table_cell_splits,
                            const uint32_t* const hash_table_index,
+                           const bool sort,
                            OUTPUT_ALLOCATOR& output_allocator) {
     using namespace open3d::utility;
-
-// number of elements for vectorization
-#define VECSIZE 8
     typedef MiniVec<T, 3> Vec3_t;
-    typedef Eigen::Array<T, VECSIZE, 1> Vec_t;
-    typedef Eigen::Array<TIndex, VECSIZE, 1> Veci_t;
-
-    typedef Eigen::Array<T, 3, 1> Pos_t;
-    typedef Eigen::Array<T, VECSIZE, 3> Poslist_t;
-    typedef Eigen::Array<bool, VECSIZE, 1> Result_t;
 
     const int batch_size = points_row_splits_size - 1;
 
@@ -245,13 +372,8 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
     const T voxel_size = 2 * radius;
     const T inv_voxel_size = 1 / voxel_size;
 
-    // counts the number of indices we have to return. This is the number of all
-    // neighbors we find.
-    size_t num_indices = 0;
-
-    // count the number of neighbors for all query points and update num_indices
-    // and populate query_neighbors_row_splits with the number of neighbors
-    // for each query point
+    // populate query_neighbors_row_splits with the number of neighbors for
+    // each query point
     for (int i = 0; i < batch_size; ++i) {
         const size_t hash_table_size =
                 hash_table_splits[i + 1] - hash_table_splits[i];
@@ -260,85 +382,35 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
                 tbb::blocked_range<size_t>(queries_row_splits[i],
                                            queries_row_splits[i + 1]),
                 [&](const tbb::blocked_range<size_t>& r) {
-                    size_t num_indices_local = 0;
                     for (size_t i = r.begin(); i != r.end(); ++i) {
-                        size_t neighbors_count = 0;
-
                         Vec3_t pos(queries + i * 3);
 
-                        std::set<size_t> bins_to_visit;
+                        size_t bins_to_visit[9];
+                        const int num_bins = ComputeBinsToVisit(
+                                pos, radius, inv_voxel_size, hash_table_size,
+                                first_cell_idx, bins_to_visit);
 
-                        auto voxel_index =
-                                ComputeVoxelIndex(pos, inv_voxel_size);
-                        size_t hash =
-                                SpatialHash(voxel_index) % hash_table_size;
+                        int64_t neighbors_count = 0;
+                        ForEachNeighbor<METRIC, IGNORE_QUERY_POINT>(
+                                pos, points, bins_to_visit, num_bins,
+                                hash_table_cell_splits, hash_table_index,
+                                threshold,
+                                [&](uint32_t, T) { ++neighbors_count; });
 
-                        bins_to_visit.insert(first_cell_idx + hash);
-
-                        for (int dz = -1; dz <= 1; dz += 2)
-                            for (int dy = -1; dy <= 1; dy += 2)
-                                for (int dx = -1; dx <= 1; dx += 2) {
-                                    Vec3_t p =
-                                            pos + radius * Vec3_t(T(dx), T(dy),
-                                                                  T(dz));
-                                    voxel_index = ComputeVoxelIndex(
-                                            p, inv_voxel_size);
-                                    hash = SpatialHash(voxel_index) %
-                                           hash_table_size;
-                                    bins_to_visit.insert(first_cell_idx + hash);
-                                }
-
-                        Poslist_t xyz;
-                        int vec_i = 0;
-
-                        for (size_t bin : bins_to_visit) {
-                            size_t begin_idx = hash_table_cell_splits[bin];
-                            size_t end_idx = hash_table_cell_splits[bin + 1];
-
-                            for (size_t j = begin_idx; j < end_idx; ++j) {
-                                uint32_t idx = hash_table_index[j];
-                                if (IGNORE_QUERY_POINT) {
-                                    if (points[idx * 3 + 0] == pos[0] &&
-                                        points[idx * 3 + 1] == pos[1] &&
-                                        points[idx * 3 + 2] == pos[2])
-                                        continue;
-                                }
-                                xyz(vec_i, 0) = points[idx * 3 + 0];
-                                xyz(vec_i, 1) = points[idx * 3 + 1];
-                                xyz(vec_i, 2) = points[idx * 3 + 2];
-                                ++vec_i;
-                                if (VECSIZE == vec_i) {
-                                    Pos_t pos_arr(pos[0], pos[1], pos[2]);
-                                    Vec_t dist = NeighborsDist<METRIC, Pos_t,
-                                                               VECSIZE>(pos_arr,
-                                                                        xyz);
-                                    Result_t test_result = dist <= threshold;
-                                    neighbors_count += test_result.count();
-                                    vec_i = 0;
-                                }
-                            }
-                        }
-                        // process the tail
-                        if (vec_i) {
-                            Pos_t pos_arr(pos[0], pos[1], pos[2]);
-                            Vec_t dist = NeighborsDist<METRIC, Pos_t, VECSIZE>(
-                                    pos_arr, xyz);
-                            Result_t test_result = dist <= threshold;
-                            for (int k = 0; k < vec_i; ++k) {
-                                neighbors_count += int(test_result(k));
-                            }
-                            vec_i = 0;
-                        }
-                        num_indices_local += neighbors_count;
                         // note the +1
                         query_neighbors_row_splits[i + 1] = neighbors_count;
                     }
-
-                    core::AtomicFetchAddRelaxed((uint64_t*)&num_indices,
-                                                num_indices_local);
                 });
     }
 
+    query_neighbors_row_splits[0] = 0;
+    InclusivePrefixSum(query_neighbors_row_splits + 1,
+                       query_neighbors_row_splits + num_queries + 1,
+                       query_neighbors_row_splits + 1);
+
+    // the number of all neighbors we find
+    const size_t num_indices = query_neighbors_row_splits[num_queries];
+
     // Allocate output arrays
     // output for the indices to the neighbors
     TIndex* indices_ptr;
@@ -351,11 +423,6 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
     else
         output_allocator.AllocDistances(&distances_ptr, 0);
 
-    query_neighbors_row_splits[0] = 0;
-    InclusivePrefixSum(query_neighbors_row_splits + 1,
-                       query_neighbors_row_splits + num_queries + 1,
-                       query_neighbors_row_splits + 1);
-
     // now populate the indices_ptr and distances_ptr array
     for (int i = 0; i < batch_size; ++i) {
         const size_t hash_table_size =
@@ -365,105 +432,136 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
                 tbb::blocked_range<size_t>(queries_row_splits[i],
                                            queries_row_splits[i + 1]),
                 [&](const tbb::blocked_range<size_t>& r) {
+                    std::vector<std::pair<T, TIndex>> neighbors;
                     for (size_t i = r.begin(); i != r.end(); ++i) {
-                        size_t neighbors_count = 0;
+                        Vec3_t pos(queries + i * 3);
 
-                        size_t indices_offset = query_neighbors_row_splits[i];
+                        size_t bins_to_visit[9];
+                        const int num_bins = ComputeBinsToVisit(
+                                pos, radius, inv_voxel_size, hash_table_size,
+                                first_cell_idx, bins_to_visit);
+
+                        const size_t indices_offset =
+                                query_neighbors_row_splits[i];
+
+                        if (!sort) {
+                            size_t neighbors_count = 0;
+                            ForEachNeighbor<METRIC, IGNORE_QUERY_POINT>(
+                                    pos, points, bins_to_visit, num_bins,
+                                    hash_table_cell_splits, hash_table_index,
+                                    threshold, [&](uint32_t idx, T dist) {
+                                        const size_t k =
+                                                indices_offset +
+                                                neighbors_count++;
+                                        indices_ptr[k] = idx;
+                                        if (RETURN_DISTANCES) {
+                                            distances_ptr[k] = dist;
+                                        }
+                                    });
+                            continue;
+                        }
 
-                        Vec3_t pos(queries[i * 3 + 0], queries[i * 3 + 1],
-                                   queries[i * 3 + 2]);
+                        // sort the neighbors by distance
+                        neighbors.clear();
+                        ForEachNeighbor<METRIC, IGNORE_QUERY_POINT>(
+                                pos, points, bins_to_visit, num_bins,
+                                hash_table_cell_splits, hash_table_index,
+                                threshold, [&](uint32_t idx, T dist) {
+                                    neighbors.emplace_back(dist, idx);
+                                });
+                        std::sort(neighbors.begin(), neighbors.end());
+                        for (size_t k = 0; k < neighbors.size(); ++k) {
+                            indices_ptr[indices_offset + k] =
+                                    neighbors[k].second;
+                            if (RETURN_DISTANCES) {
+                                distances_ptr[indices_offset + k] =
+                                        neighbors[k].first;
+                            }
+                        }
+                    }
+                });
+    }
+}
 
-                        std::set<size_t> bins_to_visit;
+/// Implementation of HybridSearchCPU with template params for metrics.
+///
+/// The neighbors of each query point are written directly to the slots
+/// [max_knn * query_idx, max_knn * (query_idx + 1)) of the output arrays,
+/// which must be allocated by the caller. Only the \p max_knn nearest
+/// neighbors are kept, sorted by distance.
+template <class T, class TIndex, int METRIC>
+void _HybridSearchCPU(const T* const points,
+                      const T* const queries,
+                      const T radius,
+                      const int max_knn,
+                      const size_t points_row_splits_size,
+                      const int64_t* const queries_row_splits,
+                      const uint32_t* const hash_table_splits,
+                      const uint32_t* const hash_table_cell_splits,
+                      const uint32_t* const hash_table_index,
+                      TIndex* const indices_ptr,
+                      T* const distances_ptr,
+                      TIndex* const counts_ptr) {
+    using namespace open3d::utility;
+    typedef MiniVec<T, 3> Vec3_t;
 
-                        auto voxel_index =
-                                ComputeVoxelIndex(pos, inv_voxel_size);
-                        size_t hash =
-                                SpatialHash(voxel_index) % hash_table_size;
+    const int batch_size = points_row_splits_size - 1;
 
-                        bins_to_visit.insert(first_cell_idx + hash);
-
-                        for (int dz = -1; dz <= 1; dz += 2)
-                            for (int dy = -1; dy <= 1; dy += 2)
-                                for (int dx = -1; dx <= 1; dx += 2) {
-                                    Vec3_t p =
-                                            pos + radius * Vec3_t(T(dx), T(dy),
-                                                                  T(dz));
-                                    voxel_index = ComputeVoxelIndex(
-                                            p, inv_voxel_size);
-                                    hash = SpatialHash(voxel_index) %
-                                           hash_table_size;
-                                    bins_to_visit.insert(first_cell_idx + hash);
-                                }
-
-                        Poslist_t xyz;
-                        Veci_t idx_vec;
-                        int vec_i = 0;
-
-                        for (size_t bin : bins_to_visit) {
-                            size_t begin_idx = hash_table_cell_splits[bin];
-                            size_t end_idx = hash_table_cell_splits[bin + 1];
-
-                            for (size_t j = begin_idx; j < end_idx; ++j) {
-                                int64_t idx = hash_table_index[j];
-                                if (IGNORE_QUERY_POINT) {
-                                    if (points[idx * 3 + 0] == pos[0] &&
-                                        points[idx * 3 + 1] == pos[1] &&
-                                        points[idx * 3 + 2] == pos[2])
-                                        continue;
-                                }
-                                xyz(vec_i, 0) = points[idx * 3 + 0];
-                                xyz(vec_i, 1) = points[idx * 3 + 1];
-                                xyz(vec_i, 2) = points[idx * 3 + 2];
-                                idx_vec(vec_i) = idx;
-                                ++vec_i;
-                                if (VECSIZE == vec_i) {
-                                    Pos_t pos_arr(pos[0], pos[1], pos[2]);
-                                    Vec_t dist = NeighborsDist<METRIC, Pos_t,
-                                                               VECSIZE>(pos_arr,
-                                                                        xyz);
-                                    Result_t test_result = dist <= threshold;
-                                    for (int k = 0; k < vec_i; ++k) {
-                                        if (test_result(k)) {
-                                            indices_ptr[indices_offset +
-                                                        neighbors_count] =
-                                                    idx_vec[k];
-                                            if (RETURN_DISTANCES) {
-                                                distances_ptr[indices_offset +
-                                                              neighbors_count] =
-                                                        dist[k];
-                                            }
-                                        }
-                                        neighbors_count += int(test_result(k));
+    // use squared radius for L2 to avoid sqrt
+    const T threshold = (METRIC == L2 ? radius * radius : radius);
+
+    const T voxel_size = 2 * radius;
+    const T inv_voxel_size = 1 / voxel_size;
+
+    for (int i = 0; i < batch_size; ++i) {
+        const size_t hash_table_size =
+                hash_table_splits[i + 1] - hash_table_splits[i];
+        const size_t first_cell_idx = hash_table_splits[i];
+        tbb::parallel_for(
+                tbb::blocked_range<size_t>(queries_row_splits[i],
+                                           queries_row_splits[i + 1]),
+                [&](const tbb::blocked_range<size_t>& r) {
+                    for (size_t i = r.begin(); i != r.end(); ++i) {
+                        Vec3_t pos(queries + i * 3);
+
+                        size_t bins_to_visit[9];
+                        const int num_bins = ComputeBinsToVisit(
+                                pos, radius, inv_voxel_size, hash_table_size,
+                                first_cell_idx, bins_to_visit);
+
+                        TIndex* const indices = indices_ptr + max_knn * i;
+                        T* const distances = distances_ptr + max_knn * i;
+                        int count = 0;
+
+                        // insertion sort into the list of the nearest
+                        // neighbors found so far
+                        ForEachNeighbor<METRIC, false>(
+                                pos, points, bins_to_visit, num_bins,
+                                hash_table_cell_splits, hash_table_index,
+                                threshold, [&](uint32_t idx, T dist) {
+                                    int k;
+                                    if (count < max_knn) {
+                                        k = count++;
+                                    } else if (dist < distances[count - 1]) {
+                                        k = count - 1;
+                                    } else {
+                                        return;
                                     }
-                                    vec_i = 0;
-                                }
-                            }
-                        }
-                        // process the tail
-                        if (vec_i) {
-                            Pos_t pos_arr(pos[0], pos[1], pos[2]);
-                            Vec_t dist = NeighborsDist<METRIC, Pos_t, VECSIZE>(
-                                    pos_arr, xyz);
-                            Result_t test_result = dist <= threshold;
-                            for (int k = 0; k < vec_i; ++k) {
-                                if (test_result(k)) {
-                                    indices_ptr[indices_offset +
-                                                neighbors_count] = idx_vec[k];
-                                    if (RETURN_DISTANCES) {
-                                        distances_ptr[indices_offset +
-                                                      neighbors_count] =
-                                                dist[k];
+                                    for (; k > 0 && distances[k - 1] > dist;
+                                         --k) {
+                                        indices[k] = indices[k - 1];
+                                        distances[k] = distances[k - 1];
                                     }
-                                }
-                                neighbors_count += int(test_result(k));
-                            }
-                            vec_i = 0;
-                        }
+                                    indices[k] = idx;
+                                    distances[k] = dist;
+                                });
+
+                        counts_ptr[i] = count;
                     }
                 });
     }
-#undef VECSIZE
 }
+#undef VECSIZE
 
 }  // namespace
 
@@ -545,6 +643,9 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
 ///         elements. Both functions must accept the argument size==0.
 ///         In this case ptr does not need to be set.
 ///
+/// \param sort    If true then the neighbors of each query point are sorted by
+///        their distance to the query point.
+///
 template <class T, class TIndex, class OUTPUT_ALLOCATOR>
 void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
                           const size_t num_points,
@@ -563,7 +664,8 @@ void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
                           const Metric metric,
                           const bool ignore_query_point,
                           const bool return_distances,
-                          OUTPUT_ALLOCATOR& output_allocator) {
+                          OUTPUT_ALLOCATOR& output_allocator,
+                          const bool sort = false) {
     // Dispatch all template parameter combinations
 
 #define FN_PARAMETERS                                                       \
@@ -571,7 +673,7 @@ void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
             radius, points_row_splits_size, points_row_splits,              \
             queries_row_splits_size, queries_row_splits, hash_table_splits, \
             hash_table_cell_splits_size, hash_table_cell_splits,            \
-            hash_table_index, output_allocator
+            hash_table_index, sort, output_allocator
 
 #define CALL_TEMPLATE(METRIC, IGNORE_QUERY_POINT, RETURN_DISTANCES)     \
     if (METRIC == metric && IGNORE_QUERY_POINT == ignore_query_point && \
@@ -599,6 +701,121 @@ void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
 #undef FN_PARAMETERS
 }
 
+/// Hybrid search. This function computes the \p max_knn nearest neighbors
+/// within \p radius for each query point. The output arrays have a fixed
+/// size of \p num_queries * \p max_knn and are written in a single pass
+/// without counting the neighbors first. Unused slots are filled with index
+/// -1 and distance 0.
+///
+/// \param num_points    The number of points.
+///
+/// \param points    Array with the 3D point positions. This must be the array
+///        that was used for building the spatial hash table.
+///
+/// \param num_queries    The number of query points.
+///
+/// \param queries    Array with the 3D query positions. This may be the same
+///                   array as \p points.
+///
+/// \param radius    The search radius.
+///
+/// \param max_knn    The maximum number of neighbors per query point.
+///
+/// \param points_row_splits_size    The size of the points_row_splits array.
+///        The size of the array is batch_size+1.
+///
+/// \param points_row_splits    Defines the start and end of the points in each
+///        batch item. The size of the array is batch_size+1. If there is
+///        only 1 batch item then this array is [0, num_points]
+///
+/// \param queries_row_splits_size    The size of the queries_row_splits array.
+///        The size of the array is batch_size+1.
+///
+/// \param queries_row_splits    Defines the start and end of the queries in
+///        each batch item. The size of the array is batch_size+1. If there is
+///        only 1 batch item then this array is [0, num_queries]
+///
+/// \param hash_table_splits    Array defining the start and end the hash table
+///        for each batch item.
+///
+/// \param hash_table_cell_splits_size    This is the length of the
+///        hash_table_cell_splits array.
+///
+/// \param hash_table_cell_splits    This is an output of the function
+///        BuildSpatialHashTableCPU.
+///
+/// \param hash_table_index    This is an output of the function
+///        BuildSpatialHashTableCPU.
+///
+/// \param metric    One of L1, L2, Linf. Defines the distance metric for the
+///        search. Note that for the L2 metric the squared distances will be
+///        returned.
+///
+/// \param output_allocator    An object that implements functions for
+///         allocating the output arrays. The object must implement functions
+///         AllocIndices(TIndex** ptr, size_t size, TIndex value),
+///         AllocDistances(T** ptr, size_t size, T value) and
+///         AllocCounts(TIndex** ptr, size_t size, TIndex value), which
+///         allocate arrays filled with value.
+///
+template <class T, class TIndex, class OUTPUT_ALLOCATOR>
+void HybridSearchCPU(const size_t num_points,
+                     const T* const points,
+                     const size_t num_queries,
+                     const T* const queries,
+                     const T radius,
+                     const int max_knn,
+                     const size_t points_row_splits_size,
+                     const int64_t* const points_row_splits,
+                     const size_t queries_row_splits_size,
+                     const int64_t* const queries_row_splits,
+                     const uint32_t* const hash_table_splits,
+                     const size_t hash_table_cell_splits_size,
+                     const uint32_t* const hash_table_cell_splits,
+                     const uint32_t* const hash_table_index,
+                     const Metric metric,
+                     OUTPUT_ALLOCATOR& output_allocator) {
+    // return empty output arrays if there are no points
+    if (0 == num_points || 0 == num_queries || max_knn <= 0) {
+        TIndex* indices_ptr;
+        output_allocator.AllocIndices(&indices_ptr, 0);
+
+        T* distances_ptr;
+        output_allocator.AllocDistances(&distances_ptr, 0);
+
+        TIndex* counts_ptr;
+        output_allocator.AllocCounts(&counts_ptr, num_queries, 0);
+        return;
+    }
+
+    // Allocate output pointers.
+    const size_t num_indices = num_queries * max_knn;
+
+    TIndex* indices_ptr;
+    output_allocator.AllocIndices(&indices_ptr, num_indices, -1);
+
+    T* distances_ptr;
+    output_allocator.AllocDistances(&distances_ptr, num_indices, 0);
+
+    TIndex* counts_ptr;
+    output_allocator.AllocCounts(&counts_ptr, num_queries, 0);
+
+#define FN_PARAMETERS                                                      \
+    points, queries, radius, max_knn, points_row_splits_size,              \
+            queries_row_splits, hash_table_splits, hash_table_cell_splits, \
+            hash_table_index, indices_ptr, distances_ptr, counts_ptr
+
+#define CALL_TEMPLATE(METRIC) \
+    if (METRIC == metric) _HybridSearchCPU<T, TIndex, METRIC>(FN_PARAMETERS);
+
+    CALL_TEMPLATE(L1)
+    CALL_TEMPLATE(L2)
+    CALL_TEMPLATE(Linf)
+
+#undef CALL_TEMPLATE
+#undef FN_PARAMETERS
+}
+
 }  // namespace impl
 }  // namespace nns
 }  // namespace core
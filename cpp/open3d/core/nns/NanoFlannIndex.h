@@ -122,6 +122,12 @@ public:
                                                     double radius,
                                                     int max_knn) const override;
 
+    /// Get the underlying NanoFlann index holder, for kernels that perform
+    /// per-point queries without materializing search results. The holder is
+    /// a NanoFlannIndexHolder<L2, scalar_t, int_t>, where scalar_t and int_t
+    /// correspond to GetDtype() and GetIndexDtype().
+    NanoFlannIndexHolderBase *GetIndexHolder() const { return holder_.get(); }
+
 protected:
     // Tensor dataset_points_;
     std::unique_ptr<NanoFlannIndexHolderBase> holder_;
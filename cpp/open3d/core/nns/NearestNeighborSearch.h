@@ -132,6 +132,13 @@ public:
                                                     const double radius,
                                                     const int max_knn) const;
 
+    /// Get the NanoFlann index used for knn, radius and hybrid search on CPU.
+    ///
+    /// \return Pointer to the index, or nullptr if no CPU index has been set.
+    const NanoFlannIndex *GetNanoFlannIndex() const {
+        return nanoflann_index_.get();
+    }
+
 private:
     bool SetIndex();
 
@@ -31,16 +31,124 @@
 
 #include "open3d/geometry/KDTreeFlann.h"
 
+#include <algorithm>
 #include <nanoflann.hpp>
+#include <numeric>
 
 #include "open3d/geometry/HalfEdgeTriangleMesh.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/MortonCode.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Number of consecutive queries processed by one task in batched searches.
+constexpr int64_t kQueryChunkSize = 256;
+
+/// Scratch buffers of a thread for the batched searches.
+struct SearchBuffer {
+    std::vector<Eigen::Index> indices;
+    std::vector<double> distance2;
+    std::vector<std::pair<Eigen::Index, double>> indices_dists;
+};
+
+/// Returns the order in which batched queries are processed. Three dimensional
+/// queries are sorted by Morton code, so that consecutive queries traverse
+/// mostly the same tree nodes.
+std::vector<int64_t> ComputeQueryOrder(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries) {
+    const int64_t num_queries = queries.cols();
+    std::vector<int64_t> order(num_queries);
+    std::iota(order.begin(), order.end(), 0);
+    if (queries.rows() != 3 || num_queries <= kQueryChunkSize) {
+        return order;
+    }
+
+    const Eigen::Vector3d min_bound = queries.rowwise().minCoeff();
+    const Eigen::Vector3d max_bound = queries.rowwise().maxCoeff();
+    const double inv_cell_size =
+            utility::MortonInvCellSize(min_bound.data(), max_bound.data());
+
+    std::vector<uint64_t> codes(num_queries);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_queries; ++i) {
+        codes[i] = utility::MortonCode3D(queries.col(i).data(),
+                                         min_bound.data(), inv_cell_size);
+    }
+    std::sort(order.begin(), order.end(), [&codes](int64_t a, int64_t b) {
+        return codes[a] < codes[b];
+    });
+    return order;
+}
+
+/// Runs \p search for every column of \p queries in parallel and packs the
+/// results in CSR format. \p search appends the neighbors of one query to
+/// its output vectors and returns their number.
+template <typename SearchFunc>
+int64_t BatchSearch(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                    SearchFunc search,
+                    std::vector<int> &indices,
+                    std::vector<double> &distance2,
+                    std::vector<int64_t> &row_splits) {
+    const int64_t num_queries = queries.cols();
+    const int64_t num_chunks =
+            (num_queries + kQueryChunkSize - 1) / kQueryChunkSize;
+    const std::vector<int64_t> order = ComputeQueryOrder(queries);
+
+    // Results are first gathered per chunk, in processing order.
+    std::vector<std::vector<int>> chunk_indices(num_chunks);
+    std::vector<std::vector<double>> chunk_distance2(num_chunks);
+    row_splits.resize(num_queries + 1);
+    row_splits[0] = 0;
+
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        SearchBuffer buffer;
+#pragma omp for schedule(dynamic)
+        for (int64_t c = 0; c < num_chunks; ++c) {
+            const int64_t end =
+                    std::min((c + 1) * kQueryChunkSize, num_queries);
+            for (int64_t j = c * kQueryChunkSize; j < end; ++j) {
+                const int64_t q = order[j];
+                row_splits[q + 1] = search(queries.col(q).data(), buffer,
+                                           chunk_indices[c],
+                                           chunk_distance2[c]);
+            }
+        }
+    }
+
+    std::partial_sum(row_splits.begin() + 1, row_splits.end(),
+                     row_splits.begin() + 1);
+    const int64_t num_neighbors = row_splits[num_queries];
+    indices.resize(num_neighbors);
+    distance2.resize(num_neighbors);
+
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        const int64_t end = std::min((c + 1) * kQueryChunkSize, num_queries);
+        int64_t offset = 0;
+        for (int64_t j = c * kQueryChunkSize; j < end; ++j) {
+            const int64_t q = order[j];
+            const int64_t count = row_splits[q + 1] - row_splits[q];
+            std::copy_n(chunk_indices[c].begin() + offset, count,
+                        indices.begin() + row_splits[q]);
+            std::copy_n(chunk_distance2[c].begin() + offset, count,
+                        distance2.begin() + row_splits[q]);
+            offset += count;
+        }
+    }
+    return num_neighbors;
+}
+
+}  // namespace
+
 KDTreeFlann::KDTreeFlann() {}
 
 KDTreeFlann::KDTreeFlann(const Eigen::MatrixXd &data) { SetMatrixData(data); }
@@ -201,6 +309,132 @@ bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
     return true;
 }
 
+int64_t KDTreeFlann::Search(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                            const KDTreeSearchParam &param,
+                            std::vector<int> &indices,
+                            std::vector<double> &distance2,
+                            std::vector<int64_t> &row_splits) const {
+    switch (param.GetSearchType()) {
+        case KDTreeSearchParam::SearchType::Knn:
+            return SearchKNN(queries,
+                             ((const KDTreeSearchParamKNN &)param).knn_,
+                             indices, distance2, row_splits);
+        case KDTreeSearchParam::SearchType::Radius:
+            return SearchRadius(
+                    queries, ((const KDTreeSearchParamRadius &)param).radius_,
+                    indices, distance2, row_splits);
+        case KDTreeSearchParam::SearchType::Hybrid:
+            return SearchHybrid(
+                    queries, ((const KDTreeSearchParamHybrid &)param).radius_,
+                    ((const KDTreeSearchParamHybrid &)param).max_nn_, indices,
+                    distance2, row_splits);
+        default:
+            return -1;
+    }
+    return -1;
+}
+
+int64_t KDTreeFlann::SearchKNN(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                               int knn,
+                               std::vector<int> &indices,
+                               std::vector<double> &distance2,
+                               std::vector<int64_t> &row_splits) const {
+    if (data_.empty() || dataset_size_ <= 0 ||
+        size_t(queries.rows()) != dimension_ || knn < 0) {
+        return -1;
+    }
+    // Every query has exactly min(knn, dataset_size_) neighbors, so the
+    // results are written to their final location directly.
+    const int64_t num_queries = queries.cols();
+    const int64_t k = std::min(static_cast<int64_t>(knn),
+                               static_cast<int64_t>(dataset_size_));
+    const std::vector<int64_t> order = ComputeQueryOrder(queries);
+    indices.resize(num_queries * k);
+    distance2.resize(num_queries * k);
+    row_splits.resize(num_queries + 1);
+
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        std::vector<Eigen::Index> indices_eigen(k);
+#pragma omp for schedule(static)
+        for (int64_t j = 0; j < num_queries; ++j) {
+            const int64_t q = order[j];
+            nanoflann_index_->index->knnSearch(queries.col(q).data(), k,
+                                               indices_eigen.data(),
+                                               distance2.data() + q * k);
+            std::copy_n(indices_eigen.begin(), k, indices.begin() + q * k);
+            row_splits[q + 1] = (q + 1) * k;
+        }
+    }
+    row_splits[0] = 0;
+    return num_queries * k;
+}
+
+int64_t KDTreeFlann::SearchRadius(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        double radius,
+        std::vector<int> &indices,
+        std::vector<double> &distance2,
+        std::vector<int64_t> &row_splits) const {
+    if (data_.empty() || dataset_size_ <= 0 ||
+        size_t(queries.rows()) != dimension_) {
+        return -1;
+    }
+    const double radius2 = radius * radius;
+    return BatchSearch(
+            queries,
+            [this, radius2](const double *query, SearchBuffer &buffer,
+                            std::vector<int> &out_indices,
+                            std::vector<double> &out_distance2) {
+                const int64_t k = nanoflann_index_->index->radiusSearch(
+                        query, radius2, buffer.indices_dists,
+                        nanoflann::SearchParams(-1, 0.0));
+                for (int64_t i = 0; i < k; ++i) {
+                    out_indices.push_back(buffer.indices_dists[i].first);
+                    out_distance2.push_back(buffer.indices_dists[i].second);
+                }
+                return k;
+            },
+            indices, distance2, row_splits);
+}
+
+int64_t KDTreeFlann::SearchHybrid(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        double radius,
+        int max_nn,
+        std::vector<int> &indices,
+        std::vector<double> &distance2,
+        std::vector<int64_t> &row_splits) const {
+    if (data_.empty() || dataset_size_ <= 0 ||
+        size_t(queries.rows()) != dimension_ || max_nn < 0) {
+        return -1;
+    }
+    const double radius2 = radius * radius;
+    return BatchSearch(
+            queries,
+            [this, radius2, max_nn](const double *query, SearchBuffer &buffer,
+                                    std::vector<int> &out_indices,
+                                    std::vector<double> &out_distance2) {
+                buffer.indices.resize(max_nn);
+                buffer.distance2.resize(max_nn);
+                int64_t k = nanoflann_index_->index->knnSearch(
+                        query, max_nn, buffer.indices.data(),
+                        buffer.distance2.data());
+                k = std::distance(
+                        buffer.distance2.begin(),
+                        std::lower_bound(buffer.distance2.begin(),
+                                         buffer.distance2.begin() + k,
+                                         radius2));
+                out_indices.insert(out_indices.end(), buffer.indices.begin(),
+                                   buffer.indices.begin() + k);
+                out_distance2.insert(out_distance2.end(),
+                                     buffer.distance2.begin(),
+                                     buffer.distance2.begin() + k);
+                return k;
+            },
+            indices, distance2, row_splits);
+}
+
 template int KDTreeFlann::Search<Eigen::Vector3d>(
         const Eigen::Vector3d &query,
         const KDTreeSearchParam &param,
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -108,6 +109,55 @@ public:
                      std::vector<int> &indices,
                      std::vector<double> &distance2) const;
 
+    /// \brief Batched search for all columns of \p queries.
+    ///
+    /// Dispatches to the batched SearchKNN, SearchRadius or SearchHybrid
+    /// according to \p param.
+    int64_t Search(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                   const KDTreeSearchParam &param,
+                   std::vector<int> &indices,
+                   std::vector<double> &distance2,
+                   std::vector<int64_t> &row_splits) const;
+
+    /// \brief Batched k-nearest neighbor search.
+    ///
+    /// All columns of \p queries are searched in parallel. Three dimensional
+    /// queries are processed in Morton order for cache locality. The results
+    /// are packed in CSR format: the neighbors of query i are stored in
+    /// [row_splits[i], row_splits[i + 1]) of \p indices and \p distance2,
+    /// sorted by distance. The output vectors keep their capacity, so they can
+    /// be reused across calls without reallocation.
+    ///
+    /// \param queries Query points, one point per column.
+    /// \param knn Number of neighbors per query.
+    /// \param indices [output] Neighbor indices of all queries.
+    /// \param distance2 [output] Squared distances of all neighbors.
+    /// \param row_splits [output] Offsets of the neighbors of each query, of
+    /// size queries.cols() + 1.
+    /// \return Total number of neighbors, or -1 if the search failed.
+    int64_t SearchKNN(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                      int knn,
+                      std::vector<int> &indices,
+                      std::vector<double> &distance2,
+                      std::vector<int64_t> &row_splits) const;
+
+    /// \brief Batched radius search. See the batched SearchKNN for the layout
+    /// of the results.
+    int64_t SearchRadius(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                         double radius,
+                         std::vector<int> &indices,
+                         std::vector<double> &distance2,
+                         std::vector<int64_t> &row_splits) const;
+
+    /// \brief Batched hybrid search. See the batched SearchKNN for the layout
+    /// of the results.
+    int64_t SearchHybrid(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                         double radius,
+                         int max_nn,
+                         std::vector<int> &indices,
+                         std::vector<double> &distance2,
+                         std::vector<int64_t> &row_splits) const;
+
 private:
     /// \brief Sets the KDTree data from the data provided by the other methods.
     ///
@@ -29,6 +29,7 @@
 #include <Eigen/Dense>
 #include <algorithm>
 #include <numeric>
+#include <utility>
 
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/KDTreeFlann.h"
@@ -36,6 +37,7 @@
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Eigen.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/MortonCode.h"
 #include "open3d/utility/Parallel.h"
 #include "open3d/utility/ProgressBar.h"
 #include "open3d/utility/Random.h"
@@ -138,21 +140,27 @@ PointCloud PointCloud::operator+(const PointCloud &cloud) const {
 
 std::vector<double> PointCloud::ComputePointCloudDistance(
         const PointCloud &target) {
-    std::vector<double> distances(points_.size());
+    std::vector<double> distances(points_.size(), 0.0);
     KDTreeFlann kdtree;
     kdtree.SetGeometry(target);
+    std::vector<int> indices;
+    std::vector<double> dists;
+    std::vector<int64_t> row_splits;
+    if (kdtree.SearchKNN(Eigen::Map<const Eigen::MatrixXd>(
+                                 (const double *)points_.data(), 3,
+                                 points_.size()),
+                         1, indices, dists, row_splits) < 0) {
+        return distances;
+    }
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < (int)points_.size(); i++) {
-        std::vector<int> indices(1);
-        std::vector<double> dists(1);
-        if (kdtree.SearchKNN(points_[i], 1, indices, dists) == 0) {
+        if (row_splits[i + 1] == row_splits[i]) {
             utility::LogDebug(
                     "[ComputePointCloudToPointCloudDistance] Found a point "
                     "without neighbors.");
-            distances[i] = 0.0;
         } else {
-            distances[i] = std::sqrt(dists[0]);
+            distances[i] = std::sqrt(dists[row_splits[i]]);
         }
     }
     return distances;
@@ -216,6 +224,56 @@ std::shared_ptr<PointCloud> PointCloud::SelectByIndex(
     return output;
 }
 
+template <typename T, typename Alloc>
+static void ReorderByPermutation(std::vector<T, Alloc> &attribute,
+                                 const std::vector<size_t> &permutation) {
+    const int64_t num_points = static_cast<int64_t>(permutation.size());
+    std::vector<T, Alloc> reordered(num_points);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_points; i++) {
+        reordered[i] = attribute[permutation[i]];
+    }
+    attribute.swap(reordered);
+}
+
+std::vector<size_t> PointCloud::SortByMortonCode() {
+    const int64_t num_points = static_cast<int64_t>(points_.size());
+    if (num_points == 0) {
+        return std::vector<size_t>();
+    }
+
+    const Eigen::Vector3d min_bound = GetMinBound();
+    const Eigen::Vector3d max_bound = GetMaxBound();
+    const double inv_cell_size =
+            utility::MortonInvCellSize(min_bound.data(), max_bound.data());
+
+    std::vector<std::pair<uint64_t, size_t>> codes_indices(num_points);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_points; i++) {
+        codes_indices[i].first = utility::MortonCode3D(
+                points_[i].data(), min_bound.data(), inv_cell_size);
+        codes_indices[i].second = static_cast<size_t>(i);
+    }
+    std::sort(codes_indices.begin(), codes_indices.end());
+
+    std::vector<size_t> permutation(num_points);
+    for (int64_t i = 0; i < num_points; i++) {
+        permutation[i] = codes_indices[i].second;
+    }
+
+    const bool has_normals = HasNormals();
+    const bool has_colors = HasColors();
+    const bool has_covariances = HasCovariances();
+    ReorderByPermutation(points_, permutation);
+    if (has_normals) ReorderByPermutation(normals_, permutation);
+    if (has_colors) ReorderByPermutation(colors_, permutation);
+    if (has_covariances) ReorderByPermutation(covariances_, permutation);
+
+    return permutation;
+}
+
 // helper classes for VoxelDownSample and VoxelDownSampleAndTrace
 namespace {
 class AccumulatedPoint {
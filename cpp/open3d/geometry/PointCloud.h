@@ -137,6 +137,17 @@ public:
     std::shared_ptr<PointCloud> SelectByIndex(
             const std::vector<size_t> &indices, bool invert = false) const;
 
+    /// \brief Reorders the points along a 3D Morton (Z-order) curve.
+    ///
+    /// Points are quantized to a 2^21 grid per axis spanning their bounding
+    /// box and sorted by their 63-bit Morton codes. Normals, colors and
+    /// covariances are reordered accordingly, so that points close in space
+    /// are also close in memory.
+    ///
+    /// \return The permutation, where element i is the index of the point
+    /// before sorting that is now at position i.
+    std::vector<size_t> SortByMortonCode();
+
     /// \brief Function to downsample input pointcloud into output pointcloud
     /// with a voxel.
     ///
@@ -0,0 +1,421 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/file_format/ASCIIRowsIO.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+inline bool IsSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+// Case-insensitive match of a lower case word at ptr.
+bool MatchWord(const char *ptr, const char *end, const char *word) {
+    for (; *word; ++ptr, ++word) {
+        if (ptr == end || (*ptr | 0x20) != *word) {
+            return false;
+        }
+    }
+    return true;
+}
+
+struct ChunkResult {
+    std::vector<double> values_;
+    int64_t num_rows_ = 0;
+    // Set if parsing stopped at an invalid line in strict mode.
+    bool failed_ = false;
+    std::string failed_line_;
+    // First line that was not parsed.
+    const char *stop_ = nullptr;
+};
+
+// Parse [begin, end), which only contains complete lines.
+void ParseChunk(const char *begin,
+                const char *end,
+                int num_fields,
+                int64_t max_rows,
+                bool strict,
+                ChunkResult &result) {
+    std::vector<double> row(num_fields);
+    const char *line = begin;
+    while (line < end && (max_rows < 0 || result.num_rows_ < max_rows)) {
+        const char *line_end =
+                static_cast<const char *>(std::memchr(line, '\n', end - line));
+        if (!line_end) {
+            line_end = end;
+        }
+
+        const char *ptr = line;
+        while (ptr < line_end && IsSpace(*ptr)) ++ptr;
+        if (ptr < line_end) {
+            int field = 0;
+            for (; field < num_fields; ++field) {
+                while (ptr < line_end && IsSpace(*ptr)) ++ptr;
+                if (!ParseDouble(ptr, line_end, row[field])) {
+                    break;
+                }
+            }
+            if (field == num_fields) {
+                result.values_.insert(result.values_.end(), row.begin(),
+                                      row.end());
+                ++result.num_rows_;
+            } else if (strict) {
+                result.failed_ = true;
+                result.failed_line_.assign(line, line_end);
+                result.stop_ = line;
+                return;
+            }
+        }
+        line = line_end + 1;
+    }
+    result.stop_ = std::min(line, end);
+}
+
+}  // unnamed namespace
+
+bool ParseDouble(const char *&ptr, const char *end, double &value) {
+    // Powers of ten that are exactly representable as double.
+    static const double kPow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                    1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                    1e18, 1e19, 1e20, 1e21, 1e22};
+    const char *p = ptr;
+    bool negative = false;
+    if (p < end && (*p == '+' || *p == '-')) {
+        negative = *p == '-';
+        ++p;
+    }
+
+    if (p < end && !IsDigit(*p) && *p != '.') {
+        if (MatchWord(p, end, "nan")) {
+            value = std::numeric_limits<double>::quiet_NaN();
+            p += 3;
+        } else if (MatchWord(p, end, "inf")) {
+            value = std::numeric_limits<double>::infinity();
+            p += MatchWord(p, end, "infinity") ? 8 : 3;
+        } else {
+            return false;
+        }
+        value = negative ? -value : value;
+        ptr = p;
+        return true;
+    }
+
+    uint64_t mantissa = 0;
+    int exponent = 0;
+    bool truncated = false;
+    auto add_digit = [&](char c) {
+        if (mantissa < 1000000000000000000ull) {
+            mantissa = mantissa * 10 + (c - '0');
+            return true;
+        }
+        truncated |= c != '0';
+        return false;
+    };
+    const char *digits_begin = p;
+    while (p < end && IsDigit(*p)) {
+        exponent += !add_digit(*p);
+        ++p;
+    }
+    bool has_digits = p > digits_begin;
+    if (p < end && *p == '.') {
+        ++p;
+        const char *fraction_begin = p;
+        while (p < end && IsDigit(*p)) {
+            exponent -= add_digit(*p);
+            ++p;
+        }
+        has_digits |= p > fraction_begin;
+    }
+    if (!has_digits) {
+        return false;
+    }
+
+    // The exponent is only consumed if it has digits, like strtod.
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char *q = p + 1;
+        bool negative_exponent = false;
+        if (q < end && (*q == '+' || *q == '-')) {
+            negative_exponent = *q == '-';
+            ++q;
+        }
+        if (q < end && IsDigit(*q)) {
+            int explicit_exponent = 0;
+            while (q < end && IsDigit(*q)) {
+                if (explicit_exponent < 100000) {
+                    explicit_exponent = explicit_exponent * 10 + (*q - '0');
+                }
+                ++q;
+            }
+            exponent += negative_exponent ? -explicit_exponent
+                                          : explicit_exponent;
+            p = q;
+        }
+    }
+
+    // Exact when both the mantissa and the power of ten are exact doubles.
+    if (!truncated && mantissa <= (uint64_t(1) << 53) && exponent >= -22 &&
+        exponent <= 22) {
+        value = exponent < 0 ? double(mantissa) / kPow10[-exponent]
+                             : double(mantissa) * kPow10[exponent];
+    } else if (mantissa == 0 && !truncated) {
+        value = 0;
+    } else {
+        std::istringstream stream(std::string(ptr, p));
+        stream.imbue(std::locale::classic());
+        stream >> value;
+        if (stream.fail()) {
+            return false;
+        }
+        negative = false;
+    }
+    value = negative ? -value : value;
+    ptr = p;
+    return true;
+}
+
+ASCIIRowsReader::ASCIIRowsReader(utility::filesystem::CFile &file,
+                                 int num_fields,
+                                 bool strict)
+    : file_(file),
+      num_fields_(num_fields),
+      strict_(strict),
+      buffer_pos_(file.CurPos()) {}
+
+bool ASCIIRowsReader::FillBuffer() {
+    const size_t kBlockSize = size_t(32) << 20;
+    if (eof_) {
+        // The last line has no line break.
+        end_ = buffer_.size();
+        return true;
+    }
+
+    // Keep the partial line, and append the next block.
+    buffer_.erase(buffer_.begin(), buffer_.begin() + end_);
+    buffer_pos_ += int64_t(end_);
+    begin_ = 0;
+    const size_t tail_size = buffer_.size();
+    buffer_.resize(tail_size + kBlockSize);
+    FILE *fp = file_.GetFILE();
+    const size_t num_read =
+            fread(buffer_.data() + tail_size, 1, kBlockSize, fp);
+    buffer_.resize(tail_size + num_read);
+    if (num_read < kBlockSize) {
+        if (ferror(fp)) {
+            utility::LogWarning("Read failed: {}", file_.GetError());
+            return false;
+        }
+        eof_ = true;
+        end_ = buffer_.size();
+    } else {
+        end_ = buffer_.size();
+        while (end_ > 0 && buffer_[end_ - 1] != '\n') --end_;
+    }
+    return true;
+}
+
+int64_t ASCIIRowsReader::Read(int64_t max_rows,
+                              std::vector<double> &values,
+                              utility::CountingProgressReporter *reporter) {
+    // Chunks are also the granularity of progress updates.
+    const int64_t kChunkSize = 1 << 16;
+    const int num_threads = utility::EstimateMaxThreads();
+    const size_t round_size = size_t(num_threads) * 4 * kChunkSize;
+
+    int64_t num_rows = 0;
+    while (max_rows < 0 || num_rows < max_rows) {
+        while (begin_ == end_) {
+            if (eof_ && end_ == buffer_.size()) {
+                return num_rows;
+            }
+            if (!FillBuffer()) {
+                return -1;
+            }
+        }
+
+        // With a row limit, only parse a bounded window ahead, sized by the
+        // line length seen so far.
+        const char *data = buffer_.data();
+        size_t round_end = end_;
+        size_t window = round_size;
+        if (max_rows >= 0 && row_size_ > 0) {
+            window = std::min(
+                    window,
+                    size_t(double(max_rows - num_rows) * row_size_ * 1.25) + 1);
+        }
+        if (max_rows >= 0 && end_ - begin_ > window) {
+            const char *line_end = static_cast<const char *>(
+                    std::memchr(data + begin_ + window, '\n',
+                                end_ - begin_ - window));
+            if (line_end) {
+                round_end = line_end + 1 - data;
+            }
+        }
+        const size_t size = round_end - begin_;
+        const int64_t num_chunks =
+                std::max(int64_t(num_threads) * 4,
+                         (int64_t(size) + kChunkSize - 1) / kChunkSize);
+        std::vector<size_t> bounds(num_chunks + 1, round_end);
+        bounds[0] = begin_;
+        for (int64_t c = 1; c < num_chunks; ++c) {
+            size_t pos =
+                    std::max(bounds[c - 1], begin_ + size * c / num_chunks);
+            while (pos > begin_ && pos < round_end && data[pos - 1] != '\n') {
+                ++pos;
+            }
+            bounds[c] = pos;
+        }
+
+        const size_t round_begin = begin_;
+        const int64_t round_rows = num_rows;
+        std::vector<ChunkResult> results(num_chunks);
+        const int64_t chunk_max_rows = max_rows < 0 ? -1 : max_rows - num_rows;
+        const int num_fields = num_fields_;
+        const bool strict = strict_;
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+        for (int64_t c = 0; c < num_chunks; ++c) {
+            ParseChunk(data + bounds[c], data + bounds[c + 1], num_fields,
+                       chunk_max_rows, strict, results[c]);
+        }
+
+        for (int64_t c = 0; c < num_chunks; ++c) {
+            const ChunkResult *result = &results[c];
+            ChunkResult truncated;
+            if (max_rows >= 0 && result->num_rows_ > max_rows - num_rows) {
+                // Find where the last needed row ends.
+                ParseChunk(data + bounds[c], data + bounds[c + 1], num_fields,
+                           max_rows - num_rows, strict, truncated);
+                result = &truncated;
+            }
+            values.insert(values.end(), result->values_.begin(),
+                          result->values_.end());
+            num_rows += result->num_rows_;
+            begin_ = result->stop_ - data;
+            if (result->failed_ && (max_rows < 0 || num_rows < max_rows)) {
+                utility::LogWarning("Unable to parse line: {}",
+                                    result->failed_line_);
+                return -1;
+            }
+            if (reporter) {
+                reporter->Update(buffer_pos_ + int64_t(begin_));
+            }
+            if (begin_ < bounds[c + 1]) {
+                break;
+            }
+        }
+        if (num_rows > round_rows) {
+            row_size_ = double(begin_ - round_begin) / (num_rows - round_rows);
+        }
+    }
+    return num_rows;
+}
+
+int64_t ReadASCIIRows(utility::filesystem::CFile &file,
+                      int num_fields,
+                      int64_t max_rows,
+                      bool strict,
+                      std::vector<double> &values,
+                      utility::CountingProgressReporter *reporter) {
+    values.clear();
+    ASCIIRowsReader reader(file, num_fields, strict);
+    return reader.Read(max_rows, values, reporter);
+}
+
+bool WriteASCIIRows(
+        utility::filesystem::CFile &file,
+        int64_t num_rows,
+        const std::function<int(int64_t, char *, size_t)> &format_row,
+        utility::CountingProgressReporter *reporter) {
+    // Chunks are also the granularity of progress updates.
+    const int64_t kChunkRows = 1000;
+    const int num_threads = utility::EstimateMaxThreads();
+    const int64_t num_chunks = int64_t(num_threads) * 4;
+    FILE *fp = file.GetFILE();
+
+    std::vector<std::string> texts(num_chunks);
+    for (int64_t batch_begin = 0; batch_begin < num_rows;
+         batch_begin += num_chunks * kChunkRows) {
+        std::atomic<bool> failed(false);
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+        for (int64_t c = 0; c < num_chunks; ++c) {
+            std::string &text = texts[c];
+            text.clear();
+            const int64_t begin = batch_begin + c * kChunkRows;
+            const int64_t end = std::min(begin + kChunkRows, num_rows);
+            std::vector<char> buffer(256);
+            for (int64_t i = begin; i < end; ++i) {
+                int length = format_row(i, buffer.data(), buffer.size());
+                if (length >= 0 && size_t(length) >= buffer.size()) {
+                    buffer.resize(length + 1);
+                    length = format_row(i, buffer.data(), buffer.size());
+                }
+                if (length < 0) {
+                    failed = true;
+                    break;
+                }
+                text.append(buffer.data(), length);
+            }
+        }
+        if (failed) {
+            return false;
+        }
+
+        for (int64_t c = 0; c < num_chunks; ++c) {
+            if (batch_begin + c * kChunkRows >= num_rows) {
+                break;
+            }
+            const std::string &text = texts[c];
+            if (fwrite(text.data(), 1, text.size(), fp) != text.size()) {
+                return false;
+            }
+            if (reporter) {
+                reporter->Update(std::min(
+                        batch_begin + (c + 1) * kChunkRows, num_rows));
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace open3d
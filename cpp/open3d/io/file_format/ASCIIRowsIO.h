@@ -0,0 +1,139 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace io {
+
+/// \brief Parse a floating point number in [ptr, end) independently of the
+/// locale.
+///
+/// Plain decimal numbers with up to 19 significant digits and small exponents
+/// are converted exactly with a fast path. Longer numbers fall back to a
+/// stream in the classic locale. "nan", "inf" and "infinity" are accepted in
+/// any case. On success, ptr is advanced past the number.
+bool ParseDouble(const char *&ptr, const char *end, double &value);
+
+/// \brief Read rows of numbers from the remaining lines of an ASCII file in
+/// parallel.
+///
+/// The file is read in large blocks, which are split at line boundaries into
+/// chunks parsed in parallel. The first num_fields whitespace-separated
+/// numbers of a line form a row, while the remaining tokens are ignored.
+/// Empty lines are skipped.
+///
+/// \param file File positioned at the first line to read.
+/// \param num_fields Number of values per row.
+/// \param max_rows Maximal number of rows to read, or -1 to read all rows.
+/// \param strict If true, reading fails at a line with less than num_fields
+/// numbers. Otherwise such lines are skipped.
+/// \param values Output row-major values.
+/// \param reporter If not null, updated with the file position of the parsed
+/// lines.
+/// \return Number of rows read, or -1 on failure.
+int64_t ReadASCIIRows(utility::filesystem::CFile &file,
+                      int num_fields,
+                      int64_t max_rows,
+                      bool strict,
+                      std::vector<double> &values,
+                      utility::CountingProgressReporter *reporter = nullptr);
+
+/// \class ASCIIRowsReader
+///
+/// \brief Resumable version of ReadASCIIRows(), reading the rows of a file in
+/// batches.
+///
+/// Only a bounded window of the file is buffered and parsed ahead of the
+/// requested rows, so files larger than the memory can be read batch by batch.
+class ASCIIRowsReader {
+public:
+    /// \param file File positioned at the first line to read. It must stay
+    /// open and must not be read by others while the reader is in use.
+    /// \param num_fields Number of values per row.
+    /// \param strict If true, reading fails at a line with less than
+    /// num_fields numbers. Otherwise such lines are skipped.
+    ASCIIRowsReader(utility::filesystem::CFile &file,
+                    int num_fields,
+                    bool strict);
+
+    /// \brief Read the next rows.
+    ///
+    /// \param max_rows Maximal number of rows to read, or -1 to read all the
+    /// remaining rows.
+    /// \param values Row-major values are appended here.
+    /// \param reporter If not null, updated with the file position of the
+    /// parsed lines.
+    /// \return Number of rows read, which is less than max_rows only at the
+    /// end of the file, or -1 on failure.
+    int64_t Read(int64_t max_rows,
+                 std::vector<double> &values,
+                 utility::CountingProgressReporter *reporter = nullptr);
+
+private:
+    /// Read the next block of the file after the unparsed lines.
+    bool FillBuffer();
+
+private:
+    utility::filesystem::CFile &file_;
+    int num_fields_;
+    bool strict_;
+    std::vector<char> buffer_;
+    /// File position of buffer_[0].
+    int64_t buffer_pos_;
+    /// Unparsed complete lines are in [begin_, end_), followed by the start
+    /// of the next line.
+    size_t begin_ = 0;
+    size_t end_ = 0;
+    bool eof_ = false;
+    /// Average byte size of the parsed lines, to size the parse window.
+    double row_size_ = 0;
+};
+
+/// \brief Write rows to an ASCII file, formatted in parallel.
+///
+/// \param file File to write at its current position.
+/// \param num_rows Number of rows.
+/// \param format_row Thread-safe function formatting row i into a buffer of
+/// the given size with snprintf semantics, i.e. returning the length of the
+/// full text, or a negative value on failure.
+/// \param reporter If not null, updated with the number of rows written.
+/// \return false if formatting or writing failed.
+bool WriteASCIIRows(
+        utility::filesystem::CFile &file,
+        int64_t num_rows,
+        const std::function<int(int64_t, char *, size_t)> &format_row,
+        utility::CountingProgressReporter *reporter = nullptr);
+
+}  // namespace io
+}  // namespace open3d
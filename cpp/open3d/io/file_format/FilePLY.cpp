@@ -31,6 +31,7 @@
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/io/TriangleMeshIO.h"
 #include "open3d/io/VoxelGridIO.h"
+#include "open3d/io/file_format/PLYBinaryReader.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/ProgressBar.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -110,6 +111,65 @@ int ReadColorCallback(p_ply_argument argument) {
     return 1;
 }
 
+// Fast path for binary files without the per-value rply callbacks. Returns
+// false if rply is needed to read the file, otherwise success tells whether
+// reading succeeded.
+bool ReadPointCloudFromBinaryPLY(const std::string &filename,
+                                 geometry::PointCloud &pointcloud,
+                                 const ReadPointCloudOption &params,
+                                 bool &success) {
+    PLYBinaryVertexReader reader;
+    if (!reader.Open(filename)) {
+        return false;
+    }
+
+    const char *names[3][3] = {{"x", "y", "z"},
+                               {"nx", "ny", "nz"},
+                               {"red", "green", "blue"}};
+    int properties[3][3];
+    bool has_attr[3];
+    for (int a = 0; a < 3; ++a) {
+        int num_found = 0;
+        for (int c = 0; c < 3; ++c) {
+            properties[a][c] = reader.FindProperty(names[a][c]);
+            num_found += properties[a][c] >= 0;
+        }
+        // Leave partial attributes to rply.
+        if (num_found != 0 && num_found != 3) {
+            return false;
+        }
+        has_attr[a] = num_found == 3;
+    }
+    if (!has_attr[0]) {
+        return false;
+    }
+
+    const int64_t num_vertices = reader.GetNumVertices();
+    pointcloud.Clear();
+    pointcloud.points_.resize(num_vertices);
+    pointcloud.normals_.resize(has_attr[1] ? num_vertices : 0);
+    pointcloud.colors_.resize(has_attr[2] ? num_vertices : 0);
+
+    std::vector<Eigen::Vector3d> *attrs[3] = {
+            &pointcloud.points_, &pointcloud.normals_, &pointcloud.colors_};
+    std::vector<PLYBinaryVertexReader::Column> columns;
+    for (int a = 0; a < 3; ++a) {
+        if (!has_attr[a]) continue;
+        for (int c = 0; c < 3; ++c) {
+            columns.push_back({properties[a][c], attrs[a]->data(), 3, c,
+                               /*to_double=*/true, a == 2 ? 255.0 : 1.0});
+        }
+    }
+
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(num_vertices);
+    success = reader.Read(columns, &reporter);
+    if (success) {
+        reporter.Finish();
+    }
+    return true;
+}
+
 }  // namespace ply_pointcloud_reader
 
 namespace ply_trianglemesh_reader {
@@ -399,6 +459,11 @@ bool ReadPointCloudFromPLY(const std::string &filename,
                            const ReadPointCloudOption &params) {
     using namespace ply_pointcloud_reader;
 
+    bool success = false;
+    if (ReadPointCloudFromBinaryPLY(filename, pointcloud, params, success)) {
+        return success;
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}",
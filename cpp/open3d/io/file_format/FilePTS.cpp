@@ -28,6 +28,7 @@
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/ASCIIRowsIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
@@ -61,7 +62,7 @@ bool ReadPointCloudFromPTS(const std::string &filename,
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(num_of_pts);
+        reporter.SetTotal(file.GetFileSize());
 
         pointcloud.Clear();
 
@@ -77,61 +78,43 @@ bool ReadPointCloudFromPTS(const std::string &filename,
                         "supported.");
             }
 
-            // X Y Z I R G B or X Y Z R G B.
-            if (num_of_fields == 7 || num_of_fields == 6) {
-                pointcloud.points_.resize(num_of_pts);
-                pointcloud.colors_.resize(num_of_pts);
-            }
-            // X Y Z I or X Y Z.
-            else if (num_of_fields == 4 || num_of_fields == 3) {
-                pointcloud.points_.resize(num_of_pts);
-            } else {
+            if (num_of_fields < 3 || num_of_fields > 7 || num_of_fields == 5) {
                 utility::LogWarning("Read PTS failed: unknown pts format: {}",
                                     line_buffer);
                 return false;
             }
+        } else {
+            reporter.Finish();
+            return true;
         }
 
         // Go to data start position.
         fseek(file.GetFILE(), start_pos, 0);
 
-        size_t idx = 0;
-        while (idx < num_of_pts && (line_buffer = file.ReadLine())) {
-            double x, y, z, i;
-            int r, g, b;
-            // X Y Z I R G B
-            if (num_of_fields == 7 &&
-                sscanf(line_buffer, "%lf %lf %lf %lf %d %d %d", &x, &y, &z, &i,
-                       &r, &g, &b) == 7) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                pointcloud.colors_[idx] = utility::ColorToDouble(r, g, b);
-            }
-            // X Y Z R G B
-            else if (num_of_fields == 6 &&
-                     sscanf(line_buffer, "%lf %lf %lf %d %d %d", &x, &y, &z, &r,
-                            &g, &b) == 6) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                pointcloud.colors_[idx] = utility::ColorToDouble(r, g, b);
-            }
-            // X Y Z I
-            else if (num_of_fields == 4 &&
-                     sscanf(line_buffer, "%lf %lf %lf %lf", &x, &y, &z, &i) ==
-                             4) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-            }
-            // X Y Z
-            else if (num_of_fields == 3 &&
-                     sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-            } else {
-                utility::LogWarning("Read PTS failed at line: {}. ",
-                                    line_buffer);
-                return false;
-            }
+        std::vector<double> values;
+        const int64_t num_rows =
+                ReadASCIIRows(file, int(num_of_fields), int64_t(num_of_pts),
+                              true, values, &reporter);
+        if (num_rows < 0) {
+            utility::LogWarning("Read PTS failed: unable to read file: {}",
+                                filename);
+            return false;
+        }
 
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
+        // X Y Z I R G B, X Y Z R G B, X Y Z I or X Y Z.
+        const bool has_colors = num_of_fields == 7 || num_of_fields == 6;
+        pointcloud.points_.resize(num_rows);
+        if (has_colors) {
+            pointcloud.colors_.resize(num_rows);
+        }
+        for (int64_t idx = 0; idx < num_rows; idx++) {
+            const double *row = values.data() + idx * num_of_fields;
+            pointcloud.points_[idx] = Eigen::Vector3d(row[0], row[1], row[2]);
+            if (has_colors) {
+                const double *rgb = row + num_of_fields - 3;
+                pointcloud.colors_[idx] = utility::ColorToDouble(
+                        uint8_t(int(rgb[0])), uint8_t(int(rgb[1])),
+                        uint8_t(int(rgb[2])));
             }
         }
 
@@ -162,31 +145,23 @@ bool WritePointCloudToPTS(const std::string &filename,
                                 filename);
             return false;
         }
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+        auto format_row = [&](int64_t i, char *buffer, size_t size) {
             const auto &point = pointcloud.points_[i];
             if (!pointcloud.HasColors()) {
-                if (fprintf(file.GetFILE(), "%.10f %.10f %.10f\r\n", point(0),
-                            point(1), point(2)) < 0) {
-                    utility::LogWarning(
-                            "Write PTS failed: unable to write file: {}",
-                            filename);
-                    return false;
-                }
-            } else {
-                auto color = utility::ColorToUint8(pointcloud.colors_[i]);
-                if (fprintf(file.GetFILE(),
+                return snprintf(buffer, size, "%.10f %.10f %.10f\r\n",
+                                point(0), point(1), point(2));
+            }
+            auto color = utility::ColorToUint8(pointcloud.colors_[i]);
+            return snprintf(buffer, size,
                             "%.10f %.10f %.10f %.10f %d %d %d\r\n", point(0),
                             point(1), point(2), 0.0, (int)color(0),
-                            (int)color(1), (int)(color(2))) < 0) {
-                    utility::LogWarning(
-                            "Write PTS failed: unable to write file: {}",
-                            filename);
-                    return false;
-                }
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+                            (int)color(1), (int)(color(2)));
+        };
+        if (!WriteASCIIRows(file, int64_t(pointcloud.points_.size()),
+                            format_row, &reporter)) {
+            utility::LogWarning("Write PTS failed: unable to write file: {}",
+                                filename);
+            return false;
         }
         reporter.Finish();
         return true;
@@ -28,6 +28,7 @@
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/ASCIIRowsIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -53,16 +54,18 @@ bool ReadPointCloudFromXYZ(const std::string &filename,
         reporter.SetTotal(file.GetFileSize());
 
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
+        std::vector<double> values;
+        const int64_t num_points =
+                ReadASCIIRows(file, 3, -1, false, values, &reporter);
+        if (num_points < 0) {
+            utility::LogWarning("Read XYZ failed: unable to read file: {}",
+                                filename);
+            return false;
+        }
+        pointcloud.points_.resize(num_points);
+        for (int64_t i = 0; i < num_points; i++) {
+            pointcloud.points_[i] = Eigen::Vector3d(
+                    values[3 * i], values[3 * i + 1], values[3 * i + 2]);
         }
         reporter.Finish();
 
@@ -86,17 +89,16 @@ bool WritePointCloudToXYZ(const std::string &filename,
         utility::CountingProgressReporter reporter(params.update_progress);
         reporter.SetTotal(pointcloud.points_.size());
 
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+        auto format_row = [&](int64_t i, char *buffer, size_t size) {
             const Eigen::Vector3d &point = pointcloud.points_[i];
-            if (fprintf(file.GetFILE(), "%.10f %.10f %.10f\n", point(0),
-                        point(1), point(2)) < 0) {
-                utility::LogWarning(
-                        "Write XYZ failed: unable to write file: {}", filename);
-                return false;  // error happened during writing.
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+            return snprintf(buffer, size, "%.10f %.10f %.10f\n", point(0),
+                            point(1), point(2));
+        };
+        if (!WriteASCIIRows(file, int64_t(pointcloud.points_.size()),
+                            format_row, &reporter)) {
+            utility::LogWarning("Write XYZ failed: unable to write file: {}",
+                                filename);
+            return false;  // error happened during writing.
         }
         reporter.Finish();
         return true;
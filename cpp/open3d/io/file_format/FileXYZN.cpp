@@ -28,6 +28,7 @@
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/ASCIIRowsIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -53,18 +54,20 @@ bool ReadPointCloudFromXYZN(const std::string &filename,
         reporter.SetTotal(file.GetFileSize());
 
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z, nx, ny, nz;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf %lf %lf", &x, &y, &z, &nx,
-                       &ny, &nz) == 6) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-                pointcloud.normals_.push_back(Eigen::Vector3d(nx, ny, nz));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
+        std::vector<double> values;
+        const int64_t num_points =
+                ReadASCIIRows(file, 6, -1, false, values, &reporter);
+        if (num_points < 0) {
+            utility::LogWarning("Read XYZN failed: unable to read file: {}",
+                                filename);
+            return false;
+        }
+        pointcloud.points_.resize(num_points);
+        pointcloud.normals_.resize(num_points);
+        for (int64_t i = 0; i < num_points; i++) {
+            const double *row = values.data() + 6 * i;
+            pointcloud.points_[i] = Eigen::Vector3d(row[0], row[1], row[2]);
+            pointcloud.normals_[i] = Eigen::Vector3d(row[3], row[4], row[5]);
         }
         reporter.Finish();
 
@@ -92,20 +95,19 @@ bool WritePointCloudToXYZN(const std::string &filename,
         utility::CountingProgressReporter reporter(params.update_progress);
         reporter.SetTotal(pointcloud.points_.size());
 
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+        auto format_row = [&](int64_t i, char *buffer, size_t size) {
             const Eigen::Vector3d &point = pointcloud.points_[i];
             const Eigen::Vector3d &normal = pointcloud.normals_[i];
-            if (fprintf(file.GetFILE(), "%.10f %.10f %.10f %.10f %.10f %.10f\n",
-                        point(0), point(1), point(2), normal(0), normal(1),
-                        normal(2)) < 0) {
-                utility::LogWarning(
-                        "Write XYZN failed: unable to write file: {}",
-                        filename);
-                return false;  // error happened during writing.
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+            return snprintf(buffer, size,
+                            "%.10f %.10f %.10f %.10f %.10f %.10f\n", point(0),
+                            point(1), point(2), normal(0), normal(1),
+                            normal(2));
+        };
+        if (!WriteASCIIRows(file, int64_t(pointcloud.points_.size()),
+                            format_row, &reporter)) {
+            utility::LogWarning("Write XYZN failed: unable to write file: {}",
+                                filename);
+            return false;  // error happened during writing.
         }
         reporter.Finish();
         return true;
@@ -28,6 +28,7 @@
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/file_format/ASCIIRowsIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -53,18 +54,20 @@ bool ReadPointCloudFromXYZRGB(const std::string &filename,
         reporter.SetTotal(file.GetFileSize());
 
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z, r, g, b;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf %lf %lf", &x, &y, &z, &r,
-                       &g, &b) == 6) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-                pointcloud.colors_.push_back(Eigen::Vector3d(r, g, b));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
+        std::vector<double> values;
+        const int64_t num_points =
+                ReadASCIIRows(file, 6, -1, false, values, &reporter);
+        if (num_points < 0) {
+            utility::LogWarning("Read XYZRGB failed: unable to read file: {}",
+                                filename);
+            return false;
+        }
+        pointcloud.points_.resize(num_points);
+        pointcloud.colors_.resize(num_points);
+        for (int64_t i = 0; i < num_points; i++) {
+            const double *row = values.data() + 6 * i;
+            pointcloud.points_[i] = Eigen::Vector3d(row[0], row[1], row[2]);
+            pointcloud.colors_[i] = Eigen::Vector3d(row[3], row[4], row[5]);
         }
         reporter.Finish();
 
@@ -92,20 +95,18 @@ bool WritePointCloudToXYZRGB(const std::string &filename,
         utility::CountingProgressReporter reporter(params.update_progress);
         reporter.SetTotal(pointcloud.points_.size());
 
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+        auto format_row = [&](int64_t i, char *buffer, size_t size) {
             const Eigen::Vector3d &point = pointcloud.points_[i];
             const Eigen::Vector3d &color = pointcloud.colors_[i];
-            if (fprintf(file.GetFILE(), "%.10f %.10f %.10f %.10f %.10f %.10f\n",
-                        point(0), point(1), point(2), color(0), color(1),
-                        color(2)) < 0) {
-                utility::LogWarning(
-                        "Write XYZRGB failed: unable to write file: {}",
-                        filename);
-                return false;  // error happened during writing.
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+            return snprintf(buffer, size,
+                            "%.10f %.10f %.10f %.10f %.10f %.10f\n", point(0),
+                            point(1), point(2), color(0), color(1), color(2));
+        };
+        if (!WriteASCIIRows(file, int64_t(pointcloud.points_.size()),
+                            format_row, &reporter)) {
+            utility::LogWarning(
+                    "Write XYZRGB failed: unable to write file: {}", filename);
+            return false;  // error happened during writing.
         }
         reporter.Finish();
         return true;
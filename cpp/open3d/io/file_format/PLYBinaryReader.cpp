@@ -0,0 +1,365 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/file_format/PLYBinaryReader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <sstream>
+#include <unordered_map>
+
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+using ScalarType = PLYBinaryVertexReader::ScalarType;
+
+bool GetScalarType(const std::string &name, ScalarType &type) {
+    static const std::unordered_map<std::string, ScalarType> kScalarTypes = {
+            {"char", ScalarType::Int8},      {"int8", ScalarType::Int8},
+            {"uchar", ScalarType::UInt8},    {"uint8", ScalarType::UInt8},
+            {"short", ScalarType::Int16},    {"int16", ScalarType::Int16},
+            {"ushort", ScalarType::UInt16},  {"uint16", ScalarType::UInt16},
+            {"int", ScalarType::Int32},      {"int32", ScalarType::Int32},
+            {"uint", ScalarType::UInt32},    {"uint32", ScalarType::UInt32},
+            {"float", ScalarType::Float32},  {"float32", ScalarType::Float32},
+            {"double", ScalarType::Float64}, {"float64", ScalarType::Float64}};
+    auto it = kScalarTypes.find(name);
+    if (it == kScalarTypes.end()) {
+        return false;
+    }
+    type = it->second;
+    return true;
+}
+
+bool IsHostBigEndian() {
+    const uint16_t one = 1;
+    uint8_t first_byte;
+    std::memcpy(&first_byte, &one, 1);
+    return first_byte == 0;
+}
+
+template <typename T>
+void DecodeColumn(const uint8_t *records,
+                  int64_t record_size,
+                  int64_t begin,
+                  int64_t end,
+                  int64_t first,
+                  bool swap,
+                  int64_t src_offset,
+                  const PLYBinaryVertexReader::Column &column) {
+    const uint8_t *src = records + begin * record_size + src_offset;
+    for (int64_t i = begin; i < end; ++i, src += record_size) {
+        T value;
+        if (swap) {
+            uint8_t bytes[sizeof(T)];
+            for (size_t b = 0; b < sizeof(T); ++b) {
+                bytes[b] = src[sizeof(T) - 1 - b];
+            }
+            std::memcpy(&value, bytes, sizeof(T));
+        } else {
+            std::memcpy(&value, src, sizeof(T));
+        }
+
+        const int64_t dst_idx = (first + i) * column.stride_ + column.offset_;
+        if (column.to_double_) {
+            static_cast<double *>(column.data_ptr_)[dst_idx] =
+                    static_cast<double>(value) / column.divisor_;
+        } else {
+            static_cast<T *>(column.data_ptr_)[dst_idx] = value;
+        }
+    }
+}
+
+void DecodeColumn(ScalarType type,
+                  const uint8_t *records,
+                  int64_t record_size,
+                  int64_t begin,
+                  int64_t end,
+                  int64_t first,
+                  bool swap,
+                  int64_t src_offset,
+                  const PLYBinaryVertexReader::Column &column) {
+    switch (type) {
+        case ScalarType::Int8:
+            DecodeColumn<int8_t>(records, record_size, begin, end, first, swap,
+                                 src_offset, column);
+            break;
+        case ScalarType::UInt8:
+            DecodeColumn<uint8_t>(records, record_size, begin, end, first,
+                                  swap, src_offset, column);
+            break;
+        case ScalarType::Int16:
+            DecodeColumn<int16_t>(records, record_size, begin, end, first,
+                                  swap, src_offset, column);
+            break;
+        case ScalarType::UInt16:
+            DecodeColumn<uint16_t>(records, record_size, begin, end, first,
+                                   swap, src_offset, column);
+            break;
+        case ScalarType::Int32:
+            DecodeColumn<int32_t>(records, record_size, begin, end, first,
+                                  swap, src_offset, column);
+            break;
+        case ScalarType::UInt32:
+            DecodeColumn<uint32_t>(records, record_size, begin, end, first,
+                                   swap, src_offset, column);
+            break;
+        case ScalarType::Float32:
+            DecodeColumn<float>(records, record_size, begin, end, first, swap,
+                                src_offset, column);
+            break;
+        case ScalarType::Float64:
+            DecodeColumn<double>(records, record_size, begin, end, first, swap,
+                                 src_offset, column);
+            break;
+    }
+}
+
+}  // unnamed namespace
+
+int64_t PLYBinaryVertexReader::GetByteSize(ScalarType type) {
+    switch (type) {
+        case ScalarType::Int8:
+        case ScalarType::UInt8:
+            return 1;
+        case ScalarType::Int16:
+        case ScalarType::UInt16:
+            return 2;
+        case ScalarType::Int32:
+        case ScalarType::UInt32:
+        case ScalarType::Float32:
+            return 4;
+        case ScalarType::Float64:
+            return 8;
+    }
+    return 0;
+}
+
+bool PLYBinaryVertexReader::Open(const std::string &filename) {
+    filename_ = filename;
+    properties_.clear();
+    num_vertices_ = 0;
+    record_size_ = 0;
+
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::string line;
+    if (!std::getline(file, line) || line.compare(0, 3, "ply") != 0) {
+        return false;
+    }
+
+    // Bytes of the elements before the vertex element.
+    int64_t skipped_size = 0;
+    bool has_vertex = false;
+    bool in_vertex = false;
+    bool in_list_free_element = true;
+    int64_t element_count = 0;
+    int64_t element_size = 0;
+    bool header_ended = false;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        std::istringstream tokens(line);
+        std::string keyword;
+        tokens >> keyword;
+        if (keyword == "format") {
+            std::string format;
+            tokens >> format;
+            if (format == "binary_little_endian") {
+                big_endian_ = false;
+            } else if (format == "binary_big_endian") {
+                big_endian_ = true;
+            } else {
+                return false;
+            }
+        } else if (keyword == "element" || keyword == "end_header") {
+            // Close the previous element.
+            if (!has_vertex) {
+                if (!in_list_free_element) {
+                    return false;
+                }
+                skipped_size += element_count * element_size;
+            } else if (in_vertex) {
+                if (!in_list_free_element) {
+                    return false;
+                }
+                in_vertex = false;
+            }
+            if (keyword == "end_header") {
+                header_ended = true;
+                break;
+            }
+
+            std::string name;
+            tokens >> name >> element_count;
+            if (!tokens || element_count < 0) {
+                return false;
+            }
+            element_size = 0;
+            in_list_free_element = true;
+            if (!has_vertex && name == "vertex") {
+                has_vertex = true;
+                in_vertex = true;
+                num_vertices_ = element_count;
+                data_offset_ = skipped_size;
+            }
+        } else if (keyword == "property") {
+            std::string type_name, name;
+            tokens >> type_name >> name;
+            ScalarType type;
+            if (type_name == "list" || !GetScalarType(type_name, type)) {
+                in_list_free_element = false;
+                continue;
+            }
+            if (in_vertex) {
+                properties_.push_back(Property{name, type, element_size});
+                record_size_ = element_size + GetByteSize(type);
+            }
+            element_size += GetByteSize(type);
+        }
+    }
+    if (!header_ended || !has_vertex || num_vertices_ == 0 ||
+        record_size_ == 0) {
+        return false;
+    }
+    data_offset_ += static_cast<int64_t>(file.tellg());
+
+    // Reject truncated files, rply reports the error in that case.
+    file.seekg(0, std::ios::end);
+    return static_cast<int64_t>(file.tellg()) >=
+           data_offset_ + num_vertices_ * record_size_;
+}
+
+int PLYBinaryVertexReader::FindProperty(const std::string &name) const {
+    for (size_t i = 0; i < properties_.size(); ++i) {
+        if (properties_[i].name_ == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+bool PLYBinaryVertexReader::Read(
+        const std::vector<Column> &columns,
+        utility::CountingProgressReporter *reporter) const {
+    return ReadRange(0, num_vertices_, columns, reporter);
+}
+
+bool PLYBinaryVertexReader::ReadRange(
+        int64_t first,
+        int64_t count,
+        const std::vector<Column> &columns,
+        utility::CountingProgressReporter *reporter) const {
+    if (first < 0 || count < 0 || first + count > num_vertices_) {
+        utility::LogWarning(
+                "Read PLY failed: vertices [{}, {}) out of range [0, {}).",
+                first, first + count, num_vertices_);
+        return false;
+    }
+    if (count == 0) {
+        return true;
+    }
+    std::ifstream file(filename_, std::ios::binary);
+    if (!file.is_open()) {
+        utility::LogWarning("Read PLY failed: unable to open file: {}.",
+                            filename_);
+        return false;
+    }
+    file.seekg(data_offset_ + first * record_size_);
+
+    // Chunks of about 16 MB, decoded in blocks of records that stay in cache.
+    const int64_t kChunkBytes = 16 << 20;
+    const int64_t kBlockRecords = 4096;
+    const int64_t chunk_records =
+            std::max(int64_t(1), kChunkBytes / record_size_);
+    const bool swap = big_endian_ != IsHostBigEndian();
+
+    // Chunk offsets are relative to the first vertex of the range.
+    auto read_chunk = [&](int64_t begin, std::vector<uint8_t> &buffer) {
+        const int64_t chunk_count = std::min(chunk_records, count - begin);
+        buffer.resize(chunk_count * record_size_);
+        file.read(reinterpret_cast<char *>(buffer.data()), buffer.size());
+        return static_cast<bool>(file);
+    };
+
+    std::vector<uint8_t> buffers[2];
+    if (!read_chunk(0, buffers[0])) {
+        utility::LogWarning("Read PLY failed: unable to read file: {}.",
+                            filename_);
+        return false;
+    }
+    for (int64_t begin = 0, k = 0; begin < count;
+         begin += chunk_records, ++k) {
+        const std::vector<uint8_t> &buffer = buffers[k % 2];
+        const int64_t next = begin + chunk_records;
+        std::future<bool> next_read;
+        if (next < count) {
+            next_read = std::async(std::launch::async, read_chunk, next,
+                                   std::ref(buffers[(k + 1) % 2]));
+        }
+
+        const int64_t chunk_count = buffer.size() / record_size_;
+        const int64_t num_blocks =
+                (chunk_count + kBlockRecords - 1) / kBlockRecords;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t b = 0; b < num_blocks; ++b) {
+            const int64_t block_begin = b * kBlockRecords;
+            const int64_t block_end =
+                    std::min(block_begin + kBlockRecords, chunk_count);
+            for (const Column &column : columns) {
+                const Property &property = properties_[column.property_];
+                DecodeColumn(property.type_, buffer.data(), record_size_,
+                             block_begin, block_end, begin, swap,
+                             property.offset_, column);
+            }
+        }
+
+        if (next_read.valid() && !next_read.get()) {
+            utility::LogWarning("Read PLY failed: unable to read file: {}.",
+                                filename_);
+            return false;
+        }
+        if (reporter) {
+            reporter->Update(std::min(next, count));
+        }
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -27,6 +27,9 @@
 #pragma once
 
 #include <memory>
+#include <vector>
+
+#include "open3d/utility/Logging.h"
 
 namespace zmq {
 class message_t;
@@ -47,6 +50,18 @@ public:
     virtual std::shared_ptr<zmq::message_t> Send(zmq::message_t& send_msg) = 0;
     virtual std::shared_ptr<zmq::message_t> Send(const void* data,
                                                  size_t size) = 0;
+
+    /// Returns true if the connection can send multipart messages, i.e., if
+    /// array data can be sent in separate frames without serializing it.
+    virtual bool SupportsMultipart() const { return false; }
+
+    /// Function for sending a multipart message. The first frame stores the
+    /// serialized messages and the following frames store the array data.
+    virtual std::shared_ptr<zmq::message_t> SendMultipart(
+            std::vector<zmq::message_t>& frames) {
+        utility::LogError("This connection does not support multipart sends");
+        return std::shared_ptr<zmq::message_t>();
+    }
 };
 }  // namespace rpc
 }  // namespace io
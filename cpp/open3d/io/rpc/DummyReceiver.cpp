@@ -35,8 +35,10 @@ namespace open3d {
 namespace io {
 namespace rpc {
 
-DummyReceiver::DummyReceiver(const std::string& address, int timeout)
-    : ZMQReceiver(address, timeout) {
+DummyReceiver::DummyReceiver(const std::string& address,
+                             int timeout,
+                             SocketType socket_type)
+    : ZMQReceiver(address, timeout, socket_type) {
     SetMessageProcessor(std::make_shared<DummyMessageProcessor>());
 }
 
@@ -37,7 +37,9 @@ namespace rpc {
 /// This class is meant for testing puproses.
 class DummyReceiver : public ZMQReceiver {
 public:
-    DummyReceiver(const std::string& address, int timeout);
+    DummyReceiver(const std::string& address,
+                  int timeout,
+                  SocketType socket_type = SocketType::REP);
 };
 
 }  // namespace rpc
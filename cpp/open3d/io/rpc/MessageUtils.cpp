@@ -26,6 +26,7 @@
 
 #include "open3d/io/rpc/MessageUtils.h"
 
+#include <liblzf/lzf.h>
 #include <zmq.hpp>
 
 #include "open3d/io/rpc/Messages.h"
@@ -355,6 +356,105 @@ messages::MeshData GeometryToMeshData(const t::geometry::LineSet& ls) {
     return mesh_data;
 }
 
+/// Returns pointers to all arrays in \p mesh_data in the order used for the
+/// frames of a multipart message.
+static std::vector<messages::Array*> GetMeshDataArrays(
+        messages::MeshData& mesh_data) {
+    std::vector<messages::Array*> arrays;
+    arrays.push_back(&mesh_data.vertices);
+    for (auto& item : mesh_data.vertex_attributes) {
+        arrays.push_back(&item.second);
+    }
+    arrays.push_back(&mesh_data.faces);
+    for (auto& item : mesh_data.face_attributes) {
+        arrays.push_back(&item.second);
+    }
+    arrays.push_back(&mesh_data.lines);
+    for (auto& item : mesh_data.line_attributes) {
+        arrays.push_back(&item.second);
+    }
+    for (auto& item : mesh_data.texture_maps) {
+        arrays.push_back(&item.second);
+    }
+    return arrays;
+}
+
+/// Releases the Tensor reference passed as hint after zmq sent the frame.
+static void ReleaseTensorRef(void* data, void* hint) {
+    delete static_cast<core::Tensor*>(hint);
+}
+
+void MoveMeshDataArraysToFrames(messages::MeshData& mesh_data,
+                                std::vector<zmq::message_t>& frames) {
+    for (messages::Array* arr : GetMeshDataArrays(mesh_data)) {
+        if (!arr->data.size) continue;
+        if (arr->tensor_.GetBlob() &&
+            arr->tensor_.GetDataPtr() == (const void*)arr->data.ptr) {
+            frames.emplace_back((void*)arr->data.ptr, arr->data.size,
+                                ReleaseTensorRef,
+                                new core::Tensor(arr->tensor_));
+        } else {
+            frames.emplace_back(arr->data.ptr, arr->data.size);
+        }
+        arr->data = msgpack::type::raw_ref(nullptr, 0);
+    }
+}
+
+bool CompressFrame(zmq::message_t& frame) {
+    // Small frames are not worth the overhead.
+    const size_t min_size = 4096;
+    if (frame.size() < min_size) return false;
+    // Only keep the compressed data if it saves at least 1/8 of the size.
+    zmq::message_t compressed(frame.size() - frame.size() / 8);
+    unsigned int compressed_size =
+            lzf_compress(frame.data(), (unsigned int)frame.size(),
+                         compressed.data(), (unsigned int)compressed.size());
+    if (!compressed_size) return false;
+    frame.rebuild(compressed.data(), compressed_size);
+    return true;
+}
+
+bool AttachFramesToMeshData(messages::MeshData& mesh_data,
+                            const std::vector<zmq::message_t>& frames,
+                            size_t& frame_idx,
+                            std::string& errstr) {
+    for (messages::Array* arr : GetMeshDataArrays(mesh_data)) {
+        if (arr->data.size || arr->type.empty()) continue;
+        const int64_t num_bytes = arr->NumBytes();
+        if (num_bytes < 0 || num_bytes > int64_t(UINT32_MAX)) {
+            errstr += " invalid array with type " + arr->type;
+            return false;
+        }
+        if (!num_bytes) continue;
+        if (frame_idx >= frames.size()) {
+            errstr += " missing frame for array";
+            return false;
+        }
+        const zmq::message_t& frame = frames[frame_idx++];
+        if (int64_t(frame.size()) == num_bytes) {
+            arr->data = msgpack::type::raw_ref((const char*)frame.data(),
+                                               uint32_t(num_bytes));
+        } else if (int64_t(frame.size()) < num_bytes) {
+            core::Tensor buffer({num_bytes}, core::UInt8);
+            unsigned int size = lzf_decompress(
+                    frame.data(), (unsigned int)frame.size(),
+                    buffer.GetDataPtr(), (unsigned int)num_bytes);
+            if (int64_t(size) != num_bytes) {
+                errstr += " failed to decompress frame";
+                return false;
+            }
+            arr->tensor_ = buffer;
+            arr->data = msgpack::type::raw_ref(
+                    (const char*)buffer.GetDataPtr(), uint32_t(num_bytes));
+        } else {
+            errstr += " frame size " + std::to_string(frame.size()) +
+                      " does not match array size " + std::to_string(num_bytes);
+            return false;
+        }
+    }
+    return true;
+}
+
 std::tuple<std::string, double, std::shared_ptr<t::geometry::Geometry>>
 DataBufferToMetaGeometry(std::string& data) {
     const char* buffer = data.data();
@@ -103,6 +103,31 @@ messages::MeshData GeometryToMeshData(const t::geometry::PointCloud& pcd);
 /// object for serialization.
 messages::MeshData GeometryToMeshData(const t::geometry::LineSet& ls);
 
+/// Moves the data of all non-empty arrays in \p mesh_data to separate frames
+/// for sending them as parts of a multipart message. The frames are appended
+/// to \p frames in a fixed order (vertices, vertex_attributes, faces,
+/// face_attributes, lines, line_attributes, texture_maps) and the data of the
+/// arrays is cleared such that only the shape and the type are serialized
+/// with the message. Arrays backed by a Tensor are not copied. The frames keep
+/// a reference to the Tensor until the data has been sent.
+void MoveMeshDataArraysToFrames(messages::MeshData& mesh_data,
+                                std::vector<zmq::message_t>& frames);
+
+/// Compresses the frame in-place with LZF if this reduces its size. Returns
+/// true if the frame has been compressed. A compressed frame is recognized by
+/// the receiver because its size is smaller than the size of the array.
+bool CompressFrame(zmq::message_t& frame);
+
+/// Reattaches the frames created by MoveMeshDataArraysToFrames to the arrays
+/// of \p mesh_data. Arrays that already store their data inside the message
+/// are skipped. \p frame_idx is the index of the next unused frame and will be
+/// updated. Compressed frames are decompressed to a Tensor owned by the array.
+/// Returns false and appends an error description to \p errstr on failure.
+bool AttachFramesToMeshData(messages::MeshData& mesh_data,
+                            const std::vector<zmq::message_t>& frames,
+                            size_t& frame_idx,
+                            std::string& errstr);
+
 /// This function returns the geometry, the path and the time stored in a
 /// SetMeshData message. \p data must contain the Request header message
 /// followed by the SetMeshData message. The function returns a null pointer for
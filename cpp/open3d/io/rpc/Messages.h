@@ -166,6 +166,23 @@ struct Array {
         return (T*)data.ptr;
     }
 
+    /// Returns the size of the array data in bytes as defined by the type and
+    /// the shape. Returns -1 if the type string is invalid.
+    int64_t NumBytes() const {
+        if (type.size() < 3) return -1;
+        int64_t item_size = 0;
+        for (size_t i = 2; i < type.size(); ++i) {
+            if (type[i] < '0' || type[i] > '9') return -1;
+            item_size = item_size * 10 + (type[i] - '0');
+        }
+        int64_t num = 1;
+        for (int64_t n : shape) {
+            if (n < 0) return -1;
+            num *= n;
+        }
+        return item_size * num;
+    }
+
     /// Checks the rank of the shape.
     /// Returns false on mismatch and appends an error description to errstr.
     bool CheckRank(const std::vector<int>& expected_ranks,
@@ -0,0 +1,159 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/rpc/PushConnection.h"
+
+#include <algorithm>
+#include <zmq.hpp>
+
+#include "open3d/io/rpc/Connection.h"
+#include "open3d/io/rpc/MessageUtils.h"
+#include "open3d/io/rpc/ZMQContext.h"
+#include "open3d/utility/Logging.h"
+
+using namespace open3d::utility;
+
+namespace {
+
+struct PushConnectionDefaults {
+    int connect_timeout = 5000;
+    int timeout = 10000;
+} defaults;
+
+}  // namespace
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+PushConnection::PushConnection()
+    : PushConnection(Connection::DefaultAddress(),
+                     defaults.connect_timeout,
+                     defaults.timeout) {}
+
+PushConnection::PushConnection(const std::string& address,
+                               int connect_timeout,
+                               int timeout,
+                               int batch_size,
+                               bool compress)
+    : context_(GetZMQContext()),
+      socket_(new zmq::socket_t(*GetZMQContext(), ZMQ_PUSH)),
+      address_(address),
+      connect_timeout_(connect_timeout),
+      timeout_(timeout),
+      batch_size_(std::max(1, batch_size)),
+      compress_(compress),
+      num_pending_(0) {
+    socket_->set(zmq::sockopt::linger, timeout_);
+    socket_->set(zmq::sockopt::connect_timeout, connect_timeout_);
+    socket_->set(zmq::sockopt::sndtimeo, timeout_);
+    socket_->connect(address_.c_str());
+}
+
+PushConnection::~PushConnection() {
+    Flush();
+    socket_->close();
+}
+
+std::shared_ptr<zmq::message_t> PushConnection::Send(
+        zmq::message_t& send_msg) {
+    std::vector<zmq::message_t> frames;
+    frames.push_back(std::move(send_msg));
+    return SendMultipart(frames);
+}
+
+std::shared_ptr<zmq::message_t> PushConnection::Send(const void* data,
+                                                     size_t size) {
+    zmq::message_t send_msg(data, size);
+    return Send(send_msg);
+}
+
+std::shared_ptr<zmq::message_t> PushConnection::SendMultipart(
+        std::vector<zmq::message_t>& frames) {
+    if (frames.empty()) {
+        LogError("PushConnection::SendMultipart: no frames");
+    }
+    bool ok = true;
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        header_.append((const char*)frames[0].data(), frames[0].size());
+        for (size_t i = 1; i < frames.size(); ++i) {
+            if (compress_) {
+                CompressFrame(frames[i]);
+            }
+            frames_.emplace_back(new zmq::message_t(std::move(frames[i])));
+        }
+        frames.clear();
+        if (++num_pending_ >= batch_size_) {
+            ok = FlushLocked();
+        }
+    }
+    if (!ok) {
+        return std::make_shared<zmq::message_t>();
+    }
+    return CreateStatusOKMsg();
+}
+
+bool PushConnection::Flush() {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return FlushLocked();
+}
+
+int PushConnection::GetNumPending() const {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return num_pending_;
+}
+
+bool PushConnection::FlushLocked() {
+    if (!num_pending_) return true;
+
+    bool ok = true;
+    try {
+        zmq::message_t header(header_.data(), header_.size());
+        auto flags = frames_.empty() ? zmq::send_flags::none
+                                     : zmq::send_flags::sndmore;
+        ok = bool(socket_->send(header, flags));
+        for (size_t i = 0; ok && i < frames_.size(); ++i) {
+            flags = i + 1 < frames_.size() ? zmq::send_flags::sndmore
+                                           : zmq::send_flags::none;
+            ok = bool(socket_->send(*frames_[i], flags));
+        }
+        if (!ok) {
+            LogInfo("PushConnection::Flush() send timed out");
+        }
+    } catch (const zmq::error_t& err) {
+        LogInfo("PushConnection::Flush() send failed with: {}", err.what());
+        ok = false;
+    }
+    header_.clear();
+    frames_.clear();
+    num_pending_ = 0;
+    return ok;
+}
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
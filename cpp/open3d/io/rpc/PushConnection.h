@@ -0,0 +1,121 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "open3d/io/rpc/ConnectionBase.h"
+#include "open3d/io/rpc/ZMQContext.h"
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+/// Connection for streaming data to a ZMQReceiver using the PULL socket type.
+///
+/// In contrast to Connection this class does not wait for a reply after each
+/// message, which allows sending the next geometry while the receiver is still
+/// processing the previous one. Messages are sent as multipart messages. The
+/// first frame stores the serialized messages like a Connection would send
+/// them, except that the array data of SetMeshData messages is sent in the
+/// following frames. Arrays created from Tensors are not copied for sending.
+/// Do not modify such Tensors in-place before the data has been sent.
+///
+/// Optionally, array frames are compressed with LZF and several messages are
+/// batched into a single multipart message.
+class PushConnection : public ConnectionBase {
+public:
+    /// Creates a connection with the default parameters
+    PushConnection();
+
+    /// Creates a PushConnection object used for sending data.
+    /// \param address          The address of the receiving end.
+    ///
+    /// \param connect_timeout  The timeout for the connect operation of the
+    /// socket.
+    ///
+    /// \param timeout          The timeout for sending data.
+    ///
+    /// \param batch_size       The number of messages that are collected
+    /// before they are sent together. Use Flush() to send pending messages.
+    ///
+    /// \param compress         If true, array frames are compressed with LZF.
+    ///
+    PushConnection(const std::string& address,
+                   int connect_timeout,
+                   int timeout,
+                   int batch_size = 1,
+                   bool compress = false);
+
+    /// Sends all pending messages before closing the socket.
+    ~PushConnection();
+
+    /// Function for sending data wrapped in a zmq message object.
+    /// The returned reply is an OK status if the message was sent or queued.
+    std::shared_ptr<zmq::message_t> Send(zmq::message_t& send_msg) override;
+
+    /// Function for sending raw data. Meant for testing purposes
+    std::shared_ptr<zmq::message_t> Send(const void* data,
+                                         size_t size) override;
+
+    bool SupportsMultipart() const override { return true; }
+
+    /// Function for sending a multipart message. The frames are moved into
+    /// the batch of pending messages.
+    std::shared_ptr<zmq::message_t> SendMultipart(
+            std::vector<zmq::message_t>& frames) override;
+
+    /// Sends all pending messages. Returns false if sending failed.
+    bool Flush();
+
+    /// Returns the number of messages that have not been sent yet.
+    int GetNumPending() const;
+
+private:
+    bool FlushLocked();
+
+    std::shared_ptr<zmq::context_t> context_;
+    std::unique_ptr<zmq::socket_t> socket_;
+    const std::string address_;
+    const int connect_timeout_;
+    const int timeout_;
+    const int batch_size_;
+    const bool compress_;
+
+    mutable std::mutex mutex_;
+    /// Concatenated serialized messages of the pending batch.
+    std::string header_;
+    /// Array frames of the pending batch.
+    std::vector<std::unique_ptr<zmq::message_t>> frames_;
+    int num_pending_;
+};
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
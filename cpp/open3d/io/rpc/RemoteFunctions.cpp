@@ -41,6 +41,41 @@ namespace open3d {
 namespace io {
 namespace rpc {
 
+namespace {
+
+/// Serializes the message and sends it with the connection.
+template <class T>
+std::shared_ptr<zmq::message_t> PackAndSend(T& msg,
+                                            ConnectionBase& connection) {
+    msgpack::sbuffer sbuf;
+    messages::Request request{msg.MsgId()};
+    msgpack::pack(sbuf, request);
+    msgpack::pack(sbuf, msg);
+
+    zmq::message_t send_msg(sbuf.data(), sbuf.size());
+    return connection.Send(send_msg);
+}
+
+/// Sends the array data of SetMeshData messages in separate frames if
+/// the connection supports multipart messages.
+std::shared_ptr<zmq::message_t> PackAndSend(messages::SetMeshData& msg,
+                                            ConnectionBase& connection) {
+    if (!connection.SupportsMultipart()) {
+        return PackAndSend<messages::SetMeshData>(msg, connection);
+    }
+    std::vector<zmq::message_t> frames(1);
+    MoveMeshDataArraysToFrames(msg.data, frames);
+
+    msgpack::sbuffer sbuf;
+    messages::Request request{msg.MsgId()};
+    msgpack::pack(sbuf, request);
+    msgpack::pack(sbuf, msg);
+    frames[0].rebuild(sbuf.data(), sbuf.size());
+    return connection.SendMultipart(frames);
+}
+
+}  // namespace
+
 bool SetPointCloud(const geometry::PointCloud& pcd,
                    const std::string& path,
                    int time,
@@ -69,16 +104,10 @@ bool SetPointCloud(const geometry::PointCloud& pcd,
                 (double*)pcd.colors_.data(), {int64_t(pcd.colors_.size()), 3});
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
     if (!connection) {
         connection = std::shared_ptr<Connection>(new Connection());
     }
-    auto reply = connection->Send(send_msg);
+    auto reply = PackAndSend(msg, *connection);
     return ReplyIsOKStatus(*reply);
 }
 
@@ -147,16 +176,10 @@ bool SetTriangleMesh(const geometry::TriangleMesh& mesh,
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
     if (!connection) {
         connection = std::shared_ptr<Connection>(new Connection());
     }
-    auto reply = connection->Send(send_msg);
+    auto reply = PackAndSend(msg, *connection);
     return ReplyIsOKStatus(*reply);
 }
 
@@ -298,16 +321,10 @@ bool SetMeshData(const std::string& path,
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
     if (!connection) {
         connection = std::shared_ptr<Connection>(new Connection());
     }
-    auto reply = connection->Send(send_msg);
+    auto reply = PackAndSend(msg, *connection);
     return ReplyIsOKStatus(*reply);
 }
 
@@ -355,16 +372,10 @@ bool SetLegacyCamera(const camera::PinholeCameraParameters& camera,
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
     if (!connection) {
         connection = std::shared_ptr<Connection>(new Connection());
     }
-    auto reply = connection->Send(send_msg);
+    auto reply = PackAndSend(msg, *connection);
     return ReplyIsOKStatus(*reply);
 }
 
@@ -372,16 +383,10 @@ bool SetTime(int time, std::shared_ptr<ConnectionBase> connection) {
     messages::SetTime msg;
     msg.time = time;
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
     if (!connection) {
         connection = std::shared_ptr<Connection>(new Connection());
     }
-    auto reply = connection->Send(send_msg);
+    auto reply = PackAndSend(msg, *connection);
     return ReplyIsOKStatus(*reply);
 }
 
@@ -390,16 +395,10 @@ bool SetActiveCamera(const std::string& path,
     messages::SetActiveCamera msg;
     msg.path = path;
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
     if (!connection) {
         connection = std::shared_ptr<Connection>(new Connection());
     }
-    auto reply = connection->Send(send_msg);
+    auto reply = PackAndSend(msg, *connection);
     return ReplyIsOKStatus(*reply);
 }
 
@@ -29,6 +29,7 @@
 #include <zmq.hpp>
 
 #include "open3d/io/rpc/MessageProcessorBase.h"
+#include "open3d/io/rpc/MessageUtils.h"
 #include "open3d/io/rpc/Messages.h"
 #include "open3d/io/rpc/ZMQContext.h"
 
@@ -46,15 +47,35 @@ std::shared_ptr<zmq::message_t> CreateStatusMessage(
 
     return msg;
 }
+
+/// Reattaches the array frames of a multipart message. Only SetMeshData
+/// messages store data in separate frames.
+template <class T>
+void AttachFrames(T& msg,
+                  const std::vector<zmq::message_t>& frames,
+                  size_t& frame_idx) {}
+
+void AttachFrames(open3d::io::rpc::messages::SetMeshData& msg,
+                  const std::vector<zmq::message_t>& frames,
+                  size_t& frame_idx) {
+    std::string errstr;
+    if (!open3d::io::rpc::AttachFramesToMeshData(msg.data, frames, frame_idx,
+                                                 errstr)) {
+        throw std::runtime_error("invalid multipart message:" + errstr);
+    }
+}
 }  // namespace
 
 namespace open3d {
 namespace io {
 namespace rpc {
 
-ZMQReceiver::ZMQReceiver(const std::string& address, int timeout)
+ZMQReceiver::ZMQReceiver(const std::string& address,
+                         int timeout,
+                         SocketType socket_type)
     : address_(address),
       timeout_(timeout),
+      socket_type_(socket_type),
       keep_running_(false),
       loop_running_(false),
       mainloop_error_code_(0),
@@ -114,7 +135,9 @@ std::runtime_error ZMQReceiver::GetLastError() {
 void ZMQReceiver::Mainloop() {
     context_ = GetZMQContext();
     socket_ = std::unique_ptr<zmq::socket_t>(
-            new zmq::socket_t(*context_, ZMQ_REP));
+            new zmq::socket_t(*context_, socket_type_ == SocketType::PULL
+                                                 ? ZMQ_PULL
+                                                 : ZMQ_REP));
 
     socket_->set(zmq::sockopt::linger, 0);
     socket_->set(zmq::sockopt::rcvtimeo, 1000);
@@ -149,6 +172,17 @@ void ZMQReceiver::Mainloop() {
                 continue;
             }
 
+            // The array data of multipart messages is stored in the frames
+            // following the first one.
+            std::vector<zmq::message_t> frames;
+            bool more = message.more();
+            while (more) {
+                frames.emplace_back();
+                if (!socket_->recv(frames.back())) break;
+                more = frames.back().more();
+            }
+            size_t frame_idx = 0;
+
             const char* buffer = (char*)message.data();
             size_t buffer_size = message.size();
 
@@ -176,6 +210,7 @@ void ZMQReceiver::Mainloop() {
         auto obj = oh.get();                                            \
         MSGTYPE msg;                                                    \
         msg = obj.as<MSGTYPE>();                                        \
+        AttachFrames(msg, frames, frame_idx);                           \
         auto reply = processor_->ProcessMessage(req, msg, oh);          \
         if (reply) {                                                    \
             replies.push_back(reply);                                   \
@@ -206,7 +241,15 @@ void ZMQReceiver::Mainloop() {
                     break;
                 }
             }
-            if (replies.size() == 1) {
+            if (socket_type_ == SocketType::PULL) {
+                // There is no reply in the pipeline pattern.
+                for (auto r : replies) {
+                    if (!ReplyIsOKStatus(*r)) {
+                        LogInfo("ZMQReceiver::Mainloop: failed to process "
+                                "message");
+                    }
+                }
+            } else if (replies.size() == 1) {
                 socket_->send(*replies[0], zmq::send_flags::none);
             } else {
                 size_t size = 0;
@@ -57,11 +57,23 @@ struct SetTime;
 /// Class for the server side receiving requests from a client.
 class ZMQReceiver {
 public:
+    /// The socket type used for receiving messages.
+    enum class SocketType {
+        /// Request-reply pattern. Each message is answered with a reply. Use
+        /// this with Connection.
+        REP,
+        /// Pipeline pattern. Messages are not answered. Use this with
+        /// PushConnection.
+        PULL
+    };
+
     /// Constructs a receiver listening on the specified address.
     /// \param address  Address to listen on.
     /// \param timeout       Timeout in milliseconds for sending the reply.
+    /// \param socket_type   The socket type used for receiving messages.
     ZMQReceiver(const std::string& address = "tcp://127.0.0.1:51454",
-                int timeout = 10000);
+                int timeout = 10000,
+                SocketType socket_type = SocketType::REP);
 
     ZMQReceiver(const ZMQReceiver&) = delete;
     ZMQReceiver& operator=(const ZMQReceiver&) = delete;
@@ -87,6 +99,7 @@ private:
 
     const std::string address_;
     const int timeout_;
+    const SocketType socket_type_;
     std::shared_ptr<zmq::context_t> context_;
     std::unique_ptr<zmq::socket_t> socket_;
     std::thread thread_;
@@ -26,6 +26,7 @@
 
 #include "open3d/t/geometry/Image.h"
 
+#include <atomic>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -46,6 +47,15 @@ namespace geometry {
 
 using dtype_channels_pairs = std::vector<std::pair<core::Dtype, int64_t>>;
 
+// If IPP is disabled or not available, the CPU operations fall back to the
+// portable kernels in kernel/ImageFilterCPU.cpp. These support the same dtype
+// and channel combinations as IPP, hence cpu_supported aliases ipp_supported.
+static std::atomic<bool> ipp_enabled{true};
+
+void Image::SetIPPEnabled(bool enabled) { ipp_enabled = enabled; }
+
+bool Image::IsIPPEnabled() { return HAVE_IPPICV && ipp_enabled; }
+
 Image::Image(int64_t rows,
              int64_t cols,
              int64_t channels,
@@ -86,7 +96,18 @@ Image &Image::Reset(int64_t rows,
         utility::LogError("channels must be > 0, but got {}.", channels);
     }
 
-    data_ = core::Tensor({rows, cols, channels}, dtype, device);
+    // Decoding a sequence into the same image does not reallocate per frame.
+    const core::SizeVector shape{rows, cols, channels};
+    const std::shared_ptr<core::Blob> blob = data_.GetBlob();
+    if (data_.GetShape() == shape && data_.GetDtype() == dtype &&
+        data_.GetDevice() == device && data_.IsContiguous() && blob &&
+        blob.use_count() == 2 /* data_ and blob */) {
+        // Order the writes to the memory after the reads by the previous
+        // owners, which released it on another thread.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return *this;
+    }
+    data_ = core::Tensor(shape, dtype, device);
     return *this;
 }
 
@@ -123,7 +144,7 @@ Image Image::To(core::Dtype dtype,
         dst_im.data_ = core::Tensor::Empty(
                 {GetRows(), GetCols(), GetChannels()}, dtype, GetDevice());
     }
-    if (HAVE_IPPICV &&  // Check for IPP fast implementation.
+    if (IsIPPEnabled() &&  // Check for IPP fast implementation.
         data_.IsCPU() &&
         std::count(ipp_supported.begin(), ipp_supported.end(), GetDtype()) >
                 0 &&
@@ -146,6 +167,7 @@ Image Image::RGBToGray() const {
             {core::UInt16, 3},
             {core::Float32, 3},
     };
+    static const dtype_channels_pairs &cpu_supported = ipp_supported;
     static const dtype_channels_pairs npp_supported{
             {core::UInt8, 3},
             {core::UInt16, 3},
@@ -159,10 +181,14 @@ Image Image::RGBToGray() const {
         std::count(npp_supported.begin(), npp_supported.end(),
                    std::make_pair(GetDtype(), GetChannels())) > 0) {
         CUDA_CALL(npp::RGBToGray, data_, dst_im.data_);
-    } else if (HAVE_IPPICV && data_.IsCPU() &&
+    } else if (IsIPPEnabled() && data_.IsCPU() &&
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::RGBToGray, data_, dst_im.data_);
+    } else if (data_.IsCPU() &&
+               std::count(cpu_supported.begin(), cpu_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::RGBToGrayCPU(data_, dst_im.data_);
     } else {
         utility::LogError(
                 "RGBToGray with data type {} on device {} is not implemented!",
@@ -188,6 +214,7 @@ Image Image::Resize(float sampling_rate, InterpType interp_type) const {
             {core::UInt8, 3}, {core::UInt16, 3}, {core::Float32, 3},
             {core::UInt8, 4}, {core::UInt16, 4}, {core::Float32, 4},
     };
+    static const dtype_channels_pairs &cpu_supported = ipp_supported;
 
     Image dst_im;
     dst_im.data_ = core::Tensor::Empty(
@@ -199,10 +226,14 @@ Image Image::Resize(float sampling_rate, InterpType interp_type) const {
         std::count(npp_supported.begin(), npp_supported.end(),
                    std::make_pair(GetDtype(), GetChannels())) > 0) {
         CUDA_CALL(npp::Resize, data_, dst_im.data_, interp_type);
-    } else if (HAVE_IPPICV && data_.IsCPU() &&
+    } else if (IsIPPEnabled() && data_.IsCPU() &&
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::Resize, data_, dst_im.data_, interp_type);
+    } else if (data_.IsCPU() &&
+               std::count(cpu_supported.begin(), cpu_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::ResizeCPU(data_, dst_im.data_, interp_type);
     } else {
         utility::LogError(
                 "Resize with data type {} on device {} is not "
@@ -229,6 +260,13 @@ Image Image::Dilate(int kernel_size) const {
             {core::Float32, 1}, {core::Bool, 3},  {core::UInt8, 3},
             {core::Float32, 3}, {core::Bool, 4},  {core::UInt8, 4},
             {core::Float32, 4}};
+    static const dtype_channels_pairs cpu_supported{
+            {core::Bool, 1},    {core::UInt8, 1},   {core::UInt16, 1},
+            {core::Int32, 1},   {core::Float32, 1}, {core::Bool, 3},
+            {core::UInt8, 3},   {core::UInt16, 3},  {core::Int32, 3},
+            {core::Float32, 3}, {core::Bool, 4},    {core::UInt8, 4},
+            {core::UInt16, 4},  {core::Int32, 4},   {core::Float32, 4},
+    };
 
     Image dst_im;
     dst_im.data_ = core::Tensor::EmptyLike(data_);
@@ -236,10 +274,14 @@ Image Image::Dilate(int kernel_size) const {
         std::count(npp_supported.begin(), npp_supported.end(),
                    std::make_pair(GetDtype(), GetChannels())) > 0) {
         CUDA_CALL(npp::Dilate, data_, dst_im.data_, kernel_size);
-    } else if (HAVE_IPPICV && data_.IsCPU() &&
+    } else if (IsIPPEnabled() && data_.IsCPU() &&
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::Dilate, data_, dst_im.data_, kernel_size);
+    } else if (data_.IsCPU() &&
+               std::count(cpu_supported.begin(), cpu_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::DilateCPU(data_, dst_im.data_, kernel_size);
     } else {
         utility::LogError(
                 "Dilate with data type {} on device {} is not implemented!",
@@ -265,6 +307,10 @@ Image Image::FilterBilateral(int kernel_size,
             {core::UInt8, 3},
             {core::Float32, 3},
     };
+    static const dtype_channels_pairs cpu_supported{
+            {core::UInt8, 1}, {core::UInt16, 1}, {core::Float32, 1},
+            {core::UInt8, 3}, {core::UInt16, 3}, {core::Float32, 3},
+    };
 
     Image dst_im;
     dst_im.data_ = core::Tensor::EmptyLike(data_);
@@ -273,11 +319,16 @@ Image Image::FilterBilateral(int kernel_size,
                    std::make_pair(GetDtype(), GetChannels())) > 0) {
         CUDA_CALL(npp::FilterBilateral, data_, dst_im.data_, kernel_size,
                   value_sigma, dist_sigma);
-    } else if (HAVE_IPPICV && data_.IsCPU() &&
+    } else if (IsIPPEnabled() && data_.IsCPU() &&
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::FilterBilateral, data_, dst_im.data_, kernel_size,
                  value_sigma, dist_sigma);
+    } else if (data_.IsCPU() &&
+               std::count(cpu_supported.begin(), cpu_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::FilterBilateralCPU(data_, dst_im.data_, kernel_size,
+                                          value_sigma, dist_sigma);
     } else {
         utility::LogError(
                 "FilterBilateral with data type {} on device {} is not "
@@ -298,6 +349,7 @@ Image Image::Filter(const core::Tensor &kernel) const {
             {core::UInt8, 3}, {core::UInt16, 3}, {core::Float32, 3},
             {core::UInt8, 4}, {core::UInt16, 4}, {core::Float32, 4},
     };
+    static const dtype_channels_pairs &cpu_supported = ipp_supported;
 
     Image dst_im;
     dst_im.data_ = core::Tensor::EmptyLike(data_);
@@ -305,10 +357,14 @@ Image Image::Filter(const core::Tensor &kernel) const {
         std::count(npp_supported.begin(), npp_supported.end(),
                    std::make_pair(GetDtype(), GetChannels())) > 0) {
         CUDA_CALL(npp::Filter, data_, dst_im.data_, kernel);
-    } else if (HAVE_IPPICV && data_.IsCPU() &&
+    } else if (IsIPPEnabled() && data_.IsCPU() &&
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::Filter, data_, dst_im.data_, kernel);
+    } else if (data_.IsCPU() &&
+               std::count(cpu_supported.begin(), cpu_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::FilterCPU(data_, dst_im.data_, kernel);
     } else {
         utility::LogError(
                 "Filter with data type {} on device {} is not "
@@ -334,6 +390,7 @@ Image Image::FilterGaussian(int kernel_size, float sigma) const {
             {core::UInt8, 3}, {core::UInt16, 3}, {core::Float32, 3},
             {core::UInt8, 4}, {core::UInt16, 4}, {core::Float32, 4},
     };
+    static const dtype_channels_pairs &cpu_supported = ipp_supported;
 
     Image dst_im;
     dst_im.data_ = core::Tensor::EmptyLike(data_);
@@ -341,10 +398,15 @@ Image Image::FilterGaussian(int kernel_size, float sigma) const {
         std::count(npp_supported.begin(), npp_supported.end(),
                    std::make_pair(GetDtype(), GetChannels())) > 0) {
         CUDA_CALL(npp::FilterGaussian, data_, dst_im.data_, kernel_size, sigma);
-    } else if (HAVE_IPPICV && data_.IsCPU() &&
+    } else if (IsIPPEnabled() && data_.IsCPU() &&
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::FilterGaussian, data_, dst_im.data_, kernel_size, sigma);
+    } else if (data_.IsCPU() &&
+               std::count(cpu_supported.begin(), cpu_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::FilterGaussianCPU(data_, dst_im.data_, kernel_size,
+                                         sigma);
     } else {
         utility::LogError(
                 "FilterGaussian with data type {} on device {} is not "
@@ -371,6 +433,7 @@ std::pair<Image, Image> Image::FilterSobel(int kernel_size) const {
             {core::UInt8, 1},
             {core::Float32, 1},
     };
+    static const dtype_channels_pairs &cpu_supported = ipp_supported;
 
     // Routines: 8u16s, 32f
     Image dst_im_dx, dst_im_dy;
@@ -390,11 +453,16 @@ std::pair<Image, Image> Image::FilterSobel(int kernel_size) const {
                    std::make_pair(GetDtype(), GetChannels())) > 0) {
         CUDA_CALL(npp::FilterSobel, data_, dst_im_dx.data_, dst_im_dy.data_,
                   kernel_size);
-    } else if (HAVE_IPPICV && data_.IsCPU() &&
+    } else if (IsIPPEnabled() && data_.IsCPU() &&
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::FilterSobel, data_, dst_im_dx.data_, dst_im_dy.data_,
                  kernel_size);
+    } else if (data_.IsCPU() &&
+               std::count(cpu_supported.begin(), cpu_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::FilterSobelCPU(data_, dst_im_dx.data_, dst_im_dy.data_,
+                                      kernel_size);
     } else {
         utility::LogError(
                 "FilterSobel with data type {} on device {} is not "
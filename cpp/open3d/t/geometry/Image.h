@@ -92,6 +92,10 @@ public:
     }
 
     /// \brief Reinitialize image with new parameters.
+    ///
+    /// The memory is reused if the image already has the same shape, dtype and
+    /// device, and shares its memory with no other tensor. The contents are
+    /// undefined in both cases.
     Image &Reset(int64_t rows = 0,
                  int64_t cols = 0,
                  int64_t channels = 1,
@@ -350,6 +354,16 @@ public:
     static constexpr bool HAVE_IPPICV = false;
 #endif
 
+    /// \brief Enable or disable IPP for CPU image operations at runtime.
+    ///
+    /// When IPP is disabled or not available, the CPU operations fall back to
+    /// portable implementations. This is mostly useful for benchmarking and
+    /// for testing the portable implementations on IPP builds.
+    static void SetIPPEnabled(bool enabled);
+
+    /// \brief Returns true if CPU image operations are dispatched to IPP.
+    static bool IsIPPEnabled();
+
 protected:
     /// Internal data of the Image, represented as a contiguous 3D tensor of
     /// shape {rows, cols, channels}. Image properties can be obtained from the
@@ -358,6 +358,34 @@ PointCloud PointCloud::RandomDownSample(double sampling_ratio) const {
             false, false);
 }
 
+core::Tensor PointCloud::SortByMortonCode() {
+    if (!HasPointPositions()) {
+        return core::Tensor::Empty({0}, core::Int64, GetDevice());
+    }
+    core::AssertTensorDtypes(GetPointPositions(),
+                             {core::Float32, core::Float64});
+
+    core::Tensor permutation;
+    if (IsCPU()) {
+        kernel::pointcloud::SortByMortonCodeCPU(
+                GetPointPositions().Contiguous(), permutation);
+    } else if (IsCUDA()) {
+        CUDA_CALL(kernel::pointcloud::SortByMortonCodeCUDA,
+                  GetPointPositions().Contiguous(), permutation);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+
+    const core::TensorKey key = core::TensorKey::IndexTensor(permutation);
+    for (auto &kv : point_attr_) {
+        if (HasPointAttr(kv.first)) {
+            kv.second = kv.second.GetItem(key);
+        }
+    }
+
+    return permutation;
+}
+
 std::tuple<PointCloud, core::Tensor> PointCloud::RemoveRadiusOutliers(
         size_t nb_points, double search_radius) const {
     if (nb_points < 1 || search_radius <= 0) {
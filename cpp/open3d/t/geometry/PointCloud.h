@@ -364,6 +364,19 @@ public:
     std::tuple<PointCloud, core::Tensor> RemoveRadiusOutliers(
             size_t nb_points, double search_radius) const;
 
+    /// \brief Reorders the points along a 3D Morton (Z-order) curve.
+    ///
+    /// Points are quantized to a 2^21 grid per axis spanning their bounding
+    /// box, and sorted by their 63-bit Morton codes. All point attributes are
+    /// reordered with the same permutation, so that points close in space are
+    /// also close in memory. This improves the cache locality of neighbor
+    /// searches and voxel operations on unorganized point clouds.
+    ///
+    /// \return Int64 tensor of shape {n,}, where element i is the index of the
+    /// point before sorting that is now at position i. Use it with
+    /// SelectByIndex() or scatter with it to restore the original order.
+    core::Tensor SortByMortonCode();
+
     /// \brief Returns the device attribute of this PointCloud.
     core::Device GetDevice() const override { return device_; }
 
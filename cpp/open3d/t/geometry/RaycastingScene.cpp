@@ -36,10 +36,15 @@
 #include <tutorials/common/math/closest_point.h>
 
 #include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <Eigen/LU>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 #include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/core/hashmap/HashMap.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
 
@@ -74,6 +79,22 @@ void AssertTensorDtypeLastDimDeviceMinNDim(const open3d::core::Tensor& tensor,
                                     open3d::core::Dtype::FromType<DTYPE>());
 }
 
+// Information about a geometry attached to the scene. For instances the
+// buffers are the buffers of the instanced prototype.
+struct GeometryInfo {
+    RTCGeometryType type;
+    const float* vertex_positions;
+    const uint32_t* triangle_indices;
+    size_t num_vertices;
+};
+
+// Returns the ID of the geometry that has been hit. For instances this is the
+// ID of the instance and not the ID of the geometry in the prototype scene.
+inline unsigned int GetHitGeometryID(unsigned int geom_id,
+                                     unsigned int inst_id) {
+    return inst_id != RTC_INVALID_GEOMETRY_ID ? inst_id : geom_id;
+}
+
 struct CountIntersectionsContext {
     RTCIntersectContext context;
     std::vector<std::tuple<uint32_t, uint32_t, float>>*
@@ -110,10 +131,12 @@ void CountIntersectionsFunc(const RTCFilterFunctionNArguments* args) {
         RTCHit hit = rtcGetHitFromHitN(hitN, N, ui);
 
         unsigned int ray_id = ray.id;
-        std::tuple<uint32_t, uint32_t, float> gpID(hit.geomID, hit.primID,
+        const unsigned int geom_id =
+                GetHitGeometryID(hit.geomID, hit.instID[0]);
+        std::tuple<uint32_t, uint32_t, float> gpID(geom_id, hit.primID,
                                                    ray.tfar);
         auto& prev_gpIDtfar = previous_geom_prim_ID_tfar->operator[](ray_id);
-        if (std::get<0>(prev_gpIDtfar) != hit.geomID ||
+        if (std::get<0>(prev_gpIDtfar) != geom_id ||
             (std::get<1>(prev_gpIDtfar) != hit.primID &&
              std::get<2>(prev_gpIDtfar) != ray.tfar)) {
             ++(intersections[ray_id]);
@@ -128,20 +151,22 @@ struct ClosestPointResult {
     ClosestPointResult()
         : primID(RTC_INVALID_GEOMETRY_ID),
           geomID(RTC_INVALID_GEOMETRY_ID),
-          geometry_ptrs_ptr() {}
+          geometry_infos_ptr() {}
 
     embree::Vec3f p;
     unsigned int primID;
     unsigned int geomID;
-    std::vector<std::tuple<RTCGeometryType, const void*, const void*>>*
-            geometry_ptrs_ptr;
+    std::vector<GeometryInfo>* geometry_infos_ptr;
 };
 
 // Code adapted from the embree closest_point tutorial.
 bool ClosestPointFunc(RTCPointQueryFunctionArguments* args) {
     using namespace embree;
     assert(args->userPtr);
-    const unsigned int geomID = args->geomID;
+    const unsigned int stack_size = args->context->instStackSize;
+    // For instances we report the ID of the instance in the top level scene.
+    const unsigned int geomID =
+            stack_size > 0 ? args->context->instID[0] : args->geomID;
     const unsigned int primID = args->primID;
 
     // query position in world space
@@ -149,16 +174,12 @@ bool ClosestPointFunc(RTCPointQueryFunctionArguments* args) {
 
     ClosestPointResult* result =
             static_cast<ClosestPointResult*>(args->userPtr);
-    const RTCGeometryType geom_type =
-            std::get<0>(result->geometry_ptrs_ptr->operator[](geomID));
-    const void* ptr1 =
-            std::get<1>(result->geometry_ptrs_ptr->operator[](geomID));
-    const void* ptr2 =
-            std::get<2>(result->geometry_ptrs_ptr->operator[](geomID));
+    const GeometryInfo& info = result->geometry_infos_ptr->operator[](geomID);
 
-    if (RTC_GEOMETRY_TYPE_TRIANGLE == geom_type) {
-        const float* vertex_positions = (const float*)ptr1;
-        const uint32_t* triangle_indices = (const uint32_t*)ptr2;
+    if (RTC_GEOMETRY_TYPE_TRIANGLE == info.type ||
+        RTC_GEOMETRY_TYPE_INSTANCE == info.type) {
+        const float* vertex_positions = info.vertex_positions;
+        const uint32_t* triangle_indices = info.triangle_indices;
 
         Vec3fa v0(vertex_positions[3 * triangle_indices[3 * primID + 0] + 0],
                   vertex_positions[3 * triangle_indices[3 * primID + 0] + 1],
@@ -170,6 +191,20 @@ bool ClosestPointFunc(RTCPointQueryFunctionArguments* args) {
                   vertex_positions[3 * triangle_indices[3 * primID + 2] + 1],
                   vertex_positions[3 * triangle_indices[3 * primID + 2] + 2]);
 
+        if (stack_size > 0) {
+            // Transform the triangle to world space. This is also correct for
+            // transforms which are not similarity transforms.
+            Eigen::Map<const Eigen::Matrix4f> inst2world(
+                    static_cast<const float*>(args->context->inst2world[0]));
+            for (Vec3fa* v : {&v0, &v1, &v2}) {
+                Eigen::Vector3f v_world =
+                        inst2world.topLeftCorner<3, 3>() *
+                                Eigen::Vector3f(v->x, v->y, v->z) +
+                        inst2world.topRightCorner<3, 1>();
+                *v = Vec3fa(v_world.x(), v_world.y(), v_world.z());
+            }
+        }
+
         // Determine distance to closest point on triangle (implemented in
         // common/math/closest_point.h).
         const Vec3fa p = closestPointTriangle(q, v0, v1, v2);
@@ -196,17 +231,214 @@ namespace open3d {
 namespace t {
 namespace geometry {
 
+namespace {
+
+// Generates the rays of a LiDAR scan on the fly.
+class LidarRayGenerator {
+public:
+    LidarRayGenerator(const LidarModel& model,
+                      const core::Tensor& start_pose,
+                      const core::Tensor& end_pose) {
+        core::AssertTensorDevice(model.elevation_angles_deg_, core::Device());
+        core::AssertTensorShape(model.elevation_angles_deg_,
+                                {utility::nullopt});
+        core::AssertTensorDevice(start_pose, core::Device());
+        core::AssertTensorShape(start_pose, {4, 4});
+        core::AssertTensorDevice(end_pose, core::Device());
+        core::AssertTensorShape(end_pose, {4, 4});
+
+        num_beams_ = model.elevation_angles_deg_.GetLength();
+        num_columns_ = model.num_columns_;
+        if (num_beams_ <= 0 || num_columns_ <= 0) {
+            utility::LogError(
+                    "The LiDAR model must have at least one beam and one "
+                    "column but got {} beams and {} columns.",
+                    num_beams_, num_columns_);
+        }
+        if (model.scan_duration_ < 0) {
+            utility::LogError("The scan duration must be >= 0 but got {}.",
+                              model.scan_duration_);
+        }
+
+        const double deg2rad = M_PI / 180;
+        auto elevations =
+                model.elevation_angles_deg_.To(core::Float64).Contiguous();
+        core::Tensor offsets;
+        if (model.azimuth_offsets_deg_.NumElements() > 0) {
+            core::AssertTensorDevice(model.azimuth_offsets_deg_,
+                                     core::Device());
+            core::AssertTensorShape(model.azimuth_offsets_deg_, {num_beams_});
+            offsets = model.azimuth_offsets_deg_.To(core::Float64).Contiguous();
+        } else {
+            offsets = core::Tensor::Zeros({num_beams_}, core::Float64);
+        }
+        const double* elevations_ptr = elevations.GetDataPtr<double>();
+        const double* offsets_ptr = offsets.GetDataPtr<double>();
+        for (int64_t beam = 0; beam < num_beams_; ++beam) {
+            beam_cos_elevations_.push_back(
+                    std::cos(elevations_ptr[beam] * deg2rad));
+            beam_sin_elevations_.push_back(
+                    std::sin(elevations_ptr[beam] * deg2rad));
+            beam_azimuth_offsets_.push_back(offsets_ptr[beam] * deg2rad);
+        }
+        for (int64_t column = 0; column < num_columns_; ++column) {
+            const double azimuth_deg =
+                    model.azimuth_start_deg_ +
+                    model.azimuth_fov_deg_ * (column + 0.5) / num_columns_;
+            column_azimuths_.push_back(azimuth_deg * deg2rad);
+        }
+
+        // The sensor pose changes with every column for spinning sensors and
+        // with every row for solid state sensors.
+        spinning_ = model.scan_pattern_ == LidarModel::ScanPattern::Spinning;
+        const int64_t num_slots = spinning_ ? num_columns_ : num_beams_;
+        auto start_pose_contig = start_pose.To(core::Float64).Contiguous();
+        auto end_pose_contig = end_pose.To(core::Float64).Contiguous();
+        Eigen::Map<const Eigen::Matrix<double, 4, 4, Eigen::RowMajor>> T0(
+                start_pose_contig.GetDataPtr<double>());
+        Eigen::Map<const Eigen::Matrix<double, 4, 4, Eigen::RowMajor>> T1(
+                end_pose_contig.GetDataPtr<double>());
+        const Eigen::Quaterniond q0(Eigen::Matrix3d(T0.block<3, 3>(0, 0)));
+        const Eigen::Quaterniond q1(Eigen::Matrix3d(T1.block<3, 3>(0, 0)));
+        for (int64_t slot = 0; slot < num_slots; ++slot) {
+            const double alpha = double(slot) / num_slots;
+            slot_rotations_.push_back(q0.slerp(alpha, q1).toRotationMatrix());
+            slot_origins_.push_back(
+                    ((1 - alpha) * T0.block<3, 1>(0, 3) +
+                     alpha * T1.block<3, 1>(0, 3))
+                            .cast<float>());
+            slot_timestamps_.push_back(alpha * model.scan_duration_);
+        }
+    }
+
+    int64_t NumRays() const { return num_beams_ * num_columns_; }
+
+    int64_t GetBeam(int64_t idx) const { return idx / num_columns_; }
+
+    double GetTimestamp(int64_t idx) const {
+        return slot_timestamps_[GetSlot(idx)];
+    }
+
+    // Writes the ray with the given index in the format
+    // [ox, oy, oz, dx, dy, dz] with normalized direction.
+    void GetRay(int64_t idx, float* ray) const {
+        const int64_t beam = idx / num_columns_;
+        const int64_t column = idx % num_columns_;
+        const double azimuth =
+                column_azimuths_[column] + beam_azimuth_offsets_[beam];
+        const Eigen::Vector3d dir(
+                beam_cos_elevations_[beam] * std::cos(azimuth),
+                beam_cos_elevations_[beam] * std::sin(azimuth),
+                beam_sin_elevations_[beam]);
+        const int64_t slot = GetSlot(idx);
+        Eigen::Map<Eigen::Vector3f> origin_map(ray);
+        Eigen::Map<Eigen::Vector3f> dir_map(ray + 3);
+        origin_map = slot_origins_[slot];
+        dir_map = (slot_rotations_[slot] * dir).cast<float>();
+    }
+
+private:
+    int64_t GetSlot(int64_t idx) const {
+        return spinning_ ? idx % num_columns_ : idx / num_columns_;
+    }
+
+    int64_t num_beams_;
+    int64_t num_columns_;
+    bool spinning_;
+    std::vector<double> beam_cos_elevations_;
+    std::vector<double> beam_sin_elevations_;
+    std::vector<double> beam_azimuth_offsets_;
+    std::vector<double> column_azimuths_;
+    std::vector<Eigen::Matrix3d> slot_rotations_;
+    std::vector<Eigen::Vector3f> slot_origins_;
+    std::vector<double> slot_timestamps_;
+};
+
+// A hit of a simulated LiDAR ray.
+struct LidarHit {
+    int64_t ray_idx;
+    float position[3];
+    float range;
+    float intensity;
+};
+
+}  // namespace
+
 struct RaycastingScene::Impl {
     // The maximum number of rays used in calls to embree.
     const size_t BATCH_SIZE = 1024;
     RTCDevice device_;
     RTCScene scene_;
     bool scene_committed_;  // true if the scene has been committed.
-    // Vector for storing some information about the added geometry.
-    std::vector<std::tuple<RTCGeometryType, const void*, const void*>>
-            geometry_ptrs_;
+    BuildQuality build_quality_;
+    // Vector for storing some information about the added geometry. The
+    // vector is indexed with the geometry ID. Removed geometry has nullptr
+    // buffers.
+    std::vector<GeometryInfo> geometry_infos_;
+    // Prototype scenes for instancing. Each scene contains a single mesh.
+    std::vector<std::tuple<RTCScene, GeometryInfo>> prototypes_;
+    // Matrices for transforming the object space normals of instance hits to
+    // world space.
+    std::unordered_map<uint32_t, Eigen::Matrix3f> instance_normal_matrices_;
     core::Device tensor_device_;  // cpu
 
+    // Sparse cache for signed distance queries. The keys are the cell
+    // coordinates and the level of the cell. The values are the distances at
+    // the 8 corners of the cell and a flag which is true if the cell meets the
+    // error bound.
+    std::shared_ptr<core::HashMap> sdf_cache_;
+    float sdf_cache_voxel_size_;
+    float sdf_cache_max_error_;
+    int sdf_cache_max_level_;
+
+    // Marks the scene as modified and invalidates cached query results.
+    void SceneChanged() {
+        scene_committed_ = false;
+        if (sdf_cache_) {
+            sdf_cache_->Clear();
+        }
+    }
+
+    // Applies the build quality and the matching flags to the scene.
+    void SetSceneBuildQuality(RTCScene scene) {
+        RTCSceneFlags flags = RTCSceneFlags(
+                RTC_SCENE_FLAG_ROBUST | RTC_SCENE_FLAG_CONTEXT_FILTER_FUNCTION);
+        RTCBuildQuality quality = RTC_BUILD_QUALITY_MEDIUM;
+        if (build_quality_ == BuildQuality::Low) {
+            // The dynamic flag keeps the acceleration structures of unchanged
+            // geometry and speeds up rebuilds at the cost of memory.
+            flags = RTCSceneFlags(flags | RTC_SCENE_FLAG_DYNAMIC);
+            quality = RTC_BUILD_QUALITY_LOW;
+        } else if (build_quality_ == BuildQuality::High) {
+            quality = RTC_BUILD_QUALITY_HIGH;
+        }
+        // set flag for better accuracy
+        rtcSetSceneFlags(scene, flags);
+        rtcSetSceneBuildQuality(scene, quality);
+    }
+
+    // Stores the info of newly attached geometry. Embree may reuse the IDs of
+    // removed geometry.
+    void SetGeometryInfo(uint32_t geom_id, const GeometryInfo& info) {
+        if (geom_id >= geometry_infos_.size()) {
+            geometry_infos_.resize(
+                    geom_id + 1,
+                    GeometryInfo{RTC_GEOMETRY_TYPE_TRIANGLE, nullptr, nullptr,
+                                 0});
+        }
+        geometry_infos_[geom_id] = info;
+    }
+
+    // Returns the info for the geometry ID and checks that the geometry
+    // exists.
+    const GeometryInfo& GetGeometryInfo(uint32_t geom_id) const {
+        if (geom_id >= geometry_infos_.size() ||
+            !geometry_infos_[geom_id].vertex_positions) {
+            utility::LogError("Invalid geometry ID {}", geom_id);
+        }
+        return geometry_infos_[geom_id];
+    }
+
     template <bool LINE_INTERSECTION>
     void CastRays(const float* const rays,
                   const size_t num_rays,
@@ -263,16 +495,23 @@ struct RaycastingScene::Impl {
                 size_t idx = rh.ray.id + range.begin();
                 t_hit[idx] = rh.ray.tfar;
                 if (rh.hit.geomID != RTC_INVALID_GEOMETRY_ID) {
-                    geometry_ids[idx] = rh.hit.geomID;
+                    geometry_ids[idx] =
+                            GetHitGeometryID(rh.hit.geomID, rh.hit.instID[0]);
                     primitive_ids[idx] = rh.hit.primID;
                     primitive_uvs[idx * 2 + 0] = rh.hit.u;
                     primitive_uvs[idx * 2 + 1] = rh.hit.v;
-                    float inv_norm = 1.f / std::sqrt(rh.hit.Ng_x * rh.hit.Ng_x +
-                                                     rh.hit.Ng_y * rh.hit.Ng_y +
-                                                     rh.hit.Ng_z * rh.hit.Ng_z);
-                    primitive_normals[idx * 3 + 0] = rh.hit.Ng_x * inv_norm;
-                    primitive_normals[idx * 3 + 1] = rh.hit.Ng_y * inv_norm;
-                    primitive_normals[idx * 3 + 2] = rh.hit.Ng_z * inv_norm;
+                    Eigen::Vector3f normal(rh.hit.Ng_x, rh.hit.Ng_y,
+                                           rh.hit.Ng_z);
+                    if (rh.hit.instID[0] != RTC_INVALID_GEOMETRY_ID) {
+                        // Normals of instance hits are in object space.
+                        normal = instance_normal_matrices_.at(
+                                         rh.hit.instID[0]) *
+                                 normal;
+                    }
+                    normal.normalize();
+                    primitive_normals[idx * 3 + 0] = normal.x();
+                    primitive_normals[idx * 3 + 1] = normal.y();
+                    primitive_normals[idx * 3 + 2] = normal.z();
                 } else {
                     geometry_ids[idx] = RTC_INVALID_GEOMETRY_ID;
                     primitive_ids[idx] = RTC_INVALID_GEOMETRY_ID;
@@ -299,6 +538,96 @@ struct RaycastingScene::Impl {
         }
     }
 
+    // Casts the rays of a LiDAR scan and stores only the hits. The hits of
+    // each batch are stored in a separate vector to keep the order of the
+    // rays.
+    void CastRaysLidar(const LidarRayGenerator& generator,
+                       const float max_range,
+                       std::vector<std::vector<LidarHit>>& batch_hits,
+                       const int nthreads) {
+        if (!scene_committed_) {
+            rtcCommitScene(scene_);
+            scene_committed_ = true;
+        }
+
+        struct RTCIntersectContext context;
+        rtcInitIntersectContext(&context);
+
+        const size_t num_rays = generator.NumRays();
+        const size_t num_batches = (num_rays + BATCH_SIZE - 1) / BATCH_SIZE;
+        batch_hits.resize(num_batches);
+
+        auto LoopFn = [&](const tbb::blocked_range<size_t>& batch_range) {
+            std::vector<RTCRayHit> rayhits(BATCH_SIZE);
+            for (size_t batch = batch_range.begin(); batch < batch_range.end();
+                 ++batch) {
+                const size_t begin = batch * BATCH_SIZE;
+                const size_t end = std::min(begin + BATCH_SIZE, num_rays);
+
+                for (size_t i = begin; i < end; ++i) {
+                    RTCRayHit& rh = rayhits[i - begin];
+                    float r[6];
+                    generator.GetRay(i, r);
+                    rh.ray.org_x = r[0];
+                    rh.ray.org_y = r[1];
+                    rh.ray.org_z = r[2];
+                    rh.ray.dir_x = r[3];
+                    rh.ray.dir_y = r[4];
+                    rh.ray.dir_z = r[5];
+                    rh.ray.tnear = 0;
+                    rh.ray.tfar = max_range;
+                    rh.ray.mask = 0;
+                    rh.ray.id = i - begin;
+                    rh.ray.flags = 0;
+                    rh.hit.geomID = RTC_INVALID_GEOMETRY_ID;
+                    rh.hit.instID[0] = RTC_INVALID_GEOMETRY_ID;
+                }
+
+                rtcIntersect1M(scene_, &context, &rayhits[0], end - begin,
+                               sizeof(RTCRayHit));
+
+                std::vector<LidarHit>& hits = batch_hits[batch];
+                for (size_t i = begin; i < end; ++i) {
+                    const RTCRayHit& rh = rayhits[i - begin];
+                    if (rh.hit.geomID == RTC_INVALID_GEOMETRY_ID) {
+                        continue;
+                    }
+                    Eigen::Vector3f normal(rh.hit.Ng_x, rh.hit.Ng_y,
+                                           rh.hit.Ng_z);
+                    if (rh.hit.instID[0] != RTC_INVALID_GEOMETRY_ID) {
+                        // Normals of instance hits are in object space.
+                        normal = instance_normal_matrices_.at(
+                                         rh.hit.instID[0]) *
+                                 normal;
+                    }
+                    normal.normalize();
+                    const Eigen::Vector3f dir(rh.ray.dir_x, rh.ray.dir_y,
+                                              rh.ray.dir_z);
+
+                    LidarHit hit;
+                    hit.ray_idx = i;
+                    hit.position[0] = rh.ray.org_x + rh.ray.tfar * dir.x();
+                    hit.position[1] = rh.ray.org_y + rh.ray.tfar * dir.y();
+                    hit.position[2] = rh.ray.org_z + rh.ray.tfar * dir.z();
+                    hit.range = rh.ray.tfar;
+                    hit.intensity = std::abs(normal.dot(dir));
+                    hits.push_back(hit);
+                }
+            }
+        };
+
+        if (nthreads > 0) {
+            tbb::task_arena arena(nthreads);
+            arena.execute([&]() {
+                tbb::parallel_for(tbb::blocked_range<size_t>(0, num_batches),
+                                  LoopFn);
+            });
+        } else {
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, num_batches),
+                              LoopFn);
+        }
+    }
+
     void TestOcclusions(const float* const rays,
                         const size_t num_rays,
                         const float tnear,
@@ -439,7 +768,7 @@ struct RaycastingScene::Impl {
                 query.time = 0.f;
 
                 ClosestPointResult result;
-                result.geometry_ptrs_ptr = &geometry_ptrs_;
+                result.geometry_infos_ptr = &geometry_infos_;
 
                 RTCPointQueryContext instStack;
                 rtcInitPointQueryContext(&instStack);
@@ -469,40 +798,25 @@ struct RaycastingScene::Impl {
     }
 };
 
-RaycastingScene::RaycastingScene() : impl_(new RaycastingScene::Impl()) {
-    impl_->device_ = rtcNewDevice(NULL);
-    rtcSetDeviceErrorFunction(impl_->device_, ErrorFunction, NULL);
-
-    impl_->scene_ = rtcNewScene(impl_->device_);
-    // set flag for better accuracy
-    rtcSetSceneFlags(
-            impl_->scene_,
-            RTC_SCENE_FLAG_ROBUST | RTC_SCENE_FLAG_CONTEXT_FILTER_FUNCTION);
-
-    impl_->scene_committed_ = false;
-}
-
-RaycastingScene::~RaycastingScene() {
-    rtcReleaseScene(impl_->scene_);
-    rtcReleaseDevice(impl_->device_);
-}
+namespace {
 
-uint32_t RaycastingScene::AddTriangles(const core::Tensor& vertex_positions,
-                                       const core::Tensor& triangle_indices) {
-    core::AssertTensorDevice(vertex_positions, impl_->tensor_device_);
+// Creates a triangle geometry with a copy of the vertices and triangles.
+RTCGeometry NewTriangleGeometry(RTCDevice device,
+                                const core::Tensor& vertex_positions,
+                                const core::Tensor& triangle_indices,
+                                const core::Device& tensor_device,
+                                GeometryInfo& info) {
+    core::AssertTensorDevice(vertex_positions, tensor_device);
     core::AssertTensorShape(vertex_positions, {utility::nullopt, 3});
     core::AssertTensorDtype(vertex_positions, core::Float32);
-    core::AssertTensorDevice(triangle_indices, impl_->tensor_device_);
+    core::AssertTensorDevice(triangle_indices, tensor_device);
     core::AssertTensorShape(triangle_indices, {utility::nullopt, 3});
     core::AssertTensorDtype(triangle_indices, core::UInt32);
 
     const size_t num_vertices = vertex_positions.GetLength();
     const size_t num_triangles = triangle_indices.GetLength();
 
-    // scene needs to be recommitted
-    impl_->scene_committed_ = false;
-    RTCGeometry geom =
-            rtcNewGeometry(impl_->device_, RTC_GEOMETRY_TYPE_TRIANGLE);
+    RTCGeometry geom = rtcNewGeometry(device, RTC_GEOMETRY_TYPE_TRIANGLE);
 
     // rtcSetNewGeometryBuffer will take care of alignment and padding
     float* vertex_buffer = (float*)rtcSetNewGeometryBuffer(
@@ -525,12 +839,56 @@ uint32_t RaycastingScene::AddTriangles(const core::Tensor& vertex_positions,
     }
     rtcCommitGeometry(geom);
 
+    info = GeometryInfo{RTC_GEOMETRY_TYPE_TRIANGLE, vertex_buffer,
+                        index_buffer, num_vertices};
+    return geom;
+}
+
+// Converts the transform to a column major float matrix for embree.
+Eigen::Matrix4f TransformToEigen(const core::Tensor& transform) {
+    core::AssertTensorDevice(transform, core::Device());
+    core::AssertTensorShape(transform, {4, 4});
+    // Transpose to get the column major layout expected by Eigen.
+    auto transform_contig = transform.To(core::Float32).T().Contiguous();
+    return Eigen::Map<const Eigen::Matrix4f>(
+            transform_contig.GetDataPtr<float>());
+}
+
+}  // namespace
+
+RaycastingScene::RaycastingScene(BuildQuality build_quality)
+    : impl_(new RaycastingScene::Impl()) {
+    impl_->device_ = rtcNewDevice(NULL);
+    rtcSetDeviceErrorFunction(impl_->device_, ErrorFunction, NULL);
+
+    impl_->build_quality_ = build_quality;
+    impl_->scene_ = rtcNewScene(impl_->device_);
+    impl_->SetSceneBuildQuality(impl_->scene_);
+
+    impl_->scene_committed_ = false;
+}
+
+RaycastingScene::~RaycastingScene() {
+    rtcReleaseScene(impl_->scene_);
+    for (auto& prototype : impl_->prototypes_) {
+        rtcReleaseScene(std::get<0>(prototype));
+    }
+    rtcReleaseDevice(impl_->device_);
+}
+
+uint32_t RaycastingScene::AddTriangles(const core::Tensor& vertex_positions,
+                                       const core::Tensor& triangle_indices) {
+    GeometryInfo info;
+    RTCGeometry geom =
+            NewTriangleGeometry(impl_->device_, vertex_positions,
+                                triangle_indices, impl_->tensor_device_, info);
+
+    // scene needs to be recommitted
+    impl_->SceneChanged();
     uint32_t geom_id = rtcAttachGeometry(impl_->scene_, geom);
     rtcReleaseGeometry(geom);
 
-    impl_->geometry_ptrs_.push_back(std::make_tuple(RTC_GEOMETRY_TYPE_TRIANGLE,
-                                                    (const void*)vertex_buffer,
-                                                    (const void*)index_buffer));
+    impl_->SetGeometryInfo(geom_id, info);
     return geom_id;
 }
 
@@ -545,6 +903,125 @@ uint32_t RaycastingScene::AddTriangles(const TriangleMesh& mesh) {
                         mesh.GetTriangleIndices().To(core::UInt32));
 }
 
+void RaycastingScene::RemoveGeometry(uint32_t geometry_id) {
+    impl_->GetGeometryInfo(geometry_id);
+    rtcDetachGeometry(impl_->scene_, geometry_id);
+    impl_->geometry_infos_[geometry_id] =
+            GeometryInfo{RTC_GEOMETRY_TYPE_TRIANGLE, nullptr, nullptr, 0};
+    impl_->instance_normal_matrices_.erase(geometry_id);
+    impl_->SceneChanged();
+}
+
+void RaycastingScene::UpdateTriangleVertices(
+        uint32_t geometry_id, const core::Tensor& vertex_positions) {
+    const GeometryInfo& info = impl_->GetGeometryInfo(geometry_id);
+    if (info.type != RTC_GEOMETRY_TYPE_TRIANGLE) {
+        utility::LogError(
+                "Geometry {} is an instance. Only the vertices of triangle "
+                "meshes added with AddTriangles can be updated.",
+                geometry_id);
+    }
+    core::AssertTensorDevice(vertex_positions, impl_->tensor_device_);
+    core::AssertTensorShape(vertex_positions,
+                            {int64_t(info.num_vertices), 3});
+    core::AssertTensorDtype(vertex_positions, core::Float32);
+
+    RTCGeometry geom = rtcGetGeometry(impl_->scene_, geometry_id);
+    {
+        auto data = vertex_positions.Contiguous();
+        memcpy(const_cast<float*>(info.vertex_positions), data.GetDataPtr(),
+               sizeof(float) * 3 * info.num_vertices);
+    }
+    rtcUpdateGeometryBuffer(geom, RTC_BUFFER_TYPE_VERTEX, 0);
+    // Keep the topology of the BVH and only update the bounds.
+    rtcSetGeometryBuildQuality(geom, RTC_BUILD_QUALITY_REFIT);
+    rtcCommitGeometry(geom);
+    impl_->SceneChanged();
+}
+
+uint32_t RaycastingScene::AddPrototype(const core::Tensor& vertex_positions,
+                                       const core::Tensor& triangle_indices) {
+    GeometryInfo info;
+    RTCGeometry geom =
+            NewTriangleGeometry(impl_->device_, vertex_positions,
+                                triangle_indices, impl_->tensor_device_, info);
+
+    // The prototype scene is built once and reused by all instances.
+    RTCScene scene = rtcNewScene(impl_->device_);
+    impl_->SetSceneBuildQuality(scene);
+    rtcAttachGeometry(scene, geom);
+    rtcReleaseGeometry(geom);
+    rtcCommitScene(scene);
+
+    impl_->prototypes_.push_back(std::make_tuple(scene, info));
+    return uint32_t(impl_->prototypes_.size() - 1);
+}
+
+uint32_t RaycastingScene::AddPrototype(const TriangleMesh& mesh) {
+    size_t num_verts = mesh.GetVertexPositions().GetLength();
+    if (num_verts > std::numeric_limits<uint32_t>::max()) {
+        utility::LogError(
+                "Cannot add mesh with more than {} vertices to the scene",
+                std::numeric_limits<uint32_t>::max());
+    }
+    return AddPrototype(mesh.GetVertexPositions(),
+                        mesh.GetTriangleIndices().To(core::UInt32));
+}
+
+uint32_t RaycastingScene::AddInstance(uint32_t prototype_id,
+                                      const core::Tensor& transform) {
+    if (prototype_id >= impl_->prototypes_.size()) {
+        utility::LogError("Invalid prototype ID {}", prototype_id);
+    }
+    const Eigen::Matrix4f transform_eigen = TransformToEigen(transform);
+
+    RTCGeometry geom =
+            rtcNewGeometry(impl_->device_, RTC_GEOMETRY_TYPE_INSTANCE);
+    rtcSetGeometryInstancedScene(geom,
+                                 std::get<0>(impl_->prototypes_[prototype_id]));
+    rtcSetGeometryTransform(geom, 0, RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR,
+                            transform_eigen.data());
+    rtcCommitGeometry(geom);
+
+    impl_->SceneChanged();
+    uint32_t geom_id = rtcAttachGeometry(impl_->scene_, geom);
+    rtcReleaseGeometry(geom);
+
+    GeometryInfo info = std::get<1>(impl_->prototypes_[prototype_id]);
+    info.type = RTC_GEOMETRY_TYPE_INSTANCE;
+    impl_->SetGeometryInfo(geom_id, info);
+    impl_->instance_normal_matrices_[geom_id] =
+            transform_eigen.topLeftCorner<3, 3>().inverse().transpose();
+    return geom_id;
+}
+
+void RaycastingScene::SetInstanceTransform(uint32_t geometry_id,
+                                           const core::Tensor& transform) {
+    const GeometryInfo& info = impl_->GetGeometryInfo(geometry_id);
+    if (info.type != RTC_GEOMETRY_TYPE_INSTANCE) {
+        utility::LogError("Geometry {} is not an instance.", geometry_id);
+    }
+    const Eigen::Matrix4f transform_eigen = TransformToEigen(transform);
+
+    RTCGeometry geom = rtcGetGeometry(impl_->scene_, geometry_id);
+    rtcSetGeometryTransform(geom, 0, RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR,
+                            transform_eigen.data());
+    rtcCommitGeometry(geom);
+    impl_->instance_normal_matrices_[geometry_id] =
+            transform_eigen.topLeftCorner<3, 3>().inverse().transpose();
+    impl_->SceneChanged();
+}
+
+void RaycastingScene::SetBuildQuality(BuildQuality build_quality) {
+    impl_->build_quality_ = build_quality;
+    impl_->SetSceneBuildQuality(impl_->scene_);
+    impl_->scene_committed_ = false;
+}
+
+RaycastingScene::BuildQuality RaycastingScene::GetBuildQuality() const {
+    return impl_->build_quality_;
+}
+
 std::unordered_map<std::string, core::Tensor> RaycastingScene::CastRays(
         const core::Tensor& rays, const int nthreads) {
     AssertTensorDtypeLastDimDeviceMinNDim<float>(rays, "rays", 6,
@@ -668,6 +1145,14 @@ core::Tensor RaycastingScene::ComputeSignedDistance(
         const core::Tensor& query_points, const int nthreads) {
     AssertTensorDtypeLastDimDeviceMinNDim<float>(query_points, "query_points",
                                                  3, impl_->tensor_device_);
+    if (impl_->sdf_cache_) {
+        return ComputeSignedDistanceCached(query_points, nthreads);
+    }
+    return ComputeSignedDistanceExact(query_points, nthreads);
+}
+
+core::Tensor RaycastingScene::ComputeSignedDistanceExact(
+        const core::Tensor& query_points, const int nthreads) {
     auto shape = query_points.GetShape();
     shape.pop_back();  // Remove last dim, we want to use this shape for the
                        // results.
@@ -704,6 +1189,12 @@ core::Tensor RaycastingScene::ComputeOccupancy(const core::Tensor& query_points,
                        // results.
     size_t num_query_points = shape.NumElements();
 
+    if (impl_->sdf_cache_) {
+        return ComputeSignedDistanceCached(query_points, nthreads)
+                .Lt(0)
+                .To(core::Float32);
+    }
+
     core::Tensor rays({int64_t(num_query_points), 6}, core::Float32);
     rays.SetItem({core::TensorKey::Slice(0, num_query_points, 1),
                   core::TensorKey::Slice(0, 3, 1)},
@@ -720,6 +1211,152 @@ core::Tensor RaycastingScene::ComputeOccupancy(const core::Tensor& query_points,
     return intersections.To(core::Float32).Reshape(shape);
 }
 
+core::Tensor RaycastingScene::ComputeSignedDistanceCached(
+        const core::Tensor& query_points, const int nthreads) {
+    auto shape = query_points.GetShape();
+    shape.pop_back();  // Remove last dim, we want to use this shape for the
+                       // results.
+    const int64_t num_query_points = shape.NumElements();
+
+    core::HashMap& cache = *impl_->sdf_cache_;
+    core::Tensor points =
+            query_points.Contiguous().Reshape({num_query_points, 3});
+    core::Tensor distance({num_query_points}, core::Float32);
+    float* distance_ptr = distance.GetDataPtr<float>();
+
+    // Indices of the query points which have not been resolved yet.
+    core::Tensor pending =
+            core::Tensor::Arange(0, num_query_points, 1, core::Int64);
+    for (int level = 0;
+         level <= impl_->sdf_cache_max_level_ && pending.GetLength() > 0;
+         ++level) {
+        const float cell_size = impl_->sdf_cache_voxel_size_ / (1 << level);
+        const int64_t num_pending = pending.GetLength();
+        core::Tensor pending_points = points.IndexGet({pending});
+        core::Tensor keys = core::Concatenate(
+                {pending_points.Div(cell_size).Floor().To(core::Int32),
+                 core::Tensor::Full({num_pending, 1}, level, core::Int32)},
+                1);
+
+        // Fill the cells which are not in the cache yet with exact distances
+        // at the corners and the center.
+        core::Tensor buf_indices, masks;
+        cache.Activate(keys, buf_indices, masks);
+        core::Tensor new_keys = keys.IndexGet({masks});
+        const int64_t num_new = new_keys.GetLength();
+        if (num_new > 0) {
+            core::Tensor samples({num_new, 9, 3}, core::Float32);
+            const int* new_keys_ptr = new_keys.GetDataPtr<int>();
+            float* samples_ptr = samples.GetDataPtr<float>();
+            for (int64_t i = 0; i < num_new; ++i) {
+                const int* key = &new_keys_ptr[4 * i];
+                for (int j = 0; j < 9; ++j) {
+                    float* sample = &samples_ptr[27 * i + 3 * j];
+                    for (int axis = 0; axis < 3; ++axis) {
+                        const float offset =
+                                j < 8 ? float((j >> axis) & 1) : 0.5f;
+                        sample[axis] = (key[axis] + offset) * cell_size;
+                    }
+                }
+            }
+            core::Tensor sample_distances =
+                    ComputeSignedDistanceExact(samples, nthreads);
+            core::Tensor corners =
+                    sample_distances.Slice(1, 0, 8).Contiguous();
+            core::Tensor centers = sample_distances.Slice(1, 8, 9);
+            // The center of a cell is the mean of the corners for trilinear
+            // interpolation.
+            core::Tensor valid = (corners.Mean({1}, true) - centers)
+                                         .Abs()
+                                         .Le(impl_->sdf_cache_max_error_);
+
+            core::Tensor new_buf_indices =
+                    buf_indices.IndexGet({masks}).To(core::Int64);
+            cache.GetValueTensor(0).IndexSet({new_buf_indices}, corners);
+            cache.GetValueTensor(1).IndexSet({new_buf_indices}, valid);
+        }
+
+        // Interpolate the distances in the cells which meet the error bound.
+        cache.Find(keys, buf_indices, masks);
+        buf_indices = buf_indices.To(core::Int64);
+        core::Tensor corners = cache.GetValueTensor(0).IndexGet({buf_indices});
+        core::Tensor valid =
+                cache.GetValueTensor(1).IndexGet({buf_indices}).Reshape(
+                        {num_pending});
+        const float* points_ptr = pending_points.GetDataPtr<float>();
+        const int* keys_ptr = keys.GetDataPtr<int>();
+        const float* corners_ptr = corners.GetDataPtr<float>();
+        const bool* valid_ptr = valid.GetDataPtr<bool>();
+        const int64_t* pending_ptr = pending.GetDataPtr<int64_t>();
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(0, num_pending),
+                [&](const tbb::blocked_range<int64_t>& range) {
+                    for (int64_t i = range.begin(); i < range.end(); ++i) {
+                        if (!valid_ptr[i]) continue;
+                        float t[3];
+                        for (int axis = 0; axis < 3; ++axis) {
+                            t[axis] = points_ptr[3 * i + axis] / cell_size -
+                                      keys_ptr[4 * i + axis];
+                        }
+                        float value = 0;
+                        for (int j = 0; j < 8; ++j) {
+                            float weight = 1;
+                            for (int axis = 0; axis < 3; ++axis) {
+                                weight *= ((j >> axis) & 1) ? t[axis]
+                                                            : 1 - t[axis];
+                            }
+                            value += weight * corners_ptr[8 * i + j];
+                        }
+                        distance_ptr[pending_ptr[i]] = value;
+                    }
+                });
+        pending = pending.IndexGet({valid.LogicalNot()});
+    }
+
+    // Compute the remaining points exactly.
+    if (pending.GetLength() > 0) {
+        distance.IndexSet({pending}, ComputeSignedDistanceExact(
+                                             points.IndexGet({pending}),
+                                             nthreads));
+    }
+    return distance.Reshape(shape);
+}
+
+void RaycastingScene::EnableSignedDistanceCache(float voxel_size,
+                                                float max_error,
+                                                int max_level,
+                                                int64_t init_capacity) {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be > 0 but got {}.", voxel_size);
+    }
+    if (max_error < 0) {
+        utility::LogError("max_error must be >= 0 but got {}.", max_error);
+    }
+    if (max_level < 0 || max_level > 16) {
+        utility::LogError("max_level must be in [0, 16] but got {}.",
+                          max_level);
+    }
+    impl_->sdf_cache_ = std::make_shared<core::HashMap>(
+            init_capacity, core::Int32, core::SizeVector{4},
+            std::vector<core::Dtype>{core::Float32, core::Bool},
+            std::vector<core::SizeVector>{{8}, {1}}, impl_->tensor_device_);
+    impl_->sdf_cache_voxel_size_ = voxel_size;
+    impl_->sdf_cache_max_error_ = max_error;
+    impl_->sdf_cache_max_level_ = max_level;
+}
+
+void RaycastingScene::DisableSignedDistanceCache() {
+    impl_->sdf_cache_.reset();
+}
+
+bool RaycastingScene::IsSignedDistanceCacheEnabled() const {
+    return impl_->sdf_cache_ != nullptr;
+}
+
+int64_t RaycastingScene::GetSignedDistanceCacheSize() const {
+    return impl_->sdf_cache_ ? impl_->sdf_cache_->Size() : 0;
+}
+
 core::Tensor RaycastingScene::CreateRaysPinhole(
         const core::Tensor& intrinsic_matrix,
         const core::Tensor& extrinsic_matrix,
@@ -818,6 +1455,85 @@ core::Tensor RaycastingScene::CreateRaysPinhole(double fov_deg,
                              height_px);
 }
 
+core::Tensor RaycastingScene::CreateRaysLidar(const LidarModel& model,
+                                              const core::Tensor& start_pose,
+                                              const core::Tensor& end_pose) {
+    LidarRayGenerator generator(model, start_pose, end_pose);
+    core::Tensor rays({model.elevation_angles_deg_.GetLength(),
+                       model.num_columns_, 6},
+                      core::Float32);
+    float* rays_ptr = rays.GetDataPtr<float>();
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, generator.NumRays()),
+                      [&](const tbb::blocked_range<int64_t>& range) {
+                          for (int64_t i = range.begin(); i < range.end();
+                               ++i) {
+                              generator.GetRay(i, &rays_ptr[6 * i]);
+                          }
+                      });
+    return rays;
+}
+
+core::Tensor RaycastingScene::CreateTimestampsLidar(const LidarModel& model) {
+    LidarRayGenerator generator(
+            model, core::Tensor::Eye(4, core::Float64, core::Device()),
+            core::Tensor::Eye(4, core::Float64, core::Device()));
+    core::Tensor timestamps(
+            {model.elevation_angles_deg_.GetLength(), model.num_columns_},
+            core::Float64);
+    double* timestamps_ptr = timestamps.GetDataPtr<double>();
+    for (int64_t i = 0; i < generator.NumRays(); ++i) {
+        timestamps_ptr[i] = generator.GetTimestamp(i);
+    }
+    return timestamps;
+}
+
+PointCloud RaycastingScene::CastRaysLidar(const LidarModel& model,
+                                          const core::Tensor& start_pose,
+                                          const core::Tensor& end_pose,
+                                          float max_range,
+                                          const int nthreads) {
+    LidarRayGenerator generator(model, start_pose, end_pose);
+    std::vector<std::vector<LidarHit>> batch_hits;
+    impl_->CastRaysLidar(generator, max_range, batch_hits, nthreads);
+
+    int64_t num_hits = 0;
+    for (const auto& hits : batch_hits) {
+        num_hits += hits.size();
+    }
+
+    core::Tensor positions({num_hits, 3}, core::Float32);
+    core::Tensor ranges({num_hits, 1}, core::Float32);
+    core::Tensor intensities({num_hits, 1}, core::Float32);
+    core::Tensor timestamps({num_hits, 1}, core::Float32);
+    core::Tensor rings({num_hits, 1}, core::Int32);
+    float* positions_ptr = positions.GetDataPtr<float>();
+    float* ranges_ptr = ranges.GetDataPtr<float>();
+    float* intensities_ptr = intensities.GetDataPtr<float>();
+    float* timestamps_ptr = timestamps.GetDataPtr<float>();
+    int* rings_ptr = rings.GetDataPtr<int>();
+
+    int64_t idx = 0;
+    for (const auto& hits : batch_hits) {
+        for (const LidarHit& hit : hits) {
+            positions_ptr[3 * idx + 0] = hit.position[0];
+            positions_ptr[3 * idx + 1] = hit.position[1];
+            positions_ptr[3 * idx + 2] = hit.position[2];
+            ranges_ptr[idx] = hit.range;
+            intensities_ptr[idx] = hit.intensity;
+            timestamps_ptr[idx] = float(generator.GetTimestamp(hit.ray_idx));
+            rings_ptr[idx] = int(generator.GetBeam(hit.ray_idx));
+            ++idx;
+        }
+    }
+
+    PointCloud pcd(positions);
+    pcd.SetPointAttr("ranges", ranges);
+    pcd.SetPointAttr("intensities", intensities);
+    pcd.SetPointAttr("timestamps", timestamps);
+    pcd.SetPointAttr("rings", rings);
+    return pcd;
+}
+
 uint32_t RaycastingScene::INVALID_ID() { return RTC_INVALID_GEOMETRY_ID; }
 
 }  // namespace geometry
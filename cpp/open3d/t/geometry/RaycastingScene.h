@@ -37,6 +37,69 @@ namespace open3d {
 namespace t {
 namespace geometry {
 
+/// \class LidarModel
+/// \brief Describes the beam pattern and timing of a LiDAR sensor.
+///
+/// The beams are defined in the sensor coordinate system with x pointing
+/// forward, y to the left and z up. The azimuth angle is measured in the
+/// xy-plane from the x-axis towards the y-axis. Rays are organized as
+/// {num_beams, num_columns}. A row corresponds to a beam (ring) and a column
+/// corresponds to an azimuth step.
+class LidarModel {
+public:
+    /// \brief Order in which the rays are fired.
+    enum class ScanPattern {
+        /// All beams fire at once and the columns are swept over time.
+        Spinning = 0,
+        /// The rows are scanned one after the other like a raster scan.
+        SolidState = 1,
+    };
+
+    /// \brief Constructor for a LiDAR model.
+    ///
+    /// \param elevation_angles_deg The elevation angle of each beam in degree
+    /// with shape {num_beams}.
+    /// \param num_columns The number of azimuth steps per scan.
+    /// \param azimuth_fov_deg The horizontal field of view in degree.
+    /// \param azimuth_start_deg The azimuth angle of the first column.
+    /// \param scan_duration The duration of a scan in seconds.
+    /// \param scan_pattern The order in which the rays are fired.
+    /// \param azimuth_offsets_deg Optional per-beam azimuth offsets in degree
+    /// with shape {num_beams}.
+    LidarModel(const core::Tensor &elevation_angles_deg,
+               int num_columns = 1024,
+               double azimuth_fov_deg = 360.0,
+               double azimuth_start_deg = -180.0,
+               double scan_duration = 0.1,
+               ScanPattern scan_pattern = ScanPattern::Spinning,
+               const core::Tensor &azimuth_offsets_deg = core::Tensor())
+        : elevation_angles_deg_(elevation_angles_deg),
+          azimuth_offsets_deg_(azimuth_offsets_deg),
+          num_columns_(num_columns),
+          azimuth_fov_deg_(azimuth_fov_deg),
+          azimuth_start_deg_(azimuth_start_deg),
+          scan_duration_(scan_duration),
+          scan_pattern_(scan_pattern) {}
+
+public:
+    /// The elevation angle of each beam in degree with shape {num_beams}.
+    core::Tensor elevation_angles_deg_;
+    /// Per-beam azimuth offsets in degree with shape {num_beams}. An empty
+    /// tensor means no offsets.
+    core::Tensor azimuth_offsets_deg_;
+    /// The number of azimuth steps per scan.
+    int num_columns_;
+    /// The horizontal field of view in degree. Use 360 for spinning sensors.
+    double azimuth_fov_deg_;
+    /// The azimuth angle of the first column in degree.
+    double azimuth_start_deg_;
+    /// The duration of a scan in seconds.
+    double scan_duration_;
+    /// The order in which the rays are fired. This defines the timestamps of
+    /// the rays for rolling shutter simulation.
+    ScanPattern scan_pattern_;
+};
+
 /// \class RaycastingScene
 /// \brief A scene class with basic ray casting and closest point queries.
 ///
@@ -44,12 +107,28 @@ namespace geometry {
 /// or compute the closest point on the surface of a mesh with respect to one
 /// or more query points.
 /// It builds an internal acceleration structure to speed up those queries.
+/// The acceleration structure is built lazily on the first query after the
+/// scene has been modified. Geometry that does not change keeps its own
+/// acceleration structure, so that adding or removing objects, moving
+/// instances and updating vertices of deforming meshes only needs a partial
+/// rebuild.
 ///
 /// This class supports only the CPU device.
 class RaycastingScene {
 public:
+    /// \brief Quality of the acceleration structure build.
+    ///
+    /// Lower quality builds faster while higher quality results in faster
+    /// queries.
+    enum class BuildQuality {
+        Low = 0,     ///< Fast build for scenes that change every frame.
+        Medium = 1,  ///< Balance between build time and query performance.
+        High = 2     ///< Slow build with the best query performance.
+    };
+
     /// \brief Default Constructor.
-    RaycastingScene();
+    /// \param build_quality The quality of the acceleration structure build.
+    RaycastingScene(BuildQuality build_quality = BuildQuality::Medium);
 
     ~RaycastingScene();
 
@@ -65,6 +144,66 @@ public:
     /// \return The geometry ID of the added mesh.
     uint32_t AddTriangles(const TriangleMesh &mesh);
 
+    /// \brief Removes a geometry or an instance from the scene.
+    /// \param geometry_id The ID of the geometry returned by AddTriangles or
+    /// AddInstance. The ID may be reused by geometry added later.
+    void RemoveGeometry(uint32_t geometry_id);
+
+    /// \brief Updates the vertex positions of a triangle mesh in the scene.
+    ///
+    /// The topology of the mesh is kept and the acceleration structure of the
+    /// mesh is only refitted instead of rebuilt. This is intended for deforming
+    /// meshes.
+    /// \param geometry_id The ID of a geometry returned by AddTriangles.
+    /// \param vertex_positions Vertices as Tensor of dim {N,3} and dtype
+    /// float. N must match the number of vertices of the geometry.
+    void UpdateTriangleVertices(uint32_t geometry_id,
+                                const core::Tensor &vertex_positions);
+
+    /// \brief Adds a triangle mesh prototype which can be instanced.
+    ///
+    /// The prototype is not part of the scene. It has its own acceleration
+    /// structure, which is built once and shared by all its instances.
+    /// \param vertex_positions Vertices as Tensor of dim {N,3} and dtype float.
+    /// \param triangle_indices Triangles as Tensor of dim {M,3} and dtype
+    /// uint32_t.
+    /// \return The ID of the prototype.
+    uint32_t AddPrototype(const core::Tensor &vertex_positions,
+                          const core::Tensor &triangle_indices);
+
+    /// \brief Adds a triangle mesh prototype which can be instanced.
+    /// \param mesh A triangle mesh.
+    /// \return The ID of the prototype.
+    uint32_t AddPrototype(const TriangleMesh &mesh);
+
+    /// \brief Adds an instance of a prototype to the scene.
+    /// \param prototype_id The ID of the prototype returned by AddPrototype.
+    /// \param transform The 4x4 affine transformation from the prototype to
+    /// the world coordinate system.
+    /// \return The geometry ID of the instance. Queries report this ID for
+    /// hits with the instance. Primitive IDs refer to the prototype triangles.
+    uint32_t AddInstance(uint32_t prototype_id,
+                         const core::Tensor &transform = core::Tensor::Eye(
+                                 4, core::Float32, core::Device("CPU:0")));
+
+    /// \brief Sets the transformation of an instance.
+    ///
+    /// Only the top level of the acceleration structure is rebuilt, the
+    /// acceleration structure of the prototype is reused.
+    /// \param geometry_id The geometry ID returned by AddInstance.
+    /// \param transform The 4x4 affine transformation from the prototype to
+    /// the world coordinate system.
+    void SetInstanceTransform(uint32_t geometry_id,
+                              const core::Tensor &transform);
+
+    /// \brief Sets the quality of the acceleration structure build.
+    ///
+    /// The new quality is used for the next build of the scene.
+    void SetBuildQuality(BuildQuality build_quality);
+
+    /// \brief Returns the quality of the acceleration structure build.
+    BuildQuality GetBuildQuality() const;
+
     /// \brief Computes the first intersection of the rays with the scene.
     /// \param rays A tensor with >=2 dims, shape {.., 6}, and Dtype Float32
     /// describing the rays.
@@ -165,6 +304,9 @@ public:
     /// dimensions, e.g., to organize the query_point to create a 3D grid the
     /// shape can be {depth, height, width, 3}. The last dimension must be 3 and
     /// has the format [x, y, z].
+    /// If the signed distance cache is enabled the distances are interpolated
+    /// from the cache, see EnableSignedDistanceCache().
+    ///
     /// \param nthreads The number of threads to use. Set to 0 for automatic.
     /// \return A tensor with the signed distances to
     /// the surface. The shape is
@@ -186,12 +328,46 @@ public:
     /// organize the query_point to create a 3D grid the shape can be
     /// {depth, height, width, 3}.
     /// The last dimension must be 3 and has the format [x, y, z].
+    /// If the signed distance cache is enabled the occupancy is derived from
+    /// the sign of the cached distances. Points closer to the surface than the
+    /// error bound of the cache may then be classified differently.
     /// \param nthreads The number of threads to use. Set to 0 for automatic.
     /// \return A tensor with the occupancy values. The shape is {..}. Values
     /// are either 0 or 1. A point is occupied or inside if the value is 1.
     core::Tensor ComputeOccupancy(const core::Tensor &query_points,
                                   const int nthreads = 0);
 
+    /// \brief Enables a cache for signed distance and occupancy queries.
+    ///
+    /// The cache is a sparse voxel hash map which stores the signed distances
+    /// at the corners of the cells that contain query points. Cells are
+    /// filled lazily with exact queries and the signed distance is
+    /// interpolated trilinearly within a cell. A cell is only used if the
+    /// interpolated distance at its center is within the error bound of the
+    /// exact distance. Otherwise the cell is subdivided up to max_level times,
+    /// which refines the cache in a narrow band around surface features.
+    /// Queries in cells that do not meet the error bound at the finest level
+    /// are computed exactly. The cache is cleared when the scene changes.
+    ///
+    /// \param voxel_size The cell size of the coarsest level.
+    /// \param max_error The error bound for the interpolated distances.
+    /// \param max_level The maximum number of subdivisions of a cell.
+    /// \param init_capacity The initial capacity of the hash map.
+    void EnableSignedDistanceCache(float voxel_size,
+                                   float max_error,
+                                   int max_level = 3,
+                                   int64_t init_capacity = 10000);
+
+    /// \brief Disables the signed distance cache and frees its memory.
+    void DisableSignedDistanceCache();
+
+    /// \brief Returns true if the signed distance cache is enabled.
+    bool IsSignedDistanceCacheEnabled() const;
+
+    /// \brief Returns the number of cells stored in the signed distance
+    /// cache.
+    int64_t GetSignedDistanceCacheSize() const;
+
     /// \brief Creates rays for the given camera parameters.
     ///
     /// \param intrinsic_matrix The upper triangular intrinsic matrix with
@@ -221,10 +397,71 @@ public:
                                           int width_px,
                                           int height_px);
 
+    /// \brief Creates rays for a LiDAR sensor.
+    ///
+    /// The sensor pose is interpolated between the start and end pose using
+    /// the timestamp of each ray to simulate the motion of the sensor during
+    /// the scan.
+    /// \param model The LiDAR model.
+    /// \param start_pose The 4x4 sensor to world transformation at the start
+    /// of the scan.
+    /// \param end_pose The 4x4 sensor to world transformation at the end of
+    /// the scan.
+    /// \return A tensor of shape {num_beams, num_columns, 6} with the rays.
+    /// The ray directions are normalized.
+    static core::Tensor CreateRaysLidar(
+            const LidarModel &model,
+            const core::Tensor &start_pose = core::Tensor::Eye(
+                    4, core::Float64, core::Device("CPU:0")),
+            const core::Tensor &end_pose = core::Tensor::Eye(
+                    4, core::Float64, core::Device("CPU:0")));
+
+    /// \brief Computes the timestamps of the rays of a LiDAR sensor.
+    ///
+    /// \param model The LiDAR model.
+    /// \return A Float64 tensor of shape {num_beams, num_columns} with the
+    /// time in seconds relative to the start of the scan.
+    static core::Tensor CreateTimestampsLidar(const LidarModel &model);
+
+    /// \brief Simulates a LiDAR scan and returns the hits as point cloud.
+    ///
+    /// The rays are generated on the fly and only the hits are stored. This
+    /// avoids creating the ray tensor and the full size result tensors of
+    /// CastRays.
+    /// \param model The LiDAR model.
+    /// \param start_pose The 4x4 sensor to world transformation at the start
+    /// of the scan.
+    /// \param end_pose The 4x4 sensor to world transformation at the end of
+    /// the scan.
+    /// \param max_range The maximum range of the sensor.
+    /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \return A point cloud with the hit points in world coordinates. The
+    /// point cloud has the Float32 attributes \b ranges, \b intensities
+    /// and \b timestamps with shape {N,1} and the Int32 attribute \b rings
+    /// with shape {N,1}. The intensity is the cosine of the incidence angle
+    /// as a simple proxy for the reflected intensity. Points are ordered by
+    /// beam and column.
+    PointCloud CastRaysLidar(
+            const LidarModel &model,
+            const core::Tensor &start_pose = core::Tensor::Eye(
+                    4, core::Float64, core::Device("CPU:0")),
+            const core::Tensor &end_pose = core::Tensor::Eye(
+                    4, core::Float64, core::Device("CPU:0")),
+            float max_range = std::numeric_limits<float>::infinity(),
+            const int nthreads = 0);
+
     /// \brief The value for invalid IDs.
     static uint32_t INVALID_ID();
 
 private:
+    /// Computes the signed distance without the cache.
+    core::Tensor ComputeSignedDistanceExact(const core::Tensor &query_points,
+                                            const int nthreads);
+
+    /// Computes the signed distance with the cache.
+    core::Tensor ComputeSignedDistanceCached(const core::Tensor &query_points,
+                                             const int nthreads);
+
     struct Impl;
     std::unique_ptr<Impl> impl_;
 };
@@ -26,18 +26,322 @@
 
 #include "open3d/t/geometry/VoxelBlockGrid.h"
 
+#include <liblzf/lzf.h>
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <numeric>
+#include <tuple>
+
+#include "open3d/core/ParallelFor.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
 #include "open3d/t/geometry/Geometry.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/Utility.h"
 #include "open3d/t/geometry/kernel/VoxelBlockGrid.h"
 #include "open3d/t/io/NumpyIO.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
 
 namespace open3d {
 namespace t {
 namespace geometry {
 
+/// Copy the SoA values of the i-th block to contiguous bytes at dst.
+static void PackBlock(const std::vector<core::Tensor> &block_values,
+                      const std::vector<int64_t> &element_byte_sizes,
+                      int64_t i,
+                      uint8_t *dst) {
+    for (size_t a = 0; a < block_values.size(); ++a) {
+        const int64_t byte_size = element_byte_sizes[a];
+        std::memcpy(dst,
+                    static_cast<const uint8_t *>(block_values[a].GetDataPtr()) +
+                            i * byte_size,
+                    byte_size);
+        dst += byte_size;
+    }
+}
+
+/// Copy contiguous bytes at src to the SoA values of the i-th block.
+static void UnpackBlock(const uint8_t *src,
+                        const std::vector<int64_t> &element_byte_sizes,
+                        int64_t i,
+                        std::vector<core::Tensor> &block_values) {
+    for (size_t a = 0; a < block_values.size(); ++a) {
+        const int64_t byte_size = element_byte_sizes[a];
+        std::memcpy(static_cast<uint8_t *>(block_values[a].GetDataPtr()) +
+                            i * byte_size,
+                    src, byte_size);
+        src += byte_size;
+    }
+}
+
+/// Byte size of one block in each of the (N, res, res, res, ...) SoA values.
+static std::vector<int64_t> GetElementByteSizes(
+        const std::vector<core::Tensor> &block_values) {
+    std::vector<int64_t> element_byte_sizes;
+    for (const core::Tensor &value : block_values) {
+        core::SizeVector element_shape = value.GetShape();
+        element_shape.erase(element_shape.begin());
+        element_byte_sizes.push_back(element_shape.NumElements() *
+                                     value.GetDtype().ByteSize());
+    }
+    return element_byte_sizes;
+}
+
+/// On-disk store of evicted voxel blocks in streaming mode.
+/// Each block is compressed with LZF and stored in a single pack file, with an
+/// in-memory index from block coordinates to records. The extents of records
+/// dropped when blocks are paged back in are kept in a free list and reused by
+/// later evictions, so revisiting an area does not grow the file. The store
+/// also tracks the frame in which each block in memory was last touched, used
+/// for LRU eviction.
+class VoxelBlockGrid::BlockStore {
+public:
+    BlockStore(const std::string &block_store_dir,
+               int64_t max_active_blocks,
+               const std::vector<core::Tensor> &value_buffers)
+        : max_active_blocks_(max_active_blocks) {
+        if (!utility::filesystem::DirectoryExists(block_store_dir) &&
+            !utility::filesystem::MakeDirectoryHierarchy(block_store_dir)) {
+            utility::LogError("Unable to create block store directory {}.",
+                              block_store_dir);
+        }
+        file_name_ = block_store_dir + "/blocks.bin";
+        file_.open(file_name_, std::ios::in | std::ios::out |
+                                       std::ios::binary | std::ios::trunc);
+        if (!file_.is_open()) {
+            utility::LogError("Unable to open block store {}.", file_name_);
+        }
+
+        for (const core::Tensor &buffer : value_buffers) {
+            core::SizeVector element_shape = buffer.GetShape();
+            element_shape.erase(element_shape.begin());
+            dtypes_.push_back(buffer.GetDtype());
+            element_shapes_.push_back(element_shape);
+        }
+        element_byte_sizes_ = GetElementByteSizes(value_buffers);
+        block_byte_size_ = std::accumulate(element_byte_sizes_.begin(),
+                                           element_byte_sizes_.end(),
+                                           int64_t(0));
+    }
+
+    ~BlockStore() {
+        file_.close();
+        utility::filesystem::RemoveFile(file_name_);
+    }
+
+    int64_t Size() const { return records_.size(); }
+
+    bool Contains(const Eigen::Vector3i &key) const {
+        return records_.count(key) > 0;
+    }
+
+    std::vector<Eigen::Vector3i> GetKeys() const {
+        std::vector<Eigen::Vector3i> keys;
+        keys.reserve(records_.size());
+        for (const auto &it : records_) {
+            keys.push_back(it.first);
+        }
+        return keys;
+    }
+
+    /// Compress and append blocks given by (N, 3) Int32 keys and their SoA
+    /// values, all contiguous on host.
+    void Write(const core::Tensor &block_keys,
+               const std::vector<core::Tensor> &block_values) {
+        const int *key_ptr = block_keys.GetDataPtr<int>();
+        std::vector<uint8_t> raw(block_byte_size_);
+        std::vector<uint8_t> compressed(block_byte_size_);
+        for (int64_t i = 0; i < block_keys.GetLength(); ++i) {
+            PackBlock(block_values, element_byte_sizes_, i, raw.data());
+
+            // Keep the raw bytes if LZF is unable to shrink the block.
+            unsigned int size = lzf_compress(
+                    raw.data(), static_cast<unsigned int>(block_byte_size_),
+                    compressed.data(),
+                    static_cast<unsigned int>(block_byte_size_ - 1));
+            const uint8_t *src = compressed.data();
+            if (size == 0) {
+                size = static_cast<unsigned int>(block_byte_size_);
+                src = raw.data();
+            }
+
+            Eigen::Vector3i key(key_ptr[3 * i + 0], key_ptr[3 * i + 1],
+                                key_ptr[3 * i + 2]);
+            auto it = records_.find(key);
+            if (it != records_.end()) {
+                Free(it->second.offset, it->second.size);
+            }
+            const int64_t offset = Allocate(size);
+            file_.seekp(offset);
+            file_.write(reinterpret_cast<const char *>(src), size);
+            if (!file_) {
+                utility::LogError("Failed to write to block store {}.",
+                                  file_name_);
+            }
+            records_[key] = Record{offset, size};
+        }
+        file_.flush();
+    }
+
+    /// Read blocks into (N, 3) Int32 keys and SoA values on host. Records are
+    /// dropped from the store if erase is true.
+    void Read(const std::vector<Eigen::Vector3i> &keys,
+              core::Tensor &block_keys,
+              std::vector<core::Tensor> &block_values,
+              bool erase) {
+        core::Device host("CPU:0");
+        const int64_t n = keys.size();
+        block_keys = core::Tensor({n, 3}, core::Int32, host);
+        block_values.clear();
+        for (size_t a = 0; a < dtypes_.size(); ++a) {
+            core::SizeVector shape = element_shapes_[a];
+            shape.insert(shape.begin(), n);
+            block_values.emplace_back(shape, dtypes_[a], host);
+        }
+
+        int *key_ptr = block_keys.GetDataPtr<int>();
+        std::vector<uint8_t> raw(block_byte_size_);
+        std::vector<uint8_t> compressed(block_byte_size_);
+        for (int64_t i = 0; i < n; ++i) {
+            auto it = records_.find(keys[i]);
+            if (it == records_.end()) {
+                utility::LogError("Block ({}, {}, {}) not found in {}.",
+                                  keys[i](0), keys[i](1), keys[i](2),
+                                  file_name_);
+            }
+            const Record &record = it->second;
+
+            file_.seekg(record.offset);
+            file_.read(reinterpret_cast<char *>(compressed.data()),
+                       record.size);
+            if (!file_) {
+                utility::LogError("Failed to read from block store {}.",
+                                  file_name_);
+            }
+            if (static_cast<int64_t>(record.size) == block_byte_size_) {
+                std::swap(raw, compressed);
+            } else if (static_cast<int64_t>(lzf_decompress(
+                               compressed.data(), record.size, raw.data(),
+                               static_cast<unsigned int>(block_byte_size_))) !=
+                       block_byte_size_) {
+                utility::LogError("Corrupted block in block store {}.",
+                                  file_name_);
+            }
+
+            UnpackBlock(raw.data(), element_byte_sizes_, i, block_values);
+            key_ptr[3 * i + 0] = keys[i](0);
+            key_ptr[3 * i + 1] = keys[i](1);
+            key_ptr[3 * i + 2] = keys[i](2);
+
+            if (erase) {
+                Free(record.offset, record.size);
+                records_.erase(it);
+            }
+        }
+    }
+
+public:
+    int64_t max_active_blocks_;
+
+    // Incremented on every streaming request.
+    int64_t frame_ = 0;
+
+    // Block coordinates in memory -> frame in which they were last touched.
+    std::unordered_map<Eigen::Vector3i,
+                       int64_t,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            last_touched_;
+
+private:
+    struct Record {
+        int64_t offset;
+        unsigned int size;
+    };
+
+    /// Returns the offset of size free bytes in the file. The smallest free
+    /// extent that fits is used, and the file is only extended if none fits.
+    int64_t Allocate(int64_t size) {
+        auto it = free_by_size_.lower_bound(size);
+        if (it == free_by_size_.end()) {
+            const int64_t offset = end_offset_;
+            end_offset_ += size;
+            return offset;
+        }
+        const int64_t offset = it->second;
+        const int64_t extent_size = it->first;
+        free_by_size_.erase(it);
+        free_by_offset_.erase(offset);
+        if (extent_size > size) {
+            AddFreeExtent(offset + size, extent_size - size);
+        }
+        return offset;
+    }
+
+    /// Returns an extent to the free list, merged with adjacent free extents.
+    /// Free space at the end of the file is given back to the end offset.
+    void Free(int64_t offset, int64_t size) {
+        auto next = free_by_offset_.find(offset + size);
+        if (next != free_by_offset_.end()) {
+            size += next->second;
+            RemoveFreeExtent(next);
+        }
+        auto prev = free_by_offset_.lower_bound(offset);
+        if (prev != free_by_offset_.begin()) {
+            --prev;
+            if (prev->first + prev->second == offset) {
+                offset = prev->first;
+                size += prev->second;
+                RemoveFreeExtent(prev);
+            }
+        }
+        if (offset + size == end_offset_) {
+            end_offset_ = offset;
+        } else {
+            AddFreeExtent(offset, size);
+        }
+    }
+
+    void AddFreeExtent(int64_t offset, int64_t size) {
+        free_by_offset_[offset] = size;
+        free_by_size_.emplace(size, offset);
+    }
+
+    void RemoveFreeExtent(std::map<int64_t, int64_t>::iterator it) {
+        auto range = free_by_size_.equal_range(it->second);
+        for (auto s = range.first; s != range.second; ++s) {
+            if (s->second == it->first) {
+                free_by_size_.erase(s);
+                break;
+            }
+        }
+        free_by_offset_.erase(it);
+    }
+
+    std::string file_name_;
+    std::fstream file_;
+    int64_t end_offset_ = 0;
+    // Free extents in the file, indexed by offset and by size.
+    std::map<int64_t, int64_t> free_by_offset_;
+    std::multimap<int64_t, int64_t> free_by_size_;
+
+    std::vector<core::Dtype> dtypes_;
+    std::vector<core::SizeVector> element_shapes_;
+    std::vector<int64_t> element_byte_sizes_;
+    int64_t block_byte_size_ = 0;
+
+    std::unordered_map<Eigen::Vector3i,
+                       Record,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            records_;
+};
+
 static std::pair<core::Tensor, core::Tensor> BufferRadiusNeighbors(
         std::shared_ptr<core::HashMap> &hashmap,
         const core::Tensor &active_buf_indices) {
@@ -69,6 +373,27 @@ static std::pair<core::Tensor, core::Tensor> BufferRadiusNeighbors(
                           masks_nb.View({27, n, 1}));
 }
 
+// Shift (N, 3) block keys by all the offsets in [lo, hi]^3, resulting in
+// ((hi - lo + 1)^3 x N, 3) keys.
+static core::Tensor DilateBlockKeys(const core::Tensor &keys, int lo, int hi) {
+    core::Device device = keys.GetDevice();
+    int64_t n = keys.GetLength();
+    int64_t width = hi - lo + 1;
+
+    core::Tensor keys_nb({width * width * width, n, 3}, core::Int32, device);
+    int64_t nb = 0;
+    for (int dz = lo; dz <= hi; ++dz) {
+        for (int dy = lo; dy <= hi; ++dy) {
+            for (int dx = lo; dx <= hi; ++dx) {
+                core::Tensor dt = core::Tensor(std::vector<int>{dx, dy, dz},
+                                               {1, 3}, core::Int32, device);
+                keys_nb[nb++] = keys + dt;
+            }
+        }
+    }
+    return keys_nb.View({width * width * width * n, 3});
+}
+
 static TensorMap ConstructTensorMap(
         const core::HashMap &block_hashmap,
         std::unordered_map<std::string, int> name_attr_map) {
@@ -133,6 +458,7 @@ VoxelBlockGrid::VoxelBlockGrid(
     block_hashmap_ = std::make_shared<core::HashMap>(
             block_count, core::Int32, core::SizeVector{3}, attr_dtypes,
             attr_element_shapes, device, backend);
+    block_occupancy_ = std::make_shared<kernel::voxel_grid::BlockOccupancy>();
 }
 
 core::Tensor VoxelBlockGrid::GetAttribute(const std::string &attr_name) const {
@@ -260,6 +586,7 @@ core::Tensor VoxelBlockGrid::GetUniqueBlockCoordinates(
                                    voxel_size_ * trunc_voxel_multiplier,
                                    depth_scale, depth_max, down_factor);
 
+    StreamBlocks(block_coords);
     return block_coords;
 }
 
@@ -282,6 +609,8 @@ core::Tensor VoxelBlockGrid::GetUniqueBlockCoordinates(
     kernel::voxel_grid::PointCloudTouch(
             frustum_hashmap_, positions, block_coords, block_resolution_,
             voxel_size_, voxel_size_ * trunc_voxel_multiplier);
+
+    StreamBlocks(block_coords);
     return block_coords;
 }
 
@@ -329,10 +658,21 @@ void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
     CheckIntrinsicTensor(color_intrinsic);
     CheckExtrinsicTensor(extrinsic);
 
+    StreamBlocks(block_coords);
+
     core::Tensor buf_indices, masks;
+    const int64_t prev_num_blocks = block_hashmap_->Size();
     block_hashmap_->Activate(block_coords, buf_indices, masks);
     block_hashmap_->Find(block_coords, buf_indices, masks);
 
+    if (dirty_block_set_ == nullptr) {
+        dirty_block_set_ = std::make_shared<core::HashSet>(
+                block_hashmap_->GetCapacity(), core::Int32, core::SizeVector{3},
+                block_hashmap_->GetDevice());
+    }
+    dirty_block_set_->Insert(block_coords);
+    UpdateBlockOccupancy(block_coords, prev_num_blocks);
+
     core::Tensor block_keys = block_hashmap_->GetKeyTensor();
     TensorMap block_value_map =
             ConstructTensorMap(*block_hashmap_, name_attr_map_);
@@ -409,13 +749,24 @@ TensorMap VoxelBlockGrid::RayCast(const core::Tensor &block_coords,
                 core::Tensor({height, width, channel}, dtype, device);
     }
 
+    // Blocks inserted through GetHashMap() are not marked in the occupancy.
+    const int64_t num_blocks = block_hashmap_->Size();
+    if (!block_occupancy_->valid_ ||
+        block_occupancy_->num_blocks_ != num_blocks) {
+        core::Tensor active_keys = block_hashmap_->GetKeyTensor().IndexGet(
+                {block_hashmap_->GetActiveIndices().To(core::Int64)});
+        kernel::voxel_grid::BuildBlockOccupancy(active_keys, *block_occupancy_);
+        block_occupancy_->num_blocks_ = num_blocks;
+    }
+
     TensorMap block_value_map =
             ConstructTensorMap(*block_hashmap_, name_attr_map_);
     kernel::voxel_grid::RayCast(
-            block_hashmap_, block_value_map, range_minmax_map, renderings_map,
-            intrinsic, extrinsic, height, width, block_resolution_, voxel_size_,
-            depth_scale, depth_min, depth_max, weight_threshold,
-            trunc_voxel_multiplier, range_map_down_factor);
+            block_hashmap_, *block_occupancy_, block_value_map,
+            range_minmax_map, renderings_map, intrinsic, extrinsic, height,
+            width, block_resolution_, voxel_size_, depth_scale, depth_min,
+            depth_max, weight_threshold, trunc_voxel_multiplier,
+            range_map_down_factor);
 
     return renderings_map;
 }
@@ -470,7 +821,8 @@ TriangleMesh VoxelBlockGrid::ExtractTriangleMesh(float weight_threshold,
     inverse_index_map.IndexSet({active_buf_indices_i32.To(core::Int64)},
                                iota_map);
 
-    core::Tensor vertices, triangles, vertex_normals, vertex_colors;
+    core::Tensor vertices, triangles, triangle_block_indices, vertex_normals,
+            vertex_colors;
 
     core::Tensor block_keys = block_hashmap_->GetKeyTensor();
     TensorMap block_value_map =
@@ -478,8 +830,9 @@ TriangleMesh VoxelBlockGrid::ExtractTriangleMesh(float weight_threshold,
     kernel::voxel_grid::ExtractTriangleMesh(
             active_buf_indices_i32, inverse_index_map, active_nb_buf_indices,
             active_nb_masks, block_keys, block_value_map, vertices, triangles,
-            vertex_normals, vertex_colors, block_resolution_, voxel_size_,
-            weight_threshold, estimated_vertex_number);
+            triangle_block_indices, vertex_normals, vertex_colors,
+            block_resolution_, voxel_size_, weight_threshold,
+            estimated_vertex_number);
 
     TriangleMesh mesh(vertices, triangles);
     mesh.SetVertexNormals(vertex_normals);
@@ -490,7 +843,278 @@ TriangleMesh VoxelBlockGrid::ExtractTriangleMesh(float weight_threshold,
     return mesh;
 }
 
-void VoxelBlockGrid::Save(const std::string &file_name) const {
+core::Tensor VoxelBlockGrid::GetDirtyBlockCoordinates() const {
+    AssertInitialized();
+    if (dirty_block_set_ == nullptr) {
+        return core::Tensor({0, 3}, core::Int32, block_hashmap_->GetDevice());
+    }
+    return dirty_block_set_->GetKeyTensor().IndexGet(
+            {dirty_block_set_->GetActiveIndices().To(core::Int64)});
+}
+
+std::pair<core::Tensor, std::vector<TriangleMesh>>
+VoxelBlockGrid::ExtractTriangleMeshChunks(float weight_threshold) {
+    AssertInitialized();
+    core::Device device = block_hashmap_->GetDevice();
+    core::Device host("CPU:0");
+
+    core::Tensor dirty_keys = GetDirtyBlockCoordinates();
+    if (dirty_block_set_ != nullptr) {
+        dirty_block_set_->Clear();
+    }
+    if (dirty_keys.GetLength() == 0) {
+        return std::make_pair(dirty_keys, std::vector<TriangleMesh>());
+    }
+
+    // A cube in block b reads voxels in b + {0, 1}^3, so blocks to regenerate
+    // are the active ones among dirty blocks - {0, 1}^3.
+    core::Tensor buf_indices, masks;
+    core::Tensor candidate_keys = DilateBlockKeys(dirty_keys, -1, 0);
+    block_hashmap_->Find(candidate_keys, buf_indices, masks);
+    candidate_keys = candidate_keys.IndexGet({masks});
+    if (candidate_keys.GetLength() == 0) {
+        return std::make_pair(candidate_keys, std::vector<TriangleMesh>());
+    }
+
+    core::HashSet block_set(candidate_keys.GetLength(), core::Int32,
+                            core::SizeVector{3}, device);
+    block_set.Insert(candidate_keys);
+    core::Tensor chunk_keys = block_set.GetKeyTensor().IndexGet(
+            {block_set.GetActiveIndices().To(core::Int64)});
+    int64_t num_chunks = chunk_keys.GetLength();
+
+    // Cubes in the chunks own vertices in chunks + {0, 1}^3, whose normals
+    // read voxels one block further away. Extract from chunks + {-1, ..., 2}^3
+    // so that the chunks are identical to a full extraction. Chunks go first
+    // so that their workload indices are [0, num_chunks).
+    core::Tensor support_keys = DilateBlockKeys(chunk_keys, -1, 2);
+    block_hashmap_->Find(support_keys, buf_indices, masks);
+    support_keys = support_keys.IndexGet({masks});
+    block_set.Insert(support_keys, buf_indices, masks);
+    support_keys = support_keys.IndexGet({masks});
+
+    core::Tensor extract_keys = core::Concatenate({chunk_keys, support_keys});
+    core::Tensor extract_buf_indices_i32;
+    block_hashmap_->Find(extract_keys, extract_buf_indices_i32, masks);
+    int64_t num_blocks = extract_keys.GetLength();
+
+    core::Tensor extract_nb_buf_indices, extract_nb_masks;
+    std::tie(extract_nb_buf_indices, extract_nb_masks) =
+            BufferRadiusNeighbors(block_hashmap_, extract_buf_indices_i32);
+
+    // Map extracted blocks to [0, num_blocks), and the rest to -1.
+    core::Tensor inverse_index_map = core::Tensor::Full(
+            {block_hashmap_->GetCapacity()}, -1, core::Int32, device);
+    core::Tensor iota_map =
+            core::Tensor::Arange(0, num_blocks, 1, core::Int32, device);
+    inverse_index_map.IndexSet({extract_buf_indices_i32.To(core::Int64)},
+                               iota_map);
+
+    // Hide neighbors that are not extracted, so that Marching Cubes in the
+    // outermost blocks never writes to blocks out of the workload.
+    core::Tensor safe_nb_buf_indices = extract_nb_buf_indices.To(core::Int64) *
+                                       extract_nb_masks.To(core::Int64);
+    extract_nb_masks = extract_nb_masks.LogicalAnd(
+            inverse_index_map.IndexGet({safe_nb_buf_indices}).Ge(0));
+
+    core::Tensor vertices, triangles, triangle_block_indices, vertex_normals,
+            vertex_colors;
+    int vertex_count = -1;
+
+    core::Tensor block_keys = block_hashmap_->GetKeyTensor();
+    TensorMap block_value_map =
+            ConstructTensorMap(*block_hashmap_, name_attr_map_);
+    kernel::voxel_grid::ExtractTriangleMesh(
+            extract_buf_indices_i32, inverse_index_map, extract_nb_buf_indices,
+            extract_nb_masks, block_keys, block_value_map, vertices, triangles,
+            triangle_block_indices, vertex_normals, vertex_colors,
+            block_resolution_, voxel_size_, weight_threshold, vertex_count);
+
+    // Split triangles generated by the chunks on host, and drop the ones from
+    // the support blocks.
+    bool has_colors = vertex_colors.GetLength() == vertices.GetLength();
+    core::Tensor vertices_host = vertices.To(host);
+    core::Tensor vertex_normals_host = vertex_normals.To(host);
+    core::Tensor vertex_colors_host =
+            has_colors ? vertex_colors.To(host) : core::Tensor();
+    core::Tensor triangles_host = triangles.To(host).Contiguous();
+    core::Tensor triangle_block_indices_host =
+            triangle_block_indices.To(host).Contiguous();
+    const int *triangles_ptr = triangles_host.GetDataPtr<int>();
+    const int *owners_ptr = triangle_block_indices_host.GetDataPtr<int>();
+    int64_t num_triangles = triangles_host.GetLength();
+
+    std::vector<int64_t> offsets(num_chunks + 1, 0);
+    for (int64_t t = 0; t < num_triangles; ++t) {
+        if (owners_ptr[t] < num_chunks) {
+            ++offsets[owners_ptr[t] + 1];
+        }
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<int64_t> cursors(offsets.begin(), offsets.end() - 1);
+    std::vector<int64_t> sorted_triangles(offsets.back());
+    for (int64_t t = 0; t < num_triangles; ++t) {
+        if (owners_ptr[t] < num_chunks) {
+            sorted_triangles[cursors[owners_ptr[t]]++] = t;
+        }
+    }
+
+    std::vector<TriangleMesh> chunks;
+    chunks.reserve(num_chunks);
+    std::vector<int> local_indices(vertex_count, -1);
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        int64_t chunk_num_triangles = offsets[c + 1] - offsets[c];
+        if (chunk_num_triangles == 0) {
+            chunks.emplace_back(
+                    core::Tensor({0, 3}, core::Float32, device),
+                    core::Tensor({0, 3}, core::Int32, device));
+            continue;
+        }
+
+        core::Tensor chunk_triangles({chunk_num_triangles, 3}, core::Int32,
+                                     host);
+        int *chunk_triangles_ptr = chunk_triangles.GetDataPtr<int>();
+        std::vector<int64_t> chunk_vertices;
+        for (int64_t i = 0; i < chunk_num_triangles; ++i) {
+            int64_t t = sorted_triangles[offsets[c] + i];
+            for (int v = 0; v < 3; ++v) {
+                int global_index = triangles_ptr[3 * t + v];
+                if (local_indices[global_index] < 0) {
+                    local_indices[global_index] =
+                            static_cast<int>(chunk_vertices.size());
+                    chunk_vertices.push_back(global_index);
+                }
+                chunk_triangles_ptr[3 * i + v] = local_indices[global_index];
+            }
+        }
+        for (int64_t global_index : chunk_vertices) {
+            local_indices[global_index] = -1;
+        }
+
+        core::Tensor chunk_vertex_indices(
+                chunk_vertices, {static_cast<int64_t>(chunk_vertices.size())},
+                core::Int64, host);
+        TriangleMesh chunk(
+                vertices_host.IndexGet({chunk_vertex_indices}).To(device),
+                chunk_triangles.To(device));
+        chunk.SetVertexNormals(
+                vertex_normals_host.IndexGet({chunk_vertex_indices})
+                        .To(device));
+        if (has_colors) {
+            chunk.SetVertexColors(
+                    vertex_colors_host.IndexGet({chunk_vertex_indices})
+                            .To(device));
+        }
+        chunks.push_back(chunk);
+    }
+
+    return std::make_pair(chunk_keys, chunks);
+}
+
+/// Compress blocks given by SoA values on host in parallel. Returns the (N,)
+/// Int64 compressed size of each block and the UInt8 concatenated payload.
+/// Blocks with only zero values, e.g. allocated but never observed, are
+/// elided with size 0. Blocks that LZF is unable to shrink are stored raw.
+static std::pair<core::Tensor, core::Tensor> CompressBlocks(
+        const std::vector<core::Tensor> &block_values) {
+    core::Device host("CPU:0");
+    const std::vector<int64_t> element_byte_sizes =
+            GetElementByteSizes(block_values);
+    const int64_t block_byte_size = std::accumulate(
+            element_byte_sizes.begin(), element_byte_sizes.end(), int64_t(0));
+    const int64_t n = block_values.empty() ? 0 : block_values[0].GetLength();
+
+    std::vector<std::vector<uint8_t>> compressed(n);
+    core::ParallelFor(host, n, [&](int64_t i) {
+        std::vector<uint8_t> raw(block_byte_size);
+        PackBlock(block_values, element_byte_sizes, i, raw.data());
+        if (std::all_of(raw.begin(), raw.end(),
+                        [](uint8_t byte) { return byte == 0; })) {
+            return;
+        }
+
+        std::vector<uint8_t> &dst = compressed[i];
+        dst.resize(block_byte_size);
+        unsigned int size = lzf_compress(
+                raw.data(), static_cast<unsigned int>(block_byte_size),
+                dst.data(), static_cast<unsigned int>(block_byte_size - 1));
+        if (size == 0) {
+            dst.swap(raw);
+        } else {
+            dst.resize(size);
+        }
+    });
+
+    core::Tensor block_sizes({n}, core::Int64, host);
+    int64_t *block_sizes_ptr = block_sizes.GetDataPtr<int64_t>();
+    int64_t total_size = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        block_sizes_ptr[i] = compressed[i].size();
+        total_size += block_sizes_ptr[i];
+    }
+
+    core::Tensor payload({total_size}, core::UInt8, host);
+    uint8_t *payload_ptr = payload.GetDataPtr<uint8_t>();
+    for (int64_t i = 0; i < n; ++i) {
+        std::memcpy(payload_ptr, compressed[i].data(), compressed[i].size());
+        payload_ptr += compressed[i].size();
+    }
+    return std::make_pair(block_sizes, payload);
+}
+
+/// Inverse of CompressBlocks, writing to preallocated SoA values on host.
+static void DecompressBlocks(const core::Tensor &block_sizes,
+                             const core::Tensor &payload,
+                             std::vector<core::Tensor> &block_values) {
+    core::Device host("CPU:0");
+    const std::vector<int64_t> element_byte_sizes =
+            GetElementByteSizes(block_values);
+    const int64_t block_byte_size = std::accumulate(
+            element_byte_sizes.begin(), element_byte_sizes.end(), int64_t(0));
+    const int64_t n = block_sizes.GetLength();
+
+    core::Tensor block_offsets = block_sizes.To(core::Int64).Contiguous();
+    int64_t *block_offsets_ptr = block_offsets.GetDataPtr<int64_t>();
+    int64_t total_size = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        int64_t size = block_offsets_ptr[i];
+        block_offsets_ptr[i] = total_size;
+        total_size += size;
+    }
+    if (payload.NumElements() != total_size) {
+        utility::LogError("Expected {} bytes of compressed blocks, but got {}.",
+                          total_size, payload.NumElements());
+    }
+
+    core::Tensor payload_host = payload.To(host).Contiguous();
+    const uint8_t *payload_ptr = payload_host.GetDataPtr<uint8_t>();
+    std::atomic<bool> corrupted(false);
+    core::ParallelFor(host, n, [&](int64_t i) {
+        const int64_t end =
+                i + 1 < n ? block_offsets_ptr[i + 1] : payload.NumElements();
+        const int64_t size = end - block_offsets_ptr[i];
+        const uint8_t *src = payload_ptr + block_offsets_ptr[i];
+
+        std::vector<uint8_t> raw(block_byte_size, 0);
+        if (size == block_byte_size) {
+            std::memcpy(raw.data(), src, size);
+        } else if (size > 0 &&
+                   static_cast<int64_t>(lzf_decompress(
+                           src, static_cast<unsigned int>(size), raw.data(),
+                           static_cast<unsigned int>(block_byte_size))) !=
+                           block_byte_size) {
+            corrupted = true;
+            return;
+        }
+        UnpackBlock(raw.data(), element_byte_sizes, i, block_values);
+    });
+    if (corrupted) {
+        utility::LogError("Corrupted compressed voxel blocks.");
+    }
+}
+
+std::unordered_map<std::string, core::Tensor> VoxelBlockGrid::Snapshot()
+        const {
     AssertInitialized();
     // TODO(wei): provide 'GetActiveKeyValues' functionality.
     core::Tensor keys = block_hashmap_->GetKeyTensor();
@@ -520,17 +1144,67 @@ void VoxelBlockGrid::Save(const std::string &file_name) const {
                                     core::Int32, host));
     }
 
+    // Blocks evicted in streaming mode are saved along with active ones.
+    core::Tensor evicted_keys;
+    std::vector<core::Tensor> evicted_values;
+    if (GetNumEvictedBlocks() > 0) {
+        block_store_->Read(block_store_->GetKeys(), evicted_keys,
+                           evicted_values, /*erase=*/false);
+    }
+
     // Save keys
     core::Tensor active_keys = keys.IndexGet({active_indices}).To(host);
+    if (evicted_keys.NumElements() > 0) {
+        active_keys = core::Concatenate({active_keys, evicted_keys});
+    }
     output.emplace("key", active_keys);
 
-    // Save SoA values and name attributes
+    // Save SoA values
     for (auto &it : name_attr_map_) {
         int value_id = it.second;
         core::Tensor active_value_i =
                 values[value_id].IndexGet({active_indices}).To(host);
+        if (evicted_keys.NumElements() > 0) {
+            active_value_i = core::Concatenate(
+                    {active_value_i, evicted_values[value_id]});
+        }
         output.emplace(fmt::format("value_{:03d}", value_id), active_value_i);
     }
+    return output;
+}
+
+void VoxelBlockGrid::SaveSnapshot(
+        const std::string &file_name,
+        std::unordered_map<std::string, core::Tensor> snapshot,
+        bool compress) {
+    if (compress) {
+        core::Device host("CPU:0");
+        const std::string prefix = "attr_name_";
+        std::vector<int> value_ids;
+        for (auto &it : snapshot) {
+            if (it.first.substr(0, prefix.size()) == prefix) {
+                value_ids.push_back(it.second[0].Item<int>());
+            }
+        }
+
+        std::vector<core::Tensor> active_values(value_ids.size());
+        for (int value_id : value_ids) {
+            active_values.at(value_id) =
+                    snapshot.at(fmt::format("value_{:03d}", value_id));
+        }
+
+        // Empty value tensors keep the dtypes and element shapes.
+        core::Tensor block_sizes, payload;
+        std::tie(block_sizes, payload) = CompressBlocks(active_values);
+        snapshot.emplace("block_sizes", block_sizes);
+        snapshot.emplace("blocks", payload);
+        for (int value_id : value_ids) {
+            core::SizeVector shape = active_values[value_id].GetShape();
+            shape[0] = 0;
+            snapshot[fmt::format("value_{:03d}", value_id)] = core::Tensor(
+                    shape, active_values[value_id].GetDtype(), host);
+        }
+    }
 
     std::string ext =
             utility::filesystem::GetFileExtensionInLowerCase(file_name);
@@ -539,12 +1213,17 @@ void VoxelBlockGrid::Save(const std::string &file_name) const {
                 "File name for a voxel grid should be with the extension "
                 ".npz. Saving to {}.npz",
                 file_name);
-        t::io::WriteNpz(file_name + ".npz", output);
+        t::io::WriteNpz(file_name + ".npz", snapshot);
     } else {
-        t::io::WriteNpz(file_name, output);
+        t::io::WriteNpz(file_name, snapshot);
     }
 }
 
+void VoxelBlockGrid::Save(const std::string &file_name,
+                          bool compress) const {
+    SaveSnapshot(file_name, Snapshot(), compress);
+}
+
 VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name) {
     std::unordered_map<std::string, core::Tensor> tensor_map =
             t::io::ReadNpz(file_name);
@@ -580,6 +1259,9 @@ VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name) {
     std::vector<core::Dtype> attr_dtypes(inv_attr_map.size());
     std::vector<core::SizeVector> attr_channels(inv_attr_map.size());
 
+    core::Tensor keys = tensor_map.at("key");
+    const bool compressed = tensor_map.count("block_sizes") > 0;
+
     // Not an ideal way to use an unordered map. Assume all the indices are
     // stored.
     for (auto &v : inv_attr_map) {
@@ -588,17 +1270,29 @@ VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name) {
 
         core::Tensor value_i =
                 tensor_map.at(fmt::format("value_{:03d}", value_id));
+        core::SizeVector value_i_shape = value_i.GetShape();
+        if (compressed) {
+            value_i_shape[0] = keys.GetLength();
+            value_i = core::Tensor(value_i_shape, value_i.GetDtype(),
+                                   value_i.GetDevice());
+        }
 
-        soa_value_tensor[value_id] = value_i.To(device);
+        soa_value_tensor[value_id] = value_i;
         attr_dtypes[value_id] = value_i.GetDtype();
 
-        core::SizeVector value_i_shape = value_i.GetShape();
         // capacity, res, res, res
         value_i_shape.erase(value_i_shape.begin(), value_i_shape.begin() + 4);
         attr_channels[value_id] = value_i_shape;
     }
 
-    core::Tensor keys = tensor_map.at("key").To(device);
+    if (compressed) {
+        DecompressBlocks(tensor_map.at("block_sizes"), tensor_map.at("blocks"),
+                         soa_value_tensor);
+    }
+    for (auto &value : soa_value_tensor) {
+        value = value.To(device);
+    }
+    keys = keys.To(device);
     float voxel_size = tensor_map.at("voxel_size")[0].Item<float>();
     int block_resolution = tensor_map.at("block_resolution")[0].Item<int64_t>();
 
@@ -609,12 +1303,191 @@ VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name) {
     return vbg;
 }
 
+void VoxelBlockGrid::EnableStreaming(const std::string &block_store_dir,
+                                     int64_t max_active_blocks) {
+    AssertInitialized();
+    if (IsStreaming()) {
+        utility::LogError("Streaming is already enabled.");
+    }
+    if (max_active_blocks < 0) {
+        max_active_blocks = block_hashmap_->GetCapacity();
+    } else if (max_active_blocks == 0) {
+        utility::LogError("max_active_blocks must be positive, but got 0.");
+    }
+
+    block_store_ = std::make_shared<BlockStore>(
+            block_store_dir, max_active_blocks,
+            block_hashmap_->GetValueTensors());
+}
+
+void VoxelBlockGrid::DisableStreaming() {
+    if (!IsStreaming()) {
+        return;
+    }
+
+    if (block_store_->Size() > 0) {
+        core::Tensor evicted_keys;
+        std::vector<core::Tensor> evicted_values;
+        block_store_->Read(block_store_->GetKeys(), evicted_keys,
+                           evicted_values, /*erase=*/true);
+
+        core::Device device = block_hashmap_->GetDevice();
+        for (auto &value : evicted_values) {
+            value = value.To(device);
+        }
+        core::Tensor buf_indices, masks;
+        const int64_t prev_num_blocks = block_hashmap_->Size();
+        block_hashmap_->Insert(evicted_keys.To(device), evicted_values,
+                               buf_indices, masks);
+        UpdateBlockOccupancy(evicted_keys.To(device), prev_num_blocks);
+    }
+    block_store_.reset();
+}
+
+int64_t VoxelBlockGrid::GetNumEvictedBlocks() const {
+    return IsStreaming() ? block_store_->Size() : 0;
+}
+
+void VoxelBlockGrid::StreamBlocks(const core::Tensor &block_coords) {
+    if (!IsStreaming()) {
+        return;
+    }
+    BlockStore &store = *block_store_;
+    ++store.frame_;
+
+    core::Device host("CPU:0");
+    core::Device device = block_hashmap_->GetDevice();
+
+    core::Tensor buf_indices, masks;
+    block_hashmap_->Find(block_coords, buf_indices, masks);
+
+    core::Tensor coords_host = block_coords.To(host).Contiguous();
+    core::Tensor masks_host = masks.To(host);
+    const int *coords_ptr = coords_host.GetDataPtr<int>();
+    const bool *masks_ptr = masks_host.GetDataPtr<bool>();
+
+    const int64_t n = block_coords.GetLength();
+    std::vector<Eigen::Vector3i> evicted_keys;
+    for (int64_t i = 0; i < n; ++i) {
+        Eigen::Vector3i key(coords_ptr[3 * i + 0], coords_ptr[3 * i + 1],
+                            coords_ptr[3 * i + 2]);
+        store.last_touched_[key] = store.frame_;
+        if (!masks_ptr[i] && store.Contains(key)) {
+            evicted_keys.push_back(key);
+        }
+    }
+
+    // HashMap::Activate reserves room for all the input keys regardless of
+    // whether they exist, so the requested blocks are counted in full to
+    // prevent the hash map from growing.
+    int64_t num_to_evict = block_hashmap_->Size() +
+                           static_cast<int64_t>(evicted_keys.size()) + n -
+                           store.max_active_blocks_;
+    if (num_to_evict > 0) {
+        EvictBlocks(num_to_evict);
+    }
+
+    if (!evicted_keys.empty()) {
+        core::Tensor keys;
+        std::vector<core::Tensor> values;
+        store.Read(evicted_keys, keys, values, /*erase=*/true);
+        for (auto &value : values) {
+            value = value.To(device);
+        }
+        const int64_t prev_num_blocks = block_hashmap_->Size();
+        block_hashmap_->Insert(keys.To(device), values, buf_indices, masks);
+        UpdateBlockOccupancy(keys.To(device), prev_num_blocks);
+    }
+}
+
+void VoxelBlockGrid::EvictBlocks(int64_t num_blocks) {
+    BlockStore &store = *block_store_;
+
+    core::Device host("CPU:0");
+    core::Device device = block_hashmap_->GetDevice();
+
+    core::Tensor active_indices =
+            block_hashmap_->GetActiveIndices().To(core::Int64);
+    core::Tensor active_keys = block_hashmap_->GetKeyTensor()
+                                       .IndexGet({active_indices})
+                                       .To(host)
+                                       .Contiguous();
+    const int *keys_ptr = active_keys.GetDataPtr<int>();
+
+    // (last touched frame, index in active_indices). Blocks touched in the
+    // current frame are in the requested region and are kept.
+    std::vector<std::pair<int64_t, int64_t>> candidates;
+    for (int64_t i = 0; i < active_keys.GetLength(); ++i) {
+        Eigen::Vector3i key(keys_ptr[3 * i + 0], keys_ptr[3 * i + 1],
+                            keys_ptr[3 * i + 2]);
+        auto it = store.last_touched_.find(key);
+        int64_t frame = (it == store.last_touched_.end()) ? -1 : it->second;
+        if (frame < store.frame_) {
+            candidates.emplace_back(frame, i);
+        }
+    }
+
+    if (static_cast<int64_t>(candidates.size()) < num_blocks) {
+        utility::LogWarning(
+                "Unable to evict {} blocks, only {} are out of the requested "
+                "region. The hash map will grow beyond {} blocks.",
+                num_blocks, candidates.size(), store.max_active_blocks_);
+        num_blocks = candidates.size();
+    }
+    if (num_blocks == 0) {
+        return;
+    }
+    std::partial_sort(candidates.begin(), candidates.begin() + num_blocks,
+                      candidates.end());
+
+    std::vector<int64_t> victims(num_blocks);
+    for (int64_t i = 0; i < num_blocks; ++i) {
+        victims[i] = candidates[i].second;
+    }
+    core::Tensor victims_host(victims, {num_blocks}, core::Int64, host);
+    core::Tensor victim_keys = active_keys.IndexGet({victims_host});
+    core::Tensor victim_buf_indices =
+            active_indices.IndexGet({victims_host.To(device)});
+
+    std::vector<core::Tensor> victim_values;
+    for (const core::Tensor &value : block_hashmap_->GetValueTensors()) {
+        victim_values.push_back(
+                value.IndexGet({victim_buf_indices}).To(host).Contiguous());
+    }
+    store.Write(victim_keys, victim_values);
+
+    core::Tensor masks;
+    const bool synchronized =
+            block_occupancy_->num_blocks_ == block_hashmap_->Size();
+    block_hashmap_->Erase(victim_keys.To(device), masks);
+    // Erased blocks stay marked, which only makes RayCast skip less space.
+    if (synchronized) {
+        block_occupancy_->num_blocks_ = block_hashmap_->Size();
+    }
+
+    const int *victim_keys_ptr = victim_keys.GetDataPtr<int>();
+    for (int64_t i = 0; i < num_blocks; ++i) {
+        store.last_touched_.erase(Eigen::Vector3i(victim_keys_ptr[3 * i + 0],
+                                                  victim_keys_ptr[3 * i + 1],
+                                                  victim_keys_ptr[3 * i + 2]));
+    }
+}
+
 void VoxelBlockGrid::AssertInitialized() const {
     if (block_hashmap_ == nullptr) {
         utility::LogError("VoxelBlockGrid not initialized.");
     }
 }
 
+void VoxelBlockGrid::UpdateBlockOccupancy(const core::Tensor &block_coords,
+                                          int64_t prev_num_blocks) {
+    if (block_occupancy_->num_blocks_ != prev_num_blocks) {
+        return;
+    }
+    kernel::voxel_grid::UpdateBlockOccupancy(block_coords, *block_occupancy_);
+    block_occupancy_->num_blocks_ = block_hashmap_->Size();
+}
+
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/HashMap.h"
+#include "open3d/core/hashmap/HashSet.h"
 #include "open3d/t/geometry/Geometry.h"
 #include "open3d/t/geometry/Image.h"
 #include "open3d/t/geometry/PointCloud.h"
@@ -38,6 +39,12 @@ namespace open3d {
 namespace t {
 namespace geometry {
 
+namespace kernel {
+namespace voxel_grid {
+struct BlockOccupancy;
+}  // namespace voxel_grid
+}  // namespace kernel
+
 /// A voxel block grid is a sparse grid of voxel blocks.
 /// Each voxel block is a dense 3D array, preserving local data distribution.
 /// If the block_resolution is set to 1, then the VoxelBlockGrid degenerates to
@@ -68,6 +75,8 @@ public:
 
     /// Get the underlying hash map that stores values in structure of arrays
     /// (SoA).
+    /// Blocks inserted through the returned hash map change its size, which
+    /// makes RayCast rebuild its block occupancy on the next call.
     core::HashMap GetHashMap() { return *block_hashmap_; }
 
     /// Get the attribute tensor corresponding to the attribute name.
@@ -144,11 +153,16 @@ public:
     /// camera model.
     /// For built-in kernels, we support efficient hash map types for SLAM:
     /// tsdf: float, weight: uint16_t, color: uint16_t
-    /// and accurate mode for differentiable rendering:
+    /// accurate mode for differentiable rendering:
     /// tsdf/weight/color: float
+    /// and quantized modes for large scenes:
+    /// tsdf: int16_t, weight: uint16_t or uint8_t, color: uint8_t
+    /// Quantized TSDF values store the normalized TSDF in [-1, 1] with a step
+    /// of 1/32767, and quantized weights saturate at the maximum of their type.
     /// We assume input data are either raw:
     /// depth: uint16_t, color: uint8_t
-    /// or depth/color: float.
+    /// or depth/color: float. Invalid float depth may be NaN, e.g. the finest
+    /// level of an odometry RGBDPyramid, integrated with depth_scale 1.
     /// To support other types and properties, users should combine
     /// GetUniqueBlockCoordinates, GetVoxelIndices, and GetVoxelCoordinates,
     /// with self-defined operations.
@@ -191,6 +205,10 @@ public:
     /// Conventional rendering: vertex, depth, color, normal, range
     /// Differentiable rendering (voxel-wise): mask, index, (interpolation)
     /// ratio.
+    /// Rays leap over the cells of a coarse block occupancy grid that contain
+    /// no allocated block. The grid is maintained by Integrate and rebuilt
+    /// lazily after other insertions. The result does not depend on the state
+    /// of the grid.
     /// The block coordinates in the frustum can be taken from
     /// GetUniqueBlockCoordinates.
     /// All the block coordinates can be taken from GetHashMap().GetKeyTensor().
@@ -231,15 +249,91 @@ public:
     TriangleMesh ExtractTriangleMesh(float weight_threshold = 3.0f,
                                      int estimated_vertex_numer = -1);
 
+    /// Get (N, 3) Int32 coordinates of the blocks modified by Integrate since
+    /// the last call to ExtractTriangleMeshChunks.
+    core::Tensor GetDirtyBlockCoordinates() const;
+
+    /// Specific operation for TSDF volumes.
+    /// Incrementally extract mesh near iso-surfaces with Marching Cubes.
+    /// Only blocks whose surfaces may be changed by Integrate since the last
+    /// call are regenerated, i.e. the dirty blocks and their boundary
+    /// neighbours in the negative directions, whose cubes read voxels in the
+    /// dirty blocks. The dirty states are cleared afterwards.
+    /// Each regenerated block returns its own mesh chunk, which replaces the
+    /// previous chunk of the same block. Chunks are identical to the
+    /// corresponding parts of ExtractTriangleMesh, with vertices duplicated
+    /// at block boundaries. An empty chunk means the surface in the block has
+    /// vanished.
+    /// \return A pair of (N, 3) Int32 block coordinates and N mesh chunks.
+    std::pair<core::Tensor, std::vector<TriangleMesh>>
+    ExtractTriangleMeshChunks(float weight_threshold = 3.0f);
+
     /// Save a voxel block grid to a .npz file.
-    void Save(const std::string &file_name) const;
+    /// \param compress If true, each block is compressed with LZF, and blocks
+    /// with only zero values are elided. Compression is lossless, and Load
+    /// restores such files transparently.
+    void Save(const std::string &file_name, bool compress = false) const;
+
+    /// \brief Copy the blocks to host tensors keyed as in the .npz file
+    /// written by Save, including the evicted blocks.
+    /// The snapshot shares no memory with the grid, and can be saved by
+    /// SaveSnapshot on another thread while the grid is being updated.
+    std::unordered_map<std::string, core::Tensor> Snapshot() const;
+
+    /// Save a snapshot taken by Snapshot to a .npz file, see Save.
+    static void SaveSnapshot(
+            const std::string &file_name,
+            std::unordered_map<std::string, core::Tensor> snapshot,
+            bool compress = false);
 
     /// Load a voxel block grid from a .npz file.
     static VoxelBlockGrid Load(const std::string &file_name);
 
+    /// \brief Enable out-of-core streaming with a bounded number of blocks in
+    /// memory.
+    /// When GetUniqueBlockCoordinates or Integrate requests more blocks than
+    /// max_active_blocks allows, the least recently touched blocks outside the
+    /// requested region are compressed and evicted to an on-disk block store.
+    /// Evicted blocks are transparently paged back in when they are requested
+    /// again. Ray casting and surface extraction only see blocks in memory,
+    /// while Save also writes the evicted blocks.
+    /// \param block_store_dir Directory of the on-disk block store.
+    /// \param max_active_blocks Maximal number of blocks kept in memory,
+    /// including the ones being requested. Use -1 to take the capacity of the
+    /// hash map.
+    void EnableStreaming(const std::string &block_store_dir,
+                         int64_t max_active_blocks = -1);
+
+    /// Disable streaming, page all the evicted blocks back in memory and remove
+    /// the on-disk block store.
+    void DisableStreaming();
+
+    /// Return true if streaming is enabled.
+    bool IsStreaming() const { return block_store_ != nullptr; }
+
+    /// Get the number of blocks evicted to the on-disk block store.
+    int64_t GetNumEvictedBlocks() const;
+
 private:
+    class BlockStore;
+
     void AssertInitialized() const;
 
+    /// Mark block_coords inserted by this grid in the block occupancy, given
+    /// the hash map size before the insertion. Left to RayCast to rebuild if
+    /// the hash map was modified elsewhere since the last synchronization.
+    void UpdateBlockOccupancy(const core::Tensor &block_coords,
+                              int64_t prev_num_blocks);
+
+    /// Page in the evicted blocks among block_coords, and evict the least
+    /// recently touched blocks beforehand if they would not fit in memory.
+    /// No-op if streaming is disabled.
+    void StreamBlocks(const core::Tensor &block_coords);
+
+    /// Evict up to num_blocks least recently touched blocks that are not
+    /// touched in the current frame.
+    void EvictBlocks(int64_t num_blocks);
+
     float voxel_size_ = -1;
     int64_t block_resolution_ = -1;
 
@@ -251,6 +345,17 @@ private:
 
     // Map: attribute name -> index to access the attribute in SoA.
     std::unordered_map<std::string, int> name_attr_map_;
+
+    // Set of block coordinates modified since the last incremental mesh
+    // extraction.
+    std::shared_ptr<core::HashSet> dirty_block_set_;
+
+    // On-disk store of evicted blocks and block recency in streaming mode.
+    std::shared_ptr<BlockStore> block_store_;
+
+    // Coarse occupancy of the allocated blocks for empty space skipping in
+    // RayCast, shared by the copies sharing block_hashmap_.
+    std::shared_ptr<kernel::voxel_grid::BlockOccupancy> block_occupancy_;
 };
 }  // namespace geometry
 }  // namespace t
@@ -27,6 +27,7 @@
 #pragma once
 
 #include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
 
 namespace open3d {
 namespace t {
@@ -98,6 +99,37 @@ void ColorizeDepthCPU(const core::Tensor &src,
                       float min_value,
                       float max_value);
 
+// Portable CPU filters, used when IPP is not available or disabled. They follow
+// the IPP conventions: replicated border and saturating round-to-nearest-even
+// conversion for integer images.
+void RGBToGrayCPU(const core::Tensor &src, core::Tensor &dst);
+
+void ResizeCPU(const core::Tensor &src,
+               core::Tensor &dst,
+               t::geometry::Image::InterpType interp_type);
+
+void DilateCPU(const core::Tensor &src, core::Tensor &dst, int kernel_size);
+
+void FilterCPU(const core::Tensor &src,
+               core::Tensor &dst,
+               const core::Tensor &kernel);
+
+void FilterBilateralCPU(const core::Tensor &src,
+                        core::Tensor &dst,
+                        int kernel_size,
+                        float value_sigma,
+                        float distance_sigma);
+
+void FilterGaussianCPU(const core::Tensor &src,
+                       core::Tensor &dst,
+                       int kernel_size,
+                       float sigma);
+
+void FilterSobelCPU(const core::Tensor &src,
+                    core::Tensor &dst_dx,
+                    core::Tensor &dst_dy,
+                    int kernel_size);
+
 #ifdef BUILD_CUDA_MODULE
 void ToCUDA(const core::Tensor &src,
             core::Tensor &dst,
@@ -0,0 +1,741 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Portable CPU implementations of the image filters that are otherwise only
+// provided through IPP. All filters work on strips of rows: each strip is
+// converted to float rows padded with replicated border pixels, so that the
+// inner loops run over contiguous memory without bounds checks and can be
+// vectorized by the compiler on any target architecture.
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/Image.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace image {
+
+namespace {
+
+/// Number of output rows processed by one task. The padded input rows of a
+/// strip fit in the L2 cache for common image widths.
+constexpr int64_t kStripRows = 32;
+
+template <typename T,
+          typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+inline T SaturateCast(float v) {
+    v = std::nearbyint(v);
+    v = std::max(v, static_cast<float>(std::numeric_limits<T>::lowest()));
+    v = std::min(v, static_cast<float>(std::numeric_limits<T>::max()));
+    return static_cast<T>(v);
+}
+
+template <typename T,
+          typename std::enable_if<std::is_floating_point<T>::value,
+                                  int>::type = 0>
+inline T SaturateCast(float v) {
+    return static_cast<T>(v);
+}
+
+inline int64_t Clamp(int64_t v, int64_t lo, int64_t hi) {
+    return std::min(std::max(v, lo), hi);
+}
+
+/// Calls func(row_begin, row_end) in parallel over strips of kStripRows rows.
+template <typename func_t>
+void ParallelForStrips(int64_t rows, const func_t &func) {
+    const int64_t num_strips = (rows + kStripRows - 1) / kStripRows;
+    core::ParallelFor(core::Device("CPU:0"), num_strips, [&](int64_t strip) {
+        const int64_t row_begin = strip * kStripRows;
+        func(row_begin, std::min(row_begin + kStripRows, rows));
+    });
+}
+
+/// Copies a row of \p cols pixels to \p line, adding \p pad_left and
+/// \p pad_right replicated pixels on each side.
+template <typename src_t, typename dst_t>
+inline void LoadPaddedRow(const src_t *row,
+                          int64_t cols,
+                          int64_t channels,
+                          int64_t pad_left,
+                          int64_t pad_right,
+                          dst_t *line) {
+    dst_t *interior = line + pad_left * channels;
+    const int64_t row_len = cols * channels;
+    for (int64_t k = 0; k < row_len; ++k) {
+        interior[k] = static_cast<dst_t>(row[k]);
+    }
+    for (int64_t x = 0; x < pad_left; ++x) {
+        for (int64_t c = 0; c < channels; ++c) {
+            line[x * channels + c] = interior[c];
+        }
+    }
+    dst_t *right = interior + row_len;
+    for (int64_t x = 0; x < pad_right; ++x) {
+        for (int64_t c = 0; c < channels; ++c) {
+            right[x * channels + c] = interior[row_len - channels + c];
+        }
+    }
+}
+
+inline void AccumulateRow(const float *in, float w, float *acc, int64_t n) {
+    for (int64_t k = 0; k < n; ++k) {
+        acc[k] += w * in[k];
+    }
+}
+
+template <typename dst_t>
+inline void StoreRow(const float *acc, dst_t *dst, int64_t n) {
+    for (int64_t k = 0; k < n; ++k) {
+        dst[k] = SaturateCast<dst_t>(acc[k]);
+    }
+}
+
+/// Correlation with the separable kernel kernel_y * kernel_x^T, anchored at
+/// the kernel center. The horizontal pass of a strip is kept in a small
+/// buffer and reused by the vertical pass.
+template <typename src_t, typename dst_t>
+void CorrelateSeparable(const src_t *src,
+                        dst_t *dst,
+                        int64_t rows,
+                        int64_t cols,
+                        int64_t channels,
+                        const std::vector<float> &kernel_x,
+                        const std::vector<float> &kernel_y) {
+    const int64_t kw = static_cast<int64_t>(kernel_x.size());
+    const int64_t kh = static_cast<int64_t>(kernel_y.size());
+    const int64_t rx = kw / 2, ry = kh / 2;
+    const int64_t row_len = cols * channels;
+    const int64_t line_len = (cols + kw - 1) * channels;
+
+    ParallelForStrips(rows, [&](int64_t row_begin, int64_t row_end) {
+        const int64_t num_lines = row_end - row_begin + kh - 1;
+        std::vector<float> line(line_len);
+        std::vector<float> horizontal(num_lines * row_len, 0.0f);
+        for (int64_t i = 0; i < num_lines; ++i) {
+            const int64_t y = Clamp(row_begin - ry + i, 0, rows - 1);
+            LoadPaddedRow(src + y * row_len, cols, channels, rx, kw - 1 - rx,
+                          line.data());
+            float *h = horizontal.data() + i * row_len;
+            for (int64_t j = 0; j < kw; ++j) {
+                AccumulateRow(line.data() + j * channels, kernel_x[j], h,
+                              row_len);
+            }
+        }
+
+        std::vector<float> acc(row_len);
+        for (int64_t y = row_begin; y < row_end; ++y) {
+            std::fill(acc.begin(), acc.end(), 0.0f);
+            for (int64_t i = 0; i < kh; ++i) {
+                AccumulateRow(horizontal.data() + (y - row_begin + i) * row_len,
+                              kernel_y[i], acc.data(), row_len);
+            }
+            StoreRow(acc.data(), dst + y * row_len, row_len);
+        }
+    });
+}
+
+/// Correlation with a general (kh, kw) row-major kernel, anchored at the
+/// kernel center.
+template <typename src_t, typename dst_t>
+void Correlate2D(const src_t *src,
+                 dst_t *dst,
+                 int64_t rows,
+                 int64_t cols,
+                 int64_t channels,
+                 const std::vector<float> &kernel,
+                 int64_t kh,
+                 int64_t kw) {
+    const int64_t rx = kw / 2, ry = kh / 2;
+    const int64_t row_len = cols * channels;
+    const int64_t line_len = (cols + kw - 1) * channels;
+
+    ParallelForStrips(rows, [&](int64_t row_begin, int64_t row_end) {
+        const int64_t num_lines = row_end - row_begin + kh - 1;
+        std::vector<float> lines(num_lines * line_len);
+        for (int64_t i = 0; i < num_lines; ++i) {
+            const int64_t y = Clamp(row_begin - ry + i, 0, rows - 1);
+            LoadPaddedRow(src + y * row_len, cols, channels, rx, kw - 1 - rx,
+                          lines.data() + i * line_len);
+        }
+
+        std::vector<float> acc(row_len);
+        for (int64_t y = row_begin; y < row_end; ++y) {
+            std::fill(acc.begin(), acc.end(), 0.0f);
+            for (int64_t i = 0; i < kh; ++i) {
+                const float *line =
+                        lines.data() + (y - row_begin + i) * line_len;
+                for (int64_t j = 0; j < kw; ++j) {
+                    const float w = kernel[i * kw + j];
+                    if (w != 0.0f) {
+                        AccumulateRow(line + j * channels, w, acc.data(),
+                                      row_len);
+                    }
+                }
+            }
+            StoreRow(acc.data(), dst + y * row_len, row_len);
+        }
+    });
+}
+
+/// Splits a (kh, kw) kernel into kernel_y * kernel_x^T if it has rank one.
+bool SeparateKernel(const std::vector<float> &kernel,
+                    int64_t kh,
+                    int64_t kw,
+                    std::vector<float> &kernel_x,
+                    std::vector<float> &kernel_y) {
+    int64_t pivot = 0;
+    for (int64_t k = 1; k < kh * kw; ++k) {
+        if (std::abs(kernel[k]) > std::abs(kernel[pivot])) {
+            pivot = k;
+        }
+    }
+    const float p = kernel[pivot];
+    if (p == 0.0f) {
+        return false;
+    }
+    const int64_t pi = pivot / kw, pj = pivot % kw;
+    kernel_x.resize(kw);
+    kernel_y.resize(kh);
+    for (int64_t j = 0; j < kw; ++j) {
+        kernel_x[j] = kernel[pi * kw + j];
+    }
+    for (int64_t i = 0; i < kh; ++i) {
+        kernel_y[i] = kernel[i * kw + pj] / p;
+    }
+    const float tol = 1e-6f * std::abs(p);
+    for (int64_t i = 0; i < kh; ++i) {
+        for (int64_t j = 0; j < kw; ++j) {
+            if (std::abs(kernel_y[i] * kernel_x[j] - kernel[i * kw + j]) >
+                tol) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename scalar_t>
+void BilateralImpl(const scalar_t *src,
+                   scalar_t *dst,
+                   int64_t rows,
+                   int64_t cols,
+                   int64_t channels,
+                   int64_t radius,
+                   float value_sigma,
+                   float distance_sigma) {
+    // Circular window, with the L1 distance between pixel values.
+    struct Tap {
+        int64_t dy;
+        int64_t offset;
+        float weight;
+    };
+    std::vector<Tap> taps;
+    const float inv_dist = 1.0f / (2.0f * distance_sigma * distance_sigma);
+    for (int64_t dy = -radius; dy <= radius; ++dy) {
+        for (int64_t dx = -radius; dx <= radius; ++dx) {
+            const int64_t d2 = dx * dx + dy * dy;
+            if (d2 <= radius * radius) {
+                taps.push_back({dy, dx * channels,
+                                std::exp(-static_cast<float>(d2) * inv_dist)});
+            }
+        }
+    }
+
+    // 8-bit images have a bounded set of value differences, look them up.
+    const float inv_value = 1.0f / (2.0f * value_sigma * value_sigma);
+    const bool use_lut = std::is_same<scalar_t, uint8_t>::value;
+    std::vector<float> value_lut;
+    if (use_lut) {
+        value_lut.resize(255 * channels + 1);
+        for (size_t d = 0; d < value_lut.size(); ++d) {
+            const float df = static_cast<float>(d);
+            value_lut[d] = std::exp(-df * df * inv_value);
+        }
+    }
+
+    const int64_t row_len = cols * channels;
+    const int64_t line_len = (cols + 2 * radius) * channels;
+    ParallelForStrips(rows, [&](int64_t row_begin, int64_t row_end) {
+        const int64_t num_lines = row_end - row_begin + 2 * radius;
+        std::vector<float> lines(num_lines * line_len);
+        for (int64_t i = 0; i < num_lines; ++i) {
+            const int64_t y = Clamp(row_begin - radius + i, 0, rows - 1);
+            LoadPaddedRow(src + y * row_len, cols, channels, radius, radius,
+                          lines.data() + i * line_len);
+        }
+
+        float sum[4];
+        for (int64_t y = row_begin; y < row_end; ++y) {
+            const float *center_line =
+                    lines.data() + (y - row_begin + radius) * line_len;
+            scalar_t *dst_row = dst + y * row_len;
+            for (int64_t x = 0; x < cols; ++x) {
+                const int64_t center_offset = (x + radius) * channels;
+                const float *center = center_line + center_offset;
+                std::fill(sum, sum + channels, 0.0f);
+                float weight_sum = 0.0f;
+                for (const Tap &tap : taps) {
+                    const float *p = center + tap.dy * line_len + tap.offset;
+                    float diff = 0.0f;
+                    for (int64_t c = 0; c < channels; ++c) {
+                        diff += std::abs(p[c] - center[c]);
+                    }
+                    const float w =
+                            tap.weight *
+                            (use_lut ? value_lut[static_cast<int64_t>(diff)]
+                                     : std::exp(-diff * diff * inv_value));
+                    for (int64_t c = 0; c < channels; ++c) {
+                        sum[c] += w * p[c];
+                    }
+                    weight_sum += w;
+                }
+                for (int64_t c = 0; c < channels; ++c) {
+                    dst_row[x * channels + c] =
+                            SaturateCast<scalar_t>(sum[c] / weight_sum);
+                }
+            }
+        }
+    });
+}
+
+template <typename scalar_t>
+void DilateImpl(const scalar_t *src,
+                scalar_t *dst,
+                int64_t rows,
+                int64_t cols,
+                int64_t channels,
+                int64_t kernel_size) {
+    // A square max filter is separable: max over rows of max over columns.
+    const int64_t r = kernel_size / 2;
+    const int64_t row_len = cols * channels;
+    const int64_t line_len = (cols + kernel_size - 1) * channels;
+    ParallelForStrips(rows, [&](int64_t row_begin, int64_t row_end) {
+        const int64_t num_lines = row_end - row_begin + kernel_size - 1;
+        std::vector<scalar_t> line(line_len);
+        std::vector<scalar_t> horizontal(num_lines * row_len);
+        for (int64_t i = 0; i < num_lines; ++i) {
+            const int64_t y = Clamp(row_begin - r + i, 0, rows - 1);
+            LoadPaddedRow(src + y * row_len, cols, channels, r,
+                          kernel_size - 1 - r, line.data());
+            scalar_t *h = horizontal.data() + i * row_len;
+            std::copy(line.begin(), line.begin() + row_len, h);
+            for (int64_t j = 1; j < kernel_size; ++j) {
+                const scalar_t *in = line.data() + j * channels;
+                for (int64_t k = 0; k < row_len; ++k) {
+                    h[k] = h[k] < in[k] ? in[k] : h[k];
+                }
+            }
+        }
+
+        for (int64_t y = row_begin; y < row_end; ++y) {
+            scalar_t *out = dst + y * row_len;
+            const scalar_t *first =
+                    horizontal.data() + (y - row_begin) * row_len;
+            std::copy(first, first + row_len, out);
+            for (int64_t i = 1; i < kernel_size; ++i) {
+                const scalar_t *in = first + i * row_len;
+                for (int64_t k = 0; k < row_len; ++k) {
+                    out[k] = out[k] < in[k] ? in[k] : out[k];
+                }
+            }
+        }
+    });
+}
+
+/// Resampling taps for one axis: output pixel i reads source pixels
+/// index_[i * num_taps_ + t] with weights weight_[i * num_taps_ + t].
+struct ResampleTaps {
+    int64_t num_taps_ = 0;
+    std::vector<int64_t> index_;
+    std::vector<float> weight_;
+};
+
+inline float CubicWeight(float d) {
+    // Keys cubic convolution with a = -0.5.
+    constexpr float a = -0.5f;
+    d = std::abs(d);
+    if (d <= 1.0f) {
+        return ((a + 2.0f) * d - (a + 3.0f)) * d * d + 1.0f;
+    } else if (d < 2.0f) {
+        return ((a * d - 5.0f * a) * d + 8.0f * a) * d - 4.0f * a;
+    }
+    return 0.0f;
+}
+
+inline float LanczosWeight(float d) {
+    // Lanczos3 window.
+    constexpr float kPi = 3.14159265358979323846f;
+    d = std::abs(d);
+    if (d < 1e-6f) {
+        return 1.0f;
+    } else if (d >= 3.0f) {
+        return 0.0f;
+    }
+    const float pd = kPi * d;
+    return 3.0f * std::sin(pd) * std::sin(pd / 3.0f) / (pd * pd);
+}
+
+ResampleTaps ComputeResampleTaps(int64_t src_size,
+                                 int64_t dst_size,
+                                 Image::InterpType interp_type) {
+    ResampleTaps taps;
+    const double scale =
+            static_cast<double>(src_size) / static_cast<double>(dst_size);
+
+    if (interp_type == Image::InterpType::Super) {
+        // Area averaging: each output pixel is the coverage-weighted mean of
+        // the source pixels under it.
+        taps.num_taps_ = static_cast<int64_t>(std::ceil(scale)) + 1;
+        taps.index_.assign(dst_size * taps.num_taps_, 0);
+        taps.weight_.assign(dst_size * taps.num_taps_, 0.0f);
+        for (int64_t i = 0; i < dst_size; ++i) {
+            const double left = i * scale, right = (i + 1) * scale;
+            const int64_t first = static_cast<int64_t>(std::floor(left));
+            for (int64_t t = 0; t < taps.num_taps_; ++t) {
+                const int64_t s = first + t;
+                const double overlap = std::min<double>(s + 1, right) -
+                                       std::max<double>(s, left);
+                taps.index_[i * taps.num_taps_ + t] =
+                        Clamp(s, 0, src_size - 1);
+                if (overlap > 0 && s < src_size) {
+                    taps.weight_[i * taps.num_taps_ + t] =
+                            static_cast<float>(overlap / scale);
+                }
+            }
+        }
+        return taps;
+    }
+
+    int64_t support;
+    float (*weight_fn)(float) = nullptr;
+    if (interp_type == Image::InterpType::Linear) {
+        support = 1;
+    } else if (interp_type == Image::InterpType::Cubic) {
+        support = 2;
+        weight_fn = CubicWeight;
+    } else if (interp_type == Image::InterpType::Lanczos) {
+        support = 3;
+        weight_fn = LanczosWeight;
+    } else {
+        utility::LogError("Unsupported interpolation type {}.",
+                          static_cast<int>(interp_type));
+    }
+
+    taps.num_taps_ = 2 * support;
+    taps.index_.resize(dst_size * taps.num_taps_);
+    taps.weight_.resize(dst_size * taps.num_taps_);
+    for (int64_t i = 0; i < dst_size; ++i) {
+        // Pixel centers are at half-integer coordinates.
+        const double center = (i + 0.5) * scale - 0.5;
+        const int64_t base = static_cast<int64_t>(std::floor(center));
+        const float frac = static_cast<float>(center - base);
+        float weight_sum = 0.0f;
+        for (int64_t t = 0; t < taps.num_taps_; ++t) {
+            const int64_t offset = t - support + 1;
+            const float w = weight_fn == nullptr
+                                    ? (offset == 0 ? 1.0f - frac : frac)
+                                    : weight_fn(offset - frac);
+            taps.index_[i * taps.num_taps_ + t] =
+                    Clamp(base + offset, 0, src_size - 1);
+            taps.weight_[i * taps.num_taps_ + t] = w;
+            weight_sum += w;
+        }
+        for (int64_t t = 0; t < taps.num_taps_; ++t) {
+            taps.weight_[i * taps.num_taps_ + t] /= weight_sum;
+        }
+    }
+    return taps;
+}
+
+template <typename scalar_t>
+void ResampleImpl(const scalar_t *src,
+                  scalar_t *dst,
+                  int64_t src_rows,
+                  int64_t src_cols,
+                  int64_t dst_rows,
+                  int64_t dst_cols,
+                  int64_t channels,
+                  Image::InterpType interp_type) {
+    const ResampleTaps taps_x =
+            ComputeResampleTaps(src_cols, dst_cols, interp_type);
+    const ResampleTaps taps_y =
+            ComputeResampleTaps(src_rows, dst_rows, interp_type);
+
+    // Horizontal pass over the source rows that are actually read.
+    const int64_t src_row_len = src_cols * channels;
+    const int64_t dst_row_len = dst_cols * channels;
+    std::vector<float> horizontal(src_rows * dst_row_len);
+    core::ParallelFor(core::Device("CPU:0"), src_rows, [&](int64_t y) {
+        const scalar_t *in = src + y * src_row_len;
+        float *out = horizontal.data() + y * dst_row_len;
+        for (int64_t x = 0; x < dst_cols; ++x) {
+            const int64_t *index = taps_x.index_.data() + x * taps_x.num_taps_;
+            const float *weight = taps_x.weight_.data() + x * taps_x.num_taps_;
+            for (int64_t c = 0; c < channels; ++c) {
+                float sum = 0.0f;
+                for (int64_t t = 0; t < taps_x.num_taps_; ++t) {
+                    sum += weight[t] *
+                           static_cast<float>(in[index[t] * channels + c]);
+                }
+                out[x * channels + c] = sum;
+            }
+        }
+    });
+
+    // Vertical pass, over contiguous rows of the horizontal result.
+    ParallelForStrips(dst_rows, [&](int64_t row_begin, int64_t row_end) {
+        std::vector<float> acc(dst_row_len);
+        for (int64_t y = row_begin; y < row_end; ++y) {
+            std::fill(acc.begin(), acc.end(), 0.0f);
+            const int64_t *index = taps_y.index_.data() + y * taps_y.num_taps_;
+            const float *weight = taps_y.weight_.data() + y * taps_y.num_taps_;
+            for (int64_t t = 0; t < taps_y.num_taps_; ++t) {
+                if (weight[t] != 0.0f) {
+                    AccumulateRow(horizontal.data() + index[t] * dst_row_len,
+                                  weight[t], acc.data(), dst_row_len);
+                }
+            }
+            StoreRow(acc.data(), dst + y * dst_row_len, dst_row_len);
+        }
+    });
+}
+
+template <typename scalar_t>
+void ResizeNearestImpl(const scalar_t *src,
+                       scalar_t *dst,
+                       int64_t src_rows,
+                       int64_t src_cols,
+                       int64_t dst_rows,
+                       int64_t dst_cols,
+                       int64_t channels) {
+    const double scale_x =
+            static_cast<double>(src_cols) / static_cast<double>(dst_cols);
+    const double scale_y =
+            static_cast<double>(src_rows) / static_cast<double>(dst_rows);
+    std::vector<int64_t> src_x(dst_cols);
+    for (int64_t x = 0; x < dst_cols; ++x) {
+        src_x[x] = Clamp(static_cast<int64_t>(std::floor(x * scale_x)), 0,
+                         src_cols - 1);
+    }
+    core::ParallelFor(core::Device("CPU:0"), dst_rows, [&](int64_t y) {
+        const int64_t sy = Clamp(static_cast<int64_t>(std::floor(y * scale_y)),
+                                 0, src_rows - 1);
+        const scalar_t *in = src + sy * src_cols * channels;
+        scalar_t *out = dst + y * dst_cols * channels;
+        for (int64_t x = 0; x < dst_cols; ++x) {
+            std::memcpy(out + x * channels, in + src_x[x] * channels,
+                        channels * sizeof(scalar_t));
+        }
+    });
+}
+
+std::vector<float> GaussianKernel1D(int kernel_size, float sigma) {
+    std::vector<float> kernel(kernel_size);
+    const int r = kernel_size / 2;
+    float sum = 0.0f;
+    for (int i = 0; i < kernel_size; ++i) {
+        const float d = static_cast<float>(i - r);
+        kernel[i] = std::exp(-d * d / (2.0f * sigma * sigma));
+        sum += kernel[i];
+    }
+    for (float &w : kernel) {
+        w /= sum;
+    }
+    return kernel;
+}
+
+}  // namespace
+
+void RGBToGrayCPU(const core::Tensor &src, core::Tensor &dst) {
+    const int64_t n = src.GetShape(0) * src.GetShape(1);
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t *src_ptr = src.GetDataPtr<scalar_t>();
+        scalar_t *dst_ptr = dst.GetDataPtr<scalar_t>();
+        core::ParallelFor(src.GetDevice(), n, [&](int64_t i) {
+            const scalar_t *rgb = src_ptr + 3 * i;
+            dst_ptr[i] = SaturateCast<scalar_t>(
+                    0.299f * static_cast<float>(rgb[0]) +
+                    0.587f * static_cast<float>(rgb[1]) +
+                    0.114f * static_cast<float>(rgb[2]));
+        });
+    });
+}
+
+void ResizeCPU(const core::Tensor &src,
+               core::Tensor &dst,
+               t::geometry::Image::InterpType interp_type) {
+    const int64_t src_rows = src.GetShape(0), src_cols = src.GetShape(1);
+    const int64_t dst_rows = dst.GetShape(0), dst_cols = dst.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    if (interp_type == Image::InterpType::Super &&
+        (dst_rows > src_rows || dst_cols > src_cols)) {
+        utility::LogError(
+                "Super interpolation only supports downsampling, but got "
+                "({}, {}) -> ({}, {}).",
+                src_rows, src_cols, dst_rows, dst_cols);
+    }
+    if (dst_rows == 0 || dst_cols == 0) {
+        return;
+    }
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t *src_ptr = src.GetDataPtr<scalar_t>();
+        scalar_t *dst_ptr = dst.GetDataPtr<scalar_t>();
+        if (interp_type == Image::InterpType::Nearest) {
+            ResizeNearestImpl(src_ptr, dst_ptr, src_rows, src_cols, dst_rows,
+                              dst_cols, channels);
+        } else {
+            ResampleImpl(src_ptr, dst_ptr, src_rows, src_cols, dst_rows,
+                         dst_cols, channels, interp_type);
+        }
+    });
+}
+
+void DilateCPU(const core::Tensor &src, core::Tensor &dst, int kernel_size) {
+    const int64_t rows = src.GetShape(0), cols = src.GetShape(1),
+                  channels = src.GetShape(2);
+    if (src.GetDtype() == core::Bool) {
+        // Bool is stored as one byte per element, 0 or 1.
+        DilateImpl(static_cast<const uint8_t *>(src.GetDataPtr()),
+                   static_cast<uint8_t *>(dst.GetDataPtr()), rows, cols,
+                   channels, kernel_size);
+        return;
+    }
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        DilateImpl(src.GetDataPtr<scalar_t>(), dst.GetDataPtr<scalar_t>(), rows,
+                   cols, channels, kernel_size);
+    });
+}
+
+void FilterCPU(const core::Tensor &src,
+               core::Tensor &dst,
+               const core::Tensor &kernel) {
+    if (kernel.NumDims() != 2) {
+        utility::LogError("Kernel must be 2D, but got {}D.", kernel.NumDims());
+    }
+    const int64_t kh = kernel.GetShape(0), kw = kernel.GetShape(1);
+    const std::vector<float> kernel_values =
+            kernel.To(core::Device("CPU:0"), core::Float32)
+                    .Contiguous()
+                    .ToFlatVector<float>();
+
+    std::vector<float> kernel_x, kernel_y;
+    const bool separable =
+            SeparateKernel(kernel_values, kh, kw, kernel_x, kernel_y);
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t *src_ptr = src.GetDataPtr<scalar_t>();
+        scalar_t *dst_ptr = dst.GetDataPtr<scalar_t>();
+        if (separable) {
+            CorrelateSeparable(src_ptr, dst_ptr, src.GetShape(0),
+                               src.GetShape(1), src.GetShape(2), kernel_x,
+                               kernel_y);
+        } else {
+            Correlate2D(src_ptr, dst_ptr, src.GetShape(0), src.GetShape(1),
+                        src.GetShape(2), kernel_values, kh, kw);
+        }
+    });
+}
+
+void FilterBilateralCPU(const core::Tensor &src,
+                        core::Tensor &dst,
+                        int kernel_size,
+                        float value_sigma,
+                        float distance_sigma) {
+    if (src.GetShape(2) > 4) {
+        utility::LogError("Expected at most 4 channels, but got {}.",
+                          src.GetShape(2));
+    }
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        BilateralImpl(src.GetDataPtr<scalar_t>(), dst.GetDataPtr<scalar_t>(),
+                      src.GetShape(0), src.GetShape(1), src.GetShape(2),
+                      kernel_size / 2, value_sigma, distance_sigma);
+    });
+}
+
+void FilterGaussianCPU(const core::Tensor &src,
+                       core::Tensor &dst,
+                       int kernel_size,
+                       float sigma) {
+    const std::vector<float> kernel = GaussianKernel1D(kernel_size, sigma);
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        CorrelateSeparable(src.GetDataPtr<scalar_t>(),
+                           dst.GetDataPtr<scalar_t>(), src.GetShape(0),
+                           src.GetShape(1), src.GetShape(2), kernel, kernel);
+    });
+}
+
+void FilterSobelCPU(const core::Tensor &src,
+                    core::Tensor &dst_dx,
+                    core::Tensor &dst_dy,
+                    int kernel_size) {
+    std::vector<float> smooth, derivative;
+    if (kernel_size == 3) {
+        smooth = {1, 2, 1};
+        derivative = {-1, 0, 1};
+    } else if (kernel_size == 5) {
+        smooth = {1, 4, 6, 4, 1};
+        derivative = {-1, -2, 0, 2, 1};
+    } else {
+        utility::LogError("Kernel size must be 3 or 5, but got {}.",
+                          kernel_size);
+    }
+
+    const int64_t rows = src.GetShape(0), cols = src.GetShape(1),
+                  channels = src.GetShape(2);
+    if (src.GetDtype() == core::UInt8) {
+        const uint8_t *src_ptr = src.GetDataPtr<uint8_t>();
+        CorrelateSeparable(src_ptr, dst_dx.GetDataPtr<int16_t>(), rows, cols,
+                           channels, derivative, smooth);
+        CorrelateSeparable(src_ptr, dst_dy.GetDataPtr<int16_t>(), rows, cols,
+                           channels, smooth, derivative);
+    } else if (src.GetDtype() == core::Float32) {
+        const float *src_ptr = src.GetDataPtr<float>();
+        CorrelateSeparable(src_ptr, dst_dx.GetDataPtr<float>(), rows, cols,
+                           channels, derivative, smooth);
+        CorrelateSeparable(src_ptr, dst_dy.GetDataPtr<float>(), rows, cols,
+                           channels, smooth, derivative);
+    } else {
+        utility::LogError("Unsupported dtype {}.", src.GetDtype().ToString());
+    }
+}
+
+}  // namespace image
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
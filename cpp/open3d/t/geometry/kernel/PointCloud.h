@@ -79,7 +79,17 @@ void ProjectCPU(
         float depth_scale,
         float depth_max);
 
+void ComputeMortonCodesCPU(const core::Tensor& points, core::Tensor& codes);
+
+void SortByMortonCodeCPU(const core::Tensor& points,
+                         core::Tensor& permutation);
+
 #ifdef BUILD_CUDA_MODULE
+void ComputeMortonCodesCUDA(const core::Tensor& points, core::Tensor& codes);
+
+void SortByMortonCodeCUDA(const core::Tensor& points,
+                          core::Tensor& permutation);
+
 void UnprojectCUDA(
         const core::Tensor& depth,
         utility::optional<std::reference_wrapper<const core::Tensor>>
@@ -24,6 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+
+#include <utility>
+#include <vector>
+
 #include "open3d/t/geometry/kernel/PointCloudImpl.h"
 
 namespace open3d {
@@ -99,6 +105,37 @@ void ProjectCPU(
     });
 }
 
+void SortByMortonCodeCPU(const core::Tensor& points,
+                         core::Tensor& permutation) {
+    core::Tensor codes;
+    ComputeMortonCodesCPU(points, codes);
+
+    const int64_t n = points.GetLength();
+    const uint64_t* codes_ptr = codes.GetDataPtr<uint64_t>();
+
+    // Sorting (code, index) pairs keeps the order of points with equal codes
+    // deterministic.
+    std::vector<std::pair<uint64_t, int64_t>> codes_indices(n);
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, n),
+                      [&](const tbb::blocked_range<int64_t>& r) {
+                          for (int64_t i = r.begin(); i != r.end(); ++i) {
+                              codes_indices[i].first = codes_ptr[i];
+                              codes_indices[i].second = i;
+                          }
+                      });
+
+    tbb::parallel_sort(codes_indices);
+
+    permutation = core::Tensor::Empty({n}, core::Int64, points.GetDevice());
+    int64_t* permutation_ptr = permutation.GetDataPtr<int64_t>();
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, n),
+                      [&](const tbb::blocked_range<int64_t>& r) {
+                          for (int64_t i = r.begin(); i != r.end(); ++i) {
+                              permutation_ptr[i] = codes_indices[i].second;
+                          }
+                      });
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
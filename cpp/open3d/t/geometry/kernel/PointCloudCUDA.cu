@@ -24,6 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <thrust/device_ptr.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
 #include "open3d/t/geometry/kernel/PointCloudImpl.h"
 
 namespace open3d {
@@ -116,6 +120,24 @@ void ProjectCUDA(
             });
 }
 
+void SortByMortonCodeCUDA(const core::Tensor& points,
+                          core::Tensor& permutation) {
+    core::Tensor codes;
+    ComputeMortonCodesCUDA(points, codes);
+
+    const int64_t n = points.GetLength();
+    permutation = core::Tensor::Empty({n}, core::Int64, points.GetDevice());
+
+    thrust::device_ptr<uint64_t> codes_dptr =
+            thrust::device_pointer_cast(codes.GetDataPtr<uint64_t>());
+    thrust::device_ptr<int64_t> permutation_dptr =
+            thrust::device_pointer_cast(permutation.GetDataPtr<int64_t>());
+
+    // A stable sort keeps the order of points with equal codes deterministic.
+    thrust::sequence(permutation_dptr, permutation_dptr + n, 0);
+    thrust::stable_sort_by_key(codes_dptr, codes_dptr + n, permutation_dptr);
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
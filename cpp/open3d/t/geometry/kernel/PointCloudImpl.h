@@ -41,6 +41,7 @@
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/MortonCode.h"
 
 namespace open3d {
 namespace t {
@@ -858,6 +859,46 @@ void EstimateColorGradientsUsingKNNSearchCPU
     core::cuda::Synchronize(points.GetDevice());
 }
 
+#if defined(__CUDACC__)
+void ComputeMortonCodesCUDA
+#else
+void ComputeMortonCodesCPU
+#endif
+        (const core::Tensor& points, core::Tensor& codes) {
+    const int64_t n = points.GetLength();
+    codes = core::Tensor::Empty({n}, core::UInt64, points.GetDevice());
+    if (n == 0) {
+        return;
+    }
+
+    // The grid spans the axis aligned bounding box of the points.
+    static const core::Device host("CPU:0");
+    const std::vector<double> min_bound =
+            points.Min({0}).To(host, core::Float64).ToFlatVector<double>();
+    const std::vector<double> max_bound =
+            points.Max({0}).To(host, core::Float64).ToFlatVector<double>();
+
+    uint64_t* codes_ptr = codes.GetDataPtr<uint64_t>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        const scalar_t min_x = static_cast<scalar_t>(min_bound[0]);
+        const scalar_t min_y = static_cast<scalar_t>(min_bound[1]);
+        const scalar_t min_z = static_cast<scalar_t>(min_bound[2]);
+        const scalar_t inv_cell_size = static_cast<scalar_t>(
+                utility::MortonInvCellSize(min_bound.data(),
+                                           max_bound.data()));
+
+        core::ParallelFor(
+                points.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const scalar_t origin[3] = {min_x, min_y, min_z};
+                    codes_ptr[workload_idx] = utility::MortonCode3D(
+                            points_ptr + 3 * workload_idx, origin,
+                            inv_cell_size);
+                });
+    });
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
@@ -100,24 +100,135 @@ void GetVoxelCoordinatesAndFlattenedIndices(const core::Tensor& buf_indices,
     }
 }
 
-#define DISPATCH_VALUE_DTYPE_TO_TEMPLATE(WEIGHT_DTYPE, COLOR_DTYPE, ...)    \
+static void MarkBlockOccupancy(const core::Tensor& block_keys,
+                               BlockOccupancy& occupancy) {
+    core::Tensor block_keys_contiguous = block_keys.Contiguous();
+    if (block_keys.IsCPU()) {
+        MarkBlockOccupancyCPU(block_keys_contiguous, occupancy.fine_,
+                              occupancy.coarse_, occupancy.origin_[0],
+                              occupancy.origin_[1], occupancy.origin_[2],
+                              occupancy.shift_);
+    } else if (block_keys.IsCUDA()) {
+        CUDA_CALL(MarkBlockOccupancyCUDA, block_keys_contiguous,
+                  occupancy.fine_, occupancy.coarse_, occupancy.origin_[0],
+                  occupancy.origin_[1], occupancy.origin_[2],
+                  occupancy.shift_);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void BuildBlockOccupancy(const core::Tensor& block_keys,
+                         BlockOccupancy& occupancy) {
+    // Keeps the grid within 16MB. Larger scenes use coarser cells.
+    constexpr int64_t kMaxCells = 1 << 24;
+
+    core::Device device = block_keys.GetDevice();
+    occupancy.shift_ = 0;
+    if (block_keys.GetLength() == 0) {
+        occupancy.origin_[0] = occupancy.origin_[1] = occupancy.origin_[2] = 0;
+        occupancy.fine_ = core::Tensor::Zeros({0, 0, 0}, core::UInt8, device);
+        occupancy.coarse_ = core::Tensor::Zeros({0, 0, 0}, core::UInt8, device);
+        occupancy.valid_ = true;
+        return;
+    }
+
+    const core::Device host("CPU:0");
+    const std::vector<index_t> key_min =
+            block_keys.Min({0}).To(host).ToFlatVector<index_t>();
+    const std::vector<index_t> key_max =
+            block_keys.Max({0}).To(host).ToFlatVector<index_t>();
+
+    // Pad by a quarter of the extent to absorb the growth of the map.
+    int64_t size[3];
+    for (int i = 0; i < 3; ++i) {
+        const int64_t extent = int64_t(key_max[i]) - key_min[i] + 1;
+        const int64_t margin = extent / 4 + 8;
+        occupancy.origin_[i] = static_cast<index_t>(key_min[i] - margin);
+        size[i] = extent + 2 * margin;
+    }
+
+    int64_t dims[3];
+    while (true) {
+        for (int i = 0; i < 3; ++i) {
+            dims[i] = ((size[i] - 1) >> occupancy.shift_) + 1;
+        }
+        if (dims[0] * dims[1] * dims[2] <= kMaxCells) break;
+        ++occupancy.shift_;
+    }
+
+    occupancy.fine_ = core::Tensor::Zeros({dims[2], dims[1], dims[0]},
+                                          core::UInt8, device);
+    occupancy.coarse_ = core::Tensor::Zeros(
+            {(dims[2] + 7) / 8, (dims[1] + 7) / 8, (dims[0] + 7) / 8},
+            core::UInt8, device);
+    MarkBlockOccupancy(block_keys, occupancy);
+    occupancy.valid_ = true;
+}
+
+void UpdateBlockOccupancy(const core::Tensor& block_keys,
+                          BlockOccupancy& occupancy) {
+    if (!occupancy.valid_ || block_keys.GetLength() == 0) {
+        return;
+    }
+
+    const core::Device host("CPU:0");
+    const std::vector<index_t> key_min =
+            block_keys.Min({0}).To(host).ToFlatVector<index_t>();
+    const std::vector<index_t> key_max =
+            block_keys.Max({0}).To(host).ToFlatVector<index_t>();
+    for (int i = 0; i < 3; ++i) {
+        // Dimensions are stored in (z, y, x) order.
+        const int64_t dim = occupancy.fine_.GetShape(2 - i);
+        if (key_min[i] < occupancy.origin_[i] ||
+            ((int64_t(key_max[i]) - occupancy.origin_[i]) >>
+             occupancy.shift_) >= dim) {
+            occupancy.valid_ = false;
+            return;
+        }
+    }
+    MarkBlockOccupancy(block_keys, occupancy);
+}
+
+#define DISPATCH_VALUE_DTYPE_TO_TEMPLATE(TSDF_DTYPE, WEIGHT_DTYPE,        \
+                                         COLOR_DTYPE, ...)                  \
     [&] {                                                                   \
-        if (WEIGHT_DTYPE == open3d::core::Float32 &&                        \
+        if (TSDF_DTYPE == open3d::core::Float32 &&                          \
+            WEIGHT_DTYPE == open3d::core::Float32 &&                        \
             COLOR_DTYPE == open3d::core::Float32) {                         \
+            using tsdf_t = float;                                           \
             using weight_t = float;                                         \
             using color_t = float;                                          \
             return __VA_ARGS__();                                           \
-        } else if (WEIGHT_DTYPE == open3d::core::UInt16 &&                  \
+        } else if (TSDF_DTYPE == open3d::core::Float32 &&                   \
+                   WEIGHT_DTYPE == open3d::core::UInt16 &&                  \
                    COLOR_DTYPE == open3d::core::UInt16) {                   \
+            using tsdf_t = float;                                           \
             using weight_t = uint16_t;                                      \
             using color_t = uint16_t;                                       \
             return __VA_ARGS__();                                           \
+        } else if (TSDF_DTYPE == open3d::core::Int16 &&                     \
+                   WEIGHT_DTYPE == open3d::core::UInt16 &&                  \
+                   COLOR_DTYPE == open3d::core::UInt8) {                    \
+            using tsdf_t = int16_t;                                         \
+            using weight_t = uint16_t;                                      \
+            using color_t = uint8_t;                                        \
+            return __VA_ARGS__();                                           \
+        } else if (TSDF_DTYPE == open3d::core::Int16 &&                     \
+                   WEIGHT_DTYPE == open3d::core::UInt8 &&                   \
+                   COLOR_DTYPE == open3d::core::UInt8) {                    \
+            using tsdf_t = int16_t;                                         \
+            using weight_t = uint8_t;                                       \
+            using color_t = uint8_t;                                        \
+            return __VA_ARGS__();                                           \
         } else {                                                            \
             utility::LogError(                                              \
                     "Unsupported value data type combination. Expected "    \
-                    "(float, float) or (uint16, uint16), but received ({} " \
-                    "{}).",                                                 \
-                    WEIGHT_DTYPE.ToString(), COLOR_DTYPE.ToString());       \
+                    "(float, float, float), (float, uint16, uint16), "      \
+                    "(int16, uint16, uint8) or (int16, uint8, uint8), but " \
+                    "received ({} {} {}).",                                 \
+                    TSDF_DTYPE.ToString(), WEIGHT_DTYPE.ToString(),         \
+                    COLOR_DTYPE.ToString());                                \
         }                                                                   \
     }()
 
@@ -141,6 +252,28 @@ void GetVoxelCoordinatesAndFlattenedIndices(const core::Tensor& buf_indices,
         }                                                                      \
     }()
 
+/// Value dtypes of the built-in TSDF attributes. Depth-only grids without a
+/// color attribute take the color dtype that completes a supported
+/// combination.
+static void GetValueDtypes(const TensorMap& block_value_map,
+                           core::Dtype& tsdf_dtype,
+                           core::Dtype& weight_dtype,
+                           core::Dtype& color_dtype) {
+    tsdf_dtype = core::Float32;
+    weight_dtype = core::Float32;
+    if (block_value_map.Contains("tsdf")) {
+        tsdf_dtype = block_value_map.at("tsdf").GetDtype();
+    }
+    if (block_value_map.Contains("weight")) {
+        weight_dtype = block_value_map.at("weight").GetDtype();
+    }
+    if (block_value_map.Contains("color")) {
+        color_dtype = block_value_map.at("color").GetDtype();
+    } else {
+        color_dtype = tsdf_dtype == core::Int16 ? core::UInt8 : weight_dtype;
+    }
+}
+
 void Integrate(const core::Tensor& depth,
                const core::Tensor& color,
                const core::Tensor& block_indices,
@@ -154,15 +287,9 @@ void Integrate(const core::Tensor& depth,
                float sdf_trunc,
                float depth_scale,
                float depth_max) {
-    using tsdf_t = float;
-    core::Dtype block_weight_dtype = core::Dtype::Float32;
-    core::Dtype block_color_dtype = core::Dtype::Float32;
-    if (block_value_map.Contains("weight")) {
-        block_weight_dtype = block_value_map.at("weight").GetDtype();
-    }
-    if (block_value_map.Contains("color")) {
-        block_color_dtype = block_value_map.at("color").GetDtype();
-    }
+    core::Dtype block_tsdf_dtype, block_weight_dtype, block_color_dtype;
+    GetValueDtypes(block_value_map, block_tsdf_dtype, block_weight_dtype,
+                   block_color_dtype);
 
     core::Dtype input_depth_dtype = depth.GetDtype();
     core::Dtype input_color_dtype = (input_depth_dtype == core::Dtype::Float32)
@@ -176,7 +303,8 @@ void Integrate(const core::Tensor& depth,
         DISPATCH_INPUT_DTYPE_TO_TEMPLATE(
                 input_depth_dtype, input_color_dtype, [&] {
                     DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                            block_weight_dtype, block_color_dtype, [&] {
+                            block_tsdf_dtype, block_weight_dtype,
+                            block_color_dtype, [&] {
                                 IntegrateCPU<input_depth_t, input_color_t,
                                              tsdf_t, weight_t, color_t>(
                                         depth, color, block_indices, block_keys,
@@ -191,7 +319,8 @@ void Integrate(const core::Tensor& depth,
         DISPATCH_INPUT_DTYPE_TO_TEMPLATE(
                 input_depth_dtype, input_color_dtype, [&] {
                     DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                            block_weight_dtype, block_color_dtype, [&] {
+                            block_tsdf_dtype, block_weight_dtype,
+                            block_color_dtype, [&] {
                                 IntegrateCUDA<input_depth_t, input_color_t,
                                               tsdf_t, weight_t, color_t>(
                                         depth, color, block_indices, block_keys,
@@ -242,6 +371,7 @@ void EstimateRange(const core::Tensor& block_keys,
 }
 
 void RayCast(std::shared_ptr<core::HashMap>& hashmap,
+             const BlockOccupancy& block_occupancy,
              const TensorMap& block_value_map,
              const core::Tensor& range_map,
              TensorMap& renderings_map,
@@ -257,37 +387,31 @@ void RayCast(std::shared_ptr<core::HashMap>& hashmap,
              float weight_threshold,
              float trunc_voxel_multiplier,
              int range_map_down_factor) {
-    using tsdf_t = float;
-    core::Dtype block_weight_dtype = core::Dtype::Float32;
-    core::Dtype block_color_dtype = core::Dtype::Float32;
-    if (block_value_map.Contains("weight")) {
-        block_weight_dtype = block_value_map.at("weight").GetDtype();
-    }
-    if (block_value_map.Contains("color")) {
-        block_color_dtype = block_value_map.at("color").GetDtype();
-    }
+    core::Dtype block_tsdf_dtype, block_weight_dtype, block_color_dtype;
+    GetValueDtypes(block_value_map, block_tsdf_dtype, block_weight_dtype,
+                   block_color_dtype);
 
     if (hashmap->IsCPU()) {
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
                     RayCastCPU<tsdf_t, weight_t, color_t>(
-                            hashmap, block_value_map, range_map, renderings_map,
-                            intrinsic, extrinsic, h, w, block_resolution,
-                            voxel_size, depth_scale, depth_min, depth_max,
-                            weight_threshold, trunc_voxel_multiplier,
-                            range_map_down_factor);
+                            hashmap, block_occupancy, block_value_map,
+                            range_map, renderings_map, intrinsic, extrinsic, h,
+                            w, block_resolution, voxel_size, depth_scale,
+                            depth_min, depth_max, weight_threshold,
+                            trunc_voxel_multiplier, range_map_down_factor);
                 });
 
     } else if (hashmap->IsCUDA()) {
 #ifdef BUILD_CUDA_MODULE
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
                     RayCastCUDA<tsdf_t, weight_t, color_t>(
-                            hashmap, block_value_map, range_map, renderings_map,
-                            intrinsic, extrinsic, h, w, block_resolution,
-                            voxel_size, depth_scale, depth_min, depth_max,
-                            weight_threshold, trunc_voxel_multiplier,
-                            range_map_down_factor);
+                            hashmap, block_occupancy, block_value_map,
+                            range_map, renderings_map, intrinsic, extrinsic, h,
+                            w, block_resolution, voxel_size, depth_scale,
+                            depth_min, depth_max, weight_threshold,
+                            trunc_voxel_multiplier, range_map_down_factor);
                 });
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
@@ -309,19 +433,13 @@ void ExtractPointCloud(const core::Tensor& block_indices,
                        float voxel_size,
                        float weight_threshold,
                        int& valid_size) {
-    using tsdf_t = float;
-    core::Dtype block_weight_dtype = core::Dtype::Float32;
-    core::Dtype block_color_dtype = core::Dtype::Float32;
-    if (block_value_map.Contains("weight")) {
-        block_weight_dtype = block_value_map.at("weight").GetDtype();
-    }
-    if (block_value_map.Contains("color")) {
-        block_color_dtype = block_value_map.at("color").GetDtype();
-    }
+    core::Dtype block_tsdf_dtype, block_weight_dtype, block_color_dtype;
+    GetValueDtypes(block_value_map, block_tsdf_dtype, block_weight_dtype,
+                   block_color_dtype);
 
     if (block_indices.IsCPU()) {
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
                     ExtractPointCloudCPU<tsdf_t, weight_t, color_t>(
                             block_indices, nb_block_indices, nb_block_masks,
                             block_keys, block_value_map, points, normals,
@@ -332,7 +450,7 @@ void ExtractPointCloud(const core::Tensor& block_indices,
     } else if (block_indices.IsCUDA()) {
 #ifdef BUILD_CUDA_MODULE
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
                     ExtractPointCloudCUDA<tsdf_t, weight_t, color_t>(
                             block_indices, nb_block_indices, nb_block_masks,
                             block_keys, block_value_map, points, normals,
@@ -355,42 +473,37 @@ void ExtractTriangleMesh(const core::Tensor& block_indices,
                          const TensorMap& block_value_map,
                          core::Tensor& vertices,
                          core::Tensor& triangles,
+                         core::Tensor& triangle_block_indices,
                          core::Tensor& vertex_normals,
                          core::Tensor& vertex_colors,
                          index_t block_resolution,
                          float voxel_size,
                          float weight_threshold,
                          int& vertex_count) {
-    using tsdf_t = float;
-    core::Dtype block_weight_dtype = core::Dtype::Float32;
-    core::Dtype block_color_dtype = core::Dtype::Float32;
-    if (block_value_map.Contains("weight")) {
-        block_weight_dtype = block_value_map.at("weight").GetDtype();
-    }
-    if (block_value_map.Contains("color")) {
-        block_color_dtype = block_value_map.at("color").GetDtype();
-    }
+    core::Dtype block_tsdf_dtype, block_weight_dtype, block_color_dtype;
+    GetValueDtypes(block_value_map, block_tsdf_dtype, block_weight_dtype,
+                   block_color_dtype);
 
     if (block_indices.IsCPU()) {
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
                     ExtractTriangleMeshCPU<tsdf_t, weight_t, color_t>(
                             block_indices, inv_block_indices, nb_block_indices,
                             nb_block_masks, block_keys, block_value_map,
-                            vertices, triangles, vertex_normals, vertex_colors,
-                            block_resolution, voxel_size, weight_threshold,
-                            vertex_count);
+                            vertices, triangles, triangle_block_indices,
+                            vertex_normals, vertex_colors, block_resolution,
+                            voxel_size, weight_threshold, vertex_count);
                 });
     } else if (block_indices.IsCUDA()) {
 #ifdef BUILD_CUDA_MODULE
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
                     ExtractTriangleMeshCUDA<tsdf_t, weight_t, color_t>(
                             block_indices, inv_block_indices, nb_block_indices,
                             nb_block_masks, block_keys, block_value_map,
-                            vertices, triangles, vertex_normals, vertex_colors,
-                            block_resolution, voxel_size, weight_threshold,
-                            vertex_count);
+                            vertices, triangles, triangle_block_indices,
+                            vertex_normals, vertex_colors, block_resolution,
+                            voxel_size, weight_threshold, vertex_count);
                 });
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
@@ -40,6 +40,27 @@ namespace voxel_grid {
 
 using index_t = int;
 
+/// Conservative dense occupancy of the allocated blocks, used by RayCast to
+/// leap over empty cells without probing the hash map. A cell of fine_ covers
+/// (1 << shift_)^3 blocks starting from the block origin_, and a cell of
+/// coarse_ covers 8^3 cells of fine_. A zero cell guarantees that none of its
+/// blocks is allocated, while a non-zero cell may still cover unallocated
+/// blocks, e.g. after blocks are removed from the hash map.
+struct BlockOccupancy {
+    /// (Dz, Dy, Dx) UInt8 occupancy.
+    core::Tensor fine_;
+    /// (ceil(Dz / 8), ceil(Dy / 8), ceil(Dx / 8)) UInt8 occupancy.
+    core::Tensor coarse_;
+    index_t origin_[3] = {0, 0, 0};
+    index_t shift_ = 0;
+    /// False if blocks may have been allocated without being marked.
+    bool valid_ = false;
+    /// Size of the block hash map when the occupancy was last synchronized
+    /// with it. A different size means blocks were inserted or erased through
+    /// the hash map directly.
+    int64_t num_blocks_ = -1;
+};
+
 void PointCloudTouch(std::shared_ptr<core::HashMap>& hashmap,
                      const core::Tensor& points,
                      core::Tensor& voxel_block_coords,
@@ -66,6 +87,16 @@ void GetVoxelCoordinatesAndFlattenedIndices(const core::Tensor& buf_indices,
                                             index_t block_resolution,
                                             float voxel_size);
 
+/// Rebuild the occupancy from the (N, 3) Int32 keys of all the allocated
+/// blocks. The bounds are padded so that later updates rarely fall outside.
+void BuildBlockOccupancy(const core::Tensor& block_keys,
+                         BlockOccupancy& occupancy);
+
+/// Mark newly allocated (N, 3) Int32 block keys in a valid occupancy, or
+/// invalidate it if some keys fall outside its bounds.
+void UpdateBlockOccupancy(const core::Tensor& block_keys,
+                          BlockOccupancy& occupancy);
+
 void Integrate(const core::Tensor& depth,
                const core::Tensor& color,
                const core::Tensor& block_indices,
@@ -93,6 +124,7 @@ void EstimateRange(const core::Tensor& block_keys,
                    float depth_max);
 
 void RayCast(std::shared_ptr<core::HashMap>& hashmap,
+             const BlockOccupancy& block_occupancy,
              const TensorMap& block_value_map,
              const core::Tensor& range_map,
              TensorMap& renderings_map,
@@ -130,6 +162,7 @@ void ExtractTriangleMesh(const core::Tensor& block_indices,
                          const TensorMap& block_value_map,
                          core::Tensor& vertices,
                          core::Tensor& triangles,
+                         core::Tensor& triangle_block_indices,
                          core::Tensor& vertex_normals,
                          core::Tensor& vertex_colors,
                          index_t block_resolution,
@@ -164,6 +197,14 @@ void GetVoxelCoordinatesAndFlattenedIndicesCPU(const core::Tensor& buf_indices,
                                                index_t block_resolution,
                                                float voxel_size);
 
+void MarkBlockOccupancyCPU(const core::Tensor& block_keys,
+                           core::Tensor& fine,
+                           core::Tensor& coarse,
+                           index_t origin_x,
+                           index_t origin_y,
+                           index_t origin_z,
+                           index_t shift);
+
 template <typename input_depth_t,
           typename input_color_t,
           typename tsdf_t,
@@ -197,6 +238,7 @@ void EstimateRangeCPU(const core::Tensor& block_keys,
 
 template <typename tsdf_t, typename weight_t, typename color_t>
 void RayCastCPU(std::shared_ptr<core::HashMap>& hashmap,
+                const BlockOccupancy& block_occupancy,
                 const TensorMap& block_value_map,
                 const core::Tensor& range_map,
                 TensorMap& renderings_map,
@@ -236,6 +278,7 @@ void ExtractTriangleMeshCPU(const core::Tensor& block_indices,
                             const TensorMap& block_value_map,
                             core::Tensor& vertices,
                             core::Tensor& triangles,
+                            core::Tensor& triangle_block_indices,
                             core::Tensor& vertex_normals,
                             core::Tensor& vertex_colors,
                             index_t block_resolution,
@@ -270,6 +313,14 @@ void GetVoxelCoordinatesAndFlattenedIndicesCUDA(const core::Tensor& buf_indices,
                                                 index_t block_resolution,
                                                 float voxel_size);
 
+void MarkBlockOccupancyCUDA(const core::Tensor& block_keys,
+                            core::Tensor& fine,
+                            core::Tensor& coarse,
+                            index_t origin_x,
+                            index_t origin_y,
+                            index_t origin_z,
+                            index_t shift);
+
 template <typename input_depth_t,
           typename input_color_t,
           typename tsdf_t,
@@ -303,6 +354,7 @@ void EstimateRangeCUDA(const core::Tensor& block_keys,
 
 template <typename tsdf_t, typename weight_t, typename color_t>
 void RayCastCUDA(std::shared_ptr<core::HashMap>& hashmap,
+                 const BlockOccupancy& block_occupancy,
                  const TensorMap& block_value_map,
                  const core::Tensor& range_map,
                  TensorMap& renderings_map,
@@ -342,6 +394,7 @@ void ExtractTriangleMeshCUDA(const core::Tensor& block_indices,
                              const TensorMap& block_value_map,
                              core::Tensor& vertices,
                              core::Tensor& triangles,
+                             core::Tensor& triangle_block_indices,
                              core::Tensor& vertex_normals,
                              core::Tensor& vertex_colors,
                              index_t block_resolution,
@@ -261,12 +261,22 @@ template void IntegrateCUDA<uint16_t, uint8_t, float, float, float>(
 template void IntegrateCUDA<float, float, float, uint16_t, uint16_t>(
         FN_ARGUMENTS);
 template void IntegrateCUDA<float, float, float, float, float>(FN_ARGUMENTS);
+template void IntegrateCUDA<uint16_t, uint8_t, int16_t, uint16_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateCUDA<uint16_t, uint8_t, int16_t, uint8_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateCUDA<float, float, int16_t, uint16_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateCUDA<float, float, int16_t, uint8_t, uint8_t>(
+        FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
 #define FN_ARGUMENTS                                                           \
-    std::shared_ptr<core::HashMap> &hashmap, const TensorMap &block_value_map, \
-            const core::Tensor &range_map, TensorMap &renderings_map,          \
+    std::shared_ptr<core::HashMap> &hashmap,                                   \
+            const BlockOccupancy &block_occupancy,                             \
+            const TensorMap &block_value_map, const core::Tensor &range_map,   \
+            TensorMap &renderings_map,                                         \
             const core::Tensor &intrinsic, const core::Tensor &extrinsic,      \
             index_t h, index_t w, index_t block_resolution, float voxel_size,  \
             float depth_scale, float depth_min, float depth_max,               \
@@ -275,6 +285,8 @@ template void IntegrateCUDA<float, float, float, float, float>(FN_ARGUMENTS);
 
 template void RayCastCUDA<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void RayCastCUDA<float, float, float>(FN_ARGUMENTS);
+template void RayCastCUDA<int16_t, uint16_t, uint8_t>(FN_ARGUMENTS);
+template void RayCastCUDA<int16_t, uint8_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -288,6 +300,8 @@ template void RayCastCUDA<float, float, float>(FN_ARGUMENTS);
 
 template void ExtractPointCloudCUDA<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractPointCloudCUDA<float, float, float>(FN_ARGUMENTS);
+template void ExtractPointCloudCUDA<int16_t, uint16_t, uint8_t>(FN_ARGUMENTS);
+template void ExtractPointCloudCUDA<int16_t, uint8_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -312,12 +326,15 @@ void ExtractTriangleMeshCUDA(const core::Tensor &block_indices,
             const core::Tensor &nb_block_masks,                               \
             const core::Tensor &block_keys, const TensorMap &block_value_map, \
             core::Tensor &vertices, core::Tensor &triangles,                  \
+            core::Tensor &triangle_block_indices,                             \
             core::Tensor &vertex_normals, core::Tensor &vertex_colors,        \
             index_t block_resolution, float voxel_size,                       \
             float weight_threshold, index_t &vertex_count
 
 template void ExtractTriangleMeshCUDA<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractTriangleMeshCUDA<float, float, float>(FN_ARGUMENTS);
+template void ExtractTriangleMeshCUDA<int16_t, uint16_t, uint8_t>(FN_ARGUMENTS);
+template void ExtractTriangleMeshCUDA<int16_t, uint8_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -98,6 +98,42 @@ void GetVoxelCoordinatesAndFlattenedIndicesCPU
     });
 }
 
+#if defined(__CUDACC__)
+void MarkBlockOccupancyCUDA
+#else
+void MarkBlockOccupancyCPU
+#endif
+        (const core::Tensor& block_keys,
+         core::Tensor& fine,
+         core::Tensor& coarse,
+         index_t origin_x,
+         index_t origin_y,
+         index_t origin_z,
+         index_t shift) {
+    core::Device device = block_keys.GetDevice();
+
+    const index_t* block_key_ptr = block_keys.GetDataPtr<index_t>();
+    uint8_t* fine_ptr = fine.GetDataPtr<uint8_t>();
+    uint8_t* coarse_ptr = coarse.GetDataPtr<uint8_t>();
+
+    index_t fine_dy = fine.GetShape(1);
+    index_t fine_dx = fine.GetShape(2);
+    index_t coarse_dy = coarse.GetShape(1);
+    index_t coarse_dx = coarse.GetShape(2);
+
+    index_t n = block_keys.GetLength();
+    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t workload_idx) {
+        index_t x = (block_key_ptr[3 * workload_idx + 0] - origin_x) >> shift;
+        index_t y = (block_key_ptr[3 * workload_idx + 1] - origin_y) >> shift;
+        index_t z = (block_key_ptr[3 * workload_idx + 2] - origin_z) >> shift;
+
+        // Concurrent writes store the same value.
+        fine_ptr[(z * fine_dy + y) * fine_dx + x] = 1;
+        coarse_ptr[((z >> 3) * coarse_dy + (y >> 3)) * coarse_dx + (x >> 3)] =
+                1;
+    });
+}
+
 inline OPEN3D_DEVICE index_t
 DeviceGetLinearIdx(index_t xo,
                    index_t yo,
@@ -127,6 +163,59 @@ DeviceGetLinearIdx(index_t xo,
            xn;
 }
 
+/// Quantized voxel values.
+/// Int16 TSDF codes map the normalized TSDF in [-1, 1] linearly to
+/// [-32767, 32767]. Integer weights saturate at the maximum of their type, so
+/// that integration turns into a moving average instead of overflowing. UInt8
+/// colors are rounded and clamped to [0, 255], while the other types keep
+/// their direct conversion.
+template <typename tsdf_t>
+inline OPEN3D_DEVICE float DecodeTSDF(tsdf_t tsdf) {
+    return tsdf;
+}
+
+template <>
+inline OPEN3D_DEVICE float DecodeTSDF<int16_t>(int16_t tsdf) {
+    return tsdf * (1.0f / 32767.0f);
+}
+
+template <typename tsdf_t>
+inline OPEN3D_DEVICE tsdf_t EncodeTSDF(float tsdf) {
+    return tsdf;
+}
+
+template <>
+inline OPEN3D_DEVICE int16_t EncodeTSDF<int16_t>(float tsdf) {
+    tsdf = tsdf < -1.0f ? -1.0f : (tsdf > 1.0f ? 1.0f : tsdf);
+    return static_cast<int16_t>(roundf(tsdf * 32767.0f));
+}
+
+template <typename weight_t>
+inline OPEN3D_DEVICE weight_t EncodeWeight(float weight) {
+    return weight;
+}
+
+template <>
+inline OPEN3D_DEVICE uint16_t EncodeWeight<uint16_t>(float weight) {
+    return static_cast<uint16_t>(weight < 65535.0f ? weight : 65535.0f);
+}
+
+template <>
+inline OPEN3D_DEVICE uint8_t EncodeWeight<uint8_t>(float weight) {
+    return static_cast<uint8_t>(weight < 255.0f ? weight : 255.0f);
+}
+
+template <typename color_t>
+inline OPEN3D_DEVICE color_t EncodeColor(float color) {
+    return static_cast<color_t>(color);
+}
+
+template <>
+inline OPEN3D_DEVICE uint8_t EncodeColor<uint8_t>(float color) {
+    color = color < 0.0f ? 0.0f : (color > 255.0f ? 255.0f : color);
+    return static_cast<uint8_t>(color + 0.5f);
+}
+
 template <typename tsdf_t>
 inline OPEN3D_DEVICE void DeviceGetNormal(
         const tsdf_t* tsdf_base_ptr,
@@ -150,9 +239,15 @@ inline OPEN3D_DEVICE void DeviceGetNormal(
     index_t vyn = GetLinearIdx(xo, yo - 1, zo);
     index_t vzp = GetLinearIdx(xo, yo, zo + 1);
     index_t vzn = GetLinearIdx(xo, yo, zo - 1);
-    if (vxp >= 0 && vxn >= 0) n[0] = tsdf_base_ptr[vxp] - tsdf_base_ptr[vxn];
-    if (vyp >= 0 && vyn >= 0) n[1] = tsdf_base_ptr[vyp] - tsdf_base_ptr[vyn];
-    if (vzp >= 0 && vzn >= 0) n[2] = tsdf_base_ptr[vzp] - tsdf_base_ptr[vzn];
+    if (vxp >= 0 && vxn >= 0) {
+        n[0] = DecodeTSDF(tsdf_base_ptr[vxp]) - DecodeTSDF(tsdf_base_ptr[vxn]);
+    }
+    if (vyp >= 0 && vyn >= 0) {
+        n[1] = DecodeTSDF(tsdf_base_ptr[vyp]) - DecodeTSDF(tsdf_base_ptr[vyn]);
+    }
+    if (vzp >= 0 && vzn >= 0) {
+        n[2] = DecodeTSDF(tsdf_base_ptr[vzp]) - DecodeTSDF(tsdf_base_ptr[vzn]);
+    }
 };
 
 template <typename input_depth_t,
@@ -265,7 +360,9 @@ void IntegrateCPU
                 *depth_indexer.GetDataPtr<input_depth_t>(ui, vi) / depth_scale;
 
         float sdf = depth - zc;
-        if (depth <= 0 || depth > depth_max || zc <= 0 || sdf < -sdf_trunc) {
+        // Negated comparison also rejects NaN depth from preprocessed frames.
+        if (!(depth > 0) || depth > depth_max || zc <= 0 ||
+            sdf < -sdf_trunc) {
             return;
         }
         sdf = sdf < sdf_trunc ? sdf : sdf_trunc;
@@ -278,7 +375,8 @@ void IntegrateCPU
 
         float inv_wsum = 1.0f / (*weight_ptr + 1);
         float weight = *weight_ptr;
-        *tsdf_ptr = (weight * (*tsdf_ptr) + sdf) * inv_wsum;
+        *tsdf_ptr = EncodeTSDF<tsdf_t>((weight * DecodeTSDF(*tsdf_ptr) + sdf) *
+                                       inv_wsum);
 
         if (integrate_color) {
             color_t* color_ptr = color_base_ptr + 3 * linear_idx;
@@ -298,13 +396,14 @@ void IntegrateCPU
                         color_indexer.GetDataPtr<input_color_t>(ui, vi);
 
                 for (index_t i = 0; i < 3; ++i) {
-                    color_ptr[i] = (weight * color_ptr[i] +
-                                    input_color_ptr[i] * color_multiplier) *
-                                   inv_wsum;
+                    color_ptr[i] = EncodeColor<color_t>(
+                            (weight * color_ptr[i] +
+                             input_color_ptr[i] * color_multiplier) *
+                            inv_wsum);
                 }
             }
         }
-        *weight_ptr = weight + 1;
+        *weight_ptr = EncodeWeight<weight_t>(weight + 1);
     });
 
 #if defined(__CUDACC__)
@@ -502,24 +601,42 @@ void EstimateRangeCPU
 #endif
 }
 
-struct MiniVecCache {
-    index_t x;
-    index_t y;
-    index_t z;
-    index_t block_idx;
-
-    inline index_t OPEN3D_DEVICE Check(index_t xin, index_t yin, index_t zin) {
-        return (xin == x && yin == y && zin == z) ? block_idx : -1;
+/// Small cache of the block lookups along a ray, including the blocks that
+/// are not allocated, to avoid repeated hash map probes. Entries are replaced
+/// in round-robin order.
+struct BlockLookupCache {
+    static constexpr int kSize = 4;
+
+    index_t keys[kSize][3];
+    index_t block_indices[kSize];
+    int size = 0;
+    int next = 0;
+
+    /// Returns true if the block is cached, with its buffer index in block_idx
+    /// or -1 if it is not allocated.
+    inline bool OPEN3D_DEVICE Find(index_t x,
+                                   index_t y,
+                                   index_t z,
+                                   index_t& block_idx) const {
+        for (int i = 0; i < size; ++i) {
+            if (keys[i][0] == x && keys[i][1] == y && keys[i][2] == z) {
+                block_idx = block_indices[i];
+                return true;
+            }
+        }
+        return false;
     }
 
-    inline void OPEN3D_DEVICE Update(index_t xin,
-                                     index_t yin,
-                                     index_t zin,
-                                     index_t block_idx_in) {
-        x = xin;
-        y = yin;
-        z = zin;
-        block_idx = block_idx_in;
+    inline void OPEN3D_DEVICE Insert(index_t x,
+                                     index_t y,
+                                     index_t z,
+                                     index_t block_idx) {
+        keys[next][0] = x;
+        keys[next][1] = y;
+        keys[next][2] = z;
+        block_indices[next] = block_idx;
+        next = (next + 1) % kSize;
+        if (size < kSize) ++size;
     }
 };
 
@@ -530,6 +647,7 @@ void RayCastCUDA
 void RayCastCPU
 #endif
         (std::shared_ptr<core::HashMap>& hashmap,
+         const BlockOccupancy& block_occupancy,
          const TensorMap& block_value_map,
          const core::Tensor& range,
          TensorMap& renderings_map,
@@ -654,6 +772,32 @@ void RayCastCPU
                            interp_ratio_dy_indexer.GetDataPtr() ||
                            interp_ratio_dz_indexer.GetDataPtr();
 
+    // Empty space skipping
+    const uint8_t* occupancy_fine_ptr = nullptr;
+    const uint8_t* occupancy_coarse_ptr = nullptr;
+    index_t occupancy_fine_dx = 0, occupancy_fine_dy = 0,
+            occupancy_fine_dz = 0;
+    index_t occupancy_coarse_dx = 0, occupancy_coarse_dy = 0;
+    index_t occupancy_origin_x = 0, occupancy_origin_y = 0,
+            occupancy_origin_z = 0;
+    index_t occupancy_shift = 0;
+    if (block_occupancy.valid_ && block_occupancy.fine_.NumElements() > 0) {
+        occupancy_fine_ptr = block_occupancy.fine_.GetDataPtr<uint8_t>();
+        occupancy_coarse_ptr = block_occupancy.coarse_.GetDataPtr<uint8_t>();
+        occupancy_fine_dz = block_occupancy.fine_.GetShape(0);
+        occupancy_fine_dy = block_occupancy.fine_.GetShape(1);
+        occupancy_fine_dx = block_occupancy.fine_.GetShape(2);
+        occupancy_coarse_dy = block_occupancy.coarse_.GetShape(1);
+        occupancy_coarse_dx = block_occupancy.coarse_.GetShape(2);
+        occupancy_origin_x = block_occupancy.origin_[0];
+        occupancy_origin_y = block_occupancy.origin_[1];
+        occupancy_origin_z = block_occupancy.origin_[2];
+        occupancy_shift = block_occupancy.shift_;
+    }
+    // An empty occupancy means that no block is allocated.
+    const bool occupancy_empty = block_occupancy.valid_ &&
+                                 block_occupancy.fine_.NumElements() == 0;
+
     TransformIndexer c2w_transform_indexer(
             intrinsic, t::geometry::InverseTransformation(extrinsics));
     TransformIndexer w2c_transform_indexer(intrinsic, extrinsics);
@@ -668,15 +812,61 @@ void RayCastCPU
 
 #ifndef __CUDACC__
     using std::max;
+    using std::min;
     using std::sqrt;
 #endif
 
     core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t workload_idx) {
+        // False only if the block is known to be unallocated.
+        auto MayBeAllocated = [&] OPEN3D_DEVICE(index_t x_b, index_t y_b,
+                                                index_t z_b) -> bool {
+            if (occupancy_fine_ptr == nullptr) return !occupancy_empty;
+
+            index_t x = x_b - occupancy_origin_x;
+            index_t y = y_b - occupancy_origin_y;
+            index_t z = z_b - occupancy_origin_z;
+            if (x < 0 || y < 0 || z < 0) return false;
+
+            x >>= occupancy_shift;
+            y >>= occupancy_shift;
+            z >>= occupancy_shift;
+            if (x >= occupancy_fine_dx || y >= occupancy_fine_dy ||
+                z >= occupancy_fine_dz) {
+                return false;
+            }
+            index_t coarse_idx =
+                    ((z >> 3) * occupancy_coarse_dy + (y >> 3)) *
+                            occupancy_coarse_dx +
+                    (x >> 3);
+            if (occupancy_coarse_ptr[coarse_idx] == 0) return false;
+
+            index_t fine_idx =
+                    (z * occupancy_fine_dy + y) * occupancy_fine_dx + x;
+            return occupancy_fine_ptr[fine_idx] != 0;
+        };
+
+        auto FindBlock = [&] OPEN3D_DEVICE(index_t x_b, index_t y_b,
+                                           index_t z_b,
+                                           BlockLookupCache& cache) -> index_t {
+            index_t block_buf_idx;
+            if (cache.Find(x_b, y_b, z_b, block_buf_idx)) {
+                return block_buf_idx;
+            }
+            if (!MayBeAllocated(x_b, y_b, z_b)) return -1;
+
+            auto iter = hashmap_impl.find(Key(x_b, y_b, z_b));
+            block_buf_idx = iter == hashmap_impl.end()
+                                    ? -1
+                                    : static_cast<index_t>(iter->second);
+            cache.Insert(x_b, y_b, z_b, block_buf_idx);
+            return block_buf_idx;
+        };
+
         auto GetLinearIdxAtP = [&] OPEN3D_DEVICE(
                                        index_t x_b, index_t y_b, index_t z_b,
                                        index_t x_v, index_t y_v, index_t z_v,
                                        core::buf_index_t block_buf_idx,
-                                       MiniVecCache & cache) -> index_t {
+                                       BlockLookupCache & cache) -> index_t {
             index_t x_vn = (x_v + block_resolution) % block_resolution;
             index_t y_vn = (y_v + block_resolution) % block_resolution;
             index_t z_vn = (z_v + block_resolution) % block_resolution;
@@ -689,15 +879,9 @@ void RayCastCPU
                 return block_buf_idx * resolution3 + z_v * resolution2 +
                        y_v * block_resolution + x_v;
             } else {
-                Key key(x_b + dx_b, y_b + dy_b, z_b + dz_b);
-
-                index_t block_buf_idx = cache.Check(key[0], key[1], key[2]);
-                if (block_buf_idx < 0) {
-                    auto iter = hashmap_impl.find(key);
-                    if (iter == hashmap_impl.end()) return -1;
-                    block_buf_idx = iter->second;
-                    cache.Update(key[0], key[1], key[2], block_buf_idx);
-                }
+                index_t block_buf_idx =
+                        FindBlock(x_b + dx_b, y_b + dy_b, z_b + dz_b, cache);
+                if (block_buf_idx < 0) return -1;
 
                 return block_buf_idx * resolution3 + z_vn * resolution2 +
                        y_vn * block_resolution + x_vn;
@@ -707,7 +891,7 @@ void RayCastCPU
         auto GetLinearIdxAtT = [&] OPEN3D_DEVICE(
                                        float x_o, float y_o, float z_o,
                                        float x_d, float y_d, float z_d, float t,
-                                       MiniVecCache& cache) -> index_t {
+                                       BlockLookupCache& cache) -> index_t {
             float x_g = x_o + t * x_d;
             float y_g = y_o + t * y_d;
             float z_g = z_o + t * z_d;
@@ -717,14 +901,8 @@ void RayCastCPU
             index_t y_b = static_cast<index_t>(floorf(y_g / block_size));
             index_t z_b = static_cast<index_t>(floorf(z_g / block_size));
 
-            Key key(x_b, y_b, z_b);
-            index_t block_buf_idx = cache.Check(x_b, y_b, z_b);
-            if (block_buf_idx < 0) {
-                auto iter = hashmap_impl.find(key);
-                if (iter == hashmap_impl.end()) return -1;
-                block_buf_idx = iter->second;
-                cache.Update(x_b, y_b, z_b, block_buf_idx);
-            }
+            index_t block_buf_idx = FindBlock(x_b, y_b, z_b, cache);
+            if (block_buf_idx < 0) return -1;
 
             // Voxel coordinate and look up
             index_t x_v = index_t((x_g - x_b * block_size) / voxel_size);
@@ -735,6 +913,78 @@ void RayCastCPU
                    y_v * block_resolution + x_v;
         };
 
+        // Returns true if the block at t is in a cell of the occupancy grid
+        // that is known to be empty, and the t at which the ray leaves that
+        // cell, at most t_end. Coarse cells are tried first, as they allow the
+        // largest leaps.
+        auto GetEmptyCellExitT = [&] OPEN3D_DEVICE(
+                                         float x_o, float y_o, float z_o,
+                                         float x_d, float y_d, float z_d,
+                                         float t, float t_end,
+                                         float& t_exit) -> bool {
+            if (occupancy_fine_ptr == nullptr) return false;
+
+            index_t x_b = static_cast<index_t>(
+                    floorf((x_o + t * x_d) / block_size));
+            index_t y_b = static_cast<index_t>(
+                    floorf((y_o + t * y_d) / block_size));
+            index_t z_b = static_cast<index_t>(
+                    floorf((z_o + t * z_d) / block_size));
+            index_t x = x_b - occupancy_origin_x;
+            index_t y = y_b - occupancy_origin_y;
+            index_t z = z_b - occupancy_origin_z;
+            if (x < 0 || y < 0 || z < 0) return false;
+
+            x >>= occupancy_shift;
+            y >>= occupancy_shift;
+            z >>= occupancy_shift;
+            if (x >= occupancy_fine_dx || y >= occupancy_fine_dy ||
+                z >= occupancy_fine_dz) {
+                return false;
+            }
+            index_t cell_shift;
+            if (occupancy_coarse_ptr[((z >> 3) * occupancy_coarse_dy +
+                                      (y >> 3)) *
+                                             occupancy_coarse_dx +
+                                     (x >> 3)] == 0) {
+                cell_shift = occupancy_shift + 3;
+                x >>= 3;
+                y >>= 3;
+                z >>= 3;
+            } else if (occupancy_fine_ptr[(z * occupancy_fine_dy + y) *
+                                                  occupancy_fine_dx +
+                                          x] == 0) {
+                cell_shift = occupancy_shift;
+            } else {
+                return false;
+            }
+
+            // Bounds of the cell in world coordinates.
+            const float cell_size =
+                    block_size * float(index_t(1) << cell_shift);
+            const float x_lo = (occupancy_origin_x + (x << cell_shift)) *
+                               block_size;
+            const float y_lo = (occupancy_origin_y + (y << cell_shift)) *
+                               block_size;
+            const float z_lo = (occupancy_origin_z + (z << cell_shift)) *
+                               block_size;
+
+            t_exit = t_end;
+            if (x_d != 0) {
+                t_exit = min(t_exit,
+                             ((x_d > 0 ? x_lo + cell_size : x_lo) - x_o) / x_d);
+            }
+            if (y_d != 0) {
+                t_exit = min(t_exit,
+                             ((y_d > 0 ? y_lo + cell_size : y_lo) - y_o) / y_d);
+            }
+            if (z_d != 0) {
+                t_exit = min(t_exit,
+                             ((z_d > 0 ? z_lo + cell_size : z_lo) - z_o) / z_d);
+            }
+            return true;
+        };
+
         index_t y = workload_idx / cols;
         index_t x = workload_idx % cols;
 
@@ -837,7 +1087,7 @@ void RayCastCPU
 
         float t = range[0];
         const float t_max = range[1];
-        if (t >= t_max) return;
+        if (t >= t_max || occupancy_empty) return;
 
         // Coordinates in camera and global
         float x_c = 0, y_c = 0, z_c = 0;
@@ -864,18 +1114,41 @@ void RayCastCPU
         float y_d = (y_g - y_o);
         float z_d = (z_g - z_o);
 
-        MiniVecCache cache{0, 0, 0, -1};
+        BlockLookupCache cache;
         bool surface_found = false;
+        // Unallocated blocks are stepped over one block at a time from the
+        // first empty sample t_run. Samples are always placed at t_run + k *
+        // block_size, so leaping over empty cells of the occupancy grid visits
+        // the same allocated blocks at the same t as stepping through them.
+        // The margin keeps samples that round into the next cell.
+        const float skip_margin = 0.01f * voxel_size;
+        float t_run = t;
+        index_t run_steps = -1;
         while (t < t_max) {
             index_t linear_idx =
                     GetLinearIdxAtT(x_o, y_o, z_o, x_d, y_d, z_d, t, cache);
 
             if (linear_idx < 0) {
-                t_prev = t;
-                t += block_size;
+                if (run_steps < 0) {
+                    t_run = t;
+                    run_steps = 0;
+                }
+                index_t next_steps = run_steps + 1;
+                float t_exit;
+                if (GetEmptyCellExitT(x_o, y_o, z_o, x_d, y_d, z_d, t, t_max,
+                                      t_exit)) {
+                    next_steps = max(next_steps,
+                                     static_cast<index_t>(ceilf(
+                                             (t_exit - skip_margin - t_run) /
+                                             block_size)));
+                }
+                run_steps = next_steps;
+                t_prev = t_run + float(run_steps - 1) * block_size;
+                t = t_run + float(run_steps) * block_size;
             } else {
+                run_steps = -1;
                 tsdf_prev = tsdf;
-                tsdf = tsdf_base_ptr[linear_idx];
+                tsdf = DecodeTSDF(tsdf_base_ptr[linear_idx]);
                 w = weight_base_ptr[linear_idx];
                 if (tsdf_prev > 0 && w >= weight_threshold && tsdf <= 0) {
                     surface_found = true;
@@ -915,15 +1188,8 @@ void RayCastCPU
             float y_v = (y_g - float(y_b) * block_size) / voxel_size;
             float z_v = (z_g - float(z_b) * block_size) / voxel_size;
 
-            Key key(x_b, y_b, z_b);
-
-            index_t block_buf_idx = cache.Check(x_b, y_b, z_b);
-            if (block_buf_idx < 0) {
-                auto iter = hashmap_impl.find(key);
-                if (iter == hashmap_impl.end()) return;
-                block_buf_idx = iter->second;
-                cache.Update(x_b, y_b, z_b, block_buf_idx);
-            }
+            index_t block_buf_idx = FindBlock(x_b, y_b, z_b, cache);
+            if (block_buf_idx < 0) return;
 
             index_t x_v_floor = static_cast<index_t>(floorf(x_v));
             index_t y_v_floor = static_cast<index_t>(floorf(y_v));
@@ -959,7 +1225,7 @@ void RayCastCPU
                         index_ptr[k] = linear_idx_k;
                     }
 
-                    float tsdf_k = tsdf_base_ptr[linear_idx_k];
+                    float tsdf_k = DecodeTSDF(tsdf_base_ptr[linear_idx_k]);
                     float interp_ratio_dx = ry * rz * (2 * dx_v - 1);
                     float interp_ratio_dy = rx * rz * (2 * dy_v - 1);
                     float interp_ratio_dz = rx * ry * (2 * dz_v - 1);
@@ -1111,7 +1377,7 @@ void ExtractPointCloudCPU
             voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
 
             index_t linear_idx = block_idx * resolution3 + voxel_idx;
-            float tsdf_o = tsdf_base_ptr[linear_idx];
+            float tsdf_o = DecodeTSDF(tsdf_base_ptr[linear_idx]);
             float weight_o = weight_base_ptr[linear_idx];
             if (weight_o <= weight_threshold) return;
 
@@ -1122,7 +1388,7 @@ void ExtractPointCloudCPU
                                      zv + (i == 2), workload_block_idx);
                 if (linear_idx_i < 0) continue;
 
-                float tsdf_i = tsdf_base_ptr[linear_idx_i];
+                float tsdf_i = DecodeTSDF(tsdf_base_ptr[linear_idx_i]);
                 float weight_i = weight_base_ptr[linear_idx_i];
                 if (weight_i > weight_threshold && tsdf_i * tsdf_o < 0) {
                     OPEN3D_ATOMIC_ADD(count_ptr, 1);
@@ -1192,7 +1458,7 @@ void ExtractPointCloudCPU
         voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
 
         index_t linear_idx = block_idx * resolution3 + voxel_idx;
-        float tsdf_o = tsdf_base_ptr[linear_idx];
+        float tsdf_o = DecodeTSDF(tsdf_base_ptr[linear_idx]);
         float weight_o = weight_base_ptr[linear_idx];
         if (weight_o <= weight_threshold) return;
 
@@ -1212,7 +1478,7 @@ void ExtractPointCloudCPU
                                  workload_block_idx);
             if (linear_idx_i < 0) continue;
 
-            float tsdf_i = tsdf_base_ptr[linear_idx_i];
+            float tsdf_i = DecodeTSDF(tsdf_base_ptr[linear_idx_i]);
             float weight_i = weight_base_ptr[linear_idx_i];
             if (weight_i > weight_threshold && tsdf_i * tsdf_o < 0) {
                 float ratio = (0 - tsdf_o) / (tsdf_i - tsdf_o);
@@ -1293,6 +1559,7 @@ void ExtractTriangleMeshCPU
          const TensorMap& block_value_map,
          core::Tensor& vertices,
          core::Tensor& triangles,
+         core::Tensor& triangle_block_indices,
          core::Tensor& vertex_normals,
          core::Tensor& vertex_colors,
          index_t block_resolution,
@@ -1380,7 +1647,7 @@ void ExtractTriangleMeshCPU
                                  zv + vtx_shifts[i][2], workload_block_idx);
             if (linear_idx_i < 0) return;
 
-            float tsdf_i = tsdf_base_ptr[linear_idx_i];
+            float tsdf_i = DecodeTSDF(tsdf_base_ptr[linear_idx_i]);
             float weight_i = weight_base_ptr[linear_idx_i];
             if (weight_i <= weight_threshold) return;
 
@@ -1544,7 +1811,7 @@ void ExtractTriangleMeshCPU
 
         // Obtain voxel ptr
         index_t linear_idx = resolution3 * block_idx + voxel_idx;
-        float tsdf_o = tsdf_base_ptr[linear_idx];
+        float tsdf_o = DecodeTSDF(tsdf_base_ptr[linear_idx]);
 
         float no[3] = {0}, ne[3] = {0};
 
@@ -1561,7 +1828,7 @@ void ExtractTriangleMeshCPU
                                  workload_block_idx);
             OPEN3D_ASSERT(linear_idx_e > 0 &&
                           "Internal error: GetVoxelAt returns nullptr.");
-            float tsdf_e = tsdf_base_ptr[linear_idx_e];
+            float tsdf_e = DecodeTSDF(tsdf_base_ptr[linear_idx_e]);
             float ratio = (0 - tsdf_o) / (tsdf_e - tsdf_o);
 
             index_t idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
@@ -1611,6 +1878,12 @@ void ExtractTriangleMeshCPU
     triangles = core::Tensor({triangle_count, 3}, core::Int32, device);
     ArrayIndexer triangle_indexer(triangles, 1);
 
+    // Workload block index of the cube that generates each triangle.
+    triangle_block_indices =
+            core::Tensor({triangle_count}, core::Int32, device);
+    index_t* triangle_block_indices_ptr =
+            triangle_block_indices.GetDataPtr<index_t>();
+
 #if defined(__CUDACC__)
     count = core::Tensor(std::vector<index_t>{0}, {}, core::Int32, device);
     count_ptr = count.GetDataPtr<index_t>();
@@ -1637,6 +1910,7 @@ void ExtractTriangleMeshCPU
             if (tri_table[table_idx][tri] == -1) return;
 
             index_t tri_idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
+            triangle_block_indices_ptr[tri_idx] = workload_block_idx;
 
             for (index_t vertex = 0; vertex < 3; ++vertex) {
                 index_t edge = tri_table[table_idx][tri + vertex];
@@ -1676,6 +1950,7 @@ void ExtractTriangleMeshCPU
 #endif
     utility::LogDebug("Total triangle count = {}", triangle_count);
     triangles = triangles.Slice(0, 0, triangle_count);
+    triangle_block_indices = triangle_block_indices.Slice(0, 0, triangle_count);
 }
 
 }  // namespace voxel_grid
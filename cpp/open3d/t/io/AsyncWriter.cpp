@@ -0,0 +1,171 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/AsyncWriter.h"
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+AsyncWriter::AsyncWriter(int num_threads, int64_t max_queue_size, bool copy)
+    : max_queue_size_(max_queue_size), copy_(copy) {
+    if (num_threads < 1) {
+        utility::LogError("num_threads must be positive, but got {}.",
+                          num_threads);
+    }
+    if (max_queue_size < 1) {
+        utility::LogError("max_queue_size must be positive, but got {}.",
+                          max_queue_size);
+    }
+    for (int i = 0; i < num_threads; ++i) {
+        workers_.emplace_back(&AsyncWriter::WorkerLoop, this);
+    }
+}
+
+AsyncWriter::~AsyncWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    // Workers drain the queue before they exit.
+    task_available_.notify_all();
+    for (std::thread &worker : workers_) {
+        worker.join();
+    }
+}
+
+void AsyncWriter::WritePointCloud(const std::string &filename,
+                                  const geometry::PointCloud &pointcloud,
+                                  const WritePointCloudOption &params,
+                                  Callback callback) {
+    geometry::PointCloud snapshot =
+            pointcloud.To(core::Device("CPU:0"), copy_);
+    Enqueue(
+            [filename, snapshot, params]() {
+                return io::WritePointCloud(filename, snapshot, params);
+            },
+            std::move(callback));
+}
+
+void AsyncWriter::WriteImage(const std::string &filename,
+                             const geometry::Image &image,
+                             int quality,
+                             Callback callback) {
+    geometry::Image snapshot = image.To(core::Device("CPU:0"), copy_);
+    Enqueue([filename, snapshot,
+             quality]() { return io::WriteImage(filename, snapshot, quality); },
+            std::move(callback));
+}
+
+void AsyncWriter::SaveVoxelBlockGrid(const std::string &filename,
+                                     const geometry::VoxelBlockGrid &voxel_grid,
+                                     bool compress,
+                                     Callback callback) {
+    // Host tensors of the snapshot never alias the hash map buffers.
+    std::unordered_map<std::string, core::Tensor> snapshot =
+            voxel_grid.Snapshot();
+    Enqueue(
+            [filename, snapshot, compress]() {
+                geometry::VoxelBlockGrid::SaveSnapshot(filename, snapshot,
+                                                       compress);
+                return true;
+            },
+            std::move(callback));
+}
+
+void AsyncWriter::Enqueue(std::function<bool()> task, Callback callback) {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        slot_available_.wait(lock, [this]() {
+            return static_cast<int64_t>(queue_.size()) < max_queue_size_;
+        });
+        queue_.push_back(Task{std::move(task), std::move(callback)});
+    }
+    task_available_.notify_one();
+}
+
+bool AsyncWriter::Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() { return queue_.empty() && num_running_ == 0; });
+    bool success = all_succeeded_;
+    all_succeeded_ = true;
+    return success;
+}
+
+int64_t AsyncWriter::GetNumPending() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int64_t>(queue_.size()) + num_running_;
+}
+
+void AsyncWriter::WorkerLoop() {
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            task_available_.wait(
+                    lock, [this]() { return stop_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;
+            }
+            task = std::move(queue_.front());
+            queue_.pop_front();
+            ++num_running_;
+        }
+        slot_available_.notify_one();
+
+        bool success = false;
+        try {
+            success = task.run();
+        } catch (const std::exception &e) {
+            utility::LogWarning("AsyncWriter task failed: {}", e.what());
+        }
+        if (task.callback) {
+            try {
+                task.callback(success);
+            } catch (const std::exception &e) {
+                utility::LogWarning("AsyncWriter callback failed: {}",
+                                    e.what());
+            }
+        }
+
+        bool idle = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --num_running_;
+            all_succeeded_ = all_succeeded_ && success;
+            idle = queue_.empty() && num_running_ == 0;
+        }
+        if (idle) {
+            idle_.notify_all();
+        }
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
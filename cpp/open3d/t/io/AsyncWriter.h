@@ -0,0 +1,149 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/VoxelBlockGrid.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/t/io/PointCloudIO.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class AsyncWriter
+///
+/// \brief Write reconstruction outputs on background threads, so that the
+/// compute loop does not wait for encoding and disk writes.
+///
+/// Geometries are snapshotted on the host when they are enqueued, and the
+/// caller is free to modify them right after. Encoding and compression run on
+/// the worker threads. When the queue is full, enqueueing blocks until a
+/// worker takes a task, which bounds the memory held by pending snapshots.
+///
+/// Example:
+/// \code{.cpp}
+/// t::io::AsyncWriter writer;
+/// for (int i = 0; i < n; ++i) {
+///     // Integrate frame i...
+///     writer.WriteImage(fmt::format("depth_{:06d}.png", i), depth);
+/// }
+/// writer.SaveVoxelBlockGrid("vbg.npz", vbg);
+/// if (!writer.Flush()) {
+///     utility::LogWarning("Some outputs could not be written.");
+/// }
+/// \endcode
+class AsyncWriter {
+public:
+    /// Called on a worker thread with the result of a write. Callbacks must
+    /// not call Flush or enqueue more writes.
+    typedef std::function<void(bool success)> Callback;
+
+    /// \param num_threads Number of worker threads. Tasks complete in order
+    /// only with a single worker thread.
+    /// \param max_queue_size Maximal number of tasks waiting for a worker.
+    /// \param copy If false, geometries already on the CPU share their
+    /// tensors with the pending tasks instead of being copied. The caller
+    /// then must not modify them in place until the write completes.
+    AsyncWriter(int num_threads = 1,
+                int64_t max_queue_size = 8,
+                bool copy = true);
+
+    /// Complete the pending writes and stop the worker threads.
+    ~AsyncWriter();
+
+    AsyncWriter(const AsyncWriter &) = delete;
+    AsyncWriter &operator=(const AsyncWriter &) = delete;
+
+    /// Enqueue t::io::WritePointCloud of a snapshot of pointcloud.
+    void WritePointCloud(const std::string &filename,
+                         const geometry::PointCloud &pointcloud,
+                         const WritePointCloudOption &params = {},
+                         Callback callback = nullptr);
+
+    /// Enqueue t::io::WriteImage of a snapshot of image.
+    void WriteImage(const std::string &filename,
+                    const geometry::Image &image,
+                    int quality = kOpen3DImageIODefaultQuality,
+                    Callback callback = nullptr);
+
+    /// \brief Enqueue VoxelBlockGrid::Save of a snapshot of voxel_grid.
+    /// The blocks are copied to the host on the calling thread, see
+    /// VoxelBlockGrid::Snapshot, while compression and writing run on a
+    /// worker thread.
+    void SaveVoxelBlockGrid(const std::string &filename,
+                            const geometry::VoxelBlockGrid &voxel_grid,
+                            bool compress = false,
+                            Callback callback = nullptr);
+
+    /// \brief Enqueue a custom task returning its success.
+    /// The task must own the data it writes. Exceptions thrown by the task
+    /// are reported as failures.
+    void Enqueue(std::function<bool()> task, Callback callback = nullptr);
+
+    /// \brief Wait until all the enqueued tasks complete.
+    /// \return true if all the tasks completed since the previous Flush
+    /// succeeded.
+    bool Flush();
+
+    /// Number of tasks enqueued and not yet completed.
+    int64_t GetNumPending() const;
+
+private:
+    struct Task {
+        std::function<bool()> run;
+        Callback callback;
+    };
+
+    void WorkerLoop();
+
+    int64_t max_queue_size_;
+    bool copy_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable task_available_;
+    std::condition_variable slot_available_;
+    std::condition_variable idle_;
+    std::deque<Task> queue_;
+    int64_t num_running_ = 0;
+    bool all_succeeded_ = true;
+    bool stop_ = false;
+    std::vector<std::thread> workers_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
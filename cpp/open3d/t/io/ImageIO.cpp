@@ -43,6 +43,7 @@ static const std::unordered_map<
                 {"png", ReadImageFromPNG},
                 {"jpg", ReadImageFromJPG},
                 {"jpeg", ReadImageFromJPG},
+                {"rvl", ReadImageFromRVL},
         };
 
 static const std::unordered_map<
@@ -52,6 +53,7 @@ static const std::unordered_map<
                 {"png", WriteImageToPNG},
                 {"jpg", WriteImageToJPG},
                 {"jpeg", WriteImageToJPG},
+                {"rvl", WriteImageToRVL},
         };
 
 std::shared_ptr<geometry::Image> CreateImageFromFile(
@@ -62,14 +62,17 @@ constexpr int kOpen3DImageIODefaultQuality = -1;
 ///                            file size
 ///                 JPEG: [0-100] Typically in [70,95]. 90 is default (good
 ///                 quality).
+///                 RVL: Ignored.
 /// \return return true if the write function is successful, false otherwise.
 ///
-/// Supported file extensions are png, jpg/jpeg. Data type and number of
-/// channels depends on the file extension.
+/// Supported file extensions are png, jpg/jpeg and rvl. Data type and number
+/// of channels depends on the file extension.
 /// - PNG: Dtype should be one of core::UInt8, core::UInt16
 ///        Supported number of channels are 1, 3, and 4.
 /// - JPG: Dtyppe should be core::UInt8
 ///        Supported number of channels are 1 and 3.
+/// - RVL: Lossless depth image codec. Dtype should be core::UInt16 with 1
+///        channel.
 bool WriteImage(const std::string &filename,
                 const geometry::Image &image,
                 int quality = kOpen3DImageIODefaultQuality);
@@ -80,12 +83,49 @@ bool WriteImageToPNG(const std::string &filename,
                      const geometry::Image &image,
                      int quality = kOpen3DImageIODefaultQuality);
 
+/// \brief Options for writing single channel UInt16 images, i.e. depth
+/// images, to PNG files.
+///
+/// The defaults trade file size for speed, for storing captured depth.
+struct DepthPNGWriteOption {
+    /// PNG row filters. With All, the best filter is picked for each row.
+    enum class Filter { None, Sub, Up, Average, Paeth, All };
+
+    /// zlib compression level in [0, 9].
+    int compression_level = 1;
+    Filter filter = Filter::Up;
+    /// Limit zlib to run-length matches. This is several times faster than
+    /// the default strategy, with little size overhead on depth images.
+    bool run_length = true;
+};
+
+/// Write a single channel UInt16 image to a PNG file. WriteImageToPNG also
+/// uses this path for such images, with options given by the quality.
+bool WriteDepthImageToPNG(const std::string &filename,
+                          const geometry::Image &image,
+                          const DepthPNGWriteOption &option = {});
+
 bool ReadImageFromJPG(const std::string &filename, geometry::Image &image);
 
 bool WriteImageToJPG(const std::string &filename,
                      const geometry::Image &image,
                      int quality = kOpen3DImageIODefaultQuality);
 
+/// Read an image written by WriteImageToRVL.
+bool ReadImageFromRVL(const std::string &filename, geometry::Image &image);
+
+/// \brief Write a single channel UInt16 image, i.e. a depth image, with the
+/// lossless RVL codec.
+///
+/// RVL codes runs of zero pixels and the differences between consecutive
+/// valid pixels with variable length nibbles (A. D. Wilson, "Fast Lossless
+/// Depth Image Compression", ISS 2017). Bands of rows are coded
+/// independently in parallel. Encoding and decoding are much faster than PNG,
+/// for a similar file size. quality is ignored.
+bool WriteImageToRVL(const std::string &filename,
+                     const geometry::Image &image,
+                     int quality = kOpen3DImageIODefaultQuality);
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
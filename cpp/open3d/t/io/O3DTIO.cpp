@@ -0,0 +1,680 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/O3DTIO.h"
+
+#include <liblzf/lzf.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <unordered_set>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+// File layout:
+//   "O3DT" magic, uint32 version
+//   chunk payloads, column by column
+//   index of groups, their columns, chunk records and chunk bounding boxes
+//   int64 index offset, "O3DT" magic
+const char kMagic[4] = {'O', '3', 'D', 'T'};
+const uint32_t kVersion = 1;
+
+struct ChunkRecord {
+    int64_t offset_;
+    // Equal to the decoded size if the chunk is stored raw.
+    int64_t size_;
+    double quantization_offset_;
+};
+
+struct ColumnIndex {
+    std::string name_;
+    core::Dtype dtype_;
+    core::SizeVector element_shape_;
+    // 0 if the column is not quantized.
+    double quantization_step_ = 0;
+    std::vector<ChunkRecord> chunks_;
+};
+
+struct GroupIndex {
+    std::string name_;
+    std::string primary_key_;
+    int64_t num_rows_ = 0;
+    int64_t chunk_size_ = 0;
+    std::vector<ColumnIndex> columns_;
+    // Min and max bound per chunk, empty if the group is not bounded.
+    std::vector<std::array<double, 6>> bounds_;
+
+    int64_t NumChunks() const {
+        return chunk_size_ > 0 ? (num_rows_ + chunk_size_ - 1) / chunk_size_
+                               : 0;
+    }
+    int64_t ChunkRows(int64_t chunk) const {
+        return std::min(chunk_size_, num_rows_ - chunk * chunk_size_);
+    }
+};
+
+struct EncodedChunk {
+    std::vector<uint8_t> data_;
+    double quantization_offset_ = 0;
+};
+
+bool Seek(FILE *file, int64_t offset, int origin) {
+#ifdef _WIN32
+    return _fseeki64(file, offset, origin) == 0;
+#else
+    return fseeko(file, offset, origin) == 0;
+#endif
+}
+
+void WriteBytes(FILE *file, const void *data, size_t size) {
+    if (size > 0 && fwrite(data, 1, size, file) != size) {
+        utility::LogError("Write O3DT failed: unable to write file.");
+    }
+}
+
+template <typename T>
+void WriteValue(FILE *file, const T &value) {
+    WriteBytes(file, &value, sizeof(T));
+}
+
+void WriteString(FILE *file, const std::string &str) {
+    WriteValue(file, int64_t(str.size()));
+    WriteBytes(file, str.data(), str.size());
+}
+
+void ReadBytes(FILE *file, void *data, size_t size) {
+    if (size > 0 && fread(data, 1, size, file) != size) {
+        utility::LogError("Read O3DT failed: unexpected end of file.");
+    }
+}
+
+template <typename T>
+T ReadValue(FILE *file) {
+    T value;
+    ReadBytes(file, &value, sizeof(T));
+    return value;
+}
+
+std::string ReadString(FILE *file) {
+    const int64_t size = ReadValue<int64_t>(file);
+    if (size < 0 || size > (1 << 16)) {
+        utility::LogError("Read O3DT failed: corrupted index.");
+    }
+    std::string str(size, '\0');
+    ReadBytes(file, &str[0], size);
+    return str;
+}
+
+core::Dtype DtypeFromString(const std::string &name) {
+    for (const core::Dtype &dtype :
+         {core::Float32, core::Float64, core::Int8, core::Int16, core::Int32,
+          core::Int64, core::UInt8, core::UInt16, core::UInt32, core::UInt64,
+          core::Bool}) {
+        if (dtype.ToString() == name) {
+            return dtype;
+        }
+    }
+    utility::LogError("Read O3DT failed: unsupported dtype {}.", name);
+}
+
+void WriteIndex(FILE *file, const std::vector<GroupIndex> &index) {
+    WriteValue(file, int64_t(index.size()));
+    for (const GroupIndex &group : index) {
+        WriteString(file, group.name_);
+        WriteString(file, group.primary_key_);
+        WriteValue(file, group.num_rows_);
+        WriteValue(file, group.chunk_size_);
+        WriteValue(file, uint8_t(!group.bounds_.empty()));
+        WriteValue(file, int64_t(group.columns_.size()));
+        for (const ColumnIndex &column : group.columns_) {
+            WriteString(file, column.name_);
+            WriteString(file, column.dtype_.ToString());
+            WriteValue(file, int64_t(column.element_shape_.size()));
+            for (int64_t dim : column.element_shape_) {
+                WriteValue(file, dim);
+            }
+            WriteValue(file, column.quantization_step_);
+            for (const ChunkRecord &chunk : column.chunks_) {
+                WriteValue(file, chunk.offset_);
+                WriteValue(file, chunk.size_);
+                WriteValue(file, chunk.quantization_offset_);
+            }
+        }
+        for (const std::array<double, 6> &bound : group.bounds_) {
+            WriteBytes(file, bound.data(), sizeof(bound));
+        }
+    }
+}
+
+std::vector<GroupIndex> ReadIndex(FILE *file, int64_t payload_end) {
+    std::vector<GroupIndex> index(ReadValue<int64_t>(file));
+    for (GroupIndex &group : index) {
+        group.name_ = ReadString(file);
+        group.primary_key_ = ReadString(file);
+        group.num_rows_ = ReadValue<int64_t>(file);
+        group.chunk_size_ = ReadValue<int64_t>(file);
+        const bool has_bounds = ReadValue<uint8_t>(file) != 0;
+        group.columns_.resize(ReadValue<int64_t>(file));
+        if (group.num_rows_ < 0 ||
+            (group.num_rows_ > 0 && group.chunk_size_ <= 0)) {
+            utility::LogError("Read O3DT failed: corrupted index.");
+        }
+        const int64_t num_chunks = group.NumChunks();
+        for (ColumnIndex &column : group.columns_) {
+            column.name_ = ReadString(file);
+            column.dtype_ = DtypeFromString(ReadString(file));
+            column.element_shape_.resize(ReadValue<int64_t>(file));
+            for (int64_t &dim : column.element_shape_) {
+                dim = ReadValue<int64_t>(file);
+            }
+            column.quantization_step_ = ReadValue<double>(file);
+            column.chunks_.resize(num_chunks);
+            for (ChunkRecord &chunk : column.chunks_) {
+                chunk.offset_ = ReadValue<int64_t>(file);
+                chunk.size_ = ReadValue<int64_t>(file);
+                chunk.quantization_offset_ = ReadValue<double>(file);
+                if (chunk.offset_ < 0 || chunk.size_ < 0 ||
+                    chunk.offset_ + chunk.size_ > payload_end) {
+                    utility::LogError("Read O3DT failed: corrupted index.");
+                }
+            }
+        }
+        if (has_bounds) {
+            group.bounds_.resize(num_chunks);
+            for (std::array<double, 6> &bound : group.bounds_) {
+                ReadBytes(file, bound.data(), sizeof(bound));
+            }
+        }
+    }
+    return index;
+}
+
+// Transpose num_elements elements of the given byte width into byte planes,
+// which LZF compresses much better for numeric data.
+void Shuffle(const uint8_t *src,
+             int64_t num_elements,
+             int64_t width,
+             uint8_t *dst) {
+    for (int64_t b = 0; b < width; ++b) {
+        for (int64_t i = 0; i < num_elements; ++i) {
+            dst[b * num_elements + i] = src[i * width + b];
+        }
+    }
+}
+
+void Unshuffle(const uint8_t *src,
+               int64_t num_elements,
+               int64_t width,
+               uint8_t *dst) {
+    for (int64_t b = 0; b < width; ++b) {
+        for (int64_t i = 0; i < num_elements; ++i) {
+            dst[i * width + b] = src[b * num_elements + i];
+        }
+    }
+}
+
+template <typename scalar_t>
+double Quantize(const scalar_t *values,
+                int64_t num_values,
+                double step,
+                int32_t *codes) {
+    double min_value = values[0];
+    for (int64_t i = 1; i < num_values; ++i) {
+        min_value = std::min(min_value, double(values[i]));
+    }
+    for (int64_t i = 0; i < num_values; ++i) {
+        codes[i] = int32_t(std::llround((values[i] - min_value) / step));
+    }
+    return min_value;
+}
+
+template <typename scalar_t>
+void Dequantize(const int32_t *codes,
+                int64_t num_values,
+                double offset,
+                double step,
+                scalar_t *values) {
+    for (int64_t i = 0; i < num_values; ++i) {
+        values[i] = scalar_t(offset + codes[i] * step);
+    }
+}
+
+/// Check that a column can be quantized with the given step, i.e. that its
+/// values are finite and their range fits into Int32 codes.
+void CheckQuantization(const core::Tensor &tensor,
+                       const std::string &name,
+                       double step) {
+    if (tensor.GetDtype() != core::Float32 &&
+        tensor.GetDtype() != core::Float64) {
+        utility::LogError(
+                "Write O3DT failed: cannot quantize attribute {} of dtype {}.",
+                name, tensor.GetDtype().ToString());
+    }
+    if (!(step > 0)) {
+        utility::LogError(
+                "Write O3DT failed: quantization step of {} must be positive, "
+                "but got {}.",
+                name, step);
+    }
+    if (tensor.NumElements() == 0) {
+        return;
+    }
+    if (!tensor.IsFinite().All()) {
+        utility::LogError(
+                "Write O3DT failed: cannot quantize non-finite values of {}.",
+                name);
+    }
+    const core::Tensor values =
+            tensor.Reshape({tensor.NumElements()}).To(core::Float64);
+    const double range = values.Max({0}).Item<double>() -
+                         values.Min({0}).Item<double>();
+    if (range / step >= double(std::numeric_limits<int32_t>::max())) {
+        utility::LogError(
+                "Write O3DT failed: quantization step {} of {} is too small "
+                "for its value range {}.",
+                step, name, range);
+    }
+}
+
+/// Encode rows [begin, end) of a contiguous host tensor.
+EncodedChunk EncodeChunk(const core::Tensor &tensor,
+                         int64_t begin,
+                         int64_t end,
+                         bool compressed,
+                         double quantization_step) {
+    const int64_t row_values = tensor.NumElements() / tensor.GetLength();
+    const int64_t num_values = (end - begin) * row_values;
+    int64_t width = tensor.GetDtype().ByteSize();
+    const uint8_t *src = static_cast<const uint8_t *>(tensor.GetDataPtr()) +
+                         begin * row_values * width;
+
+    EncodedChunk chunk;
+    std::vector<int32_t> codes;
+    if (quantization_step > 0) {
+        codes.resize(num_values);
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(tensor.GetDtype(), [&]() {
+            chunk.quantization_offset_ = Quantize(
+                    reinterpret_cast<const scalar_t *>(src), num_values,
+                    quantization_step, codes.data());
+        });
+        src = reinterpret_cast<const uint8_t *>(codes.data());
+        width = sizeof(int32_t);
+    }
+
+    // Keep the raw bytes if LZF is unable to shrink the chunk.
+    const int64_t size = num_values * width;
+    if (compressed && size > 1 &&
+        size <= int64_t(std::numeric_limits<unsigned int>::max())) {
+        std::vector<uint8_t> shuffled(size);
+        Shuffle(src, num_values, width, shuffled.data());
+        chunk.data_.resize(size);
+        const unsigned int compressed_size = lzf_compress(
+                shuffled.data(), static_cast<unsigned int>(size),
+                chunk.data_.data(), static_cast<unsigned int>(size - 1));
+        if (compressed_size > 0) {
+            chunk.data_.resize(compressed_size);
+            return chunk;
+        }
+    }
+    chunk.data_.assign(src, src + size);
+    return chunk;
+}
+
+/// Decode a chunk of num_rows rows into dst. Raw chunks are not passed here
+/// since they are read into their destination directly.
+bool DecodeChunk(const std::vector<uint8_t> &data,
+                 const ColumnIndex &column,
+                 const ChunkRecord &record,
+                 int64_t num_rows,
+                 uint8_t *dst) {
+    const int64_t num_values = num_rows * column.element_shape_.NumElements();
+    const bool quantized = column.quantization_step_ > 0;
+    const int64_t width =
+            quantized ? int64_t(sizeof(int32_t)) : column.dtype_.ByteSize();
+    const int64_t size = num_values * width;
+
+    std::vector<uint8_t> decoded(size);
+    if (record.size_ == size) {
+        std::memcpy(decoded.data(), data.data(), size);
+    } else {
+        std::vector<uint8_t> shuffled(size);
+        if (static_cast<int64_t>(lzf_decompress(
+                    data.data(), static_cast<unsigned int>(data.size()),
+                    shuffled.data(), static_cast<unsigned int>(size))) !=
+            size) {
+            return false;
+        }
+        Unshuffle(shuffled.data(), num_values, width, decoded.data());
+    }
+
+    if (quantized) {
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(column.dtype_, [&]() {
+            Dequantize(reinterpret_cast<const int32_t *>(decoded.data()),
+                       num_values, record.quantization_offset_,
+                       column.quantization_step_,
+                       reinterpret_cast<scalar_t *>(dst));
+        });
+    } else {
+        std::memcpy(dst, decoded.data(), size);
+    }
+    return true;
+}
+
+/// Compute the bounding box of each chunk of (N, 3) positions. Chunks without
+/// finite positions get an empty box.
+template <typename scalar_t>
+std::vector<std::array<double, 6>> ComputeChunkBounds(
+        const scalar_t *positions, const GroupIndex &group) {
+    std::vector<std::array<double, 6>> bounds(group.NumChunks());
+    core::ParallelFor(
+            core::Device("CPU:0"), group.NumChunks(), [&](int64_t chunk) {
+                const double inf = std::numeric_limits<double>::infinity();
+                std::array<double, 6> bound = {inf, inf, inf, -inf, -inf, -inf};
+                const int64_t begin = chunk * group.chunk_size_;
+                const int64_t end = begin + group.ChunkRows(chunk);
+                for (int64_t i = begin; i < end; ++i) {
+                    const scalar_t *p = positions + 3 * i;
+                    if (!std::isfinite(p[0]) || !std::isfinite(p[1]) ||
+                        !std::isfinite(p[2])) {
+                        continue;
+                    }
+                    for (int d = 0; d < 3; ++d) {
+                        bound[d] = std::min(bound[d], double(p[d]));
+                        bound[d + 3] = std::max(bound[d + 3], double(p[d]));
+                    }
+                }
+                bounds[chunk] = bound;
+            });
+    return bounds;
+}
+
+}  // unnamed namespace
+
+void WriteO3DT(
+        const std::string &file_name,
+        const std::unordered_map<std::string, geometry::TensorMap> &groups,
+        const WriteO3DTOption &option) {
+    if (option.chunk_size <= 0) {
+        utility::LogError(
+                "Write O3DT failed: chunk_size must be positive, but got {}.",
+                option.chunk_size);
+    }
+    utility::filesystem::CFile file;
+    if (!file.Open(file_name, "wb")) {
+        utility::LogError("Write O3DT failed: unable to open file: {}",
+                          file_name);
+    }
+    FILE *fp = file.GetFILE();
+    WriteBytes(fp, kMagic, sizeof(kMagic));
+    WriteValue(fp, kVersion);
+    int64_t offset = sizeof(kMagic) + sizeof(kVersion);
+
+    // Sort groups and attributes for a deterministic layout.
+    std::vector<std::string> group_names;
+    for (const auto &kv : groups) {
+        group_names.push_back(kv.first);
+    }
+    std::sort(group_names.begin(), group_names.end());
+
+    core::Device host("CPU:0");
+    const int64_t batch_size = int64_t(utility::EstimateMaxThreads()) * 4;
+    std::vector<GroupIndex> index;
+    for (const std::string &group_name : group_names) {
+        const geometry::TensorMap &tensor_map = groups.at(group_name);
+        GroupIndex group;
+        group.name_ = group_name;
+        group.primary_key_ = tensor_map.GetPrimaryKey();
+        group.chunk_size_ = option.chunk_size;
+        if (!tensor_map.empty()) {
+            if (!tensor_map.Contains(group.primary_key_)) {
+                utility::LogError(
+                        "Write O3DT failed: group {} does not contain its "
+                        "primary key {}.",
+                        group_name, group.primary_key_);
+            }
+            tensor_map.AssertSizeSynchronized();
+            group.num_rows_ = tensor_map.at(group.primary_key_).GetLength();
+        }
+
+        std::vector<std::string> names;
+        for (const auto &kv : tensor_map) {
+            names.push_back(kv.first);
+        }
+        std::sort(names.begin(), names.end());
+        std::vector<core::Tensor> tensors;
+        for (const std::string &name : names) {
+            const core::Tensor tensor =
+                    tensor_map.at(name).To(host).Contiguous();
+            ColumnIndex column;
+            column.name_ = name;
+            column.dtype_ = tensor.GetDtype();
+            column.element_shape_ = tensor.GetShape();
+            column.element_shape_.erase(column.element_shape_.begin());
+            auto step_itr = option.quantization_steps.find(name);
+            if (step_itr != option.quantization_steps.end()) {
+                CheckQuantization(tensor, name, step_itr->second);
+                column.quantization_step_ = step_itr->second;
+            }
+            group.columns_.push_back(column);
+            tensors.push_back(tensor);
+
+            const core::Dtype dtype = tensor.GetDtype();
+            if (name == group.primary_key_ &&
+                (dtype == core::Float32 || dtype == core::Float64) &&
+                column.element_shape_ == core::SizeVector({3})) {
+                DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+                    group.bounds_ = ComputeChunkBounds(
+                            tensor.GetDataPtr<scalar_t>(), group);
+                });
+            }
+        }
+
+        // Encode the chunks of all columns in parallel batches, and append
+        // them column by column.
+        const int64_t num_chunks = group.NumChunks();
+        const int64_t num_tasks = int64_t(tensors.size()) * num_chunks;
+        for (int64_t begin = 0; begin < num_tasks; begin += batch_size) {
+            const int64_t end = std::min(begin + batch_size, num_tasks);
+            std::vector<EncodedChunk> encoded(end - begin);
+            core::ParallelFor(host, end - begin, [&](int64_t i) {
+                const int64_t c = (begin + i) / num_chunks;
+                const int64_t chunk = (begin + i) % num_chunks;
+                const int64_t row_begin = chunk * group.chunk_size_;
+                encoded[i] = EncodeChunk(
+                        tensors[c], row_begin,
+                        row_begin + group.ChunkRows(chunk), option.compressed,
+                        group.columns_[c].quantization_step_);
+            });
+            for (int64_t i = 0; i < end - begin; ++i) {
+                const std::vector<uint8_t> &data = encoded[i].data_;
+                WriteBytes(fp, data.data(), data.size());
+                group.columns_[(begin + i) / num_chunks].chunks_.push_back(
+                        ChunkRecord{offset, int64_t(data.size()),
+                                    encoded[i].quantization_offset_});
+                offset += data.size();
+            }
+        }
+        index.push_back(group);
+    }
+
+    WriteIndex(fp, index);
+    WriteValue(fp, offset);
+    WriteBytes(fp, kMagic, sizeof(kMagic));
+}
+
+std::unordered_map<std::string, geometry::TensorMap> ReadO3DT(
+        const std::string &file_name, const ReadO3DTOption &option) {
+    utility::filesystem::CFile file;
+    if (!file.Open(file_name, "rb")) {
+        utility::LogError("Read O3DT failed: unable to open file: {}",
+                          file_name);
+    }
+    FILE *fp = file.GetFILE();
+    char magic[sizeof(kMagic)];
+    ReadBytes(fp, magic, sizeof(magic));
+    const uint32_t version = ReadValue<uint32_t>(fp);
+    if (std::memcmp(magic, kMagic, sizeof(kMagic)) != 0) {
+        utility::LogError("Read O3DT failed: {} is not an O3DT file.",
+                          file_name);
+    }
+    if (version > kVersion) {
+        utility::LogError("Read O3DT failed: unsupported version {}.",
+                          version);
+    }
+
+    if (!Seek(fp, -int64_t(sizeof(int64_t) + sizeof(kMagic)), SEEK_END)) {
+        utility::LogError("Read O3DT failed: unexpected end of file.");
+    }
+    const int64_t index_offset = ReadValue<int64_t>(fp);
+    ReadBytes(fp, magic, sizeof(magic));
+    if (std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+        !Seek(fp, index_offset, SEEK_SET)) {
+        utility::LogError("Read O3DT failed: {} is truncated.", file_name);
+    }
+    const std::vector<GroupIndex> index = ReadIndex(fp, index_offset);
+
+    const std::unordered_set<std::string> attributes(option.attributes.begin(),
+                                                     option.attributes.end());
+    core::Device host("CPU:0");
+    const int64_t batch_size = int64_t(utility::EstimateMaxThreads()) * 4;
+    std::unordered_map<std::string, geometry::TensorMap> groups;
+    for (const GroupIndex &group : index) {
+        // Select the chunks intersecting the bounds.
+        std::vector<int64_t> chunks;
+        std::vector<int64_t> row_offsets;
+        int64_t num_rows = 0;
+        for (int64_t chunk = 0; chunk < group.NumChunks(); ++chunk) {
+            if (!group.bounds_.empty()) {
+                const std::array<double, 6> &bound = group.bounds_[chunk];
+                if ((Eigen::Vector3d(bound[0], bound[1], bound[2]).array() >
+                     option.max_bound.array())
+                            .any() ||
+                    (Eigen::Vector3d(bound[3], bound[4], bound[5]).array() <
+                     option.min_bound.array())
+                            .any()) {
+                    continue;
+                }
+            }
+            chunks.push_back(chunk);
+            row_offsets.push_back(num_rows);
+            num_rows += group.ChunkRows(chunk);
+        }
+
+        // The primary key is read along with any other attribute.
+        std::vector<const ColumnIndex *> columns;
+        for (const ColumnIndex &column : group.columns_) {
+            if (attributes.empty() || attributes.count(column.name_)) {
+                columns.push_back(&column);
+            }
+        }
+        if (!columns.empty()) {
+            for (const ColumnIndex &column : group.columns_) {
+                if (column.name_ == group.primary_key_ &&
+                    std::find(columns.begin(), columns.end(), &column) ==
+                            columns.end()) {
+                    columns.push_back(&column);
+                }
+            }
+        }
+
+        geometry::TensorMap tensor_map(group.primary_key_);
+        for (const ColumnIndex *column : columns) {
+            core::SizeVector shape = column->element_shape_;
+            shape.insert(shape.begin(), num_rows);
+            core::Tensor tensor(shape, column->dtype_, host);
+            uint8_t *tensor_ptr = static_cast<uint8_t *>(tensor.GetDataPtr());
+            const int64_t row_byte_size = column->element_shape_.NumElements() *
+                                          column->dtype_.ByteSize();
+
+            // Read chunks sequentially and decode them in parallel batches.
+            // Raw chunks are read into the tensor directly.
+            const int64_t num_chunks = chunks.size();
+            for (int64_t begin = 0; begin < num_chunks; begin += batch_size) {
+                const int64_t end = std::min(begin + batch_size, num_chunks);
+                std::vector<std::vector<uint8_t>> encoded(end - begin);
+                std::vector<uint8_t> raw(end - begin);
+                for (int64_t i = begin; i < end; ++i) {
+                    const ChunkRecord &record = column->chunks_[chunks[i]];
+                    uint8_t *dst = tensor_ptr + row_offsets[i] * row_byte_size;
+                    raw[i - begin] =
+                            column->quantization_step_ == 0 &&
+                            record.size_ ==
+                                    group.ChunkRows(chunks[i]) * row_byte_size;
+                    if (!raw[i - begin]) {
+                        encoded[i - begin].resize(record.size_);
+                        dst = encoded[i - begin].data();
+                    }
+                    if (!Seek(fp, record.offset_, SEEK_SET)) {
+                        utility::LogError(
+                                "Read O3DT failed: unexpected end of file.");
+                    }
+                    ReadBytes(fp, dst, record.size_);
+                }
+
+                std::atomic<bool> corrupted(false);
+                core::ParallelFor(host, end - begin, [&](int64_t i) {
+                    if (raw[i]) {
+                        return;
+                    }
+                    const int64_t chunk = chunks[begin + i];
+                    const ChunkRecord &record = column->chunks_[chunk];
+                    if (!DecodeChunk(encoded[i], *column, record,
+                                     group.ChunkRows(chunk),
+                                     tensor_ptr + row_offsets[begin + i] *
+                                                          row_byte_size)) {
+                        corrupted = true;
+                    }
+                });
+                if (corrupted) {
+                    utility::LogError(
+                            "Read O3DT failed: corrupted chunk of {} in {}.",
+                            column->name_, file_name);
+                }
+            }
+            tensor_map.emplace(column->name_, tensor);
+        }
+        groups.emplace(group.name_, tensor_map);
+    }
+    return groups;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,100 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/t/geometry/TensorMap.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Options for writing .o3dt files.
+struct WriteO3DTOption {
+    /// Number of rows per chunk. Each chunk of each attribute is encoded
+    /// independently, and chunks of groups with 3D positions as primary key
+    /// store a bounding box.
+    int64_t chunk_size = 65536;
+    /// If true, chunks are byte shuffled and compressed with LZF. Otherwise
+    /// the raw bytes are stored and can be read without intermediate copies.
+    bool compressed = false;
+    /// Quantization step of floating point attributes by name. Values are
+    /// stored as Int32 offsets from the chunk minimum with an absolute error
+    /// of at most half a step. Quantized values must be finite.
+    std::unordered_map<std::string, double> quantization_steps;
+};
+
+/// Options for reading .o3dt files.
+struct ReadO3DTOption {
+    /// Attributes to read, e.g. {"positions"}. All attributes are read if
+    /// empty.
+    std::vector<std::string> attributes;
+    /// Only chunks whose bounding box intersects [min_bound, max_bound] are
+    /// read from groups with chunk bounding boxes. This is a coarse filter,
+    /// i.e. rows of the selected chunks may lie outside of the bounds.
+    Eigen::Vector3d min_bound =
+            Eigen::Vector3d::Constant(-std::numeric_limits<double>::infinity());
+    Eigen::Vector3d max_bound =
+            Eigen::Vector3d::Constant(std::numeric_limits<double>::infinity());
+};
+
+/// Save named tensor maps as a chunked, columnar .o3dt file.
+///
+/// Each attribute is stored as a column of chunks of
+/// WriteO3DTOption::chunk_size rows, which are encoded in parallel. Point
+/// clouds are stored as the "point" group, triangle meshes as the "vertex" and
+/// "triangle" groups.
+///
+/// \param file_name The file name to write to.
+/// \param groups The tensor maps to save by group name.
+/// \param option Chunking, compression and quantization options.
+void WriteO3DT(
+        const std::string &file_name,
+        const std::unordered_map<std::string, geometry::TensorMap> &groups,
+        const WriteO3DTOption &option = {});
+
+/// Read named tensor maps from a .o3dt file.
+///
+/// Only the requested attributes and chunks are read from the file, and
+/// chunks are decoded in parallel. The primary key attribute of a group is
+/// always read along with its other attributes, and groups without requested
+/// attributes are returned as empty tensor maps.
+///
+/// \param file_name The file name to read from.
+/// \param option Attribute projection and spatial filter options.
+std::unordered_map<std::string, geometry::TensorMap> ReadO3DT(
+        const std::string &file_name, const ReadO3DTOption &option = {});
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -47,6 +47,7 @@ static const std::unordered_map<
                            const open3d::io::ReadPointCloudOption &)>>
         file_extension_to_pointcloud_read_function{
                 {"npz", ReadPointCloudFromNPZ},
+                {"o3dt", ReadPointCloudFromO3DT},
                 {"xyzi", ReadPointCloudFromXYZI},
                 {"pcd", ReadPointCloudFromPCD},
                 {"ply", ReadPointCloudFromPLY},
@@ -61,7 +62,7 @@ static const std::unordered_map<
         file_extension_to_pointcloud_write_function{
                 {"npz", WritePointCloudToNPZ}, {"xyzi", WritePointCloudToXYZI},
                 {"pcd", WritePointCloudToPCD}, {"ply", WritePointCloudToPLY},
-                {"pts", WritePointCloudToPTS},
+                {"pts", WritePointCloudToPTS}, {"o3dt", WritePointCloudToO3DT},
         };
 
 std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
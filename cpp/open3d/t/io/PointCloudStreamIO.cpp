@@ -0,0 +1,585 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudStreamIO.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <vector>
+
+#include "open3d/io/file_format/ASCIIRowsIO.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+int64_t GetLength(const geometry::PointCloud &pointcloud) {
+    return pointcloud.IsEmpty() ? 0
+                                : pointcloud.GetPointPositions().GetLength();
+}
+
+geometry::PointCloud Concatenate(const geometry::PointCloud &first,
+                                 const geometry::PointCloud &second) {
+    if (GetLength(first) == 0) return second;
+    if (GetLength(second) == 0) return first;
+    return first.Append(second);
+}
+
+geometry::PointCloud SlicePoints(const geometry::PointCloud &pointcloud,
+                                 int64_t begin,
+                                 int64_t end) {
+    geometry::PointCloud sliced(pointcloud.GetDevice());
+    for (const auto &kv : pointcloud.GetPointAttr()) {
+        sliced.SetPointAttr(kv.first, kv.second.Slice(0, begin, end));
+    }
+    return sliced;
+}
+
+// An attribute stored in consecutive fields of an ASCII row.
+struct ASCIIAttribute {
+    std::string name_;
+    int64_t width_;
+    core::Dtype dtype_;
+};
+
+// XYZ, XYZN, XYZRGB, XYZI and PTS files.
+class ASCIIBatchReader : public PointCloudBatchReader {
+public:
+    bool Open(const std::string &filename, const std::string &format) {
+        if (!file_.Open(filename, "rb")) {
+            utility::LogWarning("Read {} failed: unable to open file: {}",
+                                utility::ToUpper(format), filename);
+            return false;
+        }
+        const ASCIIAttribute positions{"positions", 3, core::Float64};
+        // As the whole-file readers, only PTS rejects lines that cannot be
+        // parsed, while the other formats skip them.
+        bool strict = false;
+        if (format == "xyz") {
+            attributes_ = {positions};
+        } else if (format == "xyzn") {
+            attributes_ = {positions, {"normals", 3, core::Float64}};
+        } else if (format == "xyzrgb") {
+            attributes_ = {positions, {"colors", 3, core::Float64}};
+        } else if (format == "xyzi") {
+            attributes_ = {positions, {"intensities", 1, core::Float64}};
+        } else if (format == "pts") {
+            if (!ReadPTSHeader()) {
+                return false;
+            }
+            strict = true;
+        } else {
+            utility::LogWarning("Unsupported ASCII point cloud format: {}",
+                                format);
+            return false;
+        }
+
+        int num_fields = 0;
+        for (const ASCIIAttribute &attribute : attributes_) {
+            num_fields += int(attribute.width_);
+        }
+        rows_ = std::make_unique<open3d::io::ASCIIRowsReader>(
+                file_, num_fields, strict);
+        return true;
+    }
+
+    int64_t GetNumPoints() const override { return num_points_; }
+
+    bool ReadBatch(int64_t max_points, geometry::PointCloud &batch) override {
+        if (num_points_ >= 0) {
+            max_points = std::min(max_points, num_points_ - num_read_);
+        }
+        batch.Clear();
+        if (max_points <= 0) {
+            return true;
+        }
+        values_.clear();
+        const int64_t num_rows = rows_->Read(max_points, values_);
+        if (num_rows < 0) {
+            return false;
+        }
+        num_read_ += num_rows;
+        if (num_rows == 0) {
+            return true;
+        }
+
+        const int64_t num_fields = int64_t(values_.size()) / num_rows;
+        int64_t field = 0;
+        for (const ASCIIAttribute &attribute : attributes_) {
+            core::Tensor tensor({num_rows, attribute.width_}, attribute.dtype_);
+            const int64_t width = attribute.width_;
+            const double *src = values_.data() + field;
+            if (attribute.dtype_ == core::UInt8) {
+                uint8_t *dst = tensor.GetDataPtr<uint8_t>();
+                for (int64_t i = 0; i < num_rows; ++i) {
+                    for (int64_t k = 0; k < width; ++k) {
+                        dst[i * width + k] =
+                                uint8_t(int(src[i * num_fields + k]));
+                    }
+                }
+            } else {
+                double *dst = tensor.GetDataPtr<double>();
+                for (int64_t i = 0; i < num_rows; ++i) {
+                    for (int64_t k = 0; k < width; ++k) {
+                        dst[i * width + k] = src[i * num_fields + k];
+                    }
+                }
+            }
+            batch.SetPointAttr(attribute.name_, tensor);
+            field += width;
+        }
+        return true;
+    }
+
+private:
+    // The number of points, followed by X Y Z I R G B, X Y Z R G B, X Y Z I
+    // or X Y Z rows.
+    bool ReadPTSHeader() {
+        const char *line_buffer = file_.ReadLine();
+        long long num_points = 0;
+        if (!line_buffer || sscanf(line_buffer, "%lld", &num_points) != 1 ||
+            num_points < 0) {
+            utility::LogWarning(
+                    "Read PTS failed: number of points must be >= 0.");
+            return false;
+        }
+        num_points_ = num_points;
+
+        const int64_t start_pos = file_.CurPos();
+        size_t num_fields = 3;
+        if ((line_buffer = file_.ReadLine())) {
+            num_fields = utility::SplitString(line_buffer, " ").size();
+            if (num_fields != 7 && num_fields != 6 && num_fields != 4 &&
+                num_fields != 3) {
+                utility::LogWarning("Read PTS failed: unknown pts format: {}",
+                                    line_buffer);
+                return false;
+            }
+        }
+        fseek(file_.GetFILE(), start_pos, SEEK_SET);
+
+        attributes_ = {{"positions", 3, core::Float64}};
+        if (num_fields == 7 || num_fields == 4) {
+            attributes_.push_back({"intensities", 1, core::Float64});
+        }
+        if (num_fields == 7 || num_fields == 6) {
+            attributes_.push_back({"colors", 3, core::UInt8});
+        }
+        return true;
+    }
+
+private:
+    utility::filesystem::CFile file_;
+    std::unique_ptr<open3d::io::ASCIIRowsReader> rows_;
+    std::vector<ASCIIAttribute> attributes_;
+    int64_t num_points_ = -1;
+    int64_t num_read_ = 0;
+    std::vector<double> values_;
+};
+
+// Fallback for files that cannot be streamed.
+class InMemoryBatchReader : public PointCloudBatchReader {
+public:
+    bool Open(const std::string &filename, const std::string &format) {
+        open3d::io::ReadPointCloudOption params;
+        params.format = format;
+        return ReadPointCloud(filename, pointcloud_, params);
+    }
+
+    int64_t GetNumPoints() const override { return GetLength(pointcloud_); }
+
+    bool ReadBatch(int64_t max_points, geometry::PointCloud &batch) override {
+        const int64_t end = std::min(num_read_ + max_points,
+                                     GetLength(pointcloud_));
+        batch = num_read_ < end ? SlicePoints(pointcloud_, num_read_, end)
+                                : geometry::PointCloud();
+        num_read_ = std::max(num_read_, end);
+        return true;
+    }
+
+private:
+    geometry::PointCloud pointcloud_;
+    int64_t num_read_ = 0;
+};
+
+// An attribute written to consecutive fields of an ASCII row.
+struct ASCIIColumn {
+    core::Tensor values_;
+    int64_t width_;
+};
+
+class ASCIIBatchWriter : public PointCloudBatchWriter {
+public:
+    bool Open(const std::string &filename, const std::string &format) {
+        format_ = format;
+        if (!file_.Open(filename, "w")) {
+            utility::LogWarning("Write {} failed: unable to open file: {}",
+                                utility::ToUpper(format), filename);
+            return false;
+        }
+        return format_ != "pts" || WritePTSHeader();
+    }
+
+    bool WriteBatch(const geometry::PointCloud &batch) override {
+        std::vector<ASCIIColumn> columns{
+                {batch.GetPointPositions().To(core::Float64).Contiguous(), 3}};
+        const char *line_break = "\n";
+        if (format_ == "xyzn") {
+            if (!batch.HasPointNormals()) {
+                utility::LogWarning("Write XYZN failed: no point normals.");
+                return false;
+            }
+            columns.push_back(
+                    {batch.GetPointNormals().To(core::Float64).Contiguous(),
+                     3});
+        } else if (format_ == "xyzrgb") {
+            if (!batch.HasPointColors()) {
+                utility::LogWarning("Write XYZRGB failed: no point colors.");
+                return false;
+            }
+            // Like PointCloud::ToLegacy(), 8 bit colors are scaled to [0, 1].
+            core::Tensor colors = batch.GetPointColors().To(core::Float64);
+            if (batch.GetPointColors().GetDtype() == core::UInt8) {
+                colors = colors / 255.0;
+            }
+            columns.push_back({colors.Contiguous(), 3});
+        } else if (format_ == "xyzi") {
+            if (!batch.HasPointAttr("intensities")) {
+                utility::LogWarning("Write XYZI failed: no point intensities.");
+                return false;
+            }
+            columns.push_back({batch.GetPointAttr("intensities")
+                                       .To(core::Float64)
+                                       .Contiguous(),
+                               1});
+        } else if (format_ == "pts") {
+            // X Y Z I R G B, X Y Z R G B, X Y Z I or X Y Z.
+            if (batch.HasPointAttr("intensities")) {
+                columns.push_back({batch.GetPointAttr("intensities")
+                                           .To(core::Float64)
+                                           .Contiguous(),
+                                   1});
+            }
+            if (batch.HasPointColors()) {
+                core::Tensor colors = batch.GetPointColors();
+                if (colors.GetDtype() == core::Float32 ||
+                    colors.GetDtype() == core::Float64) {
+                    colors = colors.Clip(0, 1).Mul(255).Round();
+                }
+                columns.push_back({colors.To(core::UInt8).Contiguous(), 3});
+            }
+            line_break = "\r\n";
+        }
+
+        auto format_row = [&](int64_t i, char *buffer, size_t size) {
+            int length = 0;
+            for (size_t c = 0; c < columns.size(); ++c) {
+                const ASCIIColumn &column = columns[c];
+                for (int64_t k = 0; k < column.width_; ++k) {
+                    const size_t offset = std::min(size_t(length), size);
+                    const char *separator = c == 0 && k == 0 ? "" : " ";
+                    const int64_t idx = i * column.width_ + k;
+                    int n;
+                    if (column.values_.GetDtype() == core::UInt8) {
+                        n = snprintf(buffer + offset, size - offset, "%s%d",
+                                     separator,
+                                     column.values_.GetDataPtr<uint8_t>()[idx]);
+                    } else {
+                        n = snprintf(buffer + offset, size - offset, "%s%.10f",
+                                     separator,
+                                     column.values_.GetDataPtr<double>()[idx]);
+                    }
+                    if (n < 0) {
+                        return n;
+                    }
+                    length += n;
+                }
+            }
+            const size_t offset = std::min(size_t(length), size);
+            const int n =
+                    snprintf(buffer + offset, size - offset, "%s", line_break);
+            return n < 0 ? n : length + n;
+        };
+        const int64_t num_points = batch.GetPointPositions().GetLength();
+        if (!open3d::io::WriteASCIIRows(file_, num_points, format_row)) {
+            utility::LogWarning("Write {} failed: unable to write file: {}",
+                                utility::ToUpper(format_), file_.GetError());
+            return false;
+        }
+        num_points_ += num_points;
+        return true;
+    }
+
+    bool Close() override {
+        const bool success = format_ != "pts" || WritePTSHeader();
+        file_.Close();
+        return success;
+    }
+
+private:
+    // The number of points has a fixed width, so that the header can be
+    // completed in place.
+    bool WritePTSHeader() {
+        FILE *fp = file_.GetFILE();
+        const int64_t pos = file_.CurPos();
+        if (fseek(fp, 0, SEEK_SET) != 0 ||
+            fprintf(fp, "%019" PRId64 "\r\n", num_points_) < 0 ||
+            (pos > 0 && fseek(fp, pos, SEEK_SET) != 0)) {
+            utility::LogWarning("Write PTS failed: unable to write header.");
+            return false;
+        }
+        return true;
+    }
+
+private:
+    utility::filesystem::CFile file_;
+    std::string format_;
+    int64_t num_points_ = 0;
+};
+
+bool IsASCIIFormat(const std::string &format) {
+    return format == "xyz" || format == "xyzn" || format == "xyzrgb" ||
+           format == "xyzi" || format == "pts";
+}
+
+std::unique_ptr<PointCloudBatchReader> CreateBatchReader(
+        const std::string &filename, const std::string &format) {
+    if (IsASCIIFormat(format)) {
+        auto reader = std::make_unique<ASCIIBatchReader>();
+        if (!reader->Open(filename, format)) {
+            return nullptr;
+        }
+        return std::move(reader);
+    }
+
+    std::unique_ptr<PointCloudBatchReader> reader;
+    if (format == "ply") {
+        reader = CreatePLYBatchReader(filename);
+    } else if (format == "pcd") {
+        reader = CreatePCDBatchReader(filename);
+    }
+    if (reader) {
+        return reader;
+    }
+
+    utility::LogDebug("Cannot stream {}, reading the whole file.", filename);
+    auto in_memory_reader = std::make_unique<InMemoryBatchReader>();
+    if (!in_memory_reader->Open(filename, format)) {
+        return nullptr;
+    }
+    return std::move(in_memory_reader);
+}
+
+std::unique_ptr<PointCloudBatchWriter> CreateBatchWriter(
+        const std::string &filename, const std::string &format) {
+    if (IsASCIIFormat(format)) {
+        auto writer = std::make_unique<ASCIIBatchWriter>();
+        if (!writer->Open(filename, format)) {
+            return nullptr;
+        }
+        return std::move(writer);
+    }
+    if (format == "ply") {
+        return CreatePLYBatchWriter(filename);
+    }
+    if (format == "pcd") {
+        return CreatePCDBatchWriter(filename);
+    }
+    utility::LogWarning("Point cloud format {} cannot be written in batches.",
+                        format);
+    return nullptr;
+}
+
+}  // unnamed namespace
+
+bool PointCloudReader::Open(const std::string &filename,
+                            const std::string &format,
+                            bool prefetch) {
+    Close();
+    const std::string file_format =
+            format == "auto"
+                    ? utility::filesystem::GetFileExtensionInLowerCase(filename)
+                    : format;
+    try {
+        batch_reader_ = CreateBatchReader(filename, file_format);
+    } catch (const std::exception &e) {
+        utility::LogWarning("Open {} failed with exception: {}", filename,
+                            e.what());
+        batch_reader_.reset();
+    }
+    prefetch_ = prefetch;
+    return IsOpened();
+}
+
+void PointCloudReader::Close() {
+    if (prefetched_.valid()) {
+        prefetched_.wait();
+        prefetched_ = std::future<geometry::PointCloud>();
+    }
+    batch_reader_.reset();
+    leftover_.Clear();
+    eof_ = false;
+}
+
+int64_t PointCloudReader::GetNumPoints() const {
+    if (!IsOpened()) {
+        utility::LogError("PointCloudReader is not opened.");
+    }
+    return batch_reader_->GetNumPoints();
+}
+
+geometry::PointCloud PointCloudReader::Next(int64_t max_points) {
+    if (!IsOpened()) {
+        utility::LogError("PointCloudReader is not opened.");
+    }
+    if (max_points <= 0) {
+        utility::LogError("max_points must be positive, but got {}.",
+                          max_points);
+    }
+
+    geometry::PointCloud batch = leftover_;
+    leftover_.Clear();
+    if (prefetched_.valid()) {
+        batch = Concatenate(batch, prefetched_.get());
+    }
+    if (GetLength(batch) < max_points && !eof_) {
+        batch = Concatenate(batch, ReadBatch(max_points - GetLength(batch)));
+    }
+    const int64_t length = GetLength(batch);
+    if (length > max_points) {
+        leftover_ = SlicePoints(batch, max_points, length);
+        batch = SlicePoints(batch, 0, max_points);
+    }
+
+    // Expect the same batch size in the next call.
+    if (prefetch_ && !eof_) {
+        prefetched_ = std::async(std::launch::async,
+                                 &PointCloudReader::ReadBatch, this,
+                                 max_points);
+    }
+    return length == 0 ? geometry::PointCloud() : batch;
+}
+
+geometry::PointCloud PointCloudReader::ReadBatch(int64_t max_points) {
+    geometry::PointCloud batch;
+    if (!batch_reader_->ReadBatch(max_points, batch)) {
+        utility::LogError("Failed to read a batch of points.");
+    }
+    if (GetLength(batch) < max_points) {
+        eof_ = true;
+    }
+    return batch;
+}
+
+bool PointCloudWriter::Open(const std::string &filename,
+                            const std::string &format) {
+    Close();
+    const std::string file_format =
+            format == "auto"
+                    ? utility::filesystem::GetFileExtensionInLowerCase(filename)
+                    : format;
+    try {
+        batch_writer_ = CreateBatchWriter(filename, file_format);
+    } catch (const std::exception &e) {
+        utility::LogWarning("Open {} failed with exception: {}", filename,
+                            e.what());
+        batch_writer_.reset();
+    }
+    num_points_ = 0;
+    schema_.clear();
+    return IsOpened();
+}
+
+bool PointCloudWriter::Close() {
+    if (!batch_writer_) {
+        return true;
+    }
+    bool success = false;
+    try {
+        success = batch_writer_->Close();
+    } catch (const std::exception &e) {
+        utility::LogWarning("Close failed with exception: {}", e.what());
+    }
+    batch_writer_.reset();
+    return success;
+}
+
+bool PointCloudWriter::Write(const geometry::PointCloud &batch) {
+    if (!IsOpened()) {
+        utility::LogWarning("PointCloudWriter is not opened.");
+        return false;
+    }
+    if (batch.IsEmpty()) {
+        return true;
+    }
+
+    const int64_t num_points = batch.GetPointPositions().GetLength();
+    std::map<std::string, std::pair<core::Dtype, core::SizeVector>> schema;
+    for (const auto &kv : batch.GetPointAttr()) {
+        if (kv.second.GetLength() != num_points) {
+            utility::LogWarning(
+                    "Write failed: {} has {} elements, but there are {} "
+                    "points.",
+                    kv.first, kv.second.GetLength(), num_points);
+            return false;
+        }
+        const core::SizeVector &shape = kv.second.GetShape();
+        schema.emplace(kv.first,
+                       std::make_pair(kv.second.GetDtype(),
+                                      core::SizeVector(shape.begin() + 1,
+                                                       shape.end())));
+    }
+    if (schema_.empty()) {
+        schema_ = schema;
+    } else if (schema != schema_) {
+        utility::LogWarning(
+                "Write failed: the attributes of the batch differ from the "
+                "ones of the first batch.");
+        return false;
+    }
+
+    try {
+        if (!batch_writer_->WriteBatch(batch.To(core::Device("CPU:0")))) {
+            return false;
+        }
+    } catch (const std::exception &e) {
+        utility::LogWarning("Write failed with exception: {}", e.what());
+        return false;
+    }
+    num_points_ += num_points;
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,199 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class PointCloudBatchReader
+///
+/// \brief Format-specific reader of consecutive batches of points, used by
+/// PointCloudReader.
+class PointCloudBatchReader {
+public:
+    virtual ~PointCloudBatchReader() {}
+
+    /// Number of points in the file, or -1 if it is only known at the end.
+    virtual int64_t GetNumPoints() const = 0;
+
+    /// \brief Read the next batch of points.
+    ///
+    /// The batch has max_points points, or less only at the end of the file.
+    /// \return false on failure.
+    virtual bool ReadBatch(int64_t max_points, geometry::PointCloud &batch) = 0;
+};
+
+/// \class PointCloudBatchWriter
+///
+/// \brief Format-specific writer of consecutive batches of points, used by
+/// PointCloudWriter. All the batches have the attributes of the first one.
+class PointCloudBatchWriter {
+public:
+    virtual ~PointCloudBatchWriter() {}
+
+    /// Append a non-empty batch of points on the CPU.
+    virtual bool WriteBatch(const geometry::PointCloud &batch) = 0;
+
+    /// Complete the file, e.g. store the number of points in the header.
+    virtual bool Close() = 0;
+};
+
+/// Stream the vertices of a binary PLY file. Returns nullptr if the file is
+/// not binary or has list properties in or before the vertex element.
+std::unique_ptr<PointCloudBatchReader> CreatePLYBatchReader(
+        const std::string &filename);
+
+/// Stream an ASCII or binary PCD file. Returns nullptr for other files,
+/// including binary_compressed ones, whose data is compressed as a whole.
+std::unique_ptr<PointCloudBatchReader> CreatePCDBatchReader(
+        const std::string &filename);
+
+/// Write a binary PLY file, whose header is completed on Close().
+std::unique_ptr<PointCloudBatchWriter> CreatePLYBatchWriter(
+        const std::string &filename);
+
+/// Write a binary PCD file, whose header is completed on Close().
+std::unique_ptr<PointCloudBatchWriter> CreatePCDBatchWriter(
+        const std::string &filename);
+
+/// \class PointCloudReader
+///
+/// \brief Read a point cloud file in batches of points, for files that do not
+/// fit in memory.
+///
+/// Binary PLY, ASCII and binary PCD, XYZ, XYZN, XYZRGB, XYZI and PTS files are
+/// streamed, so that only about one batch is held in memory. The attributes
+/// and their data types are the ones of ReadPointCloud(). Other files,
+/// including ASCII PLY and binary_compressed PCD files, are read as a whole
+/// with ReadPointCloud() and then returned in batches.
+///
+/// Example:
+/// \code
+/// PointCloudReader reader;
+/// if (reader.Open("scan.ply")) {
+///     for (auto batch = reader.Next(1000000); !batch.IsEmpty();
+///          batch = reader.Next(1000000)) {
+///         // Process batch.
+///     }
+/// }
+/// \endcode
+class PointCloudReader {
+public:
+    PointCloudReader() {}
+    ~PointCloudReader() { Close(); }
+    PointCloudReader(const PointCloudReader &) = delete;
+    PointCloudReader &operator=(const PointCloudReader &) = delete;
+
+    /// \brief Open a point cloud file.
+    ///
+    /// \param filename Path to the file.
+    /// \param format File format, deduced from the extension if "auto".
+    /// \param prefetch If true, the next batch is read in the background
+    /// while the current one is processed.
+    bool Open(const std::string &filename,
+              const std::string &format = "auto",
+              bool prefetch = true);
+
+    /// Close the file, waiting for the pending prefetch.
+    void Close();
+
+    bool IsOpened() const { return batch_reader_ != nullptr; }
+
+    /// Number of points in the file, or -1 if it is only known at the end.
+    int64_t GetNumPoints() const;
+
+    /// \brief Read the next batch of points.
+    ///
+    /// The batch has max_points points, except for the last one. An empty
+    /// point cloud is returned after the last batch.
+    geometry::PointCloud Next(int64_t max_points);
+
+private:
+    geometry::PointCloud ReadBatch(int64_t max_points);
+
+private:
+    std::unique_ptr<PointCloudBatchReader> batch_reader_;
+    bool prefetch_ = true;
+    /// Set once the batch reader returned a partial batch.
+    bool eof_ = false;
+    /// Points read ahead of the requested ones.
+    geometry::PointCloud leftover_;
+    std::future<geometry::PointCloud> prefetched_;
+};
+
+/// \class PointCloudWriter
+///
+/// \brief Write a point cloud file batch by batch, for point clouds that do
+/// not fit in memory.
+///
+/// Binary PLY and PCD files, and XYZ, XYZN, XYZRGB, XYZI and PTS files are
+/// supported. The number of points in the header of PLY, PCD and PTS files is
+/// written with leading zeros on Close(). All batches must have the
+/// attributes of the first one, with the same data types and shapes.
+class PointCloudWriter {
+public:
+    PointCloudWriter() {}
+    ~PointCloudWriter() { Close(); }
+    PointCloudWriter(const PointCloudWriter &) = delete;
+    PointCloudWriter &operator=(const PointCloudWriter &) = delete;
+
+    /// \brief Create a point cloud file.
+    ///
+    /// \param filename Path to the file.
+    /// \param format File format, deduced from the extension if "auto".
+    bool Open(const std::string &filename, const std::string &format = "auto");
+
+    /// Complete and close the file.
+    bool Close();
+
+    bool IsOpened() const { return batch_writer_ != nullptr; }
+
+    /// Append a batch of points.
+    bool Write(const geometry::PointCloud &batch);
+
+    /// Number of points written so far.
+    int64_t GetNumPoints() const { return num_points_; }
+
+private:
+    std::unique_ptr<PointCloudBatchWriter> batch_writer_;
+    int64_t num_points_ = 0;
+    /// Data type and shape of the attributes of the first batch, without the
+    /// number of points.
+    std::map<std::string, std::pair<core::Dtype, core::SizeVector>> schema_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
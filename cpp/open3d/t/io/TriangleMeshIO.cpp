@@ -27,6 +27,7 @@
 #include "open3d/t/io/TriangleMeshIO.h"
 
 #include <unordered_map>
+#include <unordered_set>
 
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
@@ -40,7 +41,17 @@ static const std::unordered_map<
         std::function<bool(const std::string &,
                            geometry::TriangleMesh &,
                            const open3d::io::ReadTriangleMeshOptions &)>>
-        file_extension_to_trianglemesh_read_function{};
+        file_extension_to_trianglemesh_read_function{
+                {"glb", ReadTriangleMeshFromGLTF},
+                {"gltf", ReadTriangleMeshFromGLTF},
+                {"o3dt", ReadTriangleMeshFromO3DT},
+                {"obj", ReadTriangleMeshFromOBJ},
+        };
+
+// Formats read by ASSIMP in the legacy reader, which is still used for them
+// when post-processing is requested.
+static const std::unordered_set<std::string> assimp_file_extensions{
+        "glb", "gltf", "obj"};
 
 static const std::unordered_map<
         std::string,
@@ -52,7 +63,9 @@ static const std::unordered_map<
                            const bool,
                            const bool,
                            const bool)>>
-        file_extension_to_trianglemesh_write_function{};
+        file_extension_to_trianglemesh_write_function{
+                {"o3dt", WriteTriangleMeshToO3DT},
+        };
 
 std::shared_ptr<geometry::TriangleMesh> CreateMeshFromFile(
         const std::string &filename, bool print_progress) {
@@ -90,6 +103,11 @@ bool ReadTriangleMesh(const std::string &filename,
 
     auto map_itr =
             file_extension_to_trianglemesh_read_function.find(filename_ext);
+    // Post-processing is only implemented by the ASSIMP based legacy readers.
+    if (params.enable_post_processing &&
+        assimp_file_extensions.count(filename_ext) > 0) {
+        map_itr = file_extension_to_trianglemesh_read_function.end();
+    }
     bool success = false;
     if (map_itr == file_extension_to_trianglemesh_read_function.end()) {
         open3d::geometry::TriangleMesh legacy_mesh;
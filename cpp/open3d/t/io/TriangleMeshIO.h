@@ -63,6 +63,37 @@ bool WriteTriangleMesh(const std::string &filename,
                        bool write_triangle_uvs = true,
                        bool print_progress = false);
 
+bool ReadTriangleMeshFromO3DT(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::io::ReadTriangleMeshOptions &params);
+
+/// Reads an OBJ file directly into Float32 vertex and Int64 triangle index
+/// tensors. Chunks of lines are parsed in parallel and merged afterwards.
+/// Polygons are triangulated as fans. Texture coordinates are stored as the
+/// triangle attribute "texture_uvs". Materials are not read.
+bool ReadTriangleMeshFromOBJ(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::io::ReadTriangleMeshOptions &params);
+
+/// Reads a glTF or GLB file directly into tensors. All triangle primitives of
+/// all mesh nodes are merged into \p mesh with their node transformations
+/// applied. The primitives are decoded in parallel. Textures are not read.
+bool ReadTriangleMeshFromGLTF(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::io::ReadTriangleMeshOptions &params);
+
+bool WriteTriangleMeshToO3DT(const std::string &filename,
+                             const geometry::TriangleMesh &mesh,
+                             const bool write_ascii,
+                             const bool compressed,
+                             const bool write_vertex_normals,
+                             const bool write_vertex_colors,
+                             const bool write_triangle_uvs,
+                             const bool print_progress);
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
@@ -0,0 +1,453 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// The implementation of tinygltf is compiled with io/file_format/FileGLTF.cpp.
+#undef TINYGLTF_IMPLEMENTATION
+#undef STB_IMAGE_IMPLEMENTATION
+#undef STB_IMAGE_WRITE_IMPLEMENTATION
+#include <tiny_gltf.h>
+
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+// Textures are not stored in the tensor mesh, so images are not decoded.
+bool SkipImageData(tinygltf::Image *image,
+                   const int image_idx,
+                   std::string *err,
+                   std::string *warn,
+                   int req_width,
+                   int req_height,
+                   const unsigned char *bytes,
+                   int size,
+                   void *user_data) {
+    return true;
+}
+
+// Strided view of the elements of an accessor.
+struct AccessorView {
+    const unsigned char *data_ = nullptr;
+    size_t stride_ = 0;
+    size_t count_ = 0;
+    int component_type_ = -1;
+    int num_components_ = 0;
+    bool normalized_ = false;
+
+    template <typename T>
+    T Get(size_t i, int component) const {
+        T value;
+        std::memcpy(&value, data_ + i * stride_ + component * sizeof(T),
+                    sizeof(T));
+        return value;
+    }
+
+    // Returns a component converted to float. Integer components are mapped
+    // to [0, 1] if the accessor is normalized.
+    float GetFloat(size_t i, int component) const {
+        switch (component_type_) {
+            case TINYGLTF_COMPONENT_TYPE_FLOAT:
+                return Get<float>(i, component);
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+                return normalized_ ? Get<uint8_t>(i, component) / 255.f
+                                   : Get<uint8_t>(i, component);
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+                return normalized_ ? Get<uint16_t>(i, component) / 65535.f
+                                   : Get<uint16_t>(i, component);
+            default:
+                return 0.f;
+        }
+    }
+
+    int64_t GetIndex(size_t i) const {
+        switch (component_type_) {
+            case TINYGLTF_COMPONENT_TYPE_BYTE:
+                return Get<int8_t>(i, 0);
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+                return Get<uint8_t>(i, 0);
+            case TINYGLTF_COMPONENT_TYPE_SHORT:
+                return Get<int16_t>(i, 0);
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+                return Get<uint16_t>(i, 0);
+            case TINYGLTF_COMPONENT_TYPE_INT:
+                return Get<int32_t>(i, 0);
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+                return Get<uint32_t>(i, 0);
+            default:
+                return -1;
+        }
+    }
+};
+
+// Creates a view of the accessor with the given index. Returns false if the
+// accessor is invalid or exceeds its buffer.
+bool GetAccessorView(const tinygltf::Model &model,
+                     int accessor_idx,
+                     AccessorView &view) {
+    if (accessor_idx < 0 || accessor_idx >= int(model.accessors.size())) {
+        return false;
+    }
+    const tinygltf::Accessor &accessor = model.accessors[accessor_idx];
+    if (accessor.sparse.isSparse || accessor.bufferView < 0 ||
+        accessor.bufferView >= int(model.bufferViews.size())) {
+        return false;
+    }
+    const tinygltf::BufferView &buffer_view =
+            model.bufferViews[accessor.bufferView];
+    if (buffer_view.buffer < 0 ||
+        buffer_view.buffer >= int(model.buffers.size())) {
+        return false;
+    }
+    const tinygltf::Buffer &buffer = model.buffers[buffer_view.buffer];
+    const int component_size =
+            tinygltf::GetComponentSizeInBytes(accessor.componentType);
+    const int num_components = tinygltf::GetNumComponentsInType(accessor.type);
+    const int stride = accessor.ByteStride(buffer_view);
+    if (component_size <= 0 || num_components <= 0 || stride <= 0) {
+        return false;
+    }
+    const size_t begin = buffer_view.byteOffset + accessor.byteOffset;
+    if (accessor.count > 0 &&
+        begin + (accessor.count - 1) * stride +
+                        size_t(component_size * num_components) >
+                buffer.data.size()) {
+        return false;
+    }
+    view.data_ = buffer.data.data() + begin;
+    view.stride_ = size_t(stride);
+    view.count_ = accessor.count;
+    view.component_type_ = accessor.componentType;
+    view.num_components_ = num_components;
+    view.normalized_ = accessor.normalized;
+    return true;
+}
+
+// Returns the transformation of a node relative to its parent.
+Eigen::Matrix4d GetLocalTransform(const tinygltf::Node &node) {
+    if (node.matrix.size() == 16) {
+        return Eigen::Map<const Eigen::Matrix4d>(node.matrix.data());
+    }
+    // The scale is applied first, then the rotation and then the
+    // translation.
+    Eigen::Matrix4d transform = Eigen::Matrix4d::Identity();
+    if (node.scale.size() == 3) {
+        transform.topLeftCorner<3, 3>() =
+                Eigen::Vector3d(node.scale[0], node.scale[1], node.scale[2])
+                        .asDiagonal();
+    }
+    if (node.rotation.size() == 4) {
+        // glTF orders the quaternion as qx, qy, qz, qw.
+        transform.topLeftCorner<3, 3>() =
+                Eigen::Quaterniond(node.rotation[3], node.rotation[0],
+                                   node.rotation[1], node.rotation[2])
+                        .toRotationMatrix() *
+                transform.topLeftCorner<3, 3>();
+    }
+    if (node.translation.size() == 3) {
+        transform.topRightCorner<3, 1>() = Eigen::Vector3d(
+                node.translation[0], node.translation[1], node.translation[2]);
+    }
+    return transform;
+}
+
+// A triangle primitive of a mesh node and its location in the merged mesh.
+struct PrimitiveTask {
+    const tinygltf::Primitive *primitive_;
+    // Linear part of the node transform, including its scale.
+    Eigen::Matrix3f linear_;
+    Eigen::Vector3f translation_;
+    // Inverse transpose of linear_, which maps the normals.
+    Eigen::Matrix3f normal_matrix_;
+    AccessorView positions_;
+    AccessorView normals_;
+    AccessorView colors_;
+    AccessorView uvs_;
+    AccessorView indices_;
+    bool has_indices_ = false;
+    int64_t num_indices_ = 0;
+    int64_t num_triangles_ = 0;
+    int64_t vertex_offset_ = 0;
+    int64_t triangle_offset_ = 0;
+};
+
+// Returns the vertex index of a corner of triangle i of the primitive.
+int64_t GetCornerIndex(const PrimitiveTask &task, int64_t i, int corner) {
+    int64_t pos = 0;
+    switch (task.primitive_->mode) {
+        case TINYGLTF_MODE_TRIANGLE_STRIP:
+            // Every second triangle of a strip has the opposite winding.
+            pos = i + ((i % 2 == 1 && corner < 2) ? 1 - corner : corner);
+            break;
+        case TINYGLTF_MODE_TRIANGLE_FAN:
+            pos = corner == 0 ? 0 : i + corner;
+            break;
+        default:
+            pos = 3 * i + corner;
+            break;
+    }
+    return task.has_indices_ ? task.indices_.GetIndex(size_t(pos)) : pos;
+}
+
+}  // namespace
+
+bool ReadTriangleMeshFromGLTF(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::io::ReadTriangleMeshOptions &params) {
+    tinygltf::Model model;
+    tinygltf::TinyGLTF loader;
+    loader.SetImageLoader(SkipImageData, nullptr);
+    std::string warn;
+    std::string err;
+
+    const std::string filename_ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    bool ret;
+    if (filename_ext == "glb") {
+        ret = loader.LoadBinaryFromFile(&model, &err, &warn, filename.c_str());
+    } else {
+        ret = loader.LoadASCIIFromFile(&model, &err, &warn, filename.c_str());
+    }
+    if (!ret) {
+        utility::LogWarning("Read GLTF failed: unable to open file {}: {}",
+                            filename, err);
+        return false;
+    }
+
+    // Compose the transformations along the node hierarchy.
+    std::vector<int> parents(model.nodes.size(), -1);
+    for (size_t n = 0; n < model.nodes.size(); ++n) {
+        for (int child : model.nodes[n].children) {
+            if (child >= 0 && child < int(model.nodes.size())) {
+                parents[child] = int(n);
+            }
+        }
+    }
+    auto get_global_transform = [&](int n) {
+        Eigen::Matrix4d transform = GetLocalTransform(model.nodes[n]);
+        for (int p = parents[n], depth = 0;
+             p >= 0 && depth < int(model.nodes.size());
+             p = parents[p], ++depth) {
+            transform = GetLocalTransform(model.nodes[p]) * transform;
+        }
+        return transform;
+    };
+
+    // Collect the triangle primitives of all mesh nodes and their offsets in
+    // the merged mesh.
+    std::vector<PrimitiveTask> tasks;
+    int64_t num_vertices = 0;
+    int64_t num_triangles = 0;
+    bool has_normals = true;
+    bool has_colors = true;
+    bool has_uvs = true;
+    for (size_t n = 0; n < model.nodes.size(); ++n) {
+        const int mesh_idx = model.nodes[n].mesh;
+        if (mesh_idx < 0 || mesh_idx >= int(model.meshes.size())) continue;
+        const Eigen::Matrix4d transform = get_global_transform(int(n));
+        for (const tinygltf::Primitive &primitive :
+             model.meshes[mesh_idx].primitives) {
+            if (primitive.mode != TINYGLTF_MODE_TRIANGLES &&
+                primitive.mode != TINYGLTF_MODE_TRIANGLE_STRIP &&
+                primitive.mode != TINYGLTF_MODE_TRIANGLE_FAN) {
+                utility::LogInfo(
+                        "Skipping non-triangle primitive geometry of mode {}",
+                        primitive.mode);
+                continue;
+            }
+            PrimitiveTask task;
+            task.primitive_ = &primitive;
+            const Eigen::Matrix3d linear = transform.topLeftCorner<3, 3>();
+            task.linear_ = linear.cast<float>();
+            task.translation_ = transform.topRightCorner<3, 1>().cast<float>();
+            task.normal_matrix_ = linear.inverse().transpose().cast<float>();
+            auto attribute = [&primitive](const std::string &name) {
+                auto it = primitive.attributes.find(name);
+                return it == primitive.attributes.end() ? -1 : it->second;
+            };
+            if (!GetAccessorView(model, attribute("POSITION"),
+                                 task.positions_) ||
+                task.positions_.component_type_ !=
+                        TINYGLTF_COMPONENT_TYPE_FLOAT ||
+                task.positions_.num_components_ != 3) {
+                utility::LogWarning(
+                        "Read GLTF failed: invalid vertex positions in {}",
+                        filename);
+                return false;
+            }
+            has_normals = has_normals &&
+                          GetAccessorView(model, attribute("NORMAL"),
+                                          task.normals_) &&
+                          task.normals_.component_type_ ==
+                                  TINYGLTF_COMPONENT_TYPE_FLOAT &&
+                          task.normals_.count_ == task.positions_.count_;
+            has_colors = has_colors &&
+                         GetAccessorView(model, attribute("COLOR_0"),
+                                         task.colors_) &&
+                         task.colors_.num_components_ >= 3 &&
+                         task.colors_.count_ == task.positions_.count_;
+            has_uvs = has_uvs &&
+                      GetAccessorView(model, attribute("TEXCOORD_0"),
+                                      task.uvs_) &&
+                      task.uvs_.num_components_ == 2 &&
+                      task.uvs_.count_ == task.positions_.count_;
+            // Colors are always normalized unless they are floats.
+            task.colors_.normalized_ = true;
+            task.uvs_.normalized_ = true;
+
+            task.has_indices_ = primitive.indices >= 0;
+            if (task.has_indices_) {
+                if (!GetAccessorView(model, primitive.indices,
+                                     task.indices_)) {
+                    utility::LogWarning(
+                            "Read GLTF failed: invalid triangle indices in {}",
+                            filename);
+                    return false;
+                }
+                task.num_indices_ = int64_t(task.indices_.count_);
+            } else {
+                task.num_indices_ = int64_t(task.positions_.count_);
+            }
+            task.num_triangles_ =
+                    primitive.mode == TINYGLTF_MODE_TRIANGLES
+                            ? task.num_indices_ / 3
+                            : std::max(int64_t(0), task.num_indices_ - 2);
+            task.vertex_offset_ = num_vertices;
+            task.triangle_offset_ = num_triangles;
+            num_vertices += int64_t(task.positions_.count_);
+            num_triangles += task.num_triangles_;
+            tasks.push_back(task);
+        }
+    }
+
+    mesh.Clear();
+    if (tasks.empty()) {
+        return true;
+    }
+    core::Tensor positions({num_vertices, 3}, core::Float32);
+    core::Tensor normals, colors, texture_uvs;
+    if (has_normals) normals = core::Tensor({num_vertices, 3}, core::Float32);
+    if (has_colors) colors = core::Tensor({num_vertices, 3}, core::Float32);
+    if (has_uvs) {
+        texture_uvs = core::Tensor({num_triangles, 3, 2}, core::Float32);
+    }
+    core::Tensor indices({num_triangles, 3}, core::Int64);
+
+    // Decode the primitives in parallel directly into the merged tensors.
+    std::atomic<bool> out_of_range(false);
+    const int64_t num_tasks = int64_t(tasks.size());
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t t = 0; t < num_tasks; ++t) {
+        const PrimitiveTask &task = tasks[t];
+        const int64_t count = int64_t(task.positions_.count_);
+        float *positions_ptr =
+                positions.GetDataPtr<float>() + task.vertex_offset_ * 3;
+        for (int64_t i = 0; i < count; ++i) {
+            Eigen::Map<Eigen::Vector3f>(positions_ptr + i * 3) =
+                    task.linear_ *
+                            Eigen::Vector3f(task.positions_.Get<float>(i, 0),
+                                            task.positions_.Get<float>(i, 1),
+                                            task.positions_.Get<float>(i, 2)) +
+                    task.translation_;
+        }
+        if (has_normals) {
+            float *normals_ptr =
+                    normals.GetDataPtr<float>() + task.vertex_offset_ * 3;
+            for (int64_t i = 0; i < count; ++i) {
+                Eigen::Map<Eigen::Vector3f>(normals_ptr + i * 3) =
+                        (task.normal_matrix_ *
+                         Eigen::Vector3f(task.normals_.Get<float>(i, 0),
+                                         task.normals_.Get<float>(i, 1),
+                                         task.normals_.Get<float>(i, 2)))
+                                .normalized();
+            }
+        }
+        if (has_colors) {
+            float *colors_ptr =
+                    colors.GetDataPtr<float>() + task.vertex_offset_ * 3;
+            for (int64_t i = 0; i < count; ++i) {
+                for (int c = 0; c < 3; ++c) {
+                    colors_ptr[i * 3 + c] = task.colors_.GetFloat(i, c);
+                }
+            }
+        }
+
+        int64_t *indices_ptr =
+                indices.GetDataPtr<int64_t>() + task.triangle_offset_ * 3;
+        float *uvs_ptr = has_uvs ? texture_uvs.GetDataPtr<float>() +
+                                           task.triangle_offset_ * 6
+                                 : nullptr;
+        for (int64_t i = 0; i < task.num_triangles_; ++i) {
+            for (int corner = 0; corner < 3; ++corner) {
+                const int64_t index = GetCornerIndex(task, i, corner);
+                if (index < 0 || index >= count) {
+                    out_of_range = true;
+                    break;
+                }
+                indices_ptr[i * 3 + corner] = index + task.vertex_offset_;
+                if (uvs_ptr) {
+                    // glTF places the origin of the texture coordinates at the
+                    // top left corner, Open3D at the bottom left corner.
+                    uvs_ptr[i * 6 + corner * 2 + 0] =
+                            task.uvs_.GetFloat(index, 0);
+                    uvs_ptr[i * 6 + corner * 2 + 1] =
+                            1.f - task.uvs_.GetFloat(index, 1);
+                }
+            }
+        }
+    }
+    if (out_of_range) {
+        utility::LogWarning("Read GLTF failed: index out of range in file {}",
+                            filename);
+        return false;
+    }
+
+    mesh.SetVertexPositions(positions);
+    if (has_normals) mesh.SetVertexNormals(normals);
+    if (has_colors) mesh.SetVertexColors(colors);
+    if (num_triangles > 0) {
+        mesh.SetTriangleIndices(indices);
+        if (has_uvs) mesh.SetTriangleAttr("texture_uvs", texture_uvs);
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
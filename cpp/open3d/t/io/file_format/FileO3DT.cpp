@@ -0,0 +1,147 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/O3DTIO.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+bool ReadPointCloudFromO3DT(const std::string &filename,
+                            geometry::PointCloud &pointcloud,
+                            const ReadPointCloudOption &params) {
+    try {
+        const auto groups = ReadO3DT(filename);
+        auto it = groups.find("point");
+        if (it == groups.end()) {
+            utility::LogWarning("Read O3DT failed: {} has no point cloud.",
+                                filename);
+            return false;
+        }
+        if (it->second.empty()) {
+            pointcloud.Clear();
+        } else {
+            // Required checks are performed in the pointcloud constructor.
+            pointcloud = geometry::PointCloud(it->second);
+        }
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read O3DT failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+bool WritePointCloudToO3DT(const std::string &filename,
+                           const geometry::PointCloud &pointcloud,
+                           const WritePointCloudOption &params) {
+    if (bool(params.write_ascii)) {
+        utility::LogWarning(
+                "Write O3DT failed: PointCloud can't be saved in ASCII "
+                "format as .o3dt.");
+        return false;
+    }
+    try {
+        WriteO3DTOption option;
+        option.compressed = bool(params.compressed);
+        WriteO3DT(filename, {{"point", pointcloud.GetPointAttr()}}, option);
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Write O3DT failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+bool ReadTriangleMeshFromO3DT(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::io::ReadTriangleMeshOptions &params) {
+    try {
+        const auto groups = ReadO3DT(filename);
+        auto vertex_it = groups.find("vertex");
+        auto triangle_it = groups.find("triangle");
+        if (vertex_it == groups.end() || triangle_it == groups.end()) {
+            utility::LogWarning("Read O3DT failed: {} has no triangle mesh.",
+                                filename);
+            return false;
+        }
+        mesh = geometry::TriangleMesh();
+        for (const auto &kv : vertex_it->second) {
+            mesh.SetVertexAttr(kv.first, kv.second);
+        }
+        for (const auto &kv : triangle_it->second) {
+            mesh.SetTriangleAttr(kv.first, kv.second);
+        }
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read O3DT failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+bool WriteTriangleMeshToO3DT(const std::string &filename,
+                             const geometry::TriangleMesh &mesh,
+                             const bool write_ascii,
+                             const bool compressed,
+                             const bool write_vertex_normals,
+                             const bool write_vertex_colors,
+                             const bool write_triangle_uvs,
+                             const bool print_progress) {
+    if (write_ascii) {
+        utility::LogWarning(
+                "Write O3DT failed: TriangleMesh can't be saved in ASCII "
+                "format as .o3dt.");
+        return false;
+    }
+    try {
+        geometry::TensorMap vertex_attr = mesh.GetVertexAttr();
+        if (!write_vertex_normals && vertex_attr.Contains("normals")) {
+            vertex_attr.Erase("normals");
+        }
+        if (!write_vertex_colors && vertex_attr.Contains("colors")) {
+            vertex_attr.Erase("colors");
+        }
+        geometry::TensorMap triangle_attr = mesh.GetTriangleAttr();
+        if (!write_triangle_uvs && triangle_attr.Contains("texture_uvs")) {
+            triangle_attr.Erase("texture_uvs");
+        }
+        WriteO3DTOption option;
+        option.compressed = compressed;
+        WriteO3DT(filename,
+                  {{"vertex", vertex_attr}, {"triangle", triangle_attr}},
+                  option);
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Write O3DT failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,446 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/io/file_format/ASCIIRowsIO.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+inline bool IsSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// Parse a signed integer in [ptr, end). On success, ptr is advanced past the
+// number.
+bool ParseIndex(const char *&ptr, const char *end, int64_t &value) {
+    const char *p = ptr;
+    bool negative = false;
+    if (p < end && (*p == '+' || *p == '-')) {
+        negative = *p == '-';
+        ++p;
+    }
+    if (p == end || *p < '0' || *p > '9') {
+        return false;
+    }
+    value = 0;
+    for (; p < end && *p >= '0' && *p <= '9'; ++p) {
+        value = value * 10 + (*p - '0');
+    }
+    if (negative) value = -value;
+    ptr = p;
+    return true;
+}
+
+// Element lists of an OBJ file, which are referenced by the face corners.
+enum Element { kVertex = 0, kTexCoord = 1, kNormal = 2, kNumElements = 3 };
+
+struct OBJChunk {
+    std::vector<float> positions_;
+    std::vector<float> colors_;
+    std::vector<float> texcoords_;
+    std::vector<float> normals_;
+    // Number of elements defined in the chunk.
+    int64_t counts_[kNumElements] = {0, 0, 0};
+    // Indices of the triangle corners per element, or -1 if not given. Indices
+    // in relative notation are local to the chunk until the offsets of the
+    // previous chunks are known.
+    std::vector<int64_t> corners_[kNumElements];
+    std::vector<int64_t> relative_corners_[kNumElements];
+    // Number of corners without texture coordinates or normals.
+    int64_t num_missing_[kNumElements] = {0, 0, 0};
+    bool failed_ = false;
+    std::string failed_line_;
+};
+
+// Parse a face corner 'v', 'v/vt', 'v//vn' or 'v/vt/vn'. Relative indices are
+// converted to chunk-local indices.
+bool ParseCorner(const char *&ptr,
+                 const char *end,
+                 const OBJChunk &chunk,
+                 int64_t (&corner)[kNumElements],
+                 bool (&relative)[kNumElements]) {
+    std::fill(corner, corner + kNumElements, -1);
+    std::fill(relative, relative + kNumElements, false);
+    for (int e = 0; e < kNumElements; ++e) {
+        if (e > 0) {
+            if (ptr == end || *ptr != '/') break;
+            ++ptr;
+            // Empty texture coordinate index in 'v//vn'.
+            if (e == kTexCoord && ptr < end && *ptr == '/') continue;
+        }
+        int64_t index;
+        if (!ParseIndex(ptr, end, index) || index == 0) {
+            return false;
+        }
+        if (index > 0) {
+            corner[e] = index - 1;
+        } else {
+            corner[e] = chunk.counts_[e] + index;
+            relative[e] = true;
+        }
+    }
+    return ptr == end || IsSpace(*ptr);
+}
+
+// Parse [begin, end), which only contains complete lines.
+void ParseChunk(const char *begin, const char *end, OBJChunk &chunk) {
+    std::vector<float> values;
+    std::vector<int64_t> polygon[kNumElements];
+    std::vector<char> polygon_relative[kNumElements];
+    const char *line = begin;
+    while (line < end) {
+        const char *line_end =
+                static_cast<const char *>(std::memchr(line, '\n', end - line));
+        if (!line_end) {
+            line_end = end;
+        }
+        const char *ptr = line;
+        while (ptr < line_end && IsSpace(*ptr)) ++ptr;
+        bool ok = true;
+        if (ptr + 1 < line_end && ptr[0] == 'v' &&
+            (IsSpace(ptr[1]) || ptr[1] == 't' || ptr[1] == 'n')) {
+            // Vertex data 'v x y z [r g b]', 'vt u v [w]' or 'vn x y z'.
+            const char type = IsSpace(ptr[1]) ? ' ' : ptr[1];
+            ptr += type == ' ' ? 1 : 2;
+            values.clear();
+            double value;
+            while (true) {
+                while (ptr < line_end && IsSpace(*ptr)) ++ptr;
+                if (ptr == line_end || !open3d::io::ParseDouble(ptr, line_end,
+                                                                value)) {
+                    break;
+                }
+                values.push_back(float(value));
+            }
+            if (type == ' ' && (values.size() == 3 || values.size() == 4 ||
+                                values.size() == 6)) {
+                chunk.positions_.insert(chunk.positions_.end(), values.begin(),
+                                        values.begin() + 3);
+                if (values.size() == 6) {
+                    chunk.colors_.insert(chunk.colors_.end(),
+                                         values.begin() + 3, values.end());
+                }
+                ++chunk.counts_[kVertex];
+            } else if (type == 't' && values.size() >= 1 &&
+                       values.size() <= 3) {
+                chunk.texcoords_.push_back(values[0]);
+                chunk.texcoords_.push_back(values.size() > 1 ? values[1] : 0.f);
+                ++chunk.counts_[kTexCoord];
+            } else if (type == 'n' && values.size() == 3) {
+                chunk.normals_.insert(chunk.normals_.end(), values.begin(),
+                                      values.end());
+                ++chunk.counts_[kNormal];
+            } else {
+                ok = false;
+            }
+        } else if (ptr + 1 < line_end && ptr[0] == 'f' && IsSpace(ptr[1])) {
+            // Polygons are triangulated as a fan around the first corner.
+            ++ptr;
+            for (int e = 0; e < kNumElements; ++e) {
+                polygon[e].clear();
+                polygon_relative[e].clear();
+            }
+            while (ok) {
+                while (ptr < line_end && IsSpace(*ptr)) ++ptr;
+                if (ptr == line_end) break;
+                int64_t corner[kNumElements];
+                bool relative[kNumElements];
+                ok = ParseCorner(ptr, line_end, chunk, corner, relative);
+                for (int e = 0; ok && e < kNumElements; ++e) {
+                    polygon[e].push_back(corner[e]);
+                    polygon_relative[e].push_back(relative[e]);
+                }
+            }
+            ok = ok && polygon[kVertex].size() >= 3;
+            for (size_t i = 2; ok && i < polygon[kVertex].size(); ++i) {
+                for (int e = 0; e < kNumElements; ++e) {
+                    for (size_t c : {size_t(0), i - 1, i}) {
+                        if (polygon_relative[e][c]) {
+                            chunk.relative_corners_[e].push_back(
+                                    chunk.corners_[e].size());
+                        }
+                        // Relative indices into previous chunks are also
+                        // negative here.
+                        if (polygon[e][c] < 0 && !polygon_relative[e][c]) {
+                            ++chunk.num_missing_[e];
+                        }
+                        chunk.corners_[e].push_back(polygon[e][c]);
+                    }
+                }
+            }
+        }
+        // Other statements, e.g., groups, materials and comments, are
+        // ignored.
+        if (!ok) {
+            chunk.failed_ = true;
+            chunk.failed_line_.assign(line, line_end);
+            return;
+        }
+        line = line_end + 1;
+    }
+}
+
+}  // namespace
+
+bool ReadTriangleMeshFromOBJ(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::io::ReadTriangleMeshOptions &params) {
+    std::vector<char> data;
+    std::string error_str;
+    if (!utility::filesystem::FReadToBuffer(filename, data, &error_str)) {
+        utility::LogWarning("Read OBJ failed: unable to read file {}: {}",
+                            filename, error_str);
+        return false;
+    }
+
+    // Split the file at line boundaries into chunks, which are parsed in
+    // parallel.
+    const int64_t kChunkSize = 1 << 20;
+    const int num_threads = utility::EstimateMaxThreads();
+    const size_t size = data.size();
+    const int64_t num_chunks =
+            std::max(int64_t(1), std::min(int64_t(num_threads) * 4,
+                                          int64_t(size) / kChunkSize + 1));
+    std::vector<size_t> bounds(num_chunks + 1, size);
+    bounds[0] = 0;
+    for (int64_t c = 1; c < num_chunks; ++c) {
+        size_t pos = std::max(bounds[c - 1], size_t(size * c / num_chunks));
+        while (pos > 0 && pos < size && data[pos - 1] != '\n') {
+            ++pos;
+        }
+        bounds[c] = pos;
+    }
+
+    std::vector<OBJChunk> chunks(num_chunks);
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        ParseChunk(data.data() + bounds[c], data.data() + bounds[c + 1],
+                   chunks[c]);
+    }
+
+    // Offsets of the chunks in the merged element and corner lists.
+    std::vector<int64_t> offsets[kNumElements];
+    std::vector<int64_t> corner_offsets(num_chunks + 1, 0);
+    int64_t num_colors = 0;
+    int64_t num_missing[kNumElements] = {0, 0, 0};
+    for (int e = 0; e < kNumElements; ++e) {
+        offsets[e].assign(num_chunks + 1, 0);
+    }
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        if (chunks[c].failed_) {
+            utility::LogWarning("Read OBJ failed: unable to parse line: {}",
+                                chunks[c].failed_line_);
+            return false;
+        }
+        for (int e = 0; e < kNumElements; ++e) {
+            offsets[e][c + 1] = offsets[e][c] + chunks[c].counts_[e];
+            num_missing[e] += chunks[c].num_missing_[e];
+        }
+        corner_offsets[c + 1] =
+                corner_offsets[c] + int64_t(chunks[c].corners_[kVertex].size());
+        num_colors += int64_t(chunks[c].colors_.size()) / 3;
+    }
+    const int64_t num_vertices = offsets[kVertex][num_chunks];
+    const int64_t num_corners = corner_offsets[num_chunks];
+    const int64_t num_elements[kNumElements] = {
+            num_vertices, offsets[kTexCoord][num_chunks],
+            offsets[kNormal][num_chunks]};
+
+    mesh.Clear();
+    core::Tensor positions({num_vertices, 3}, core::Float32);
+    core::Tensor indices({num_corners / 3, 3}, core::Int64);
+    // Texture coordinates are stored per triangle corner and only if all
+    // corners have them.
+    const bool has_uvs = num_corners > 0 && !num_missing[kTexCoord];
+    core::Tensor texture_uvs;
+    if (has_uvs) {
+        texture_uvs = core::Tensor({num_corners / 3, 3, 2}, core::Float32);
+    }
+    std::vector<float> texcoords(num_elements[kTexCoord] * 2);
+    std::vector<float> normals(num_elements[kNormal] * 3);
+    // Normal index per triangle corner, used for assigning vertex normals.
+    std::vector<int64_t> normal_ids(num_missing[kNormal] ? 0 : num_corners);
+    float *positions_ptr = positions.GetDataPtr<float>();
+    int64_t *indices_ptr = indices.GetDataPtr<int64_t>();
+
+    std::atomic<bool> out_of_range(false);
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        OBJChunk &chunk = chunks[c];
+        std::copy(chunk.positions_.begin(), chunk.positions_.end(),
+                  positions_ptr + offsets[kVertex][c] * 3);
+        std::copy(chunk.texcoords_.begin(), chunk.texcoords_.end(),
+                  texcoords.begin() + offsets[kTexCoord][c] * 2);
+        std::copy(chunk.normals_.begin(), chunk.normals_.end(),
+                  normals.begin() + offsets[kNormal][c] * 3);
+        // Missing texture coordinates and normals are stored as -1, which is
+        // only valid if the index was not given in relative notation.
+        bool valid = true;
+        for (int e = 0; e < kNumElements; ++e) {
+            for (int64_t i : chunk.relative_corners_[e]) {
+                chunk.corners_[e][i] += offsets[e][c];
+                valid = valid && chunk.corners_[e][i] >= 0;
+            }
+            for (int64_t index : chunk.corners_[e]) {
+                valid = valid && index < num_elements[e] &&
+                        (index >= 0 || e != kVertex);
+            }
+        }
+        if (!valid) {
+            out_of_range = true;
+            continue;
+        }
+        std::copy(chunk.corners_[kVertex].begin(),
+                  chunk.corners_[kVertex].end(),
+                  indices_ptr + corner_offsets[c]);
+        if (!normal_ids.empty()) {
+            std::copy(chunk.corners_[kNormal].begin(),
+                      chunk.corners_[kNormal].end(),
+                      normal_ids.begin() + corner_offsets[c]);
+        }
+    }
+    if (out_of_range) {
+        utility::LogWarning("Read OBJ failed: index out of range in file {}",
+                            filename);
+        return false;
+    }
+
+    if (has_uvs) {
+        float *uvs_ptr = texture_uvs.GetDataPtr<float>();
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+        for (int64_t c = 0; c < num_chunks; ++c) {
+            const std::vector<int64_t> &ids = chunks[c].corners_[kTexCoord];
+            float *dst = uvs_ptr + corner_offsets[c] * 2;
+            for (size_t i = 0; i < ids.size(); ++i) {
+                dst[2 * i + 0] = texcoords[2 * ids[i] + 0];
+                dst[2 * i + 1] = texcoords[2 * ids[i] + 1];
+            }
+        }
+    }
+
+    const bool has_colors = num_colors == num_vertices && num_vertices > 0;
+    core::Tensor colors;
+    if (has_colors) {
+        colors = core::Tensor({num_vertices, 3}, core::Float32);
+        float *colors_ptr = colors.GetDataPtr<float>();
+        int64_t offset = 0;
+        for (const OBJChunk &chunk : chunks) {
+            std::copy(chunk.colors_.begin(), chunk.colors_.end(),
+                      colors_ptr + offset);
+            offset += int64_t(chunk.colors_.size());
+        }
+    }
+
+    // A vertex referenced with different normals, e.g., at the edges of a
+    // cube with one normal per face, is split into one vertex per normal, as
+    // ASSIMP does when joining identical vertices. Vertex normals are only
+    // kept if all vertices are referenced by a face.
+    std::vector<int64_t> vertex_normal_ids;
+    if (!normal_ids.empty()) {
+        vertex_normal_ids.assign(num_vertices, -1);
+        for (int64_t i = 0; i < num_corners; ++i) {
+            int64_t &normal_id = vertex_normal_ids[indices_ptr[i]];
+            if (normal_id < 0) {
+                normal_id = normal_ids[i];
+            }
+        }
+    }
+    if (!vertex_normal_ids.empty() &&
+        std::find(vertex_normal_ids.begin(), vertex_normal_ids.end(), -1) ==
+                vertex_normal_ids.end()) {
+        // Source vertex of each split vertex.
+        std::vector<int64_t> split_vertices;
+        // (vertex, normal) -> split vertex.
+        std::unordered_map<int64_t, int64_t> split_ids;
+        for (int64_t i = 0; i < num_corners; ++i) {
+            const int64_t v = indices_ptr[i];
+            if (normal_ids[i] == vertex_normal_ids[v]) {
+                continue;
+            }
+            auto result = split_ids.emplace(
+                    v * num_elements[kNormal] + normal_ids[i],
+                    num_vertices + int64_t(split_vertices.size()));
+            if (result.second) {
+                split_vertices.push_back(v);
+                vertex_normal_ids.push_back(normal_ids[i]);
+            }
+            indices_ptr[i] = result.first->second;
+        }
+        if (!split_vertices.empty()) {
+            std::vector<int64_t> sources(num_vertices);
+            std::iota(sources.begin(), sources.end(), 0);
+            sources.insert(sources.end(), split_vertices.begin(),
+                           split_vertices.end());
+            core::Tensor sources_t(sources, {int64_t(sources.size())},
+                                   core::Int64);
+            positions = positions.IndexGet({sources_t});
+            if (has_colors) {
+                colors = colors.IndexGet({sources_t});
+            }
+        }
+        const int64_t num_split_vertices = int64_t(vertex_normal_ids.size());
+        core::Tensor vertex_normals({num_split_vertices, 3}, core::Float32);
+        float *vertex_normals_ptr = vertex_normals.GetDataPtr<float>();
+        for (int64_t v = 0; v < num_split_vertices; ++v) {
+            std::copy(normals.begin() + vertex_normal_ids[v] * 3,
+                      normals.begin() + vertex_normal_ids[v] * 3 + 3,
+                      vertex_normals_ptr + v * 3);
+        }
+        mesh.SetVertexNormals(vertex_normals);
+    }
+
+    mesh.SetVertexPositions(positions);
+    if (has_colors) {
+        mesh.SetVertexColors(colors);
+    }
+    if (num_corners > 0) {
+        mesh.SetTriangleIndices(indices);
+        if (has_uvs) {
+            mesh.SetTriangleAttr("texture_uvs", texture_uvs);
+        }
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -26,9 +26,12 @@
 
 #include <liblzf/lzf.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cinttypes>
 #include <cstdint>
 #include <cstdio>
+#include <limits>
 #include <sstream>
 
 #include "open3d/core/Dtype.h"
@@ -36,6 +39,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/PointCloudStreamIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
@@ -76,6 +80,9 @@ public:
     // helper variables
     int elementnum;
     int pointsize;
+    // Size of the independently compressed LZF blocks of binary_compressed
+    // data, or 0 if unknown.
+    int lzf_block_size = 0;
     std::unordered_map<std::string, bool> has_attr;
     std::unordered_map<std::string, core::Dtype> attr_dtype;
 };
@@ -224,6 +231,9 @@ static bool ReadPCDHeader(FILE *file, PCDHeader &header) {
         std::string line_type;
         sstream >> line_type;
         if (line_type.substr(0, 1) == "#") {
+            if (st.size() >= 3 && st[0] == "#" && st[1] == "lzf_block_size") {
+                header.lzf_block_size = std::atoi(st[2].c_str());
+            }
         } else if (line_type.substr(0, 7) == "VERSION") {
             if (st.size() >= 2) {
                 header.version = st[1];
@@ -432,40 +442,136 @@ static void ReadASCIIPCDElementsFromField(ReadAttributePtr &attr,
             });
 }
 
-static void ReadBinaryPCDColorsFromField(ReadAttributePtr &attr,
-                                         const PCLPointField &field,
-                                         const void *data_ptr,
-                                         const int index) {
-    std::uint8_t *attr_data_ptr = static_cast<std::uint8_t *>(attr.data_ptr_) +
-                                  index * attr.row_length_;
-
-    if (field.size == 4) {
-        std::uint8_t data[4] = {0};
-        std::memcpy(data, data_ptr, 4 * sizeof(std::uint8_t));
+// Copy of a binary field to its attribute.
+struct PCDFieldCopy {
+    // The field of point i is at src_offset_ + i * src_stride_.
+    int64_t src_offset_;
+    int64_t src_stride_;
+    int size_;
+    // Copied to dst_ + i * dst_stride_, or unpacked to 3 UInt8 for colors.
+    char *dst_;
+    int64_t dst_stride_;
+    bool is_color_;
+};
 
-        // color data is packed in BGR order.
-        attr_data_ptr[0] = data[2];
-        attr_data_ptr[1] = data[1];
-        attr_data_ptr[2] = data[0];
-    } else {
-        attr_data_ptr[0] = 0;
-        attr_data_ptr[1] = 0;
-        attr_data_ptr[2] = 0;
+// Fields are either interleaved in records (binary) or stored one after the
+// other (binary_compressed).
+static std::vector<PCDFieldCopy> GetPCDFieldCopies(
+        const PCDHeader &header,
+        const std::unordered_map<std::string, ReadAttributePtr> &attr_ptrs,
+        bool interleaved) {
+    std::vector<PCDFieldCopy> copies;
+    for (const auto &field : header.fields) {
+        PCDFieldCopy copy;
+        copy.src_offset_ = interleaved ? field.offset
+                                       : int64_t(field.offset) * header.points;
+        copy.src_stride_ =
+                interleaved ? header.pointsize : field.size * field.count;
+        copy.size_ = field.size;
+        copy.is_color_ = field.name == "rgb" || field.name == "rgba";
+        auto it = attr_ptrs.find(copy.is_color_ ? "colors" : field.name);
+        if (it == attr_ptrs.end()) {
+            continue;
+        }
+        const ReadAttributePtr &attr = it->second;
+        copy.dst_ = static_cast<char *>(attr.data_ptr_) +
+                    int64_t(attr.row_idx_) * field.size;
+        copy.dst_stride_ = int64_t(attr.row_length_) *
+                           (copy.is_color_ ? 1 : field.size);
+        copies.push_back(copy);
     }
+    return copies;
 }
 
-static void ReadBinaryPCDElementsFromField(ReadAttributePtr &attr,
-                                           const PCLPointField &field,
-                                           const void *data_ptr,
-                                           const int index) {
-    DISPATCH_DTYPE_TO_TEMPLATE(
-            GetDtypeFromPCDHeaderField(field.type, field.size), [&] {
-                scalar_t *attr_data_ptr =
-                        static_cast<scalar_t *>(attr.data_ptr_) +
-                        index * attr.row_length_ + attr.row_idx_;
+// Copy the fields of num_points points starting at point first in parallel.
+static void CopyPCDFields(const char *src,
+                          int64_t first,
+                          int64_t num_points,
+                          const std::vector<PCDFieldCopy> &copies) {
+    core::ParallelFor(core::Device("CPU:0"), num_points, [&](int64_t i) {
+        for (const PCDFieldCopy &copy : copies) {
+            const char *field_src =
+                    src + copy.src_offset_ + i * copy.src_stride_;
+            char *field_dst = copy.dst_ + (first + i) * copy.dst_stride_;
+            if (!copy.is_color_) {
+                std::memcpy(field_dst, field_src, copy.size_);
+            } else if (copy.size_ == 4) {
+                // color data is packed in BGR order.
+                field_dst[0] = field_src[2];
+                field_dst[1] = field_src[1];
+                field_dst[2] = field_src[0];
+            } else {
+                field_dst[0] = 0;
+                field_dst[1] = 0;
+                field_dst[2] = 0;
+            }
+        }
+    });
+}
 
-                std::memcpy(attr_data_ptr, data_ptr, sizeof(scalar_t));
-            });
+// Blocks that were compressed independently, see CompressLZF(), are
+// decompressed in parallel. Their boundaries in the compressed data are found
+// by scanning the LZF tokens, which is much faster than decompressing them.
+static bool DecompressLZF(const char *in,
+                          std::uint32_t in_size,
+                          char *out,
+                          std::uint32_t out_size,
+                          int64_t block_size) {
+    std::vector<int64_t> block_begins;
+    if (block_size > 0 && out_size > block_size) {
+        const std::uint8_t *in_begin = reinterpret_cast<const uint8_t *>(in);
+        const std::uint8_t *ip = in_begin;
+        const std::uint8_t *in_end = in_begin + in_size;
+        int64_t out_pos = 0;
+        int64_t next_begin = block_size;
+        block_begins.push_back(0);
+        while (ip < in_end && out_pos < out_size) {
+            const unsigned int ctrl = *ip++;
+            if (ctrl < 32) {
+                // Literal run.
+                ip += ctrl + 1;
+                out_pos += ctrl + 1;
+            } else {
+                // Back reference.
+                unsigned int length = ctrl >> 5;
+                if (length == 7 && ip < in_end) {
+                    length += *ip++;
+                }
+                ++ip;
+                out_pos += length + 2;
+            }
+            if (out_pos == next_begin && out_pos < out_size) {
+                block_begins.push_back(ip - in_begin);
+                next_begin += block_size;
+            } else if (out_pos > next_begin) {
+                // Not compressed in blocks.
+                block_begins.clear();
+                break;
+            }
+        }
+    }
+
+    const int64_t num_blocks = block_begins.size();
+    if (num_blocks < 2 ||
+        num_blocks != (int64_t(out_size) + block_size - 1) / block_size) {
+        return lzf_decompress(in, in_size, out, out_size) == out_size;
+    }
+    block_begins.push_back(in_size);
+    std::atomic<bool> success(true);
+    core::ParallelFor(core::Device("CPU:0"), num_blocks, [&](int64_t b) {
+        const int64_t out_begin = b * block_size;
+        const unsigned int length = static_cast<unsigned int>(
+                std::min(block_size, int64_t(out_size) - out_begin));
+        if (lzf_decompress(in + block_begins[b],
+                           static_cast<unsigned int>(block_begins[b + 1] -
+                                                     block_begins[b]),
+                           out + out_begin, length) != length) {
+            success = false;
+        }
+    });
+    // Back references across the blocks are errors in parallel.
+    return success ||
+           lzf_decompress(in, in_size, out, out_size) == out_size;
 }
 
 static bool ReadPCDData(FILE *file,
@@ -544,8 +650,8 @@ static bool ReadPCDData(FILE *file,
     if (header.datatype == PCDDataType::ASCII) {
         char line_buffer[DEFAULT_IO_BUFFER_SIZE];
         int idx = 0;
-        while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file) &&
-               idx < header.points) {
+        while (idx < header.points &&
+               fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
             std::string line(line_buffer);
             std::vector<std::string> strs =
                     utility::SplitString(line, "\t\r\n ");
@@ -570,28 +676,25 @@ static bool ReadPCDData(FILE *file,
             }
         }
     } else if (header.datatype == PCDDataType::BINARY) {
-        std::unique_ptr<char[]> buffer(new char[header.pointsize]);
-        for (int i = 0; i < header.points; ++i) {
-            if (fread(buffer.get(), header.pointsize, 1, file) != 1) {
+        // Read the records in large chunks, and copy their fields in parallel.
+        const int64_t kChunkBytes = 16 << 20;
+        const int64_t chunk_points =
+                std::max(int64_t(1), kChunkBytes / header.pointsize);
+        const std::vector<PCDFieldCopy> copies =
+                GetPCDFieldCopies(header, map_field_to_attr_ptr, true);
+        std::vector<char> buffer;
+        for (int64_t first = 0; first < header.points; first += chunk_points) {
+            const int64_t count = std::min(chunk_points, header.points - first);
+            buffer.resize(count * header.pointsize);
+            if (fread(buffer.data(), header.pointsize, count, file) !=
+                size_t(count)) {
                 utility::LogWarning(
                         "[ReadPCDData] Failed to read data record.");
                 pointcloud.Clear();
                 return false;
             }
-            for (const auto &field : header.fields) {
-                if (field.name == "rgb" || field.name == "rgba") {
-                    ReadBinaryPCDColorsFromField(
-                            map_field_to_attr_ptr["colors"], field,
-                            buffer.get() + field.offset, i);
-                } else {
-                    ReadBinaryPCDElementsFromField(
-                            map_field_to_attr_ptr[field.name], field,
-                            buffer.get() + field.offset, i);
-                }
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+            CopyPCDFields(buffer.data(), first, count, copies);
+            reporter.Update(first + count);
         }
     } else if (header.datatype == PCDDataType::BINARY_COMPRESSED) {
         double reporter_total = 100.0;
@@ -622,35 +725,23 @@ static bool ReadPCDData(FILE *file,
             pointcloud.Clear();
             return false;
         }
+        if (uncompressed_size < int64_t(header.pointsize) * header.points) {
+            utility::LogWarning("[ReadPCDData] Wrong uncompressed size.");
+            pointcloud.Clear();
+            return false;
+        }
         std::unique_ptr<char[]> buffer(new char[uncompressed_size]);
         reporter.Update(int(reporter_total * .2));
-        if (lzf_decompress(buffer_compressed.get(),
-                           (unsigned int)compressed_size, buffer.get(),
-                           (unsigned int)uncompressed_size) !=
-            uncompressed_size) {
+        if (!DecompressLZF(buffer_compressed.get(), compressed_size,
+                           buffer.get(), uncompressed_size,
+                           header.lzf_block_size)) {
             utility::LogWarning("[ReadPCDData] Uncompression failed.");
             pointcloud.Clear();
             return false;
         }
-        for (const auto &field : header.fields) {
-            const char *base_ptr = buffer.get() + field.offset * header.points;
-            double progress =
-                    double(base_ptr - buffer.get()) / uncompressed_size;
-            reporter.Update(int(reporter_total * (progress + .2)));
-            if (field.name == "rgb" || field.name == "rgba") {
-                for (int i = 0; i < header.points; ++i) {
-                    ReadBinaryPCDColorsFromField(
-                            map_field_to_attr_ptr["colors"], field,
-                            base_ptr + i * field.size * field.count, i);
-                }
-            } else {
-                for (int i = 0; i < header.points; ++i) {
-                    ReadBinaryPCDElementsFromField(
-                            map_field_to_attr_ptr[field.name], field,
-                            base_ptr + i * field.size * field.count, i);
-                }
-            }
-        }
+        reporter.Update(int(reporter_total * .8));
+        CopyPCDFields(buffer.get(), 0, header.points,
+                      GetPCDFieldCopies(header, map_field_to_attr_ptr, false));
     }
     reporter.Finish();
     return true;
@@ -803,9 +894,66 @@ static bool GenerateHeader(const t::geometry::PointCloud &pointcloud,
     return true;
 }
 
-static bool WritePCDHeader(FILE *file, const PCDHeader &header) {
+// binary_compressed data larger than a block is compressed in independent
+// blocks, whose size is stored in a header comment. Other readers ignore the
+// comment and decompress the blocks with a single call, see CompressLZF().
+static int64_t GetLZFBlockSize(const PCDHeader &header) {
+    const int64_t kLZFBlockSize = 1 << 20;
+    const int64_t data_size = int64_t(header.pointsize) * header.points;
+    return data_size > kLZFBlockSize ? kLZFBlockSize : 0;
+}
+
+// Compress blocks of block_size bytes independently and in parallel, or the
+// whole data if block_size is 0. LZF back references stay within a block, so
+// the concatenated blocks are also a valid LZF stream of the whole data.
+static bool CompressLZF(const char *in,
+                        std::uint32_t size,
+                        int64_t block_size,
+                        std::vector<char> &out) {
+    if (block_size <= 0) {
+        block_size = std::max(int64_t(size), int64_t(1));
+    }
+    const int64_t num_blocks = (int64_t(size) + block_size - 1) / block_size;
+    std::vector<std::vector<char>> blocks(num_blocks);
+    std::atomic<bool> success(true);
+    core::ParallelFor(core::Device("CPU:0"), num_blocks, [&](int64_t b) {
+        const int64_t begin = b * block_size;
+        const unsigned int length = static_cast<unsigned int>(
+                std::min(block_size, int64_t(size) - begin));
+        // Enough for incompressible data.
+        std::vector<char> &block = blocks[b];
+        block.resize(length + length / 16 + 64);
+        const unsigned int compressed_length =
+                lzf_compress(in + begin, length, block.data(),
+                             static_cast<unsigned int>(block.size()));
+        if (compressed_length == 0) {
+            success = false;
+        }
+        block.resize(compressed_length);
+    });
+    if (!success) {
+        return false;
+    }
+
+    out.clear();
+    for (const std::vector<char> &block : blocks) {
+        out.insert(out.end(), block.begin(), block.end());
+    }
+    return true;
+}
+
+// The number of points is padded with leading zeros to count_digits digits,
+// so that it can be updated in place.
+static bool WritePCDHeader(FILE *file,
+                           const PCDHeader &header,
+                           int count_digits = 0) {
     fprintf(file, "# .PCD v%s - Point Cloud Data file format\n",
             header.version.c_str());
+    if (header.datatype == PCDDataType::BINARY_COMPRESSED &&
+        GetLZFBlockSize(header) > 0) {
+        fprintf(file, "# lzf_block_size %d\n",
+                static_cast<int>(GetLZFBlockSize(header)));
+    }
     fprintf(file, "VERSION %s\n", header.version.c_str());
     fprintf(file, "FIELDS");
     for (const auto &field : header.fields) {
@@ -827,10 +975,10 @@ static bool WritePCDHeader(FILE *file, const PCDHeader &header) {
         fprintf(file, " %d", field.count);
     }
     fprintf(file, "\n");
-    fprintf(file, "WIDTH %d\n", header.width);
+    fprintf(file, "WIDTH %0*d\n", count_digits, header.width);
     fprintf(file, "HEIGHT %d\n", header.height);
     fprintf(file, "VIEWPOINT 0 0 0 1 0 0 0\n");
-    fprintf(file, "POINTS %d\n", header.points);
+    fprintf(file, "POINTS %0*d\n", count_digits, header.points);
 
     switch (header.datatype) {
         case PCDDataType::BINARY:
@@ -1041,6 +1189,11 @@ static bool WritePCDData(FILE *file,
         }
     }
 
+    int64_t record_size = 0;
+    for (const auto &it : attribute_ptrs) {
+        record_size += it.group_size_ * it.dtype_.ByteSize();
+    }
+
     utility::CountingProgressReporter reporter(params.update_progress);
     reporter.SetTotal(num_points);
     if (header.datatype == PCDDataType::ASCII) {
@@ -1064,31 +1217,24 @@ static bool WritePCDData(FILE *file,
             }
         }
     } else if (header.datatype == PCDDataType::BINARY) {
-        std::vector<char> buffer((header.pointsize * header.points));
-        std::uint32_t buffer_index = 0;
-        for (std::int64_t i = 0; i < num_points; ++i) {
-            for (auto &it : attribute_ptrs) {
-                DISPATCH_DTYPE_TO_TEMPLATE(it.dtype_, [&]() {
-                    const scalar_t *data_ptr =
-                            static_cast<const scalar_t *>(it.data_ptr_);
-
-                    for (int idx_offset = it.group_size_ * i;
-                         idx_offset < it.group_size_ * (i + 1); ++idx_offset) {
-                        std::memcpy(buffer.data() + buffer_index,
-                                    reinterpret_cast<const char *>(
-                                            &data_ptr[idx_offset]),
-                                    sizeof(scalar_t));
-                        buffer_index += sizeof(scalar_t);
-                    }
-                });
+        // Interleave the attributes into records in parallel.
+        std::vector<char> buffer(record_size * num_points);
+        core::ParallelFor(core::Device("CPU:0"), num_points, [&](int64_t i) {
+            char *dst = buffer.data() + i * record_size;
+            for (const auto &it : attribute_ptrs) {
+                const int64_t size = it.group_size_ * it.dtype_.ByteSize();
+                std::memcpy(dst,
+                            static_cast<const char *>(it.data_ptr_) + i * size,
+                            size);
+                dst += size;
             }
+        });
 
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+        if (fwrite(buffer.data(), sizeof(char), buffer.size(), file) !=
+            buffer.size()) {
+            utility::LogWarning("[WritePCDData] Failed to write data.");
+            return false;
         }
-
-        fwrite(buffer.data(), sizeof(char), buffer.size(), file);
     } else if (header.datatype == PCDDataType::BINARY_COMPRESSED) {
         // BINARY_COMPRESSED data contains attributes in column layout
         // for better compression.
@@ -1102,40 +1248,38 @@ static bool WritePCDData(FILE *file,
         reporter.SetTotal(report_total);
 
         const std::uint32_t buffer_size_in_bytes =
-                header.pointsize * header.points;
+                static_cast<std::uint32_t>(record_size * num_points);
         std::vector<char> buffer(buffer_size_in_bytes);
-        std::vector<char> buffer_compressed(2 * buffer_size_in_bytes);
 
-        std::uint32_t buffer_index = 0;
+        int64_t column_offset = 0;
         std::int64_t count = 0;
         for (auto &it : attribute_ptrs) {
-            DISPATCH_DTYPE_TO_TEMPLATE(it.dtype_, [&]() {
-                const scalar_t *data_ptr =
-                        static_cast<const scalar_t *>(it.data_ptr_);
-
-                for (int idx_offset = 0; idx_offset < it.group_size_;
-                     ++idx_offset) {
-                    for (std::int64_t i = 0; i < num_points; ++i) {
-                        std::memcpy(buffer.data() + buffer_index,
-                                    reinterpret_cast<const char *>(
-                                            &data_ptr[i * it.group_size_ +
-                                                      idx_offset]),
-                                    sizeof(scalar_t));
-                        buffer_index += sizeof(scalar_t);
-                    }
-                }
-            });
-
+            const int64_t element_size = it.dtype_.ByteSize();
+            const char *data_ptr = static_cast<const char *>(it.data_ptr_);
+            for (int idx_offset = 0; idx_offset < it.group_size_;
+                 ++idx_offset) {
+                char *column = buffer.data() + column_offset;
+                core::ParallelFor(
+                        core::Device("CPU:0"), num_points, [&](int64_t i) {
+                            std::memcpy(column + i * element_size,
+                                        data_ptr + (i * it.group_size_ +
+                                                    idx_offset) *
+                                                           element_size,
+                                        element_size);
+                        });
+                column_offset += element_size * num_points;
+            }
             reporter.Update(count++);
         }
 
-        std::uint32_t size_compressed = lzf_compress(
-                buffer.data(), buffer_size_in_bytes, buffer_compressed.data(),
-                buffer_size_in_bytes * 2);
-        if (size_compressed == 0) {
+        std::vector<char> buffer_compressed;
+        if (!CompressLZF(buffer.data(), buffer_size_in_bytes,
+                         GetLZFBlockSize(header), buffer_compressed)) {
             utility::LogWarning("[WritePCDData] Failed to compress data.");
             return false;
         }
+        const std::uint32_t size_compressed =
+                static_cast<std::uint32_t>(buffer_compressed.size());
 
         utility::LogDebug(
                 "[WritePCDData] {:d} bytes data compressed into {:d} bytes.",
@@ -1220,6 +1364,150 @@ bool WritePointCloudToPCD(const std::string &filename,
     return true;
 }
 
+// Reads the points of ASCII and binary files in batches.
+class PCDBatchReader : public PointCloudBatchReader {
+public:
+    ~PCDBatchReader() override {
+        if (file_) {
+            fclose(file_);
+        }
+    }
+
+    bool Open(const std::string &filename) {
+        file_ = utility::filesystem::FOpen(filename.c_str(), "rb");
+        if (file_ == NULL) {
+            utility::LogWarning("Read PCD failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        if (!ReadPCDHeader(file_, header_)) {
+            utility::LogWarning("Read PCD failed: unable to parse header.");
+            return false;
+        }
+        return header_.datatype != PCDDataType::BINARY_COMPRESSED;
+    }
+
+    int64_t GetNumPoints() const override { return header_.points; }
+
+    bool ReadBatch(int64_t max_points, geometry::PointCloud &batch) override {
+        const int64_t count = std::min(max_points, GetNumPoints() - num_read_);
+        if (count <= 0) {
+            batch.Clear();
+            return true;
+        }
+        PCDHeader batch_header = header_;
+        batch_header.width = static_cast<int>(count);
+        batch_header.height = 1;
+        batch_header.points = static_cast<int>(count);
+        if (!ReadPCDData(file_, batch_header, batch, ReadPointCloudOption())) {
+            utility::LogWarning("Read PCD failed: unable to read data.");
+            return false;
+        }
+        num_read_ += count;
+        return true;
+    }
+
+private:
+    FILE *file_ = nullptr;
+    PCDHeader header_;
+    int64_t num_read_ = 0;
+};
+
+std::unique_ptr<PointCloudBatchReader> CreatePCDBatchReader(
+        const std::string &filename) {
+    auto reader = std::make_unique<PCDBatchReader>();
+    if (!reader->Open(filename)) {
+        return nullptr;
+    }
+    return std::move(reader);
+}
+
+// Writes binary files in batches. The header is written with the attributes
+// of the first batch, and completed in place on Close().
+class PCDBatchWriter : public PointCloudBatchWriter {
+public:
+    ~PCDBatchWriter() override {
+        if (file_) {
+            fclose(file_);
+        }
+    }
+
+    bool Open(const std::string &filename) {
+        file_ = utility::filesystem::FOpen(filename.c_str(), "wb");
+        if (file_ == NULL) {
+            utility::LogWarning("Write PCD failed: unable to open file.");
+            return false;
+        }
+        return true;
+    }
+
+    bool WriteBatch(const geometry::PointCloud &batch) override {
+        const int64_t num_points = batch.GetPointPositions().GetLength();
+        if (num_points_ + num_points > std::numeric_limits<int>::max()) {
+            utility::LogWarning("Write PCD failed: too many points.");
+            return false;
+        }
+        PCDHeader batch_header;
+        if (!GenerateHeader(batch, false, false, batch_header)) {
+            utility::LogWarning("Write PCD failed: unable to generate header.");
+            return false;
+        }
+        if (header_.fields.empty()) {
+            header_ = batch_header;
+            if (!WriteHeader()) {
+                return false;
+            }
+        }
+        if (!WritePCDData(file_, batch_header, batch,
+                          WritePointCloudOption())) {
+            utility::LogWarning("Write PCD failed: unable to write data.");
+            return false;
+        }
+        num_points_ += num_points;
+        return true;
+    }
+
+    bool Close() override {
+        bool success = false;
+        if (header_.fields.empty()) {
+            utility::LogWarning("Write PCD failed: point cloud has 0 points.");
+        } else {
+            success = fseek(file_, 0, SEEK_SET) == 0 && WriteHeader();
+        }
+        success = fclose(file_) == 0 && success;
+        file_ = nullptr;
+        return success;
+    }
+
+private:
+    bool WriteHeader() {
+        // Enough digits for any int.
+        const int kCountDigits = 10;
+        header_.width = static_cast<int>(num_points_);
+        header_.height = 1;
+        header_.points = header_.width;
+        if (!WritePCDHeader(file_, header_, kCountDigits) || ferror(file_)) {
+            utility::LogWarning("Write PCD failed: unable to write header.");
+            return false;
+        }
+        return true;
+    }
+
+private:
+    FILE *file_ = nullptr;
+    PCDHeader header_;
+    int64_t num_points_ = 0;
+};
+
+std::unique_ptr<PointCloudBatchWriter> CreatePCDBatchWriter(
+        const std::string &filename) {
+    auto writer = std::make_unique<PCDBatchWriter>();
+    if (!writer->Open(filename)) {
+        return nullptr;
+    }
+    return std::move(writer);
+}
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
@@ -26,13 +26,18 @@
 
 #include <rply.h>
 
+#include <algorithm>
+#include <cstring>
 #include <vector>
 
 #include "open3d/core/Dtype.h"
+#include "open3d/core/ParallelFor.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/file_format/PLYBinaryReader.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/PointCloudStreamIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -163,9 +168,154 @@ static std::tuple<std::string, int, int> GetNameStrideOffsetForAttribute(
     return std::make_tuple(name, 1, 0);
 }
 
+static e_ply_type GetPlyType(
+        open3d::io::PLYBinaryVertexReader::ScalarType type) {
+    using ScalarType = open3d::io::PLYBinaryVertexReader::ScalarType;
+    switch (type) {
+        case ScalarType::Int8:
+            return PLY_INT8;
+        case ScalarType::UInt8:
+            return PLY_UINT8;
+        case ScalarType::Int16:
+            return PLY_INT16;
+        case ScalarType::UInt16:
+            return PLY_UINT16;
+        case ScalarType::Int32:
+            return PLY_INT32;
+        case ScalarType::UInt32:
+            return PLY_UIN32;
+        case ScalarType::Float32:
+            return PLY_FLOAT32;
+        case ScalarType::Float64:
+            return PLY_FLOAT64;
+    }
+    return PLY_LIST;
+}
+
+// Reads the vertices of binary files in batches without the per-value rply
+// callbacks.
+class PLYBatchReader : public PointCloudBatchReader {
+public:
+    /// Returns false if rply is needed to read the file.
+    bool Open(const std::string &filename) {
+        if (!reader_.Open(filename)) {
+            return false;
+        }
+        const auto &properties = reader_.GetProperties();
+
+        // Leave attributes that mix datatypes to rply.
+        std::unordered_map<std::string, core::Dtype> attr_dtypes;
+        for (const auto &property : properties) {
+            core::Dtype dtype = GetDtype(GetPlyType(property.type_));
+            if (dtype == core::Undefined) continue;
+            const std::string attr_name = std::get<0>(
+                    GetNameStrideOffsetForAttribute(property.name_));
+            auto it = attr_dtypes.emplace(attr_name, dtype).first;
+            if (it->second != dtype) {
+                return false;
+            }
+        }
+        if (attr_dtypes.count("positions") == 0) {
+            return false;
+        }
+
+        for (size_t i = 0; i < properties.size(); ++i) {
+            const e_ply_type type = GetPlyType(properties[i].type_);
+            const core::Dtype dtype = GetDtype(type);
+            if (dtype == core::Undefined) {
+                utility::LogWarning(
+                        "Read PLY warning: skipping property \"{}\", "
+                        "unsupported datatype \"{}\".",
+                        properties[i].name_, GetDtypeString(type));
+                continue;
+            }
+            std::string attr_name;
+            int stride, offset;
+            std::tie(attr_name, stride, offset) =
+                    GetNameStrideOffsetForAttribute(properties[i].name_);
+            columns_.push_back(
+                    {static_cast<int>(i), attr_name, stride, offset, dtype});
+        }
+        return true;
+    }
+
+    int64_t GetNumPoints() const override { return reader_.GetNumVertices(); }
+
+    bool ReadBatch(int64_t max_points, geometry::PointCloud &batch) override {
+        return ReadBatch(max_points, batch, nullptr);
+    }
+
+    bool ReadBatch(int64_t max_points,
+                   geometry::PointCloud &batch,
+                   utility::CountingProgressReporter *reporter) {
+        const int64_t count =
+                std::min(max_points, reader_.GetNumVertices() - num_read_);
+        batch.Clear();
+        if (count <= 0) {
+            return true;
+        }
+
+        std::unordered_map<std::string, core::Tensor> attrs;
+        std::vector<open3d::io::PLYBinaryVertexReader::Column> columns;
+        for (const Column &column : columns_) {
+            if (attrs.count(column.attr_name_) == 0) {
+                attrs.emplace(column.attr_name_,
+                              core::Tensor::Empty({count, column.stride_},
+                                                  column.dtype_));
+            }
+            columns.push_back({column.property_,
+                               attrs.at(column.attr_name_).GetDataPtr(),
+                               column.stride_, column.offset_});
+        }
+        if (!reader_.ReadRange(num_read_, count, columns, reporter)) {
+            return false;
+        }
+        num_read_ += count;
+        for (auto &it : attrs) {
+            batch.SetPointAttr(it.first, it.second);
+        }
+        return true;
+    }
+
+private:
+    struct Column {
+        int property_;
+        std::string attr_name_;
+        int stride_;
+        int offset_;
+        core::Dtype dtype_;
+    };
+
+    open3d::io::PLYBinaryVertexReader reader_;
+    std::vector<Column> columns_;
+    int64_t num_read_ = 0;
+};
+
+std::unique_ptr<PointCloudBatchReader> CreatePLYBatchReader(
+        const std::string &filename) {
+    auto reader = std::make_unique<PLYBatchReader>();
+    if (!reader->Open(filename)) {
+        return nullptr;
+    }
+    return std::move(reader);
+}
+
 bool ReadPointCloudFromPLY(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const open3d::io::ReadPointCloudOption &params) {
+    // Fast path for binary files.
+    PLYBatchReader batch_reader;
+    if (batch_reader.Open(filename)) {
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(batch_reader.GetNumPoints());
+        if (!batch_reader.ReadBatch(batch_reader.GetNumPoints(), pointcloud,
+                                    &reporter)) {
+            return false;
+        }
+        reporter.Finish();
+        return true;
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), nullptr, 0, nullptr);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}.",
@@ -438,6 +588,170 @@ bool WritePointCloudToPLY(const std::string &filename,
     return true;
 }
 
+// Writes binary files in batches. The number of vertices has a fixed width, so
+// that the header can be completed in place on Close().
+class PLYBatchWriter : public PointCloudBatchWriter {
+public:
+    ~PLYBatchWriter() override {
+        if (file_) {
+            fclose(file_);
+        }
+    }
+
+    bool Open(const std::string &filename) {
+        file_ = utility::filesystem::FOpen(filename, "wb");
+        if (!file_) {
+            utility::LogWarning("Write PLY failed: unable to open file: {}.",
+                                filename);
+            return false;
+        }
+        return true;
+    }
+
+    bool WriteBatch(const geometry::PointCloud &batch) override {
+        if (attributes_.empty() && (!InitializeAttributes(batch) ||
+                                    !WriteHeader())) {
+            return false;
+        }
+
+        const int64_t num_points = batch.GetPointPositions().GetLength();
+        std::vector<core::Tensor> tensors;
+        for (const Attribute &attribute : attributes_) {
+            tensors.push_back(batch.GetPointAttr(attribute.name_).Contiguous());
+        }
+        std::vector<uint8_t> buffer(num_points * record_size_);
+        core::ParallelFor(core::Device("CPU:0"), num_points, [&](int64_t i) {
+            uint8_t *dst = buffer.data() + i * record_size_;
+            for (size_t a = 0; a < attributes_.size(); ++a) {
+                const int64_t size = attributes_[a].byte_size_;
+                std::memcpy(dst,
+                            static_cast<const uint8_t *>(
+                                    tensors[a].GetDataPtr()) +
+                                    i * size,
+                            size);
+                dst += size;
+            }
+        });
+        if (fwrite(buffer.data(), 1, buffer.size(), file_) != buffer.size()) {
+            utility::LogWarning("Write PLY failed: unable to write data.");
+            return false;
+        }
+        num_points_ += num_points;
+        return true;
+    }
+
+    bool Close() override {
+        bool success = false;
+        if (attributes_.empty()) {
+            utility::LogWarning("Write PLY failed: point cloud has 0 points.");
+        } else {
+            success = fseek(file_, 0, SEEK_SET) == 0 && WriteHeader();
+        }
+        success = fclose(file_) == 0 && success;
+        file_ = nullptr;
+        return success;
+    }
+
+private:
+    // Positions, normals and colors, followed by the other attributes in
+    // alphabetical order.
+    bool InitializeAttributes(const geometry::PointCloud &batch) {
+        std::vector<std::string> names;
+        for (const std::string name : {"positions", "normals", "colors"}) {
+            if (batch.HasPointAttr(name)) {
+                names.push_back(name);
+            }
+        }
+        std::vector<std::string> other_names;
+        for (const auto &kv : batch.GetPointAttr()) {
+            if (kv.first != "positions" && kv.first != "normals" &&
+                kv.first != "colors") {
+                other_names.push_back(kv.first);
+            }
+        }
+        std::sort(other_names.begin(), other_names.end());
+        names.insert(names.end(), other_names.begin(), other_names.end());
+
+        const int64_t num_points = batch.GetPointPositions().GetLength();
+        for (const std::string &name : names) {
+            const core::Tensor &tensor = batch.GetPointAttr(name);
+            const bool is_vector = name == "positions" ||
+                                   name == "normals" || name == "colors";
+            const int64_t width = is_vector ? 3 : 1;
+            if (tensor.GetShape() != core::SizeVector({num_points, width})) {
+                utility::LogWarning(
+                        "Write PLY failed. PointCloud contains {} attribute "
+                        "which is not supported by PLY IO. Expected shape: {} "
+                        "but got {}.",
+                        name, core::SizeVector({num_points, width}).ToString(),
+                        tensor.GetShape().ToString());
+                attributes_.clear();
+                return false;
+            }
+            const core::Dtype dtype = tensor.GetDtype();
+            attributes_.push_back({name, GetPlyType(dtype),
+                                   width * dtype.ByteSize()});
+            record_size_ += width * dtype.ByteSize();
+        }
+        return true;
+    }
+
+    bool WriteHeader() {
+        const uint16_t one = 1;
+        const bool little_endian = *reinterpret_cast<const uint8_t *>(&one);
+        fprintf(file_, "ply\nformat %s 1.0\ncomment Created by Open3D\n",
+                little_endian ? "binary_little_endian" : "binary_big_endian");
+        fprintf(file_, "element vertex %019lld\n",
+                static_cast<long long>(num_points_));
+        for (const Attribute &attribute : attributes_) {
+            const std::string type = GetDtypeString(attribute.type_);
+            if (attribute.name_ == "positions") {
+                fprintf(file_, "property %s x\nproperty %s y\nproperty %s z\n",
+                        type.c_str(), type.c_str(), type.c_str());
+            } else if (attribute.name_ == "normals") {
+                fprintf(file_,
+                        "property %s nx\nproperty %s ny\nproperty %s nz\n",
+                        type.c_str(), type.c_str(), type.c_str());
+            } else if (attribute.name_ == "colors") {
+                fprintf(file_,
+                        "property %s red\nproperty %s green\nproperty %s "
+                        "blue\n",
+                        type.c_str(), type.c_str(), type.c_str());
+            } else {
+                fprintf(file_, "property %s %s\n", type.c_str(),
+                        attribute.name_.c_str());
+            }
+        }
+        if (fprintf(file_, "end_header\n") < 0) {
+            utility::LogWarning("Write PLY failed: unable to write header.");
+            return false;
+        }
+        return true;
+    }
+
+private:
+    struct Attribute {
+        std::string name_;
+        e_ply_type type_;
+        /// Byte size of the attribute of a vertex.
+        int64_t byte_size_;
+    };
+
+    FILE *file_ = nullptr;
+    std::vector<Attribute> attributes_;
+    int64_t record_size_ = 0;
+    int64_t num_points_ = 0;
+};
+
+std::unique_ptr<PointCloudBatchWriter> CreatePLYBatchWriter(
+        const std::string &filename) {
+    auto writer = std::make_unique<PLYBatchWriter>();
+    if (!writer->Open(filename)) {
+        return nullptr;
+    }
+    return std::move(writer);
+}
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
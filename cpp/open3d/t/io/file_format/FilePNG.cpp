@@ -25,8 +25,12 @@
 // ----------------------------------------------------------------------------
 
 #include <png.h>
+#include <zlib.h>
+
+#include <vector>
 
 #include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -54,6 +58,70 @@ static void SetPNGImageFromImage(const geometry::Image &image,
     }
 }
 
+/// PNG stores 16-bit samples in big endian.
+static bool IsLittleEndian() {
+    const uint16_t one = 1;
+    return *reinterpret_cast<const uint8_t *>(&one) == 1;
+}
+
+/// Decode a 16-bit grayscale PNG file directly into the rows of image, which
+/// is reused if it already has the size of the file.
+static bool ReadDepthImageFromPNG(const std::string &filename,
+                                  geometry::Image &image) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read PNG failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    png_structp png =
+            png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    png_infop info = png ? png_create_info_struct(png) : NULL;
+    if (info == NULL) {
+        png_destroy_read_struct(&png, NULL, NULL);
+        fclose(file);
+        utility::LogWarning("Read PNG failed: unable to allocate libpng.");
+        return false;
+    }
+    // libpng reports errors with longjmp, so objects with destructors are
+    // only created before.
+    std::vector<png_bytep> rows;
+    if (setjmp(png_jmpbuf(png))) {
+        png_destroy_read_struct(&png, &info, NULL);
+        fclose(file);
+        utility::LogWarning("Read PNG failed: unable to read file: {}",
+                            filename);
+        return false;
+    }
+
+    png_init_io(png, file);
+    png_read_info(png, info);
+    if (png_get_bit_depth(png, info) != 16 ||
+        png_get_color_type(png, info) != PNG_COLOR_TYPE_GRAY) {
+        png_error(png, "Not a 16-bit grayscale image.");
+    }
+    if (IsLittleEndian()) {
+        png_set_swap(png);
+    }
+    png_set_interlace_handling(png);
+    png_read_update_info(png, info);
+
+    const int64_t height = png_get_image_height(png, info);
+    const int64_t width = png_get_image_width(png, info);
+    image.Reset(height, width, 1, core::UInt16, image.GetDevice());
+    uint16_t *data = static_cast<uint16_t *>(image.GetDataPtr());
+    rows.resize(height);
+    for (int64_t i = 0; i < height; ++i) {
+        rows[i] = reinterpret_cast<png_bytep>(data + i * width);
+    }
+    png_read_image(png, rows.data());
+    png_read_end(png, NULL);
+
+    png_destroy_read_struct(&png, &info, NULL);
+    fclose(file);
+    return true;
+}
+
 bool ReadImageFromPNG(const std::string &filename, geometry::Image &image) {
     png_image pngimage;
     memset(&pngimage, 0, sizeof(pngimage));
@@ -63,6 +131,13 @@ bool ReadImageFromPNG(const std::string &filename, geometry::Image &image) {
         return false;
     }
 
+    // Depth images skip the conversions of the simplified API.
+    if ((pngimage.format & PNG_FORMAT_FLAG_LINEAR) &&
+        PNG_IMAGE_SAMPLE_CHANNELS(pngimage.format) == 1) {
+        png_image_free(&pngimage);
+        return ReadDepthImageFromPNG(filename, image);
+    }
+
     // Clear colormap flag if necessary to ensure libpng expands the color
     // indexed pixels to full color
     if (pngimage.format & PNG_FORMAT_FLAG_COLORMAP) {
@@ -88,6 +163,108 @@ bool ReadImageFromPNG(const std::string &filename, geometry::Image &image) {
     return true;
 }
 
+bool WriteDepthImageToPNG(const std::string &filename,
+                          const geometry::Image &image,
+                          const DepthPNGWriteOption &option) {
+    if (image.IsEmpty()) {
+        utility::LogWarning("Write PNG failed: image has no data.");
+        return false;
+    }
+    if (image.GetDtype() != core::UInt16 || image.GetChannels() != 1) {
+        utility::LogWarning(
+                "Write PNG failed: depth image must be UInt16 with 1 channel.");
+        return false;
+    }
+    if (option.compression_level < 0 || option.compression_level > 9) {
+        utility::LogWarning(
+                "Write PNG failed: compression level ({}) must be in the "
+                "range [0,9]",
+                option.compression_level);
+        return false;
+    }
+    int filters = PNG_ALL_FILTERS;
+    switch (option.filter) {
+        case DepthPNGWriteOption::Filter::None:
+            filters = PNG_FILTER_NONE;
+            break;
+        case DepthPNGWriteOption::Filter::Sub:
+            filters = PNG_FILTER_SUB;
+            break;
+        case DepthPNGWriteOption::Filter::Up:
+            filters = PNG_FILTER_UP;
+            break;
+        case DepthPNGWriteOption::Filter::Average:
+            filters = PNG_FILTER_AVG;
+            break;
+        case DepthPNGWriteOption::Filter::Paeth:
+            filters = PNG_FILTER_PAETH;
+            break;
+        case DepthPNGWriteOption::Filter::All:
+            filters = PNG_ALL_FILTERS;
+            break;
+    }
+    const core::Tensor data =
+            image.AsTensor().To(core::Device("CPU:0")).Contiguous();
+    const int64_t height = image.GetRows();
+    const int64_t width = image.GetCols();
+
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write PNG failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    png_structp png =
+            png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    png_infop info = png ? png_create_info_struct(png) : NULL;
+    if (info == NULL) {
+        png_destroy_write_struct(&png, NULL);
+        fclose(file);
+        utility::LogWarning("Write PNG failed: unable to allocate libpng.");
+        return false;
+    }
+    // libpng reports errors with longjmp, so objects with destructors are
+    // only created before.
+    std::vector<png_bytep> rows(height);
+    if (setjmp(png_jmpbuf(png))) {
+        png_destroy_write_struct(&png, &info);
+        fclose(file);
+        utility::LogWarning("Write PNG failed: unable to write file: {}",
+                            filename);
+        return false;
+    }
+
+    png_init_io(png, file);
+    png_set_IHDR(png, info, static_cast<png_uint_32>(width),
+                 static_cast<png_uint_32>(height), 16, PNG_COLOR_TYPE_GRAY,
+                 PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
+                 PNG_FILTER_TYPE_DEFAULT);
+    png_set_compression_level(png, option.compression_level);
+    if (option.run_length) {
+        png_set_compression_strategy(png, Z_RLE);
+    }
+    png_set_filter(png, PNG_FILTER_TYPE_BASE, filters);
+    png_write_info(png, info);
+    if (IsLittleEndian()) {
+        png_set_swap(png);
+    }
+    // libpng does not modify the rows.
+    uint16_t *data_ptr = const_cast<uint16_t *>(data.GetDataPtr<uint16_t>());
+    for (int64_t i = 0; i < height; ++i) {
+        rows[i] = reinterpret_cast<png_bytep>(data_ptr + i * width);
+    }
+    png_write_image(png, rows.data());
+    png_write_end(png, NULL);
+
+    png_destroy_write_struct(&png, &info);
+    if (fclose(file) != 0) {
+        utility::LogWarning("Write PNG failed: unable to write file: {}",
+                            filename);
+        return false;
+    }
+    return true;
+}
+
 bool WriteImageToPNG(const std::string &filename,
                      const geometry::Image &image,
                      int quality) {
@@ -109,6 +286,16 @@ bool WriteImageToPNG(const std::string &filename,
                 quality);
         return false;
     }
+    if (image.GetDtype() == core::UInt16 && image.GetChannels() == 1) {
+        // Fast writes use the default options for captured depth.
+        DepthPNGWriteOption option;
+        if (quality > 2) {
+            option.compression_level = quality;
+            option.filter = DepthPNGWriteOption::Filter::All;
+            option.run_length = false;
+        }
+        return WriteDepthImageToPNG(filename, image, option);
+    }
     png_image pngimage;
     memset(&pngimage, 0, sizeof(pngimage));
     pngimage.version = PNG_IMAGE_VERSION;
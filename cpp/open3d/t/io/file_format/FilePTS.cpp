@@ -28,6 +28,7 @@
 
 #include "open3d/core/TensorCheck.h"
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/file_format/ASCIIRowsIO.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -73,122 +74,76 @@ bool ReadPointCloudFromPTS(const std::string &filename,
             return true;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(num_points);
+        reporter.SetTotal(file.GetFileSize());
 
         // Store data start position.
         int64_t start_pos = ftell(file.GetFILE());
 
-        double *points_ptr = nullptr;
-        double *intensities_ptr = nullptr;
-        uint8_t *colors_ptr = nullptr;
         size_t num_fields = 0;
-
         if ((line_buffer = file.ReadLine())) {
             num_fields = utility::SplitString(line_buffer, " ").size();
-
-            // X Y Z I R G B.
-            if (num_fields == 7) {
-                pointcloud.SetPointPositions(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr =
-                        pointcloud.GetPointPositions().GetDataPtr<double>();
-                pointcloud.SetPointAttr(
-                        "intensities",
-                        core::Tensor({num_points, 1}, core::Float64));
-                intensities_ptr = pointcloud.GetPointAttr("intensities")
-                                          .GetDataPtr<double>();
-                pointcloud.SetPointColors(
-                        core::Tensor({num_points, 3}, core::UInt8));
-                colors_ptr = pointcloud.GetPointColors().GetDataPtr<uint8_t>();
-            }
-            // X Y Z R G B.
-            else if (num_fields == 6) {
-                pointcloud.SetPointPositions(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr =
-                        pointcloud.GetPointPositions().GetDataPtr<double>();
-                pointcloud.SetPointColors(
-                        core::Tensor({num_points, 3}, core::UInt8));
-                colors_ptr = pointcloud.GetPointColors().GetDataPtr<uint8_t>();
-            }
-            // X Y Z I.
-            else if (num_fields == 4) {
-                pointcloud.SetPointPositions(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr =
-                        pointcloud.GetPointPositions().GetDataPtr<double>();
-                pointcloud.SetPointAttr(
-                        "intensities",
-                        core::Tensor({num_points, 1}, core::Float64));
-                intensities_ptr = pointcloud.GetPointAttr("intensities")
-                                          .GetDataPtr<double>();
-            }
-            // X Y Z.
-            else if (num_fields == 3) {
-                pointcloud.SetPointPositions(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr =
-                        pointcloud.GetPointPositions().GetDataPtr<double>();
-            } else {
+            if (num_fields != 7 && num_fields != 6 && num_fields != 4 &&
+                num_fields != 3) {
                 utility::LogWarning("Read PTS failed: unknown pts format: {}",
                                     line_buffer);
                 return false;
             }
+        } else {
+            reporter.Finish();
+            return true;
         }
 
         // Go to data start position.
         fseek(file.GetFILE(), start_pos, 0);
 
-        int64_t idx = 0;
-        while (idx < num_points && (line_buffer = file.ReadLine())) {
-            double x, y, z, i;
-            int r, g, b;
-            // X Y Z I R G B.
-            if (num_fields == 7 &&
-                (sscanf(line_buffer, "%lf %lf %lf %lf %d %d %d", &x, &y, &z, &i,
-                        &r, &g, &b) == 7)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                intensities_ptr[idx] = i;
-                colors_ptr[3 * idx + 0] = r;
-                colors_ptr[3 * idx + 1] = g;
-                colors_ptr[3 * idx + 2] = b;
-            }
-            // X Y Z R G B.
-            else if (num_fields == 6 &&
-                     (sscanf(line_buffer, "%lf %lf %lf %d %d %d", &x, &y, &z,
-                             &r, &g, &b) == 6)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                colors_ptr[3 * idx + 0] = r;
-                colors_ptr[3 * idx + 1] = g;
-                colors_ptr[3 * idx + 2] = b;
-            }
-            // X Y Z I.
-            else if (num_fields == 4 && (sscanf(line_buffer, "%lf %lf %lf %lf",
-                                                &x, &y, &z, &i) == 4)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                intensities_ptr[idx] = i;
-            }
-            // X Y Z.
-            else if (num_fields == 3 &&
-                     sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-            } else {
-                utility::LogWarning("Read PTS failed at line: {}", line_buffer);
-                return false;
+        std::vector<double> values;
+        const int64_t num_rows = open3d::io::ReadASCIIRows(
+                file, int(num_fields), num_points, true, values, &reporter);
+        if (num_rows < 0) {
+            utility::LogWarning("Read PTS failed: unable to read file: {}",
+                                filename);
+            return false;
+        }
+
+        // X Y Z I R G B, X Y Z R G B, X Y Z I or X Y Z.
+        const bool has_intensities = num_fields == 7 || num_fields == 4;
+        const bool has_colors = num_fields == 7 || num_fields == 6;
+        core::Tensor points({num_rows, 3}, core::Float64);
+        core::Tensor intensities;
+        core::Tensor colors;
+        double *points_ptr = points.GetDataPtr<double>();
+        double *intensities_ptr = nullptr;
+        uint8_t *colors_ptr = nullptr;
+        if (has_intensities) {
+            intensities = core::Tensor({num_rows, 1}, core::Float64);
+            intensities_ptr = intensities.GetDataPtr<double>();
+        }
+        if (has_colors) {
+            colors = core::Tensor({num_rows, 3}, core::UInt8);
+            colors_ptr = colors.GetDataPtr<uint8_t>();
+        }
+        for (int64_t idx = 0; idx < num_rows; idx++) {
+            const double *row = values.data() + idx * num_fields;
+            points_ptr[3 * idx + 0] = row[0];
+            points_ptr[3 * idx + 1] = row[1];
+            points_ptr[3 * idx + 2] = row[2];
+            if (has_intensities) {
+                intensities_ptr[idx] = row[3];
             }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
+            if (has_colors) {
+                const double *rgb = row + num_fields - 3;
+                colors_ptr[3 * idx + 0] = uint8_t(int(rgb[0]));
+                colors_ptr[3 * idx + 1] = uint8_t(int(rgb[1]));
+                colors_ptr[3 * idx + 2] = uint8_t(int(rgb[2]));
             }
         }
+        pointcloud.SetPointPositions(points);
+        if (has_intensities) {
+            pointcloud.SetPointAttr("intensities", intensities);
+        }
+        if (has_colors) {
+            pointcloud.SetPointColors(colors);
+        }
 
         reporter.Finish();
         return true;
@@ -251,99 +206,65 @@ bool WritePointCloudToPTS(const std::string &filename,
             return false;
         }
 
+        // Keep the converted tensors alive while their data is written.
+        core::Tensor points;
+        core::Tensor intensities;
+        core::Tensor colors;
         const double *points_ptr = nullptr;
         const double *intensities_ptr = nullptr;
         const uint8_t *colors_ptr = nullptr;
-        core::Tensor colors;
 
         if (num_points > 0) {
-            points_ptr = pointcloud.GetPointPositions()
-                                 .To(core::Float64)
-                                 .GetDataPtr<double>();
-        }
-
-        // X Y Z I R G B.
-        if (pointcloud.HasPointColors() &&
-            pointcloud.HasPointAttr("intensities")) {
-            colors = ConvertColorTensorToUint8(pointcloud.GetPointColors());
-            colors_ptr = colors.GetDataPtr<uint8_t>();
-            intensities_ptr = pointcloud.GetPointAttr("intensities")
+            points = pointcloud.GetPointPositions()
+                             .To(core::Float64)
+                             .Contiguous();
+            points_ptr = points.GetDataPtr<double>();
+            if (pointcloud.HasPointColors()) {
+                colors = ConvertColorTensorToUint8(pointcloud.GetPointColors())
+                                 .Contiguous();
+                colors_ptr = colors.GetDataPtr<uint8_t>();
+            }
+            if (pointcloud.HasPointAttr("intensities")) {
+                intensities = pointcloud.GetPointAttr("intensities")
                                       .To(core::Float64)
-                                      .GetDataPtr<double>();
-            for (int i = 0; i < num_points; i++) {
-                if (fprintf(file.GetFILE(),
-                            "%.10f %.10f %.10f %.10f %d %d %d\r\n",
-                            points_ptr[3 * i + 0], points_ptr[3 * i + 1],
-                            points_ptr[3 * i + 2], intensities_ptr[i],
-                            colors_ptr[3 * i + 0], colors_ptr[3 * i + 1],
-                            colors_ptr[3 * i + 2]) < 0) {
-                    utility::LogWarning(
-                            "Write PTS failed: unable to write file: {}",
-                            filename);
-                    return false;
-                }
-
-                if (i % 1000 == 0) {
-                    reporter.Update(i);
-                }
+                                      .Contiguous();
+                intensities_ptr = intensities.GetDataPtr<double>();
             }
         }
-        // X Y Z R G B.
-        else if (pointcloud.HasPointColors()) {
-            colors = ConvertColorTensorToUint8(pointcloud.GetPointColors());
-            colors_ptr = colors.GetDataPtr<uint8_t>();
-            for (int i = 0; i < num_points; i++) {
-                if (fprintf(file.GetFILE(), "%.10f %.10f %.10f %d %d %d\r\n",
-                            points_ptr[3 * i + 0], points_ptr[3 * i + 1],
-                            points_ptr[3 * i + 2], colors_ptr[3 * i + 0],
-                            colors_ptr[3 * i + 1], colors_ptr[3 * i + 2]) < 0) {
-                    utility::LogWarning(
-                            "Write PTS failed: unable to write file: {}",
-                            filename);
-                    return false;
-                }
 
-                if (i % 1000 == 0) {
-                    reporter.Update(i);
-                }
+        auto format_row = [&](int64_t i, char *buffer, size_t size) {
+            // X Y Z I R G B.
+            if (colors_ptr && intensities_ptr) {
+                return snprintf(buffer, size,
+                                "%.10f %.10f %.10f %.10f %d %d %d\r\n",
+                                points_ptr[3 * i + 0], points_ptr[3 * i + 1],
+                                points_ptr[3 * i + 2], intensities_ptr[i],
+                                colors_ptr[3 * i + 0], colors_ptr[3 * i + 1],
+                                colors_ptr[3 * i + 2]);
             }
-        }
-        // X Y Z I.
-        else if (pointcloud.HasPointAttr("intensities")) {
-            intensities_ptr = pointcloud.GetPointAttr("intensities")
-                                      .To(core::Float64)
-                                      .GetDataPtr<double>();
-            for (int i = 0; i < num_points; i++) {
-                if (fprintf(file.GetFILE(), "%.10f %.10f %.10f %.10f\r\n",
-                            points_ptr[3 * i + 0], points_ptr[3 * i + 1],
-                            points_ptr[3 * i + 2], intensities_ptr[i]) < 0) {
-                    utility::LogWarning(
-                            "Write PTS failed: unable to write file: {}",
-                            filename);
-                    return false;
-                }
-
-                if (i % 1000 == 0) {
-                    reporter.Update(i);
-                }
+            // X Y Z R G B.
+            else if (colors_ptr) {
+                return snprintf(buffer, size, "%.10f %.10f %.10f %d %d %d\r\n",
+                                points_ptr[3 * i + 0], points_ptr[3 * i + 1],
+                                points_ptr[3 * i + 2], colors_ptr[3 * i + 0],
+                                colors_ptr[3 * i + 1], colors_ptr[3 * i + 2]);
             }
-        }
-        // X Y Z.
-        else {
-            for (int i = 0; i < num_points; i++) {
-                if (fprintf(file.GetFILE(), "%.10f %.10f %.10f\r\n",
-                            points_ptr[3 * i + 0], points_ptr[3 * i + 1],
-                            points_ptr[3 * i + 2]) < 0) {
-                    utility::LogWarning(
-                            "Write PTS failed: unable to write file: {}",
-                            filename);
-                    return false;
-                }
-
-                if (i % 1000 == 0) {
-                    reporter.Update(i);
-                }
+            // X Y Z I.
+            else if (intensities_ptr) {
+                return snprintf(buffer, size, "%.10f %.10f %.10f %.10f\r\n",
+                                points_ptr[3 * i + 0], points_ptr[3 * i + 1],
+                                points_ptr[3 * i + 2], intensities_ptr[i]);
             }
+            // X Y Z.
+            return snprintf(buffer, size, "%.10f %.10f %.10f\r\n",
+                            points_ptr[3 * i + 0], points_ptr[3 * i + 1],
+                            points_ptr[3 * i + 2]);
+        };
+        if (!open3d::io::WriteASCIIRows(file, num_points, format_row,
+                                        &reporter)) {
+            utility::LogWarning("Write PTS failed: unable to write file: {}",
+                                filename);
+            return false;
         }
 
         reporter.Finish();
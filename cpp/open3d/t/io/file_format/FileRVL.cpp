@@ -0,0 +1,344 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+#include "open3d/core/ParallelFor.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+// File layout, in little endian:
+// - char[4] magic "RVL1"
+// - uint32 rows, cols, rows per band and number of bands
+// - uint64 number of 32-bit words coding each band
+// - the words of all the bands
+static const char kRVLMagic[4] = {'R', 'V', 'L', '1'};
+static constexpr int64_t kRVLBandRows = 32;
+
+static bool IsLittleEndian() {
+    const uint16_t one = 1;
+    return *reinterpret_cast<const uint8_t *>(&one) == 1;
+}
+
+/// Convert values between the host and the file byte order in-place.
+template <typename T>
+static void SwapToLittleEndian(T *values, int64_t count) {
+    if (IsLittleEndian()) {
+        return;
+    }
+    for (int64_t i = 0; i < count; ++i) {
+        uint8_t *bytes = reinterpret_cast<uint8_t *>(values + i);
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+}
+
+namespace {
+
+/// Append variable length codes of 3-bit nibbles with a continuation bit,
+/// packed 8 per 32-bit word from the most significant bits.
+class RVLEncoder {
+public:
+    explicit RVLEncoder(std::vector<uint32_t> &words) : words_(words) {}
+
+    void Encode(uint32_t value) {
+        do {
+            uint32_t nibble = value & 0x7;
+            value >>= 3;
+            if (value) {
+                nibble |= 0x8;
+            }
+            word_ = (word_ << 4) | nibble;
+            if (++num_nibbles_ == 8) {
+                words_.push_back(word_);
+                word_ = 0;
+                num_nibbles_ = 0;
+            }
+        } while (value);
+    }
+
+    void Flush() {
+        if (num_nibbles_ > 0) {
+            words_.push_back(word_ << (4 * (8 - num_nibbles_)));
+            word_ = 0;
+            num_nibbles_ = 0;
+        }
+    }
+
+private:
+    std::vector<uint32_t> &words_;
+    uint32_t word_ = 0;
+    int num_nibbles_ = 0;
+};
+
+class RVLDecoder {
+public:
+    RVLDecoder(const uint32_t *begin, const uint32_t *end)
+        : ptr_(begin), end_(end) {}
+
+    /// Return false if the words end before the value, or it overflows.
+    bool Decode(uint32_t &value) {
+        value = 0;
+        uint32_t nibble;
+        int shift = 0;
+        do {
+            if (num_nibbles_ == 0) {
+                if (ptr_ == end_) {
+                    return false;
+                }
+                word_ = *ptr_++;
+                num_nibbles_ = 8;
+            }
+            nibble = word_ >> 28;
+            word_ <<= 4;
+            --num_nibbles_;
+            if (shift > 30) {
+                return false;
+            }
+            value |= (nibble & 0x7) << shift;
+            shift += 3;
+        } while (nibble & 0x8);
+        return true;
+    }
+
+private:
+    const uint32_t *ptr_;
+    const uint32_t *end_;
+    uint32_t word_ = 0;
+    int num_nibbles_ = 0;
+};
+
+}  // namespace
+
+/// Code runs of zeros, runs of valid pixels and the zigzag coded difference
+/// of each valid pixel to the previous one.
+static void EncodeRVL(const uint16_t *pixels,
+                      int64_t num_pixels,
+                      std::vector<uint32_t> &words) {
+    RVLEncoder encoder(words);
+    const uint16_t *end = pixels + num_pixels;
+    int32_t previous = 0;
+    while (pixels < end) {
+        const uint16_t *run = pixels;
+        while (pixels < end && *pixels == 0) {
+            ++pixels;
+        }
+        encoder.Encode(static_cast<uint32_t>(pixels - run));
+        run = pixels;
+        while (pixels < end && *pixels != 0) {
+            ++pixels;
+        }
+        encoder.Encode(static_cast<uint32_t>(pixels - run));
+        for (; run < pixels; ++run) {
+            const int32_t delta = static_cast<int32_t>(*run) - previous;
+            encoder.Encode((static_cast<uint32_t>(delta) << 1) ^
+                           static_cast<uint32_t>(delta >> 31));
+            previous = *run;
+        }
+    }
+    encoder.Flush();
+}
+
+static bool DecodeRVL(const uint32_t *words,
+                      int64_t num_words,
+                      uint16_t *pixels,
+                      int64_t num_pixels) {
+    RVLDecoder decoder(words, words + num_words);
+    int32_t previous = 0;
+    int64_t i = 0;
+    while (i < num_pixels) {
+        uint32_t num_zeros, num_valid;
+        if (!decoder.Decode(num_zeros) || num_zeros > num_pixels - i) {
+            return false;
+        }
+        std::memset(pixels + i, 0, num_zeros * sizeof(uint16_t));
+        i += num_zeros;
+        if (!decoder.Decode(num_valid) || num_valid > num_pixels - i) {
+            return false;
+        }
+        for (uint32_t k = 0; k < num_valid; ++k) {
+            uint32_t code;
+            if (!decoder.Decode(code)) {
+                return false;
+            }
+            previous += static_cast<int32_t>(code >> 1) ^
+                        -static_cast<int32_t>(code & 1);
+            pixels[i++] = static_cast<uint16_t>(previous);
+        }
+    }
+    return true;
+}
+
+bool ReadImageFromRVL(const std::string &filename, geometry::Image &image) {
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "rb")) {
+        utility::LogWarning("Read RVL failed: unable to open file: {}, {}",
+                            filename, file.GetError());
+        return false;
+    }
+    try {
+        char magic[4];
+        uint32_t header[4];
+        if (file.ReadData(magic, 1, 4) != 4 ||
+            std::memcmp(magic, kRVLMagic, 4) != 0 ||
+            file.ReadData(header, sizeof(uint32_t), 4) != 4) {
+            utility::LogWarning("Read RVL failed: invalid header in {}",
+                                filename);
+            return false;
+        }
+        SwapToLittleEndian(header, 4);
+        const int64_t rows = header[0];
+        const int64_t cols = header[1];
+        const int64_t band_rows = header[2];
+        const int64_t num_bands = header[3];
+        if (band_rows <= 0 ||
+            num_bands != (rows + band_rows - 1) / band_rows) {
+            utility::LogWarning("Read RVL failed: invalid header in {}",
+                                filename);
+            return false;
+        }
+
+        std::vector<uint64_t> band_offsets(num_bands + 1, 0);
+        if (file.ReadData(band_offsets.data() + 1, sizeof(uint64_t),
+                          num_bands) != static_cast<size_t>(num_bands)) {
+            utility::LogWarning("Read RVL failed: invalid header in {}",
+                                filename);
+            return false;
+        }
+        SwapToLittleEndian(band_offsets.data() + 1, num_bands);
+        const uint64_t max_words = file.GetFileSize() / sizeof(uint32_t);
+        for (int64_t b = 0; b < num_bands; ++b) {
+            if (band_offsets[b + 1] > max_words - band_offsets[b]) {
+                utility::LogWarning("Read RVL failed: {} is truncated.",
+                                    filename);
+                return false;
+            }
+            band_offsets[b + 1] += band_offsets[b];
+        }
+        const int64_t num_words = static_cast<int64_t>(band_offsets.back());
+        std::vector<uint32_t> words(num_words);
+        if (file.ReadData(words.data(), sizeof(uint32_t), num_words) !=
+            static_cast<size_t>(num_words)) {
+            utility::LogWarning("Read RVL failed: {} is truncated.", filename);
+            return false;
+        }
+        SwapToLittleEndian(words.data(), num_words);
+
+        image.Reset(rows, cols, 1, core::UInt16, image.GetDevice());
+        uint16_t *pixels = static_cast<uint16_t *>(image.GetDataPtr());
+        std::atomic<bool> success(true);
+        core::ParallelFor(core::Device("CPU:0"), num_bands, [&](int64_t b) {
+            const int64_t first_row = b * band_rows;
+            const int64_t num_rows = std::min(band_rows, rows - first_row);
+            if (!DecodeRVL(words.data() + band_offsets[b],
+                           band_offsets[b + 1] - band_offsets[b],
+                           pixels + first_row * cols, num_rows * cols)) {
+                success = false;
+            }
+        });
+        if (!success) {
+            utility::LogWarning("Read RVL failed: {} is corrupted.", filename);
+            return false;
+        }
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read RVL failed: {}", e.what());
+        return false;
+    }
+    return true;
+}
+
+bool WriteImageToRVL(const std::string &filename,
+                     const geometry::Image &image,
+                     int quality) {
+    if (image.IsEmpty()) {
+        utility::LogWarning("Write RVL failed: image has no data.");
+        return false;
+    }
+    if (image.GetDtype() != core::UInt16 || image.GetChannels() != 1) {
+        utility::LogWarning(
+                "Write RVL failed: image must be UInt16 with 1 channel.");
+        return false;
+    }
+    const core::Tensor data =
+            image.AsTensor().To(core::Device("CPU:0")).Contiguous();
+    const uint16_t *pixels = data.GetDataPtr<uint16_t>();
+    const int64_t rows = image.GetRows();
+    const int64_t cols = image.GetCols();
+    const int64_t num_bands = (rows + kRVLBandRows - 1) / kRVLBandRows;
+
+    std::vector<std::vector<uint32_t>> band_words(num_bands);
+    core::ParallelFor(core::Device("CPU:0"), num_bands, [&](int64_t b) {
+        const int64_t first_row = b * kRVLBandRows;
+        const int64_t num_rows = std::min(kRVLBandRows, rows - first_row);
+        band_words[b].reserve(num_rows * cols / 2);
+        EncodeRVL(pixels + first_row * cols, num_rows * cols, band_words[b]);
+    });
+
+    uint32_t header[4] = {static_cast<uint32_t>(rows),
+                          static_cast<uint32_t>(cols),
+                          static_cast<uint32_t>(kRVLBandRows),
+                          static_cast<uint32_t>(num_bands)};
+    std::vector<uint64_t> band_sizes(num_bands);
+    for (int64_t b = 0; b < num_bands; ++b) {
+        band_sizes[b] = band_words[b].size();
+        SwapToLittleEndian(band_words[b].data(), band_sizes[b]);
+    }
+    SwapToLittleEndian(header, 4);
+    SwapToLittleEndian(band_sizes.data(), num_bands);
+
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write RVL failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = fwrite(kRVLMagic, 1, 4, file) == 4 &&
+                   fwrite(header, sizeof(uint32_t), 4, file) == 4 &&
+                   fwrite(band_sizes.data(), sizeof(uint64_t), num_bands,
+                          file) == static_cast<size_t>(num_bands);
+    for (int64_t b = 0; success && b < num_bands; ++b) {
+        success = fwrite(band_words[b].data(), sizeof(uint32_t),
+                         band_words[b].size(),
+                         file) == band_words[b].size();
+    }
+    success = fclose(file) == 0 && success;
+    if (!success) {
+        utility::LogWarning("Write RVL failed: unable to write file: {}",
+                            filename);
+    }
+    return success;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -29,6 +29,7 @@
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/file_format/ASCIIRowsIO.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
@@ -54,27 +55,25 @@ bool ReadPointCloudFromXYZI(const std::string &filename,
         }
         utility::CountingProgressReporter reporter(params.update_progress);
         reporter.SetTotal(file.GetFileSize());
-        int64_t num_points = file.GetNumLines();
 
         pointcloud.Clear();
+        std::vector<double> values;
+        const int64_t num_points = open3d::io::ReadASCIIRows(
+                file, 4, -1, false, values, &reporter);
+        if (num_points < 0) {
+            utility::LogWarning("Read XYZI failed: unable to read file: {}",
+                                filename);
+            return false;
+        }
         core::Tensor points({num_points, 3}, core::Float64);
         core::Tensor intensities({num_points, 1}, core::Float64);
         double *points_ptr = points.GetDataPtr<double>();
         double *intensities_ptr = intensities.GetDataPtr<double>();
-
-        int i = 0;
-        double x, y, z, I;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf", &x, &y, &z, &I) == 4) {
-                points_ptr[3 * i + 0] = x;
-                points_ptr[3 * i + 1] = y;
-                points_ptr[3 * i + 2] = z;
-                intensities_ptr[i] = I;
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
+        for (int64_t i = 0; i < num_points; i++) {
+            points_ptr[3 * i + 0] = values[4 * i + 0];
+            points_ptr[3 * i + 1] = values[4 * i + 1];
+            points_ptr[3 * i + 2] = values[4 * i + 2];
+            intensities_ptr[i] = values[4 * i + 3];
         }
         pointcloud.SetPointPositions(points);
         pointcloud.SetPointAttr("intensities", intensities);
@@ -121,20 +120,29 @@ bool WritePointCloudToXYZI(const std::string &filename,
         }
         reporter.SetTotal(points.GetShape(0));
 
-        for (int i = 0; i < points.GetShape(0); i++) {
-            if (fprintf(file.GetFILE(), "%.10f %.10f %.10f %.10f\n",
-                        points[i][0].Item<double>(),
-                        points[i][1].Item<double>(),
-                        points[i][2].Item<double>(),
-                        intensities[i][0].Item<double>()) < 0) {
-                utility::LogWarning(
-                        "Write XYZI failed: unable to write file: {}",
-                        filename);
-                return false;  // error happened during writing.
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+        const int64_t num_points = points.GetShape(0);
+        const core::Tensor points_f64 =
+                points.To(core::Device("CPU:0"), core::Float64).Contiguous();
+        const core::Tensor intensities_f64 =
+                intensities.To(core::Device("CPU:0"), core::Float64)
+                        .Contiguous();
+        const double *points_ptr = points_f64.GetDataPtr<double>();
+        const double *intensities_ptr = intensities_f64.GetDataPtr<double>();
+        // Only the first intensity channel is written.
+        const int64_t intensities_stride =
+                num_points > 0 ? intensities_f64.NumElements() / num_points : 0;
+
+        auto format_row = [&](int64_t i, char *buffer, size_t size) {
+            return snprintf(buffer, size, "%.10f %.10f %.10f %.10f\n",
+                            points_ptr[3 * i + 0], points_ptr[3 * i + 1],
+                            points_ptr[3 * i + 2],
+                            intensities_ptr[i * intensities_stride]);
+        };
+        if (!open3d::io::WriteASCIIRows(file, num_points, format_row,
+                                        &reporter)) {
+            utility::LogWarning("Write XYZI failed: unable to write file: {}",
+                                filename);
+            return false;  // error happened during writing.
         }
         reporter.Finish();
         return true;
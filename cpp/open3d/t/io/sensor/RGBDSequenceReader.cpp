@@ -0,0 +1,404 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/RGBDSequenceReader.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "open3d/io/IJsonConvertibleIO.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+static constexpr double kDefaultFPS = 30.0;
+
+static std::vector<uint64_t> GetTimestampsAtFPS(size_t num_frames,
+                                                double fps) {
+    std::vector<uint64_t> timestamps(num_frames);
+    for (size_t i = 0; i < num_frames; ++i) {
+        timestamps[i] = static_cast<uint64_t>(std::round(i * 1e6 / fps));
+    }
+    return timestamps;
+}
+
+/// List color and depth images in the subfolders of folder, sorted by name.
+static bool ListFramesInFolder(const std::string &folder,
+                               std::vector<std::string> &color_filenames,
+                               std::vector<std::string> &depth_filenames) {
+    std::string color_folder;
+    for (const std::string name : {"color", "rgb", "image"}) {
+        if (utility::filesystem::DirectoryExists(folder + "/" + name)) {
+            color_folder = folder + "/" + name;
+            break;
+        }
+    }
+    const std::string depth_folder = folder + "/depth";
+    if (color_folder.empty() ||
+        !utility::filesystem::DirectoryExists(depth_folder)) {
+        utility::LogWarning(
+                "Folder {} has no color, rgb or image subfolder, or no depth "
+                "subfolder.",
+                folder);
+        return false;
+    }
+
+    auto list_images = [](const std::string &image_folder,
+                          std::vector<std::string> &filenames) {
+        std::vector<std::string> all_filenames;
+        utility::filesystem::ListFilesInDirectory(image_folder, all_filenames);
+        for (const std::string &filename : all_filenames) {
+            const std::string ext =
+                    utility::filesystem::GetFileExtensionInLowerCase(filename);
+            if (ext == "png" || ext == "jpg" || ext == "jpeg") {
+                filenames.push_back(filename);
+            }
+        }
+        std::sort(filenames.begin(), filenames.end());
+    };
+    list_images(color_folder, color_filenames);
+    list_images(depth_folder, depth_filenames);
+    if (color_filenames.size() != depth_filenames.size()) {
+        utility::LogWarning(
+                "Numbers of color ({}) and depth ({}) images mismatch in {}.",
+                color_filenames.size(), depth_filenames.size(), folder);
+        return false;
+    }
+    return true;
+}
+
+/// Read a TUM RGB-D or ICL-NUIM style association file.
+static bool ReadAssociationFile(const std::string &filename,
+                                std::vector<std::string> &color_filenames,
+                                std::vector<std::string> &depth_filenames,
+                                std::vector<uint64_t> &timestamps) {
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "r")) {
+        utility::LogWarning("Failed to open association file {}: {}.",
+                            filename, file.GetError());
+        return false;
+    }
+    std::string parent =
+            utility::filesystem::GetFileParentDirectory(filename);
+
+    std::vector<double> times;
+    bool integer_times = true;
+    try {
+        const char *line;
+        while ((line = file.ReadLine())) {
+            std::vector<std::string> tokens =
+                    utility::SplitString(line, " \t\r\n");
+            if (tokens.empty() || tokens[0][0] == '#') {
+                continue;
+            }
+            if (tokens.size() != 4) {
+                utility::LogWarning(
+                        "Association file {} has an invalid line: {}",
+                        filename, line);
+                return false;
+            }
+            // The image with 'depth' in its path is the depth one.
+            const bool depth_first =
+                    utility::ContainsString(tokens[1], "depth") &&
+                    !utility::ContainsString(tokens[3], "depth");
+            const std::string &color = tokens[depth_first ? 3 : 1];
+            const std::string &depth = tokens[depth_first ? 1 : 3];
+            color_filenames.push_back(color[0] == '/' ? color : parent + color);
+            depth_filenames.push_back(depth[0] == '/' ? depth : parent + depth);
+
+            const double time = std::stod(tokens[depth_first ? 2 : 0]);
+            integer_times = integer_times && time == std::floor(time);
+            times.push_back(time);
+        }
+    } catch (const std::exception &e) {
+        utility::LogWarning("Failed to read association file {}: {}", filename,
+                            e.what());
+        return false;
+    }
+
+    // Timestamps in us relative to the first frame.
+    timestamps.resize(times.size());
+    for (size_t i = 0; i < times.size(); ++i) {
+        double seconds = integer_times ? times[i] / kDefaultFPS : times[i];
+        double first = integer_times ? times[0] / kDefaultFPS : times[0];
+        timestamps[i] = static_cast<uint64_t>(
+                std::round(std::max(0.0, seconds - first) * 1e6));
+    }
+    return true;
+}
+
+RGBDSequenceReader::RGBDSequenceReader(size_t buffer_size,
+                                       int num_threads,
+                                       const core::Device &device)
+    : buffer_size_(buffer_size), num_threads_(num_threads), device_(device) {
+    if (buffer_size_ == 0) {
+        utility::LogError("buffer_size must be positive.");
+    }
+    if (num_threads_ <= 0) {
+        utility::LogError("num_threads must be positive, but got {}.",
+                          num_threads_);
+    }
+    num_threads_ = std::min(num_threads_, static_cast<int>(buffer_size_));
+}
+
+RGBDSequenceReader::~RGBDSequenceReader() { Close(); }
+
+bool RGBDSequenceReader::IsEOF() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return next_frame_ >= GetNumFrames();
+}
+
+bool RGBDSequenceReader::Open(const std::string &filename) {
+    std::vector<std::string> color_filenames, depth_filenames;
+    std::vector<uint64_t> timestamps;
+    RGBDVideoMetadata metadata;
+    bool has_metadata = false;
+    if (utility::filesystem::DirectoryExists(filename)) {
+        if (!ListFramesInFolder(filename, color_filenames, depth_filenames)) {
+            return false;
+        }
+        const std::string metadata_filename = filename + "/intrinsic.json";
+        if (utility::filesystem::FileExists(metadata_filename)) {
+            has_metadata = open3d::io::ReadIJsonConvertibleFromJSON(
+                    metadata_filename, metadata);
+        }
+        timestamps = GetTimestampsAtFPS(
+                color_filenames.size(),
+                has_metadata && metadata.fps_ > 0 ? metadata.fps_
+                                                  : kDefaultFPS);
+    } else if (!ReadAssociationFile(filename, color_filenames,
+                                    depth_filenames, timestamps)) {
+        return false;
+    }
+
+    if (!Open(color_filenames, depth_filenames, timestamps)) {
+        return false;
+    }
+    filename_ = filename;
+    if (has_metadata) {
+        const uint64_t stream_length_usec = metadata_.stream_length_usec_;
+        metadata_ = metadata;
+        metadata_.stream_length_usec_ = stream_length_usec;
+    }
+    return true;
+}
+
+bool RGBDSequenceReader::Open(const std::vector<std::string> &color_filenames,
+                              const std::vector<std::string> &depth_filenames,
+                              const std::vector<uint64_t> &timestamps) {
+    if (IsOpened()) {
+        Close();
+    }
+    if (color_filenames.empty() ||
+        color_filenames.size() != depth_filenames.size()) {
+        utility::LogWarning(
+                "Numbers of color ({}) and depth ({}) images must be equal "
+                "and positive.",
+                color_filenames.size(), depth_filenames.size());
+        return false;
+    }
+    if (!timestamps.empty() && timestamps.size() != color_filenames.size()) {
+        utility::LogWarning("Numbers of timestamps and frames mismatch.");
+        return false;
+    }
+
+    // The first frame gives the metadata.
+    geometry::Image color, depth;
+    if (!ReadImage(color_filenames[0], color) ||
+        !ReadImage(depth_filenames[0], depth)) {
+        utility::LogWarning("Failed to read the first frame {} and {}.",
+                            color_filenames[0], depth_filenames[0]);
+        return false;
+    }
+    color_filenames_ = color_filenames;
+    depth_filenames_ = depth_filenames;
+    timestamps_ = timestamps.empty()
+                          ? GetTimestampsAtFPS(color_filenames.size(),
+                                               kDefaultFPS)
+                          : timestamps;
+
+    const size_t n = timestamps_.size();
+    metadata_ = RGBDVideoMetadata();
+    metadata_.width_ = static_cast<int>(color.GetCols());
+    metadata_.height_ = static_cast<int>(color.GetRows());
+    metadata_.color_dt_ = color.GetDtype();
+    metadata_.depth_dt_ = depth.GetDtype();
+    metadata_.color_channels_ = static_cast<uint8_t>(color.GetChannels());
+    metadata_.depth_scale_ = 1000.0;
+    metadata_.fps_ = n > 1 && timestamps_.back() > timestamps_.front()
+                             ? (n - 1) * 1e6 /
+                                       (timestamps_.back() - timestamps_[0])
+                             : kDefaultFPS;
+    metadata_.stream_length_usec_ =
+            timestamps_.back() +
+            static_cast<uint64_t>(std::round(1e6 / metadata_.fps_));
+
+    filename_ = "";
+    slots_ = std::vector<Slot>(buffer_size_);
+    next_frame_ = 0;
+    next_decode_ = 0;
+    timestamp_ = 0;
+    stop_ = false;
+    for (int i = 0; i < num_threads_; ++i) {
+        workers_.emplace_back(&RGBDSequenceReader::DecodeFrames, this);
+    }
+    is_opened_ = true;
+    return true;
+}
+
+void RGBDSequenceReader::Close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    frame_needed_.notify_all();
+    for (std::thread &worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+    slots_.clear();
+    is_opened_ = false;
+}
+
+bool RGBDSequenceReader::SeekTimestamp(uint64_t timestamp) {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return false;
+    }
+    auto it = std::lower_bound(timestamps_.begin(), timestamps_.end(),
+                               timestamp);
+    if (it == timestamps_.end()) {
+        utility::LogWarning("Timestamp {} exceeds maximum {} (us).", timestamp,
+                            timestamps_.back());
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++generation_;
+        next_frame_ = next_decode_ = it - timestamps_.begin();
+        for (Slot &slot : slots_) {
+            slot.frame = -1;
+            slot.rgbd = geometry::RGBDImage();
+        }
+    }
+    frame_needed_.notify_all();
+    return true;
+}
+
+uint64_t RGBDSequenceReader::GetTimestamp() const {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return UINT64_MAX;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    return timestamp_;
+}
+
+t::geometry::RGBDImage RGBDSequenceReader::NextFrame() {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (next_frame_ >= GetNumFrames()) {
+        utility::LogInfo("EOF reached");
+        return t::geometry::RGBDImage();
+    }
+    // The slot is not reused for a later frame until next_frame_ moves on.
+    const int64_t frame = next_frame_;
+    Slot &slot = slots_[frame % slots_.size()];
+    frame_ready_.wait(lock, [&]() { return slot.frame == frame; });
+    t::geometry::RGBDImage rgbd = slot.rgbd;
+    const bool success = slot.success;
+    slot.rgbd = geometry::RGBDImage();
+    slot.frame = -1;
+    ++next_frame_;
+    timestamp_ = timestamps_[frame];
+    lock.unlock();
+    frame_needed_.notify_all();
+
+    if (!success) {
+        utility::LogError("Failed to read frame {} from {} and {}.", frame,
+                          color_filenames_[frame], depth_filenames_[frame]);
+    }
+    return rgbd;
+}
+
+void RGBDSequenceReader::DecodeFrames() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        frame_needed_.wait(lock, [this]() {
+            return stop_ || (next_decode_ < GetNumFrames() &&
+                             next_decode_ < next_frame_ +
+                                                    static_cast<int64_t>(
+                                                            slots_.size()));
+        });
+        if (stop_) {
+            return;
+        }
+        const int64_t frame = next_decode_++;
+        const uint64_t generation = generation_;
+        Slot &slot = slots_[frame % slots_.size()];
+        // Take the buffers out of the slot, so that they are reused only if
+        // the previous frame in the slot is no longer referenced.
+        geometry::Image color = slot.color;
+        geometry::Image depth = slot.depth;
+        slot.color = geometry::Image();
+        slot.depth = geometry::Image();
+        lock.unlock();
+
+        geometry::RGBDImage rgbd;
+        bool success = false;
+        try {
+            success = ReadImage(color_filenames_[frame], color) &&
+                      ReadImage(depth_filenames_[frame], depth);
+            if (success) {
+                rgbd = geometry::RGBDImage(color, depth).To(device_);
+            }
+        } catch (const std::exception &e) {
+            utility::LogWarning("{}", e.what());
+            success = false;
+        }
+
+        lock.lock();
+        if (generation == generation_) {
+            slot.color = color;
+            slot.depth = depth;
+            slot.rgbd = rgbd;
+            slot.success = success;
+            slot.frame = frame;
+            frame_ready_.notify_all();
+        }
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
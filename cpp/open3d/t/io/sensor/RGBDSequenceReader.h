@@ -0,0 +1,171 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/t/io/sensor/RGBDVideoReader.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class RGBDSequenceReader
+///
+/// \brief Reader of RGBD frames stored as separate color and depth images.
+///
+/// Supported inputs:
+///  - A folder with color images in a 'color', 'rgb' or 'image' subfolder and
+///  depth images in a 'depth' subfolder, paired in the order of their file
+///  names, e.g. written by RGBDVideoReader::SaveFrames. The metadata is read
+///  from 'intrinsic.json' in the folder if it exists.
+///  - A TUM RGB-D or ICL-NUIM style association file (.txt) with lines
+///  'timestamp path timestamp path', and '#' for comments. Paths are relative
+///  to the association file, and the one containing 'depth' is the depth
+///  image. Timestamps are in seconds, or frame indices if all are integers.
+///
+/// Frames ahead of the current one are decoded by a pool of worker threads
+/// and returned in order. Decoded images are reused for later frames once
+/// they are no longer referenced, so dropping a frame before the next call to
+/// NextFrame avoids reallocations.
+///
+/// Without 'intrinsic.json', the metadata is filled from the first frame with
+/// 30 fps and a depth scale of 1000, and the intrinsics are not set.
+class RGBDSequenceReader : public RGBDVideoReader {
+public:
+    static const size_t DEFAULT_BUFFER_SIZE = 8;
+
+    /// Constructor
+    ///
+    /// \param buffer_size Number of frames decoded ahead.
+    /// \param num_threads Number of decoding threads, at most buffer_size.
+    /// \param device Device of the returned frames. Frames are moved there by
+    /// the decoding threads.
+    explicit RGBDSequenceReader(
+            size_t buffer_size = DEFAULT_BUFFER_SIZE,
+            int num_threads = 4,
+            const core::Device &device = core::Device("CPU:0"));
+
+    RGBDSequenceReader(const RGBDSequenceReader &) = delete;
+    RGBDSequenceReader &operator=(const RGBDSequenceReader &) = delete;
+    virtual ~RGBDSequenceReader();
+
+    /// Check if a sequence is opened.
+    virtual bool IsOpened() const override { return is_opened_; }
+
+    /// Check if all the frames are read.
+    virtual bool IsEOF() const override;
+
+    /// Open an image folder or an association file.
+    ///
+    /// \param filename Path to the folder or the association file.
+    virtual bool Open(const std::string &filename) override;
+
+    /// Open a sequence of color and depth images.
+    ///
+    /// \param color_filenames Paths to the color images.
+    /// \param depth_filenames Paths to the depth images.
+    /// \param timestamps Frame timestamps in us. Empty for 30 fps.
+    bool Open(const std::vector<std::string> &color_filenames,
+              const std::vector<std::string> &depth_filenames,
+              const std::vector<uint64_t> &timestamps = {});
+
+    /// Close the opened sequence and stop the decoding threads.
+    virtual void Close() override;
+
+    /// Get (read-only) metadata of the sequence.
+    virtual const RGBDVideoMetadata &GetMetadata() const override {
+        return metadata_;
+    }
+
+    /// Get reference to the metadata of the sequence.
+    virtual RGBDVideoMetadata &GetMetadata() override { return metadata_; }
+
+    /// Seek to the first frame at or after the timestamp (in us).
+    virtual bool SeekTimestamp(uint64_t timestamp) override;
+
+    /// Get timestamp (in us) of the last frame returned by NextFrame.
+    virtual uint64_t GetTimestamp() const override;
+
+    /// Get the next frame, or an empty frame at the end of the sequence.
+    virtual t::geometry::RGBDImage NextFrame() override;
+
+    /// Return the folder or association file being read.
+    virtual std::string GetFilename() const override { return filename_; };
+
+    /// Number of frames in the sequence.
+    int64_t GetNumFrames() const {
+        return static_cast<int64_t>(color_filenames_.size());
+    }
+
+    using RGBDVideoReader::SaveFrames;
+    using RGBDVideoReader::ToString;
+
+private:
+    /// Decoding buffer and result of one frame ahead.
+    struct Slot {
+        int64_t frame = -1;  ///< Decoded frame, or -1 if not ready.
+        bool success = false;
+        geometry::Image color;
+        geometry::Image depth;
+        geometry::RGBDImage rgbd;
+    };
+
+    void DecodeFrames();
+
+    size_t buffer_size_;
+    int num_threads_;
+    core::Device device_;
+
+    std::string filename_;
+    RGBDVideoMetadata metadata_;
+    std::vector<std::string> color_filenames_;
+    std::vector<std::string> depth_filenames_;
+    std::vector<uint64_t> timestamps_;
+    bool is_opened_ = false;
+
+    mutable std::mutex mutex_;
+    std::condition_variable frame_needed_;
+    std::condition_variable frame_ready_;
+    std::vector<Slot> slots_;
+    int64_t next_frame_ = 0;   ///< Next frame returned by NextFrame.
+    int64_t next_decode_ = 0;  ///< Next frame taken by a decoding thread.
+    uint64_t timestamp_ = 0;
+    /// Incremented on seek, so that frames decoded before are discarded.
+    uint64_t generation_ = 0;
+    bool stop_ = false;
+    std::vector<std::thread> workers_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -30,6 +30,7 @@
 
 #include "open3d/io/IJsonConvertibleIO.h"
 #include "open3d/io/ImageIO.h"
+#include "open3d/t/io/sensor/RGBDSequenceReader.h"
 #include "open3d/t/io/sensor/realsense/RSBagReader.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -97,6 +98,12 @@ void RGBDVideoReader::SaveFrames(const std::string &frame_path,
 
 std::unique_ptr<RGBDVideoReader> RGBDVideoReader::Create(
         const std::string &filename) {
+    if (utility::filesystem::DirectoryExists(filename) ||
+        utility::filesystem::GetFileExtensionInLowerCase(filename) == "txt") {
+        auto reader = std::make_unique<RGBDSequenceReader>();
+        reader->Open(filename);
+        return reader;
+    }
 #ifdef BUILD_LIBREALSENSE
     if (utility::ToLower(filename).compare(filename.length() - 4, 4, ".bag") ==
         0) {
@@ -89,6 +89,8 @@ public:
     virtual std::string ToString() const;
 
     /// Factory function to create object based on RGBD video file type.
+    /// Image folders and association files (.txt) are read with
+    /// RGBDSequenceReader, and RealSense bag files with RSBagReader.
     static std::unique_ptr<RGBDVideoReader> Create(const std::string &filename);
 };
 
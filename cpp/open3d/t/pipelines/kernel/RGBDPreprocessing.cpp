@@ -0,0 +1,189 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/RGBDPreprocessing.h"
+
+#include "open3d/core/TensorCheck.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace odometry {
+
+void PreprocessRGBD(const core::Tensor &raw_depth,
+                    const core::Tensor &raw_color,
+                    core::Tensor &depth,
+                    core::Tensor &intensity,
+                    core::Tensor &color,
+                    float depth_scale,
+                    float depth_max) {
+    core::AssertTensorDtypes(raw_depth, {core::UInt16, core::Float32});
+    core::AssertTensorDtype(depth, core::Float32);
+
+    const core::Device device = raw_depth.GetDevice();
+    core::AssertTensorDevice(depth, device);
+    if (intensity.NumElements() > 0 || color.NumElements() > 0) {
+        core::AssertTensorDtypes(raw_color,
+                                 {core::UInt8, core::UInt16, core::Float32});
+        core::AssertTensorDevice(raw_color, device);
+        if (raw_color.GetShape(0) != raw_depth.GetShape(0) ||
+            raw_color.GetShape(1) != raw_depth.GetShape(1)) {
+            utility::LogError(
+                    "Color image shape {} mismatch with depth image shape {}.",
+                    raw_color.GetShape(), raw_depth.GetShape());
+        }
+    }
+    if (intensity.NumElements() > 0) {
+        core::AssertTensorDtype(intensity, core::Float32);
+        core::AssertTensorDevice(intensity, device);
+    }
+    if (color.NumElements() > 0) {
+        core::AssertTensorDtype(color, core::Float32);
+        core::AssertTensorDevice(color, device);
+    }
+
+    if (device.IsCPU()) {
+        PreprocessRGBDCPU(raw_depth, raw_color, depth, intensity, color,
+                          depth_scale, depth_max);
+    } else if (device.IsCUDA()) {
+        CUDA_CALL(PreprocessRGBDCUDA, raw_depth, raw_color, depth, intensity,
+                  color, depth_scale, depth_max);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+void PyrDownRGBD(const core::Tensor &depth,
+                 const core::Tensor &intensity,
+                 core::Tensor &depth_down,
+                 core::Tensor &intensity_down,
+                 float depth_diff) {
+    core::AssertTensorDtype(depth, core::Float32);
+    core::AssertTensorDtype(depth_down, core::Float32);
+
+    const core::Device device = depth.GetDevice();
+    core::AssertTensorDevice(depth_down, device);
+    if (intensity_down.NumElements() > 0) {
+        core::AssertTensorDtype(intensity, core::Float32);
+        core::AssertTensorDtype(intensity_down, core::Float32);
+        core::AssertTensorDevice(intensity, device);
+        core::AssertTensorDevice(intensity_down, device);
+    }
+
+    if (device.IsCPU()) {
+        PyrDownRGBDCPU(depth, intensity, depth_down, intensity_down,
+                       depth_diff);
+    } else if (device.IsCUDA()) {
+        CUDA_CALL(PyrDownRGBDCUDA, depth, intensity, depth_down,
+                  intensity_down, depth_diff);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+void FilterBilateralDepth(const core::Tensor &depth,
+                          core::Tensor &depth_smooth,
+                          int kernel_size,
+                          float value_sigma,
+                          float dist_sigma) {
+    core::AssertTensorDtype(depth, core::Float32);
+    core::AssertTensorDtype(depth_smooth, core::Float32);
+
+    const core::Device device = depth.GetDevice();
+    core::AssertTensorDevice(depth_smooth, device);
+    if (kernel_size <= 0 || kernel_size % 2 == 0) {
+        utility::LogError("Kernel size must be a positive odd number, got {}.",
+                          kernel_size);
+    }
+    if (value_sigma <= 0 || dist_sigma <= 0) {
+        utility::LogError("Sigmas must be positive, got {} and {}.",
+                          value_sigma, dist_sigma);
+    }
+
+    if (device.IsCPU()) {
+        FilterBilateralDepthCPU(depth, depth_smooth, kernel_size, value_sigma,
+                                dist_sigma);
+    } else if (device.IsCUDA()) {
+        CUDA_CALL(FilterBilateralDepthCUDA, depth, depth_smooth, kernel_size,
+                  value_sigma, dist_sigma);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+void ComputeRGBDLevel(const core::Tensor &depth,
+                      const core::Tensor &depth_smooth,
+                      const core::Tensor &intensity,
+                      const core::Tensor &intrinsics,
+                      core::Tensor &vertex_map,
+                      core::Tensor &normal_map,
+                      core::Tensor &depth_dx,
+                      core::Tensor &depth_dy,
+                      core::Tensor &intensity_dx,
+                      core::Tensor &intensity_dy) {
+    core::AssertTensorDtype(depth, core::Float32);
+    core::AssertTensorShape(intrinsics, {3, 3});
+
+    const core::Device device = depth.GetDevice();
+    for (const core::Tensor *output :
+         {&vertex_map, &normal_map, &depth_dx, &depth_dy, &intensity_dx,
+          &intensity_dy}) {
+        if (output->NumElements() > 0) {
+            core::AssertTensorDtype(*output, core::Float32);
+            core::AssertTensorDevice(*output, device);
+        }
+    }
+    if (normal_map.NumElements() > 0) {
+        core::AssertTensorDtype(depth_smooth, core::Float32);
+        core::AssertTensorDevice(depth_smooth, device);
+    }
+    if (intensity_dx.NumElements() > 0 || intensity_dy.NumElements() > 0) {
+        core::AssertTensorDtype(intensity, core::Float32);
+        core::AssertTensorDevice(intensity, device);
+    }
+
+    static const core::Device host("CPU:0");
+    core::Tensor intrinsics_d = intrinsics.To(host, core::Float64).Contiguous();
+
+    if (device.IsCPU()) {
+        ComputeRGBDLevelCPU(depth, depth_smooth, intensity, intrinsics_d,
+                            vertex_map, normal_map, depth_dx, depth_dy,
+                            intensity_dx, intensity_dy);
+    } else if (device.IsCUDA()) {
+        CUDA_CALL(ComputeRGBDLevelCUDA, depth, depth_smooth, intensity,
+                  intrinsics_d, vertex_map, normal_map, depth_dx, depth_dy,
+                  intensity_dx, intensity_dy);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+}  // namespace odometry
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
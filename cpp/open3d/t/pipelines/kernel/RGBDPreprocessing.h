@@ -0,0 +1,150 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace odometry {
+
+/// Converts a raw depth image (UInt16 or Float32) to Float32 meters, with
+/// values out of (0, depth_max) set to NaN. In the same pass, converts the
+/// color image (UInt8, UInt16 or Float32) to a Float32 intensity image in the
+/// units of the input color, and to a Float32 color image in [0, 1]. Outputs
+/// are preallocated; empty \p intensity or \p color are skipped.
+void PreprocessRGBD(const core::Tensor &raw_depth,
+                    const core::Tensor &raw_color,
+                    core::Tensor &depth,
+                    core::Tensor &intensity,
+                    core::Tensor &color,
+                    float depth_scale,
+                    float depth_max);
+
+/// Downsamples the depth (as Image::PyrDownDepth) and intensity (5x5 Gaussian
+/// then subsampled, as Image::PyrDown) by 2 in one pass. An empty \p intensity
+/// is skipped.
+void PyrDownRGBD(const core::Tensor &depth,
+                 const core::Tensor &intensity,
+                 core::Tensor &depth_down,
+                 core::Tensor &intensity_down,
+                 float depth_diff);
+
+/// Bilateral filter on a Float32 depth image in which NaN pixels are invalid
+/// and excluded from the filter window.
+void FilterBilateralDepth(const core::Tensor &depth,
+                          core::Tensor &depth_smooth,
+                          int kernel_size,
+                          float value_sigma,
+                          float dist_sigma);
+
+/// Computes vertex map, normal map (from \p depth_smooth), and Sobel gradients
+/// of depth and intensity of one pyramid level in one pass. Empty outputs are
+/// skipped.
+void ComputeRGBDLevel(const core::Tensor &depth,
+                      const core::Tensor &depth_smooth,
+                      const core::Tensor &intensity,
+                      const core::Tensor &intrinsics,
+                      core::Tensor &vertex_map,
+                      core::Tensor &normal_map,
+                      core::Tensor &depth_dx,
+                      core::Tensor &depth_dy,
+                      core::Tensor &intensity_dx,
+                      core::Tensor &intensity_dy);
+
+void PreprocessRGBDCPU(const core::Tensor &raw_depth,
+                       const core::Tensor &raw_color,
+                       core::Tensor &depth,
+                       core::Tensor &intensity,
+                       core::Tensor &color,
+                       float depth_scale,
+                       float depth_max);
+
+void PyrDownRGBDCPU(const core::Tensor &depth,
+                    const core::Tensor &intensity,
+                    core::Tensor &depth_down,
+                    core::Tensor &intensity_down,
+                    float depth_diff);
+
+void FilterBilateralDepthCPU(const core::Tensor &depth,
+                             core::Tensor &depth_smooth,
+                             int kernel_size,
+                             float value_sigma,
+                             float dist_sigma);
+
+void ComputeRGBDLevelCPU(const core::Tensor &depth,
+                         const core::Tensor &depth_smooth,
+                         const core::Tensor &intensity,
+                         const core::Tensor &intrinsics,
+                         core::Tensor &vertex_map,
+                         core::Tensor &normal_map,
+                         core::Tensor &depth_dx,
+                         core::Tensor &depth_dy,
+                         core::Tensor &intensity_dx,
+                         core::Tensor &intensity_dy);
+
+#ifdef BUILD_CUDA_MODULE
+void PreprocessRGBDCUDA(const core::Tensor &raw_depth,
+                        const core::Tensor &raw_color,
+                        core::Tensor &depth,
+                        core::Tensor &intensity,
+                        core::Tensor &color,
+                        float depth_scale,
+                        float depth_max);
+
+void PyrDownRGBDCUDA(const core::Tensor &depth,
+                     const core::Tensor &intensity,
+                     core::Tensor &depth_down,
+                     core::Tensor &intensity_down,
+                     float depth_diff);
+
+void FilterBilateralDepthCUDA(const core::Tensor &depth,
+                              core::Tensor &depth_smooth,
+                              int kernel_size,
+                              float value_sigma,
+                              float dist_sigma);
+
+void ComputeRGBDLevelCUDA(const core::Tensor &depth,
+                          const core::Tensor &depth_smooth,
+                          const core::Tensor &intensity,
+                          const core::Tensor &intrinsics,
+                          core::Tensor &vertex_map,
+                          core::Tensor &normal_map,
+                          core::Tensor &depth_dx,
+                          core::Tensor &depth_dy,
+                          core::Tensor &intensity_dx,
+                          core::Tensor &intensity_dy);
+#endif
+
+}  // namespace odometry
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
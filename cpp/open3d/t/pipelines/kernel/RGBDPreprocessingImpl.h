@@ -0,0 +1,487 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <limits>
+
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/GeometryIndexer.h"
+#include "open3d/t/geometry/kernel/GeometryMacros.h"
+#include "open3d/t/pipelines/kernel/RGBDPreprocessing.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace odometry {
+
+using t::geometry::kernel::NDArrayIndexer;
+using t::geometry::kernel::TransformIndexer;
+
+#ifndef __CUDACC__
+using std::isnan;
+#endif
+
+#define DISPATCH_RGBD_DTYPE_TO_TEMPLATE(DEPTH_DTYPE, COLOR_DTYPE, ...)         \
+    [&] {                                                                      \
+        if (DEPTH_DTYPE != core::UInt16 && DEPTH_DTYPE != core::Float32) {     \
+            utility::LogError("Unsupported depth data type {}.",               \
+                              DEPTH_DTYPE.ToString());                         \
+        }                                                                      \
+        if (COLOR_DTYPE != core::UInt8 && COLOR_DTYPE != core::UInt16 &&       \
+            COLOR_DTYPE != core::Float32) {                                    \
+            utility::LogError("Unsupported color data type {}.",               \
+                              COLOR_DTYPE.ToString());                         \
+        }                                                                      \
+        if (DEPTH_DTYPE == core::UInt16 && COLOR_DTYPE == core::UInt8) {       \
+            using depth_t = uint16_t;                                          \
+            using color_t = uint8_t;                                           \
+            return __VA_ARGS__();                                              \
+        } else if (DEPTH_DTYPE == core::UInt16 &&                              \
+                   COLOR_DTYPE == core::UInt16) {                              \
+            using depth_t = uint16_t;                                          \
+            using color_t = uint16_t;                                          \
+            return __VA_ARGS__();                                              \
+        } else if (DEPTH_DTYPE == core::UInt16) {                              \
+            using depth_t = uint16_t;                                          \
+            using color_t = float;                                             \
+            return __VA_ARGS__();                                              \
+        } else if (COLOR_DTYPE == core::UInt8) {                               \
+            using depth_t = float;                                             \
+            using color_t = uint8_t;                                           \
+            return __VA_ARGS__();                                              \
+        } else if (COLOR_DTYPE == core::UInt16) {                              \
+            using depth_t = float;                                             \
+            using color_t = uint16_t;                                          \
+            return __VA_ARGS__();                                              \
+        } else {                                                               \
+            using depth_t = float;                                             \
+            using color_t = float;                                             \
+            return __VA_ARGS__();                                              \
+        }                                                                      \
+    }()
+
+#ifdef __CUDACC__
+void PreprocessRGBDCUDA
+#else
+void PreprocessRGBDCPU
+#endif
+        (const core::Tensor& raw_depth,
+         const core::Tensor& raw_color,
+         core::Tensor& depth,
+         core::Tensor& intensity,
+         core::Tensor& color,
+         float depth_scale,
+         float depth_max) {
+    const bool has_intensity = intensity.NumElements() > 0;
+    const bool has_color = color.NumElements() > 0;
+
+    NDArrayIndexer raw_depth_indexer(raw_depth, 2);
+    NDArrayIndexer depth_indexer(depth, 2);
+    NDArrayIndexer raw_color_indexer, intensity_indexer, color_indexer;
+    core::Dtype color_dtype = core::UInt8;
+    if (has_intensity || has_color) {
+        raw_color_indexer = NDArrayIndexer(raw_color, 2);
+        color_dtype = raw_color.GetDtype();
+    }
+    if (has_intensity) {
+        intensity_indexer = NDArrayIndexer(intensity, 2);
+    }
+    if (has_color) {
+        color_indexer = NDArrayIndexer(color, 2);
+    }
+
+    // Float32 color for integration is normalized to [0, 1].
+    float color_scale = 1.0f;
+    if (color_dtype == core::UInt8) {
+        color_scale = 1.0f / 255.0f;
+    } else if (color_dtype == core::UInt16) {
+        color_scale = 1.0f / 65535.0f;
+    }
+
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const int64_t cols = raw_depth.GetShape(1);
+    const int64_t n = raw_depth.GetShape(0) * cols;
+
+    DISPATCH_RGBD_DTYPE_TO_TEMPLATE(raw_depth.GetDtype(), color_dtype, [&]() {
+        core::ParallelFor(
+                raw_depth.GetDevice(), n,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t y = workload_idx / cols;
+                    int64_t x = workload_idx % cols;
+
+                    float d = static_cast<float>(
+                                      *raw_depth_indexer.GetDataPtr<depth_t>(
+                                              x, y)) /
+                              depth_scale;
+                    *depth_indexer.GetDataPtr<float>(x, y) =
+                            (d > 0 && d < depth_max) ? d : nan;
+
+                    if (!has_intensity && !has_color) {
+                        return;
+                    }
+                    const color_t* rgb =
+                            raw_color_indexer.GetDataPtr<color_t>(x, y);
+                    float r = static_cast<float>(rgb[0]);
+                    float g = static_cast<float>(rgb[1]);
+                    float b = static_cast<float>(rgb[2]);
+                    if (has_intensity) {
+                        *intensity_indexer.GetDataPtr<float>(x, y) =
+                                0.299f * r + 0.587f * g + 0.114f * b;
+                    }
+                    if (has_color) {
+                        float* c = color_indexer.GetDataPtr<float>(x, y);
+                        c[0] = r * color_scale;
+                        c[1] = g * color_scale;
+                        c[2] = b * color_scale;
+                    }
+                });
+    });
+}
+
+// Depth follows PyrDownDepth, intensity follows PyrDown, i.e. a 5x5 Gaussian
+// (sigma = 1) with replicated border, subsampled at even pixels.
+#ifdef __CUDACC__
+void PyrDownRGBDCUDA
+#else
+void PyrDownRGBDCPU
+#endif
+        (const core::Tensor& depth,
+         const core::Tensor& intensity,
+         core::Tensor& depth_down,
+         core::Tensor& intensity_down,
+         float depth_diff) {
+    const bool has_intensity = intensity_down.NumElements() > 0;
+
+    NDArrayIndexer depth_indexer(depth, 2);
+    NDArrayIndexer depth_down_indexer(depth_down, 2);
+    NDArrayIndexer intensity_indexer, intensity_down_indexer;
+    if (has_intensity) {
+        intensity_indexer = NDArrayIndexer(intensity, 2);
+        intensity_down_indexer = NDArrayIndexer(intensity_down, 2);
+    }
+
+    const int rows = static_cast<int>(depth.GetShape(0));
+    const int cols = static_cast<int>(depth.GetShape(1));
+    const int cols_down = static_cast<int>(depth_down.GetShape(1));
+    const int64_t n = depth_down.GetShape(0) * cols_down;
+
+    const int kernel_radius = 2;
+    const float dweights[3] = {0.375f, 0.25f, 0.0625f};
+    float gweights[3];
+    float gweight_sum = 0;
+    for (int i = 0; i <= kernel_radius; ++i) {
+        gweights[i] = std::exp(-0.5f * i * i);
+        gweight_sum += (i == 0 ? 1 : 2) * gweights[i];
+    }
+    for (int i = 0; i <= kernel_radius; ++i) {
+        gweights[i] /= gweight_sum;
+    }
+    const float gw0 = gweights[0], gw1 = gweights[1], gw2 = gweights[2];
+
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+
+#ifndef __CUDACC__
+    using std::abs;
+    using std::max;
+    using std::min;
+#endif
+
+    core::ParallelFor(
+            depth.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                int y = static_cast<int>(workload_idx / cols_down);
+                int x = static_cast<int>(workload_idx % cols_down);
+                int y_src = 2 * y;
+                int x_src = 2 * x;
+
+                if (has_intensity) {
+                    const float gw[3] = {gw0, gw1, gw2};
+                    float v_sum = 0;
+                    for (int dy = -kernel_radius; dy <= kernel_radius; ++dy) {
+                        int yk = min(max(y_src + dy, 0), rows - 1);
+                        float row_sum = 0;
+                        for (int dx = -kernel_radius; dx <= kernel_radius;
+                             ++dx) {
+                            int xk = min(max(x_src + dx, 0), cols - 1);
+                            row_sum += gw[abs(dx)] *
+                                       *intensity_indexer.GetDataPtr<float>(
+                                               xk, yk);
+                        }
+                        v_sum += gw[abs(dy)] * row_sum;
+                    }
+                    *intensity_down_indexer.GetDataPtr<float>(x, y) = v_sum;
+                }
+
+                float v_center = *depth_indexer.GetDataPtr<float>(x_src, y_src);
+                float* out = depth_down_indexer.GetDataPtr<float>(x, y);
+                if (isnan(v_center)) {
+                    *out = nan;
+                    return;
+                }
+
+                int x_min = max(0, x_src - kernel_radius);
+                int y_min = max(0, y_src - kernel_radius);
+                int x_max = min(cols - 1, x_src + kernel_radius);
+                int y_max = min(rows - 1, y_src + kernel_radius);
+
+                float v_sum = 0;
+                float w_sum = 0;
+                for (int yk = y_min; yk <= y_max; ++yk) {
+                    for (int xk = x_min; xk <= x_max; ++xk) {
+                        float v = *depth_indexer.GetDataPtr<float>(xk, yk);
+                        if (!isnan(v) && abs(v - v_center) < depth_diff) {
+                            float w = dweights[abs(xk - x_src)] *
+                                      dweights[abs(yk - y_src)];
+                            v_sum += w * v;
+                            w_sum += w;
+                        }
+                    }
+                }
+                *out = w_sum == 0 ? nan : v_sum / w_sum;
+            });
+}
+
+#ifdef __CUDACC__
+void FilterBilateralDepthCUDA
+#else
+void FilterBilateralDepthCPU
+#endif
+        (const core::Tensor& depth,
+         core::Tensor& depth_smooth,
+         int kernel_size,
+         float value_sigma,
+         float dist_sigma) {
+    NDArrayIndexer depth_indexer(depth, 2);
+    NDArrayIndexer depth_smooth_indexer(depth_smooth, 2);
+
+    const int rows = static_cast<int>(depth.GetShape(0));
+    const int cols = static_cast<int>(depth.GetShape(1));
+    const int64_t n = static_cast<int64_t>(rows) * cols;
+
+    const int kernel_radius = kernel_size / 2;
+    const float inv_value_var = 0.5f / (value_sigma * value_sigma);
+    const float inv_dist_var = 0.5f / (dist_sigma * dist_sigma);
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+
+#ifndef __CUDACC__
+    using std::exp;
+    using std::max;
+    using std::min;
+#endif
+
+    core::ParallelFor(
+            depth.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                int y = static_cast<int>(workload_idx / cols);
+                int x = static_cast<int>(workload_idx % cols);
+
+                float v_center = *depth_indexer.GetDataPtr<float>(x, y);
+                float* out = depth_smooth_indexer.GetDataPtr<float>(x, y);
+                if (isnan(v_center)) {
+                    *out = nan;
+                    return;
+                }
+
+                int x_min = max(0, x - kernel_radius);
+                int y_min = max(0, y - kernel_radius);
+                int x_max = min(cols - 1, x + kernel_radius);
+                int y_max = min(rows - 1, y + kernel_radius);
+
+                float v_sum = 0;
+                float w_sum = 0;
+                for (int yk = y_min; yk <= y_max; ++yk) {
+                    for (int xk = x_min; xk <= x_max; ++xk) {
+                        float v = *depth_indexer.GetDataPtr<float>(xk, yk);
+                        if (isnan(v)) continue;
+                        float dv = v - v_center;
+                        float dist2 = static_cast<float>((xk - x) * (xk - x) +
+                                                         (yk - y) * (yk - y));
+                        float w = exp(-dv * dv * inv_value_var -
+                                      dist2 * inv_dist_var);
+                        v_sum += w * v;
+                        w_sum += w;
+                    }
+                }
+                *out = v_sum / w_sum;
+            });
+}
+
+#ifdef __CUDACC__
+void ComputeRGBDLevelCUDA
+#else
+void ComputeRGBDLevelCPU
+#endif
+        (const core::Tensor& depth,
+         const core::Tensor& depth_smooth,
+         const core::Tensor& intensity,
+         const core::Tensor& intrinsics,
+         core::Tensor& vertex_map,
+         core::Tensor& normal_map,
+         core::Tensor& depth_dx,
+         core::Tensor& depth_dy,
+         core::Tensor& intensity_dx,
+         core::Tensor& intensity_dy) {
+    const bool has_vertex = vertex_map.NumElements() > 0;
+    const bool has_normal = normal_map.NumElements() > 0;
+    const bool has_depth_grad =
+            depth_dx.NumElements() > 0 && depth_dy.NumElements() > 0;
+    const bool has_intensity_grad =
+            intensity_dx.NumElements() > 0 && intensity_dy.NumElements() > 0;
+
+    NDArrayIndexer depth_indexer(depth, 2);
+    NDArrayIndexer depth_smooth_indexer, intensity_indexer;
+    NDArrayIndexer vertex_indexer, normal_indexer;
+    NDArrayIndexer depth_dx_indexer, depth_dy_indexer;
+    NDArrayIndexer intensity_dx_indexer, intensity_dy_indexer;
+    if (has_vertex) {
+        vertex_indexer = NDArrayIndexer(vertex_map, 2);
+    }
+    if (has_normal) {
+        depth_smooth_indexer = NDArrayIndexer(depth_smooth, 2);
+        normal_indexer = NDArrayIndexer(normal_map, 2);
+    }
+    if (has_depth_grad) {
+        depth_dx_indexer = NDArrayIndexer(depth_dx, 2);
+        depth_dy_indexer = NDArrayIndexer(depth_dy, 2);
+    }
+    if (has_intensity_grad) {
+        intensity_indexer = NDArrayIndexer(intensity, 2);
+        intensity_dx_indexer = NDArrayIndexer(intensity_dx, 2);
+        intensity_dy_indexer = NDArrayIndexer(intensity_dy, 2);
+    }
+    TransformIndexer ti(intrinsics, core::Tensor::Eye(4, core::Float64,
+                                                      core::Device("CPU:0")));
+
+    const int rows = static_cast<int>(depth.GetShape(0));
+    const int cols = static_cast<int>(depth.GetShape(1));
+    const int64_t n = static_cast<int64_t>(rows) * cols;
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+
+#ifndef __CUDACC__
+    using std::max;
+    using std::min;
+    using std::sqrt;
+#endif
+
+    core::ParallelFor(
+            depth.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                int y = static_cast<int>(workload_idx / cols);
+                int x = static_cast<int>(workload_idx % cols);
+
+                // 3x3 Sobel with replicated border, matching FilterSobel.
+                auto sobel = [=] OPEN3D_DEVICE(const NDArrayIndexer& indexer,
+                                               float* dx, float* dy) {
+                    int xl = max(x - 1, 0), xr = min(x + 1, cols - 1);
+                    int yt = max(y - 1, 0), yb = min(y + 1, rows - 1);
+                    float tl = *indexer.GetDataPtr<float>(xl, yt);
+                    float tc = *indexer.GetDataPtr<float>(x, yt);
+                    float tr = *indexer.GetDataPtr<float>(xr, yt);
+                    float ml = *indexer.GetDataPtr<float>(xl, y);
+                    float mr = *indexer.GetDataPtr<float>(xr, y);
+                    float bl = *indexer.GetDataPtr<float>(xl, yb);
+                    float bc = *indexer.GetDataPtr<float>(x, yb);
+                    float br = *indexer.GetDataPtr<float>(xr, yb);
+                    *dx = (tr + 2 * mr + br) - (tl + 2 * ml + bl);
+                    *dy = (bl + 2 * bc + br) - (tl + 2 * tc + tr);
+                };
+
+                if (has_depth_grad) {
+                    sobel(depth_indexer,
+                          depth_dx_indexer.GetDataPtr<float>(x, y),
+                          depth_dy_indexer.GetDataPtr<float>(x, y));
+                }
+                if (has_intensity_grad) {
+                    sobel(intensity_indexer,
+                          intensity_dx_indexer.GetDataPtr<float>(x, y),
+                          intensity_dy_indexer.GetDataPtr<float>(x, y));
+                }
+
+                if (has_vertex) {
+                    float d = *depth_indexer.GetDataPtr<float>(x, y);
+                    float* vertex = vertex_indexer.GetDataPtr<float>(x, y);
+                    if (isnan(d)) {
+                        vertex[0] = vertex[1] = vertex[2] = nan;
+                    } else {
+                        ti.Unproject(static_cast<float>(x),
+                                     static_cast<float>(y), d, vertex + 0,
+                                     vertex + 1, vertex + 2);
+                    }
+                }
+
+                if (has_normal) {
+                    // Same as CreateNormalMap on the vertex map of the
+                    // smoothed depth, without materializing that map.
+                    float* normal = normal_indexer.GetDataPtr<float>(x, y);
+                    normal[0] = normal[1] = normal[2] = nan;
+                    if (x >= cols - 1 || y >= rows - 1) {
+                        return;
+                    }
+                    float d00 = *depth_smooth_indexer.GetDataPtr<float>(x, y);
+                    float d10 =
+                            *depth_smooth_indexer.GetDataPtr<float>(x + 1, y);
+                    float d01 =
+                            *depth_smooth_indexer.GetDataPtr<float>(x, y + 1);
+                    if (isnan(d00) || isnan(d10) || isnan(d01)) {
+                        return;
+                    }
+
+                    float v00[3], v10[3], v01[3];
+                    ti.Unproject(static_cast<float>(x), static_cast<float>(y),
+                                 d00, v00 + 0, v00 + 1, v00 + 2);
+                    ti.Unproject(static_cast<float>(x + 1),
+                                 static_cast<float>(y), d10, v10 + 0, v10 + 1,
+                                 v10 + 2);
+                    ti.Unproject(static_cast<float>(x),
+                                 static_cast<float>(y + 1), d01, v01 + 0,
+                                 v01 + 1, v01 + 2);
+
+                    float dx0 = v01[0] - v00[0];
+                    float dy0 = v01[1] - v00[1];
+                    float dz0 = v01[2] - v00[2];
+
+                    float dx1 = v10[0] - v00[0];
+                    float dy1 = v10[1] - v00[1];
+                    float dz1 = v10[2] - v00[2];
+
+                    float nx = dy0 * dz1 - dz0 * dy1;
+                    float ny = dz0 * dx1 - dx0 * dz1;
+                    float nz = dx0 * dy1 - dy0 * dx1;
+
+                    constexpr float EPSILON = 1e-5f;
+                    float norm = sqrt(nx * nx + ny * ny + nz * nz);
+                    norm = max(norm, EPSILON);
+                    normal[0] = nx / norm;
+                    normal[1] = ny / norm;
+                    normal[2] = nz / norm;
+                }
+            });
+}
+
+}  // namespace odometry
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
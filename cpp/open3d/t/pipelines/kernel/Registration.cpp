@@ -26,6 +26,8 @@
 
 #include "open3d/t/pipelines/kernel/Registration.h"
 
+#include <cmath>
+
 #include "open3d/core/TensorCheck.h"
 #include "open3d/t/pipelines/kernel/RegistrationImpl.h"
 
@@ -68,6 +70,62 @@ core::Tensor ComputePosePointToPlane(const core::Tensor &source_points,
     return pose;
 }
 
+core::Tensor ComputePosePointToPlaneFused(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::nns::NearestNeighborSearch &target_nns,
+        const double max_correspondence_distance,
+        const registration::RobustKernel &kernel,
+        double &fitness,
+        double &inlier_rmse) {
+    const core::Device device = source_points.GetDevice();
+    const core::Dtype dtype = source_points.GetDtype();
+
+    core::AssertTensorDevice(target_points, device);
+    core::AssertTensorDtype(target_points, dtype);
+    core::AssertTensorDtype(target_normals, dtype);
+
+    if (!source_points.IsCPU()) {
+        utility::LogError(
+                "ComputePosePointToPlaneFused is only implemented for CPU "
+                "device.");
+    }
+
+    const core::nns::NanoFlannIndex *target_index =
+            target_nns.GetNanoFlannIndex();
+    if (target_index == nullptr) {
+        utility::LogError("Index is not set.");
+    }
+
+    // Pose {6,} tensor [output].
+    core::Tensor pose = core::Tensor::Zeros({6}, core::Float64, device);
+
+    double squared_error = 0;
+    int inlier_count = 0;
+
+    ComputePosePointToPlaneFusedCPU(
+            source_points.Contiguous(), target_points.Contiguous(),
+            target_normals.Contiguous(), *target_index,
+            max_correspondence_distance, pose, squared_error, inlier_count,
+            dtype, device, kernel);
+
+    if (inlier_count > 0) {
+        fitness = static_cast<double>(inlier_count) /
+                  static_cast<double>(source_points.GetLength());
+        inlier_rmse = std::sqrt(squared_error / inlier_count);
+    } else {
+        fitness = 0.0;
+        inlier_rmse = 0.0;
+    }
+
+    utility::LogDebug(
+            "PointToPlane Fused Transform: squared_error {}, inlier_count {}",
+            squared_error, inlier_count);
+
+    return pose;
+}
+
 core::Tensor ComputePoseColoredICP(const core::Tensor &source_points,
                                    const core::Tensor &source_colors,
                                    const core::Tensor &target_points,
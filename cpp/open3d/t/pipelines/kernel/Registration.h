@@ -27,6 +27,7 @@
 #pragma once
 
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/t/pipelines/registration/Registration.h"
 #include "open3d/t/pipelines/registration/RobustKernel.h"
 
@@ -55,6 +56,41 @@ core::Tensor ComputePosePointToPlane(const core::Tensor &source_positions,
                                      const core::Tensor &correspondence_indices,
                                      const registration::RobustKernel &kernel);
 
+/// \brief Computes pose for point to plane registration method, with the
+/// nearest neighbor search fused into the reduction of the linear system.
+///
+/// Each source point queries its nearest target point, evaluates the residual,
+/// Jacobian and robust weight, and accumulates them directly into the 6x6
+/// system, so no correspondence, distance or selected point tensors are
+/// created. Only CPU tensors are supported.
+///
+/// \param source_positions source point positions of Float32 or Float64 dtype.
+/// \param target_positions target point positions of same dtype as source point
+/// positions.
+/// \param target_normals target point normals of same dtype as source point
+/// positions.
+/// \param target_nns NearestNeighborSearch object for target_positions, with
+/// the hybrid index already set.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param kernel statistical robust kernel for outlier rejection.
+/// \param fitness [output] The overlapping area (# of inlier correspondences /
+/// # of points in source), before the returned pose is applied.
+/// \param inlier_rmse [output] RMSE of all inlier correspondences, before the
+/// returned pose is applied.
+/// \return Pose [alpha beta gamma, tx, ty, tz], a shape {6} tensor of dtype
+/// Float64, where alpha, beta, gamma are the Euler angles in the ZYX order.
+/// The pose is zero if no correspondence is found.
+core::Tensor ComputePosePointToPlaneFused(
+        const core::Tensor &source_positions,
+        const core::Tensor &target_positions,
+        const core::Tensor &target_normals,
+        const core::nns::NearestNeighborSearch &target_nns,
+        const double max_correspondence_distance,
+        const registration::RobustKernel &kernel,
+        double &fitness,
+        double &inlier_rmse);
+
 /// \brief Computes pose for colored-icp registration method.
 ///
 /// \param source_positions source point positions of Float32 or Float64 dtype.
@@ -34,6 +34,7 @@
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/ParallelFor.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NanoFlannImpl.h"
 #include "open3d/t/pipelines/kernel/RegistrationImpl.h"
 #include "open3d/t/pipelines/kernel/TransformationConverter.h"
 #include "open3d/t/pipelines/registration/RobustKernel.h"
@@ -146,6 +147,143 @@ void ComputePosePointToPlaneCPU(const core::Tensor &source_points,
     DecodeAndSolve6x6(global_sum, pose, residual, inlier_count);
 }
 
+template <typename scalar_t, typename int_t, typename func_t>
+static void ComputePosePointToPlaneFusedKernelCPU(
+        const scalar_t *source_points_ptr,
+        const scalar_t *target_points_ptr,
+        const scalar_t *target_normals_ptr,
+        const core::nns::NanoFlannIndexHolder<core::nns::L2, scalar_t, int_t>
+                *holder,
+        const scalar_t max_distance_squared,
+        const int n,
+        scalar_t *global_sum,
+        func_t GetWeightFromRobustKernel) {
+    // Same layout as ComputePosePointToPlaneKernelCPU, except that the 27th
+    // element accumulates the squared correspondence distance, which is
+    // required for the inlier rmse of the registration result.
+    std::vector<scalar_t> A_1x29(29, 0.0);
+
+#ifdef _WIN32
+    std::vector<scalar_t> zeros_29(29, 0.0);
+    A_1x29 = tbb::parallel_reduce(
+            tbb::blocked_range<int>(0, n), zeros_29,
+            [&](tbb::blocked_range<int> r, std::vector<scalar_t> A_reduction) {
+                for (int workload_idx = r.begin(); workload_idx < r.end();
+                     ++workload_idx) {
+#else
+    scalar_t *A_reduction = A_1x29.data();
+#pragma omp parallel for reduction(+ : A_reduction[:29]) schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int workload_idx = 0; workload_idx < n; workload_idx++) {
+#endif
+                    const scalar_t *source_point_ptr =
+                            source_points_ptr + 3 * workload_idx;
+
+                    int_t target_idx = -1;
+                    scalar_t distance2 = 0;
+                    const size_t num_found = holder->index_->knnSearch(
+                            source_point_ptr, 1, &target_idx, &distance2);
+
+                    // Same criterion as the nanoflann radius search used by
+                    // HybridSearch.
+                    if (num_found == 0 || distance2 >= max_distance_squared) {
+                        continue;
+                    }
+
+                    // The correspondence of the current point is passed as a
+                    // single element array, with the source pointer offset.
+                    const int64_t correspondence_index = target_idx;
+                    scalar_t J_ij[6];
+                    scalar_t r = 0;
+
+                    kernel::GetJacobianPointToPlane<scalar_t>(
+                            0, source_point_ptr, target_points_ptr,
+                            target_normals_ptr, &correspondence_index, J_ij,
+                            r);
+
+                    scalar_t w = GetWeightFromRobustKernel(r);
+
+                    // Dump J, r into JtJ and Jtr
+                    int i = 0;
+                    for (int j = 0; j < 6; ++j) {
+                        for (int k = 0; k <= j; ++k) {
+                            A_reduction[i] += J_ij[j] * w * J_ij[k];
+                            ++i;
+                        }
+                        A_reduction[21 + j] += J_ij[j] * w * r;
+                    }
+                    A_reduction[27] += distance2;
+                    A_reduction[28] += 1;
+                }
+#ifdef _WIN32
+                return A_reduction;
+            },
+            // TBB: Defining reduction operation.
+            [&](std::vector<scalar_t> a, std::vector<scalar_t> b) {
+                std::vector<scalar_t> result(29);
+                for (int j = 0; j < 29; ++j) {
+                    result[j] = a[j] + b[j];
+                }
+                return result;
+            });
+#endif
+
+    for (int i = 0; i < 29; ++i) {
+        global_sum[i] = A_1x29[i];
+    }
+}
+
+void ComputePosePointToPlaneFusedCPU(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::nns::NanoFlannIndex &target_index,
+        const double max_correspondence_distance,
+        core::Tensor &pose,
+        double &squared_error,
+        int &inlier_count,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const registration::RobustKernel &kernel) {
+    int n = source_points.GetLength();
+
+    core::Tensor global_sum = core::Tensor::Zeros({29}, dtype, device);
+
+    DISPATCH_FLOAT_INT_DTYPE_TO_TEMPLATE(
+            dtype, target_index.GetIndexDtype(), [&]() {
+                scalar_t *global_sum_ptr = global_sum.GetDataPtr<scalar_t>();
+                const auto *holder = static_cast<
+                        core::nns::NanoFlannIndexHolder<core::nns::L2,
+                                                        scalar_t, int_t> *>(
+                        target_index.GetIndexHolder());
+                const scalar_t max_distance_squared = static_cast<scalar_t>(
+                        max_correspondence_distance *
+                        max_correspondence_distance);
+
+                DISPATCH_ROBUST_KERNEL_FUNCTION(
+                        kernel.type_, scalar_t, kernel.scaling_parameter_,
+                        kernel.shape_parameter_, [&]() {
+                            kernel::ComputePosePointToPlaneFusedKernelCPU(
+                                    source_points.GetDataPtr<scalar_t>(),
+                                    target_points.GetDataPtr<scalar_t>(),
+                                    target_normals.GetDataPtr<scalar_t>(),
+                                    holder, max_distance_squared, n,
+                                    global_sum_ptr, GetWeightFromRobustKernel);
+                        });
+
+                squared_error = static_cast<double>(global_sum_ptr[27]);
+                inlier_count = static_cast<int>(global_sum_ptr[28]);
+            });
+
+    // The 6x6 system is singular without any correspondence.
+    if (inlier_count == 0) {
+        pose.Fill(0);
+        return;
+    }
+
+    float residual = 0;
+    DecodeAndSolve6x6(global_sum, pose, residual, inlier_count);
+}
+
 template <typename scalar_t, typename funct_t>
 static void ComputePoseColoredICPKernelCPU(
         const scalar_t *source_points_ptr,
@@ -30,6 +30,7 @@
 
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
 #include "open3d/t/pipelines/registration/RobustKernel.h"
 
 namespace open3d {
@@ -48,6 +49,19 @@ void ComputePosePointToPlaneCPU(const core::Tensor &source_points,
                                 const core::Device &device,
                                 const registration::RobustKernel &kernel);
 
+void ComputePosePointToPlaneFusedCPU(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::nns::NanoFlannIndex &target_index,
+        const double max_correspondence_distance,
+        core::Tensor &pose,
+        double &squared_error,
+        int &inlier_count,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const registration::RobustKernel &kernel);
+
 void ComputePoseColoredICPCPU(const core::Tensor &source_points,
                               const core::Tensor &source_colors,
                               const core::Tensor &target_points,
@@ -31,6 +31,7 @@
 #include "open3d/t/geometry/kernel/Image.h"
 #include "open3d/t/pipelines/kernel/RGBDOdometry.h"
 #include "open3d/t/pipelines/kernel/TransformationConverter.h"
+#include "open3d/t/pipelines/odometry/RGBDPreprocessor.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 
 namespace open3d {
@@ -125,30 +126,157 @@ OdometryResult RGBDOdometryMultiScale(
     return OdometryResult(trans_d);
 }
 
-OdometryResult RGBDOdometryMultiScalePointToPlane(
-        const RGBDImage& source,
+// Checks the maps required by the odometry method are computed on all levels.
+static void AssertPyramidMaps(const std::vector<Tensor>& maps,
+                              int64_t n_levels,
+                              const std::string& name) {
+    if (int64_t(maps.size()) != n_levels) {
+        utility::LogError("Pyramid has {} levels of {}, but expected {}.",
+                          maps.size(), name, n_levels);
+    }
+    for (const Tensor& map : maps) {
+        if (map.NumElements() == 0) {
+            utility::LogError(
+                    "Pyramid {} required by the odometry method is empty. Was "
+                    "it built for a different method?",
+                    name);
+        }
+    }
+}
+
+OdometryResult RGBDOdometryMultiScale(
+        const RGBDPyramid& source,
+        const RGBDPyramid& target,
+        const Tensor& init_source_to_target,
+        const std::vector<OdometryConvergenceCriteria>& criteria,
+        const Method method,
+        const OdometryLossParams& params) {
+    const int64_t n_levels = int64_t(criteria.size());
+    AssertPyramidMaps(source.vertex_maps_, n_levels, "source vertex maps");
+    AssertPyramidMaps(target.intrinsics_, n_levels, "target intrinsics");
+    if (method == Method::PointToPlane) {
+        AssertPyramidMaps(target.vertex_maps_, n_levels, "target vertex maps");
+        AssertPyramidMaps(target.normal_maps_, n_levels, "target normal maps");
+    } else {
+        AssertPyramidMaps(source.depth_, n_levels, "source depth");
+        AssertPyramidMaps(target.depth_, n_levels, "target depth");
+        AssertPyramidMaps(source.intensity_, n_levels, "source intensity");
+        AssertPyramidMaps(target.intensity_, n_levels, "target intensity");
+        AssertPyramidMaps(target.intensity_dx_, n_levels,
+                          "target intensity gradients");
+        AssertPyramidMaps(target.intensity_dy_, n_levels,
+                          "target intensity gradients");
+        if (method == Method::Hybrid) {
+            AssertPyramidMaps(target.depth_dx_, n_levels,
+                              "target depth gradients");
+            AssertPyramidMaps(target.depth_dy_, n_levels,
+                              "target depth gradients");
+        }
+    }
+    core::AssertTensorShape(init_source_to_target, {4, 4});
+
+    const core::Device host("CPU:0");
+    const Tensor trans_d =
+            init_source_to_target.To(host, core::Float64).Clone();
+
+    OdometryResult result(trans_d, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
+    for (int64_t i = 0; i < n_levels; ++i) {
+        for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
+            OdometryResult delta_result;
+            if (method == Method::PointToPlane) {
+                delta_result = ComputeOdometryResultPointToPlane(
+                        source.vertex_maps_[i], target.vertex_maps_[i],
+                        target.normal_maps_[i], target.intrinsics_[i],
+                        result.transformation_, params.depth_outlier_trunc_,
+                        params.depth_huber_delta_);
+            } else if (method == Method::Intensity) {
+                delta_result = ComputeOdometryResultIntensity(
+                        source.depth_[i], target.depth_[i],
+                        source.intensity_[i], target.intensity_[i],
+                        target.intensity_dx_[i], target.intensity_dy_[i],
+                        source.vertex_maps_[i], target.intrinsics_[i],
+                        result.transformation_, params.depth_outlier_trunc_,
+                        params.intensity_huber_delta_);
+            } else if (method == Method::Hybrid) {
+                delta_result = ComputeOdometryResultHybrid(
+                        source.depth_[i], target.depth_[i],
+                        source.intensity_[i], target.intensity_[i],
+                        target.depth_dx_[i], target.depth_dy_[i],
+                        target.intensity_dx_[i], target.intensity_dy_[i],
+                        source.vertex_maps_[i], target.intrinsics_[i],
+                        result.transformation_, params.depth_outlier_trunc_,
+                        params.depth_huber_delta_,
+                        params.intensity_huber_delta_);
+            } else {
+                utility::LogError("Odometry method not implemented.");
+            }
+            result.transformation_ =
+                    delta_result.transformation_.Matmul(result.transformation_);
+            utility::LogDebug("level {}, iter {}: rmse = {}, fitness = {}", i,
+                              iter, delta_result.inlier_rmse_,
+                              delta_result.fitness_);
+
+            if (std::abs(result.fitness_ - delta_result.fitness_) /
+                                result.fitness_ <
+                        criteria[i].relative_fitness_ &&
+                std::abs(result.inlier_rmse_ - delta_result.inlier_rmse_) /
+                                result.inlier_rmse_ <
+                        criteria[i].relative_rmse_) {
+                utility::LogDebug("Early exit at level {}, iter {}", i, iter);
+                break;
+            }
+            result.inlier_rmse_ = delta_result.inlier_rmse_;
+            result.fitness_ = delta_result.fitness_;
+        }
+    }
+
+    return result;
+}
+
+// Vertex maps from the coarsest to the finest level of a depth image already
+// processed by ClipTransform.
+static std::vector<Tensor> CreateVertexMapPyramidFromProcessedDepth(
+        const Image& depth,
+        const Tensor& intrinsics,
+        int64_t n_levels,
+        const OdometryLossParams& params) {
+    std::vector<Tensor> vertex_maps(n_levels);
+
+    Image depth_curr = depth;
+    Tensor intrinsics_pyr = intrinsics.Clone();
+    for (int64_t i = 0; i < n_levels; ++i) {
+        Image vertex_map = depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
+        vertex_maps[n_levels - 1 - i] = vertex_map.AsTensor();
+
+        if (i != n_levels - 1) {
+            depth_curr = depth_curr.PyrDownDepth(
+                    params.depth_outlier_trunc_ * 2, NAN);
+
+            intrinsics_pyr /= 2;
+            intrinsics_pyr[-1][-1] = 1;
+        }
+    }
+    return vertex_maps;
+}
+
+static OdometryResult RGBDOdometryMultiScalePointToPlaneFromSourcePyramid(
+        const std::vector<Tensor>& source_vertex_maps,
         const RGBDImage& target,
         const Tensor& intrinsics,
         const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
         const OdometryLossParams& params) {
     int64_t n_levels = int64_t(criteria.size());
-    std::vector<Tensor> source_vertex_maps(n_levels);
     std::vector<Tensor> target_vertex_maps(n_levels);
     std::vector<Tensor> target_normal_maps(n_levels);
     std::vector<Tensor> intrinsic_matrices(n_levels);
 
-    Image source_depth_curr = source.depth_;
     Image target_depth_curr = target.depth_;
 
-    Tensor intrinsics_pyr = intrinsics;
+    Tensor intrinsics_pyr = intrinsics.Clone();
 
     // Create image pyramid.
     for (int64_t i = 0; i < n_levels; ++i) {
-        Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
         Image target_vertex_map =
                 target_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
 
@@ -158,15 +286,12 @@ OdometryResult RGBDOdometryMultiScalePointToPlane(
                 target_depth_curr_smooth.CreateVertexMap(intrinsics_pyr, NAN);
         Image target_normal_map = target_vertex_map_smooth.CreateNormalMap(NAN);
 
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
         target_vertex_maps[n_levels - 1 - i] = target_vertex_map.AsTensor();
         target_normal_maps[n_levels - 1 - i] = target_normal_map.AsTensor();
 
         intrinsic_matrices[n_levels - 1 - i] = intrinsics_pyr.Clone();
 
         if (i != n_levels - 1) {
-            source_depth_curr = source_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
             target_depth_curr = target_depth_curr.PyrDownDepth(
                     params.depth_outlier_trunc_ * 2, NAN);
 
@@ -206,6 +331,80 @@ OdometryResult RGBDOdometryMultiScalePointToPlane(
     return result;
 }
 
+OdometryResult RGBDOdometryMultiScalePointToPlane(
+        const RGBDImage& source,
+        const RGBDImage& target,
+        const Tensor& intrinsics,
+        const Tensor& trans,
+        const float depth_scale,
+        const float depth_max,
+        const std::vector<OdometryConvergenceCriteria>& criteria,
+        const OdometryLossParams& params) {
+    std::vector<Tensor> source_vertex_maps =
+            CreateVertexMapPyramidFromProcessedDepth(
+                    source.depth_, intrinsics, int64_t(criteria.size()),
+                    params);
+    return RGBDOdometryMultiScalePointToPlaneFromSourcePyramid(
+            source_vertex_maps, target, intrinsics, trans, criteria, params);
+}
+
+std::vector<Tensor> CreateVertexMapPyramid(const Image& depth,
+                                           const Tensor& intrinsics,
+                                           const float depth_scale,
+                                           const float depth_max,
+                                           const int num_levels,
+                                           const OdometryLossParams& params) {
+    core::AssertTensorShape(intrinsics, {3, 3});
+    if (num_levels <= 0) {
+        utility::LogError("num_levels must be positive, but got {}.",
+                          num_levels);
+    }
+
+    const core::Device host("CPU:0");
+    const Tensor intrinsics_d = intrinsics.To(host, core::Float64).Clone();
+
+    Image depth_processed = depth.ClipTransform(depth_scale, 0, depth_max, NAN);
+    return CreateVertexMapPyramidFromProcessedDepth(
+            depth_processed, intrinsics_d, num_levels, params);
+}
+
+OdometryResult RGBDOdometryMultiScalePointToPlane(
+        const std::vector<Tensor>& source_vertex_maps,
+        const RGBDImage& target,
+        const Tensor& intrinsics,
+        const Tensor& init_source_to_target,
+        const float depth_scale,
+        const float depth_max,
+        const std::vector<OdometryConvergenceCriteria>& criteria_list,
+        const OdometryLossParams& params) {
+    if (source_vertex_maps.size() != criteria_list.size()) {
+        utility::LogError(
+                "Number of source vertex maps ({}) mismatch with criteria "
+                "({}).",
+                source_vertex_maps.size(), criteria_list.size());
+    }
+    const core::Device device = target.depth_.GetDevice();
+    for (const Tensor& vertex_map : source_vertex_maps) {
+        core::AssertTensorDevice(vertex_map, device);
+    }
+
+    core::AssertTensorShape(intrinsics, {3, 3});
+    core::AssertTensorShape(init_source_to_target, {4, 4});
+
+    const core::Device host("CPU:0");
+    const Tensor intrinsics_d = intrinsics.To(host, core::Float64).Clone();
+    const Tensor trans_d =
+            init_source_to_target.To(host, core::Float64).Clone();
+
+    Image target_depth_processed =
+            target.depth_.ClipTransform(depth_scale, 0, depth_max, NAN);
+    RGBDImage target_processed(target.color_, target_depth_processed);
+
+    return RGBDOdometryMultiScalePointToPlaneFromSourcePyramid(
+            source_vertex_maps, target_processed, intrinsics_d, trans_d,
+            criteria_list, params);
+}
+
 OdometryResult RGBDOdometryMultiScaleIntensity(
         const RGBDImage& source,
         const RGBDImage& target,
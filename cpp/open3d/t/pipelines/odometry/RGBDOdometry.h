@@ -39,6 +39,8 @@ namespace t {
 namespace pipelines {
 namespace odometry {
 
+class RGBDPyramid;
+
 enum class Method {
     PointToPlane,  // Implemented and commented in
                    // ComputeOdometryResultPointToPlane
@@ -174,6 +176,83 @@ OdometryResult RGBDOdometryMultiScale(
         const Method method = Method::Hybrid,
         const OdometryLossParams& params = OdometryLossParams());
 
+/// \brief Perform hierarchical odometry using specified \p method on source and
+/// target pyramids built by RGBDPreprocessor for the same method. Each frame
+/// is preprocessed once and can serve as the target of one frame pair and the
+/// source of the next.
+/// \param source Source RGBD pyramid.
+/// \param target Target RGBD pyramid.
+/// \param init_source_to_target (4, 4) initial transformation matrix from
+/// source to target of core::Float64 on CPU.
+/// \param criteria_list Criteria used to define and terminate iterations, one
+/// per pyramid level from coarse to fine.
+/// \param method Method used to apply RGBD odometry.
+/// \param params Parameters used in loss function, including outlier rejection
+/// threshold and Huber norm parameters.
+/// \return odometry result, with (4, 4) optimized transformation matrix from
+/// source to target, inlier ratio, and fitness.
+OdometryResult RGBDOdometryMultiScale(
+        const RGBDPyramid& source,
+        const RGBDPyramid& target,
+        const core::Tensor& init_source_to_target =
+                core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+        const std::vector<OdometryConvergenceCriteria>& criteria_list = {10, 5,
+                                                                         3},
+        const Method method = Method::Hybrid,
+        const OdometryLossParams& params = OdometryLossParams());
+
+/// \brief Create the source vertex map pyramid used by multi-scale
+/// point-to-plane odometry, ordered from coarse to fine. It only depends on the
+/// source frame, and can be built ahead of tracking, e.g. in another thread.
+///
+/// \param depth Raw source depth image.
+/// \param intrinsics (3, 3) intrinsic matrix for projection.
+/// \param depth_scale Converts depth pixel values to meters by dividing the
+/// scale factor.
+/// \param depth_max Max depth to truncate depth image with noisy measurements.
+/// \param num_levels Number of pyramid levels, equal to the size of the
+/// criteria list used in tracking.
+/// \param params Parameters used in loss function, where the depth outlier
+/// threshold is used in depth downsampling.
+/// \return (rows, cols, channels=3) Float32 vertex maps per level.
+std::vector<core::Tensor> CreateVertexMapPyramid(
+        const t::geometry::Image& depth,
+        const core::Tensor& intrinsics,
+        const float depth_scale = 1000.0f,
+        const float depth_max = 3.0f,
+        const int num_levels = 3,
+        const OdometryLossParams& params = OdometryLossParams());
+
+/// \brief Same as RGBDOdometryMultiScale with Method::PointToPlane, but takes
+/// a source vertex map pyramid created by CreateVertexMapPyramid with the same
+/// depth_scale, depth_max, and params. The results are identical.
+///
+/// \param source_vertex_maps Source vertex maps ordered from coarse to fine.
+/// \param target Target RGBD image.
+/// \param intrinsics (3, 3) intrinsic matrix for projection.
+/// \param init_source_to_target (4, 4) initial transformation matrix from
+/// source to target of core::Float64 on CPU.
+/// \param depth_scale Converts depth pixel values to meters by dividing the
+/// scale factor.
+/// \param depth_max Max depth to truncate depth image with noisy measurements.
+/// \param criteria_list Criteria used to define and terminate iterations, one
+/// per pyramid level.
+/// \param params Parameters used in loss function, including outlier rejection
+/// threshold and Huber norm parameters.
+/// \return odometry result, with (4, 4) optimized transformation matrix from
+/// source to target, inlier ratio, and fitness.
+OdometryResult RGBDOdometryMultiScalePointToPlane(
+        const std::vector<core::Tensor>& source_vertex_maps,
+        const t::geometry::RGBDImage& target,
+        const core::Tensor& intrinsics,
+        const core::Tensor& init_source_to_target =
+                core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+        const float depth_scale = 1000.0f,
+        const float depth_max = 3.0f,
+        const std::vector<OdometryConvergenceCriteria>& criteria_list = {10, 5,
+                                                                         3},
+        const OdometryLossParams& params = OdometryLossParams());
+
 /// \brief Estimates the 4x4 rigid transformation T from source to target, with
 /// inlier rmse and fitness.
 /// Performs one iteration of RGBD odometry using loss function
@@ -0,0 +1,183 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/odometry/RGBDPreprocessor.h"
+
+#include "open3d/core/TensorCheck.h"
+#include "open3d/t/pipelines/kernel/RGBDPreprocessing.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace odometry {
+
+using core::Tensor;
+using t::geometry::RGBDImage;
+
+// Filter parameters shared with the image based multi-scale odometry.
+static constexpr int kBilateralKernelSize = 5;
+static constexpr float kBilateralValueSigma = 5.0f;
+static constexpr float kBilateralDistSigma = 10.0f;
+
+// Keeps the buffer if it already has the shape and device, or allocates it.
+static void ReserveBuffer(Tensor& buffer,
+                          const core::SizeVector& shape,
+                          const core::Device& device) {
+    if (buffer.GetShape() != shape || buffer.GetDevice() != device ||
+        buffer.GetDtype() != core::Float32) {
+        buffer = Tensor::Empty(shape, core::Float32, device);
+    }
+}
+
+RGBDPreprocessor::RGBDPreprocessor(const Tensor& intrinsics,
+                                   int num_levels,
+                                   float depth_scale,
+                                   float depth_max,
+                                   Method method,
+                                   const OdometryLossParams& params,
+                                   bool keep_color)
+    : num_levels_(num_levels),
+      depth_scale_(depth_scale),
+      depth_max_(depth_max),
+      method_(method),
+      params_(params),
+      keep_color_(keep_color) {
+    core::AssertTensorShape(intrinsics, {3, 3});
+    if (num_levels <= 0) {
+        utility::LogError("num_levels must be positive, but got {}.",
+                          num_levels);
+    }
+
+    intrinsics_.resize(num_levels);
+    Tensor intrinsics_pyr =
+            intrinsics.To(core::Device("CPU:0"), core::Float64).Clone();
+    for (int i = num_levels - 1; i >= 0; --i) {
+        intrinsics_[i] = intrinsics_pyr.Clone();
+        intrinsics_pyr /= 2;
+        intrinsics_pyr[-1][-1] = 1;
+    }
+}
+
+void RGBDPreprocessor::Process(const RGBDImage& rgbd,
+                               RGBDPyramid& pyramid) const {
+    const Tensor& raw_depth = rgbd.depth_.AsTensor();
+    const Tensor& raw_color = rgbd.color_.AsTensor();
+    if (rgbd.depth_.IsEmpty() || rgbd.depth_.GetChannels() != 1) {
+        utility::LogError("Expected a non-empty 1 channel depth image.");
+    }
+
+    const bool use_normal = method_ == Method::PointToPlane;
+    const bool use_intensity = method_ != Method::PointToPlane;
+    const bool use_depth_grad = method_ == Method::Hybrid;
+    if ((use_intensity || keep_color_) &&
+        (rgbd.color_.IsEmpty() || rgbd.color_.GetChannels() != 3)) {
+        utility::LogError(
+                "Expected a 3 channel color image for intensity or color.");
+    }
+
+    const int64_t n_levels = num_levels_;
+    int64_t rows = rgbd.depth_.GetRows();
+    int64_t cols = rgbd.depth_.GetCols();
+    if ((rows >> (n_levels - 1)) == 0 || (cols >> (n_levels - 1)) == 0) {
+        utility::LogError("Image of size ({}, {}) too small for {} levels.",
+                          rows, cols, n_levels);
+    }
+
+    const core::Device device = raw_depth.GetDevice();
+    for (std::vector<Tensor>* maps :
+         {&pyramid.depth_, &pyramid.depth_smooth_, &pyramid.vertex_maps_,
+          &pyramid.normal_maps_, &pyramid.depth_dx_, &pyramid.depth_dy_,
+          &pyramid.intensity_, &pyramid.intensity_dx_,
+          &pyramid.intensity_dy_}) {
+        maps->resize(n_levels);
+    }
+    pyramid.intrinsics_ = intrinsics_;
+
+    // Reserve buffers from fine to coarse and drop maps not used by the method.
+    for (int64_t i = n_levels - 1; i >= 0; --i) {
+        const core::SizeVector shape1{rows, cols, 1};
+        const core::SizeVector shape3{rows, cols, 3};
+        auto reserve_or_clear = [&](bool used, Tensor& buffer,
+                                    const core::SizeVector& shape) {
+            if (used) {
+                ReserveBuffer(buffer, shape, device);
+            } else {
+                buffer = Tensor();
+            }
+        };
+        reserve_or_clear(true, pyramid.depth_[i], shape1);
+        reserve_or_clear(true, pyramid.vertex_maps_[i], shape3);
+        reserve_or_clear(use_normal, pyramid.depth_smooth_[i], shape1);
+        reserve_or_clear(use_normal, pyramid.normal_maps_[i], shape3);
+        reserve_or_clear(use_depth_grad, pyramid.depth_dx_[i], shape1);
+        reserve_or_clear(use_depth_grad, pyramid.depth_dy_[i], shape1);
+        reserve_or_clear(use_intensity, pyramid.intensity_[i], shape1);
+        reserve_or_clear(use_intensity, pyramid.intensity_dx_[i], shape1);
+        reserve_or_clear(use_intensity, pyramid.intensity_dy_[i], shape1);
+        if (i == n_levels - 1) {
+            reserve_or_clear(keep_color_, pyramid.color_, shape3);
+        }
+        rows /= 2;
+        cols /= 2;
+    }
+
+    const int64_t finest = n_levels - 1;
+    kernel::odometry::PreprocessRGBD(raw_depth, raw_color,
+                                     pyramid.depth_[finest],
+                                     pyramid.intensity_[finest], pyramid.color_,
+                                     depth_scale_, depth_max_);
+    for (int64_t i = finest; i >= 0; --i) {
+        if (use_normal) {
+            kernel::odometry::FilterBilateralDepth(
+                    pyramid.depth_[i], pyramid.depth_smooth_[i],
+                    kBilateralKernelSize, kBilateralValueSigma,
+                    kBilateralDistSigma);
+        }
+        kernel::odometry::ComputeRGBDLevel(
+                pyramid.depth_[i], pyramid.depth_smooth_[i],
+                pyramid.intensity_[i], intrinsics_[i], pyramid.vertex_maps_[i],
+                pyramid.normal_maps_[i], pyramid.depth_dx_[i],
+                pyramid.depth_dy_[i], pyramid.intensity_dx_[i],
+                pyramid.intensity_dy_[i]);
+        if (i > 0) {
+            kernel::odometry::PyrDownRGBD(
+                    pyramid.depth_[i], pyramid.intensity_[i],
+                    pyramid.depth_[i - 1], pyramid.intensity_[i - 1],
+                    params_.depth_outlier_trunc_ * 2);
+        }
+    }
+}
+
+RGBDPyramid RGBDPreprocessor::Process(const RGBDImage& rgbd) const {
+    RGBDPyramid pyramid;
+    Process(rgbd, pyramid);
+    return pyramid;
+}
+
+}  // namespace odometry
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
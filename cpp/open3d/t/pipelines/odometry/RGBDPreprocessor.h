@@ -0,0 +1,129 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/pipelines/odometry/RGBDOdometry.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace odometry {
+
+/// \brief Multi-scale maps of one RGB-D frame built by RGBDPreprocessor.
+/// Per-level maps are ordered from the coarsest to the finest level, as the
+/// convergence criteria in RGBDOdometryMultiScale. Maps not required by the
+/// odometry method are left empty.
+class RGBDPyramid {
+public:
+    /// Number of pyramid levels.
+    int64_t NumLevels() const { return static_cast<int64_t>(depth_.size()); }
+
+public:
+    /// (rows, cols, 1) Float32 depth in meters, invalid pixels are NaN.
+    std::vector<core::Tensor> depth_;
+    /// (rows, cols, 1) Float32 bilateral filtered depth used for normals.
+    std::vector<core::Tensor> depth_smooth_;
+    /// (rows, cols, 3) Float32 vertex maps.
+    std::vector<core::Tensor> vertex_maps_;
+    /// (rows, cols, 3) Float32 normal maps.
+    std::vector<core::Tensor> normal_maps_;
+    /// (rows, cols, 1) Float32 depth gradients.
+    std::vector<core::Tensor> depth_dx_;
+    std::vector<core::Tensor> depth_dy_;
+    /// (rows, cols, 1) Float32 intensity in the units of the input color.
+    std::vector<core::Tensor> intensity_;
+    /// (rows, cols, 1) Float32 intensity gradients.
+    std::vector<core::Tensor> intensity_dx_;
+    std::vector<core::Tensor> intensity_dy_;
+    /// (3, 3) Float64 intrinsic matrices on CPU.
+    std::vector<core::Tensor> intrinsics_;
+    /// (rows, cols, 3) Float32 color in [0, 1] at the finest level, only
+    /// filled when the preprocessor keeps color. Together with depth_.back()
+    /// it can be integrated by VoxelBlockGrid::Integrate with depth_scale 1.
+    core::Tensor color_;
+};
+
+/// \brief Builds the RGBDPyramid of RGB-D frames for multi-scale odometry and
+/// integration with a few fused passes per level: depth clipping and color to
+/// intensity conversion, bilateral filtering, vertex/normal/gradient
+/// computation, and joint depth/intensity downsampling.
+/// The buffers of the output pyramid are reused across frames as long as the
+/// image size and device stay the same.
+class RGBDPreprocessor {
+public:
+    /// \brief Constructor.
+    ///
+    /// \param intrinsics (3, 3) intrinsic matrix of the finest level.
+    /// \param num_levels Number of pyramid levels, equal to the size of the
+    /// criteria list used in odometry.
+    /// \param depth_scale Converts depth pixel values to meters by dividing the
+    /// scale factor.
+    /// \param depth_max Max depth to truncate depth image with noisy
+    /// measurements.
+    /// \param method Odometry method that determines the computed maps.
+    /// \param params Parameters used in loss function, where the depth outlier
+    /// threshold is used in depth downsampling.
+    /// \param keep_color Whether to store the Float32 color for integration.
+    RGBDPreprocessor(const core::Tensor& intrinsics,
+                     int num_levels = 3,
+                     float depth_scale = 1000.0f,
+                     float depth_max = 3.0f,
+                     Method method = Method::Hybrid,
+                     const OdometryLossParams& params = OdometryLossParams(),
+                     bool keep_color = false);
+
+    /// Build the pyramid of \p rgbd in place, reusing its buffers.
+    void Process(const t::geometry::RGBDImage& rgbd,
+                 RGBDPyramid& pyramid) const;
+
+    /// Build and return the pyramid of \p rgbd.
+    RGBDPyramid Process(const t::geometry::RGBDImage& rgbd) const;
+
+    int GetNumLevels() const { return num_levels_; }
+    float GetDepthScale() const { return depth_scale_; }
+    float GetDepthMax() const { return depth_max_; }
+    Method GetMethod() const { return method_; }
+
+private:
+    /// (3, 3) Float64 intrinsic matrices on CPU, from coarse to fine.
+    std::vector<core::Tensor> intrinsics_;
+    int num_levels_;
+    float depth_scale_;
+    float depth_max_;
+    Method method_;
+    OdometryLossParams params_;
+    bool keep_color_;
+};
+
+}  // namespace odometry
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
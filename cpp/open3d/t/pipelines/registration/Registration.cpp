@@ -26,14 +26,18 @@
 
 #include "open3d/t/pipelines/registration/Registration.h"
 
+#include <exception>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
 #include "open3d/core/TensorFunction.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/pipelines/kernel/Registration.h"
+#include "open3d/t/pipelines/kernel/TransformationConverter.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace t {
@@ -80,6 +84,38 @@ static RegistrationResult ComputeRegistrationResult(
     return result;
 }
 
+/// Fused CPU path for point-to-plane ICP. Evaluates the registration result
+/// for \p transformation and computes the transformation update in a single
+/// pass over the source points, without materializing correspondences.
+static std::tuple<RegistrationResult, core::Tensor>
+ComputeRegistrationResultAndUpdateFused(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::nns::NearestNeighborSearch &target_nns,
+        const double max_correspondence_distance,
+        const TransformationEstimationPointToPlane &estimation,
+        const core::Tensor &transformation) {
+    RegistrationResult result(transformation);
+
+    core::Tensor pose = kernel::ComputePosePointToPlaneFused(
+            source.GetPointPositions(), target.GetPointPositions(),
+            target.GetPointNormals(), target_nns, max_correspondence_distance,
+            estimation.kernel_, result.fitness_, result.inlier_rmse_);
+
+    if (result.fitness_ <= std::numeric_limits<double>::min()) {
+        // Case of no-correspondences.
+        utility::LogWarning(
+                "0 correspondence present between the pointclouds. Try "
+                "increasing the max_correspondence_distance parameter.");
+        result.fitness_ = 0.0;
+        result.inlier_rmse_ = 0.0;
+        result.transformation_ =
+                core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+    }
+
+    return std::make_tuple(result, kernel::PoseToTransformation(pose));
+}
+
 RegistrationResult EvaluateRegistration(const geometry::PointCloud &source,
                                         const geometry::PointCloud &target,
                                         double max_correspondence_distance,
@@ -124,6 +160,74 @@ ICP(const geometry::PointCloud &source,
                          estimation, callback_after_iteration);
 }
 
+std::vector<RegistrationResult> BatchICP(
+        const std::vector<geometry::PointCloud> &sources,
+        const std::vector<geometry::PointCloud> &targets,
+        const double max_correspondence_distance,
+        const std::vector<core::Tensor> &init_source_to_targets,
+        const TransformationEstimation &estimation,
+        const ICPConvergenceCriteria &criteria,
+        const double voxel_size) {
+    if (sources.size() != targets.size()) {
+        utility::LogError(
+                "Number of source ({}) and target ({}) point clouds must be "
+                "same.",
+                sources.size(), targets.size());
+    }
+    if (!init_source_to_targets.empty() &&
+        init_source_to_targets.size() != sources.size()) {
+        utility::LogError(
+                "Number of initial transformations ({}) must be same as the "
+                "number of point cloud pairs ({}).",
+                init_source_to_targets.size(), sources.size());
+    }
+
+    const int num_pairs = static_cast<int>(sources.size());
+    std::vector<RegistrationResult> results(num_pairs);
+
+    bool all_cpu = true;
+    for (int i = 0; i < num_pairs; ++i) {
+        all_cpu = all_cpu && sources[i].GetDevice().IsCPU() &&
+                  targets[i].GetDevice().IsCPU();
+    }
+
+    // Exceptions cannot leave a parallel region, they are re-thrown after it.
+    std::vector<std::exception_ptr> exceptions(num_pairs);
+    auto register_pair = [&](int i) {
+        try {
+            results[i] = ICP(sources[i], targets[i],
+                             max_correspondence_distance,
+                             init_source_to_targets.empty()
+                                     ? core::Tensor::Eye(4, core::Float64,
+                                                         core::Device("CPU:0"))
+                                     : init_source_to_targets[i],
+                             estimation, criteria, voxel_size);
+        } catch (...) {
+            exceptions[i] = std::current_exception();
+        }
+    };
+
+    if (all_cpu) {
+        // The parallel regions of the ICP kernels are nested in this one, so
+        // each pair is registered by a single thread.
+#pragma omp parallel for schedule(dynamic) num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < num_pairs; ++i) {
+            register_pair(i);
+        }
+    } else {
+        for (int i = 0; i < num_pairs; ++i) {
+            register_pair(i);
+        }
+    }
+
+    for (const std::exception_ptr &exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+    return results;
+}
+
 static void AssertInputMultiScaleICP(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -270,26 +374,43 @@ static std::tuple<RegistrationResult, int> DoSingleScaleICPIterations(
     RegistrationResult result(current_result.transformation_);
     double prev_fitness = current_result.fitness_;
     double prev_inlier_rmse = current_result.inlier_rmse_;
+
+    // On CPU, point-to-plane ICP fuses the correspondence search with the
+    // reduction of the linear system.
+    const bool use_fused_kernel =
+            device.IsCPU() && estimation.GetTransformationEstimationType() ==
+                                      TransformationEstimationType::PointToPlane;
+
     int iteration_count = 0;
     for (iteration_count = 0; iteration_count < criteria.max_iteration_;
          ++iteration_count) {
-        result = ComputeRegistrationResult(
-                source.GetPointPositions(), target_nns,
-                max_correspondence_distance, result.transformation_);
+        core::Tensor update;
+        if (use_fused_kernel) {
+            std::tie(result, update) = ComputeRegistrationResultAndUpdateFused(
+                    source, target, target_nns, max_correspondence_distance,
+                    static_cast<const TransformationEstimationPointToPlane &>(
+                            estimation),
+                    result.transformation_);
+        } else {
+            result = ComputeRegistrationResult(
+                    source.GetPointPositions(), target_nns,
+                    max_correspondence_distance, result.transformation_);
+        }
 
         if (result.fitness_ <= std::numeric_limits<double>::min()) {
             return std::make_tuple(result,
                                    prev_iteration_count + iteration_count);
         }
 
-        // Computing Transform between source and target, given
-        // correspondences. ComputeTransformation returns {4,4} shaped
-        // Float64 transformation tensor on CPU device.
-        core::Tensor update =
-                estimation
-                        .ComputeTransformation(source, target,
-                                               result.correspondences_)
-                        .To(core::Float64);
+        if (!use_fused_kernel) {
+            // Computing Transform between source and target, given
+            // correspondences. ComputeTransformation returns {4,4} shaped
+            // Float64 transformation tensor on CPU device.
+            update = estimation
+                             .ComputeTransformation(source, target,
+                                                    result.correspondences_)
+                             .To(core::Float64);
+        }
 
         // Multiply the transform to the cumulative transformation (update).
         result.transformation_ = update.Matmul(result.transformation_);
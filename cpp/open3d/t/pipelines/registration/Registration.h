@@ -158,6 +158,35 @@ ICP(const geometry::PointCloud &source,
     const std::function<void(const std::unordered_map<std::string, core::Tensor>
                                      &)> &callback_after_iteration = nullptr);
 
+/// \brief Functions for ICP registration of many independent (source, target)
+/// pairs, e.g. the pairwise fragment registration of a reconstruction system.
+///
+/// Pairs are registered concurrently, one pair per thread, which scales much
+/// better than running many small ICP calls one after another. Each pair uses
+/// its own search index, so the results are identical to calling ICP on each
+/// pair. Pairs are processed sequentially if any point cloud is not on CPU.
+///
+/// \param sources The source point clouds. (Float32 or Float64 type).
+/// \param targets The target point clouds, same number as \p sources.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param init_source_to_targets Initial transformation estimations of type
+/// Float64 on CPU, one for each pair. If empty, identity is used for all pairs.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+/// \param voxel_size The input pointclouds will be down-sampled to this
+/// `voxel_size` scale. If voxel_size < 0, original scale will be used.
+/// \return Vector of RegistrationResult, one for each pair.
+std::vector<RegistrationResult> BatchICP(
+        const std::vector<geometry::PointCloud> &sources,
+        const std::vector<geometry::PointCloud> &targets,
+        const double max_correspondence_distance,
+        const std::vector<core::Tensor> &init_source_to_targets = {},
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
+        const double voxel_size = -1.0);
+
 /// \brief Functions for Multi-Scale ICP registration.
 /// It will run ICP on different voxel level, from coarse to dense.
 /// The vector of ICPConvergenceCriteria(relative fitness, relative rmse,
@@ -39,6 +39,9 @@ namespace t {
 namespace pipelines {
 namespace slam {
 
+static const std::vector<odometry::OdometryConvergenceCriteria>
+        kTrackingCriteria{6, 3, 1};
+
 Model::Model(float voxel_size,
              int block_resolution,
              int est_block_count,
@@ -93,11 +96,27 @@ odometry::OdometryResult Model::TrackFrameToModel(const Frame& input_frame,
             t::geometry::RGBDImage(raycast_frame.GetDataAsImage("color"),
                                    raycast_frame.GetDataAsImage("depth")),
             raycast_frame.GetIntrinsics(), identity, depth_scale, depth_max,
-            std::vector<odometry::OdometryConvergenceCriteria>{6, 3, 1},
-            odometry::Method::PointToPlane,
+            kTrackingCriteria, odometry::Method::PointToPlane,
             odometry::OdometryLossParams(depth_diff));
 }
 
+odometry::OdometryResult Model::TrackFrameToModel(
+        const std::vector<core::Tensor>& input_vertex_maps,
+        const Frame& raycast_frame,
+        float depth_scale,
+        float depth_max,
+        float depth_diff) {
+    const static core::Tensor identity =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+
+    return odometry::RGBDOdometryMultiScalePointToPlane(
+            input_vertex_maps,
+            t::geometry::RGBDImage(raycast_frame.GetDataAsImage("color"),
+                                   raycast_frame.GetDataAsImage("depth")),
+            raycast_frame.GetIntrinsics(), identity, depth_scale, depth_max,
+            kTrackingCriteria, odometry::OdometryLossParams(depth_diff));
+}
+
 void Model::Integrate(const Frame& input_frame,
                       float depth_scale,
                       float depth_max,
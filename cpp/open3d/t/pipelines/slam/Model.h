@@ -88,6 +88,20 @@ public:
                                                float depth_max,
                                                float depth_diff);
 
+    /// Same as above, but takes the vertex map pyramid of the input frame
+    /// precomputed by odometry::CreateVertexMapPyramid with 3 levels.
+    /// \param input_vertex_maps Input vertex maps ordered from coarse to fine.
+    /// \param raycast_frame RGBD frame generated by raycasting.
+    /// \param depth_scale Scale factor to convert raw data into meter metric.
+    /// \param depth_max Depth truncation to discard points far away from the
+    /// camera.
+    odometry::OdometryResult TrackFrameToModel(
+            const std::vector<core::Tensor>& input_vertex_maps,
+            const Frame& raycast_frame,
+            float depth_scale,
+            float depth_max,
+            float depth_diff);
+
     /// Integrate RGBD frame into the volumetric voxel grid.
     /// \param input_frame Input RGBD frame.
     /// \param depth_scale Scale factor to convert raw data into meter metric.
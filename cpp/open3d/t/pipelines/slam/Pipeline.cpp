@@ -0,0 +1,346 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slam/Pipeline.h"
+
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/t/pipelines/odometry/RGBDOdometry.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Timer.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+namespace {
+
+/// Blocking FIFO queue with a bounded capacity. Push blocks while the queue is
+/// full, and Pop blocks while it is empty, until the queue is closed.
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(size_t capacity) : capacity_(capacity) {}
+
+    /// Returns false if the queue is closed and the item is dropped.
+    bool Push(T item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock,
+                       [&] { return closed_ || queue_.size() < capacity_; });
+        if (closed_) {
+            return false;
+        }
+        queue_.push_back(std::move(item));
+        not_empty_.notify_one();
+        return true;
+    }
+
+    /// Returns false if the queue is closed and drained.
+    bool Pop(T& item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_empty_.wait(lock, [&] { return closed_ || !queue_.empty(); });
+        if (queue_.empty()) {
+            return false;
+        }
+        item = std::move(queue_.front());
+        queue_.pop_front();
+        not_full_.notify_one();
+        return true;
+    }
+
+    void Close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        not_full_.notify_all();
+        not_empty_.notify_all();
+    }
+
+private:
+    size_t capacity_;
+    bool closed_ = false;
+    std::deque<T> queue_;
+    std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+};
+
+// Number of pyramid levels used in Model::TrackFrameToModel.
+constexpr int kNumPyramidLevels = 3;
+
+}  // namespace
+
+Pipeline::Pipeline(Model& model,
+                   const core::Tensor& intrinsics,
+                   float depth_scale,
+                   float depth_max,
+                   float depth_diff,
+                   float trunc_voxel_multiplier,
+                   int queue_size,
+                   bool pipelined)
+    : model_(model),
+      intrinsics_(intrinsics),
+      device_(model.GetHashMap().GetDevice()),
+      depth_scale_(depth_scale),
+      depth_max_(depth_max),
+      depth_diff_(depth_diff),
+      trunc_voxel_multiplier_(trunc_voxel_multiplier),
+      queue_size_(queue_size),
+      pipelined_(pipelined) {
+    core::AssertTensorShape(intrinsics, {3, 3});
+    if (queue_size <= 0) {
+        utility::LogError("queue_size must be positive, but got {}.",
+                          queue_size);
+    }
+}
+
+Pipeline::PreprocessedFrame Pipeline::Preprocess(
+        const t::geometry::Image& depth,
+        const t::geometry::Image& color) const {
+    PreprocessedFrame frame;
+    frame.depth = depth.To(device_);
+    frame.color = color.To(device_);
+    frame.vertex_maps = odometry::CreateVertexMapPyramid(
+            frame.depth, intrinsics_, depth_scale_, depth_max_,
+            kNumPyramidLevels, odometry::OdometryLossParams(depth_diff_));
+    return frame;
+}
+
+core::Tensor Pipeline::ProcessFrame(int frame_id,
+                                    const PreprocessedFrame& frame,
+                                    Frame& input_frame,
+                                    Frame& raycast_frame) {
+    utility::Timer timer;
+    input_frame.SetDataFromImage("depth", frame.depth);
+    input_frame.SetDataFromImage("color", frame.color);
+
+    core::Tensor T_frame_to_model = model_.GetCurrentFramePose();
+    bool tracking_success = true;
+    if (frame_id > 0) {
+        timer.Start();
+        auto result = model_.TrackFrameToModel(frame.vertex_maps, raycast_frame,
+                                               depth_scale_, depth_max_,
+                                               depth_diff_);
+
+        core::Tensor translation =
+                result.transformation_.Slice(0, 0, 3).Slice(1, 3, 4);
+        double translation_norm = std::sqrt(
+                (translation * translation).Sum({0, 1}).Item<double>());
+
+        // If the overlap is too small or translation is too high between two
+        // consecutive frames, it is likely that the tracking failed.
+        if (result.fitness_ >= 0.1 && translation_norm < 0.15) {
+            T_frame_to_model = T_frame_to_model.Matmul(result.transformation_);
+        } else {
+            tracking_success = false;
+            utility::LogWarning(
+                    "Tracking failed for frame {}, fitness: {:.3f}, "
+                    "translation: {:.3f}. Using previous frame's pose.",
+                    frame_id, result.fitness_, translation_norm);
+        }
+        timer.Stop();
+        stage_latencies_["track"] += timer.GetDuration();
+    }
+
+    model_.UpdateFramePose(frame_id, T_frame_to_model);
+    if (tracking_success) {
+        timer.Start();
+        model_.Integrate(input_frame, depth_scale_, depth_max_,
+                         trunc_voxel_multiplier_);
+        timer.Stop();
+        stage_latencies_["integrate"] += timer.GetDuration();
+    }
+
+    timer.Start();
+    model_.SynthesizeModelFrame(raycast_frame, depth_scale_, 0.1, depth_max_,
+                                trunc_voxel_multiplier_, false);
+    timer.Stop();
+    stage_latencies_["raycast"] += timer.GetDuration();
+
+    return T_frame_to_model;
+}
+
+std::vector<core::Tensor> Pipeline::Run(const FrameSource& frame_source) {
+    stage_latencies_ = {{"decode", 0.0},
+                        {"preprocess", 0.0},
+                        {"track", 0.0},
+                        {"integrate", 0.0},
+                        {"raycast", 0.0}};
+
+    std::vector<core::Tensor> poses;
+    std::shared_ptr<Frame> input_frame;
+    std::shared_ptr<Frame> raycast_frame;
+    auto process = [&](const PreprocessedFrame& frame) {
+        if (input_frame == nullptr) {
+            int64_t rows = frame.depth.GetRows();
+            int64_t cols = frame.depth.GetCols();
+            input_frame = std::make_shared<Frame>(rows, cols, intrinsics_,
+                                                  device_);
+            raycast_frame = std::make_shared<Frame>(rows, cols, intrinsics_,
+                                                    device_);
+        }
+        poses.push_back(ProcessFrame(static_cast<int>(poses.size()), frame,
+                                     *input_frame, *raycast_frame));
+    };
+
+    double decode_duration = 0.0;
+    double preprocess_duration = 0.0;
+    if (!pipelined_) {
+        utility::Timer timer;
+        while (true) {
+            t::geometry::Image depth, color;
+            timer.Start();
+            bool has_frame = frame_source(depth, color);
+            timer.Stop();
+            if (!has_frame) break;
+            decode_duration += timer.GetDuration();
+
+            timer.Start();
+            PreprocessedFrame frame = Preprocess(depth, color);
+            timer.Stop();
+            preprocess_duration += timer.GetDuration();
+
+            process(frame);
+        }
+    } else {
+        using DecodedFrame = std::pair<t::geometry::Image, t::geometry::Image>;
+        BoundedQueue<DecodedFrame> decoded_frames(queue_size_);
+        BoundedQueue<PreprocessedFrame> preprocessed_frames(queue_size_);
+
+        // Each stage closes its queues on exit, so that a failure in any stage
+        // stops the others.
+        std::exception_ptr decode_error, preprocess_error, process_error;
+        std::thread decode_thread([&]() {
+            try {
+                utility::Timer timer;
+                while (true) {
+                    DecodedFrame images;
+                    timer.Start();
+                    bool has_frame = frame_source(images.first, images.second);
+                    timer.Stop();
+                    if (!has_frame) break;
+                    decode_duration += timer.GetDuration();
+
+                    if (!decoded_frames.Push(std::move(images))) break;
+                }
+            } catch (...) {
+                decode_error = std::current_exception();
+            }
+            decoded_frames.Close();
+        });
+
+        std::thread preprocess_thread([&]() {
+            try {
+                utility::Timer timer;
+                DecodedFrame images;
+                while (decoded_frames.Pop(images)) {
+                    timer.Start();
+                    PreprocessedFrame frame =
+                            Preprocess(images.first, images.second);
+                    timer.Stop();
+                    preprocess_duration += timer.GetDuration();
+
+                    if (!preprocessed_frames.Push(std::move(frame))) break;
+                }
+            } catch (...) {
+                preprocess_error = std::current_exception();
+            }
+            decoded_frames.Close();
+            preprocessed_frames.Close();
+        });
+
+        try {
+            PreprocessedFrame frame;
+            while (preprocessed_frames.Pop(frame)) {
+                process(frame);
+            }
+        } catch (...) {
+            process_error = std::current_exception();
+        }
+        preprocessed_frames.Close();
+        decoded_frames.Close();
+
+        decode_thread.join();
+        preprocess_thread.join();
+        for (const std::exception_ptr& error :
+             {decode_error, preprocess_error, process_error}) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    stage_latencies_["decode"] = decode_duration;
+    stage_latencies_["preprocess"] = preprocess_duration;
+    if (!poses.empty()) {
+        for (auto& it : stage_latencies_) {
+            it.second /= poses.size();
+        }
+    }
+    utility::LogDebug(
+            "Stage latencies (ms): decode {:.2f}, preprocess {:.2f}, track "
+            "{:.2f}, integrate {:.2f}, raycast {:.2f}",
+            stage_latencies_["decode"], stage_latencies_["preprocess"],
+            stage_latencies_["track"], stage_latencies_["integrate"],
+            stage_latencies_["raycast"]);
+    return poses;
+}
+
+std::vector<core::Tensor> Pipeline::Run(
+        const std::vector<std::string>& depth_paths,
+        const std::vector<std::string>& color_paths) {
+    if (depth_paths.size() != color_paths.size()) {
+        utility::LogError(
+                "Number of depth images ({}) mismatch with color images ({}).",
+                depth_paths.size(), color_paths.size());
+    }
+
+    size_t i = 0;
+    return Run([&](t::geometry::Image& depth, t::geometry::Image& color) {
+        if (i >= depth_paths.size()) {
+            return false;
+        }
+        if (!t::io::ReadImage(depth_paths[i], depth)) {
+            utility::LogError("Unable to read depth image {}.", depth_paths[i]);
+        }
+        if (!t::io::ReadImage(color_paths[i], color)) {
+            utility::LogError("Unable to read color image {}.", color_paths[i]);
+        }
+        ++i;
+        return true;
+    });
+}
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
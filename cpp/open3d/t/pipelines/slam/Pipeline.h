@@ -0,0 +1,135 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/pipelines/slam/Frame.h"
+#include "open3d/t/pipelines/slam/Model.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+/// \class Pipeline
+///
+/// \brief Pipelined driver of dense RGB-D SLAM on a Model.
+///
+/// Frames go through five stages: decode, preprocess (upload and source vertex
+/// map pyramid), track, integrate, and raycast. Decode and preprocess of the
+/// upcoming frames run in their own threads, connected by bounded queues that
+/// block producers when full. Track, integrate, and raycast depend on the
+/// model updated by the previous frame, so they run in order on the calling
+/// thread. The estimated trajectory is identical to the sequential path, which
+/// is available by disabling pipelining.
+class Pipeline {
+public:
+    /// Returns false when there are no more frames. Otherwise fills raw depth
+    /// and color images of the next frame. Called from the decode thread.
+    using FrameSource = std::function<bool(t::geometry::Image& depth,
+                                           t::geometry::Image& color)>;
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param model Model to track against and integrate into. Must outlive
+    /// the pipeline.
+    /// \param intrinsics (3, 3) intrinsic matrix of the camera.
+    /// \param depth_scale Scale factor to convert raw data into meter metric.
+    /// \param depth_max Depth truncation to discard points far away from the
+    /// camera.
+    /// \param depth_diff Depth difference threshold used in tracking.
+    /// \param trunc_voxel_multiplier Truncation distance in voxels.
+    /// \param queue_size Maximal number of frames buffered between stages.
+    /// \param pipelined Run decode and preprocess in their own threads. If
+    /// false, all the stages run sequentially on the calling thread.
+    Pipeline(Model& model,
+             const core::Tensor& intrinsics,
+             float depth_scale = 1000.0f,
+             float depth_max = 3.0f,
+             float depth_diff = 0.07f,
+             float trunc_voxel_multiplier = 8.0f,
+             int queue_size = 4,
+             bool pipelined = true);
+
+    /// \brief Process all the frames from the frame source.
+    /// A frame is integrated only if its tracking succeeds, otherwise it keeps
+    /// the pose of the previous frame.
+    /// \return (4, 4) Float64 frame to world poses per frame on CPU.
+    std::vector<core::Tensor> Run(const FrameSource& frame_source);
+
+    /// \brief Process frames read from depth and color image files.
+    std::vector<core::Tensor> Run(const std::vector<std::string>& depth_paths,
+                                  const std::vector<std::string>& color_paths);
+
+    /// Get the average latency per frame in milliseconds of each stage in the
+    /// last Run, keyed by "decode", "preprocess", "track", "integrate", and
+    /// "raycast".
+    std::unordered_map<std::string, double> GetStageLatencies() const {
+        return stage_latencies_;
+    }
+
+private:
+    struct PreprocessedFrame {
+        t::geometry::Image depth;
+        t::geometry::Image color;
+        std::vector<core::Tensor> vertex_maps;
+    };
+
+    PreprocessedFrame Preprocess(const t::geometry::Image& depth,
+                                 const t::geometry::Image& color) const;
+
+    /// Track, integrate, and raycast a frame. Returns the frame pose.
+    core::Tensor ProcessFrame(int frame_id,
+                              const PreprocessedFrame& frame,
+                              Frame& input_frame,
+                              Frame& raycast_frame);
+
+    Model& model_;
+    core::Tensor intrinsics_;
+    core::Device device_;
+
+    float depth_scale_;
+    float depth_max_;
+    float depth_diff_;
+    float trunc_voxel_multiplier_;
+    int queue_size_;
+    bool pipelined_;
+
+    // Accumulated stage durations in milliseconds, averaged after Run.
+    std::unordered_map<std::string, double> stage_latencies_;
+};
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
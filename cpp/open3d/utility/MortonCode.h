@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#ifdef __CUDACC__
+#define FN_SPECIFIERS inline __host__ __device__
+#else
+#define FN_SPECIFIERS inline
+#endif
+
+namespace open3d {
+namespace utility {
+
+/// Number of bits per axis of a 3D Morton code. 3 * 21 = 63 bits are used.
+constexpr int kMortonBitsPerAxis = 21;
+
+/// Maximum grid coordinate per axis that can be encoded in a 3D Morton code.
+constexpr uint32_t kMortonMaxCoordinate = (1u << kMortonBitsPerAxis) - 1;
+
+/// Inserts two zero bits between each of the lower 21 bits of \p v.
+FN_SPECIFIERS uint64_t MortonSplitBy3(uint32_t v) {
+    uint64_t x = v & kMortonMaxCoordinate;
+    x = (x | (x << 32)) & 0x1f00000000ffffULL;
+    x = (x | (x << 16)) & 0x1f0000ff0000ffULL;
+    x = (x | (x << 8)) & 0x100f00f00f00f00fULL;
+    x = (x | (x << 4)) & 0x10c30c30c30c30c3ULL;
+    x = (x | (x << 2)) & 0x1249249249249249ULL;
+    return x;
+}
+
+/// \brief Computes the 63-bit Morton (Z-order) code of a 3D grid coordinate.
+///
+/// Only the lower 21 bits of each coordinate are used.
+FN_SPECIFIERS uint64_t MortonCode3D(uint32_t x, uint32_t y, uint32_t z) {
+    return MortonSplitBy3(x) | (MortonSplitBy3(y) << 1) |
+           (MortonSplitBy3(z) << 2);
+}
+
+/// \brief Computes the 63-bit Morton (Z-order) code of a 3D point.
+///
+/// The point is quantized to a 2^21 grid per axis, starting at \p min_bound
+/// with cell size 1 / \p inv_cell_size. Coordinates outside of the grid are
+/// clamped.
+///
+/// \param point Pointer to the x, y, z coordinates of the point.
+/// \param min_bound Pointer to the x, y, z coordinates of the grid origin.
+/// \param inv_cell_size Inverse of the grid cell size.
+template <typename T>
+FN_SPECIFIERS uint64_t MortonCode3D(const T *point,
+                                    const T *min_bound,
+                                    T inv_cell_size) {
+    uint32_t grid[3];
+    for (int i = 0; i < 3; ++i) {
+        T coord = (point[i] - min_bound[i]) * inv_cell_size;
+        // Also maps NaN to 0.
+        if (!(coord > 0)) {
+            grid[i] = 0;
+        } else if (coord >= static_cast<T>(kMortonMaxCoordinate)) {
+            grid[i] = kMortonMaxCoordinate;
+        } else {
+            grid[i] = static_cast<uint32_t>(coord);
+        }
+    }
+    return MortonCode3D(grid[0], grid[1], grid[2]);
+}
+
+/// \brief Computes the inverse cell size that fits the axis aligned box
+/// [\p min_bound, \p max_bound] into the 3D Morton grid.
+template <typename T>
+FN_SPECIFIERS T MortonInvCellSize(const T *min_bound, const T *max_bound) {
+    T extent = 0;
+    for (int i = 0; i < 3; ++i) {
+        T e = max_bound[i] - min_bound[i];
+        extent = e > extent ? e : extent;
+    }
+    return extent > 0 ? static_cast<T>(kMortonMaxCoordinate) / extent : T(1);
+}
+
+}  // namespace utility
+}  // namespace open3d
+
+#undef FN_SPECIFIERS
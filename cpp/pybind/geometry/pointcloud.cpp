@@ -74,6 +74,11 @@ void pybind_pointcloud(py::module &m) {
                  "Function to select points from input pointcloud into output "
                  "pointcloud.",
                  "indices"_a, "invert"_a = false)
+            .def("sort_by_morton_code", &PointCloud::SortByMortonCode,
+                 "Reorders the points, normals, colors and covariances along "
+                 "a 3D Morton (Z-order) curve to improve memory locality. "
+                 "Returns the permutation, where element i is the original "
+                 "index of the point now at position i.")
             .def("voxel_down_sample", &PointCloud::VoxelDownSample,
                  "Function to downsample input pointcloud into output "
                  "pointcloud with "
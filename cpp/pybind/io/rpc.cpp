@@ -28,6 +28,7 @@
 #include "open3d/io/rpc/Connection.h"
 #include "open3d/io/rpc/DummyReceiver.h"
 #include "open3d/io/rpc/MessageUtils.h"
+#include "open3d/io/rpc/PushConnection.h"
 #include "open3d/io/rpc/RemoteFunctions.h"
 #include "open3d/io/rpc/ZMQContext.h"
 #include "pybind/core/tensor_type_caster.h"
@@ -62,6 +63,27 @@ The default connection class which uses a ZeroMQ socket.
                  "address"_a = "tcp://127.0.0.1:51454",
                  "connect_timeout"_a = 5000, "timeout"_a = 10000);
 
+    py::class_<rpc::PushConnection, std::shared_ptr<rpc::PushConnection>,
+               rpc::ConnectionBase>(m, "PushConnection", R"doc(
+A connection which streams data to a receiver without waiting for replies.
+Array data is sent in separate frames without copying and can be compressed.
+Several messages can be batched into a single message.
+)doc")
+            .def(py::init([](std::string address, int connect_timeout,
+                             int timeout, int batch_size, bool compress) {
+                     return std::shared_ptr<rpc::PushConnection>(
+                             new rpc::PushConnection(address, connect_timeout,
+                                                     timeout, batch_size,
+                                                     compress));
+                 }),
+                 "Creates a push connection object",
+                 "address"_a = "tcp://127.0.0.1:51454",
+                 "connect_timeout"_a = 5000, "timeout"_a = 10000,
+                 "batch_size"_a = 1, "compress"_a = false)
+            .def("flush", &rpc::PushConnection::Flush,
+                 "Sends all pending messages. Returns False if sending "
+                 "failed.");
+
     py::class_<rpc::BufferConnection, std::shared_ptr<rpc::BufferConnection>,
                rpc::ConnectionBase>(m, "BufferConnection", R"doc(
 A connection writing to a memory buffer.
@@ -261,6 +261,11 @@ void pybind_image(py::module &m) {
                      "device"_a = core::Device("CPU:0"),
                      "Create a Image from a legacy Open3D Image.");
     image.def("as_tensor", &Image::AsTensor);
+    image.def_static("set_ipp_enabled", &Image::SetIPPEnabled, "enabled"_a,
+                     "Enable or disable IPP for CPU image operations. When "
+                     "disabled, portable CPU implementations are used.");
+    image.def_static("is_ipp_enabled", &Image::IsIPPEnabled,
+                     "Returns True if CPU image operations use IPP.");
 
     docstring::ClassMethodDocInject(m, "Image", "get_min_bound");
     docstring::ClassMethodDocInject(m, "Image", "get_max_bound");
@@ -206,6 +206,11 @@ The attributes of the point cloud have different levels::
                    "Downsample a pointcloud by selecting random index point "
                    "and its attributes.",
                    "sampling_ratio"_a);
+    pointcloud.def("sort_by_morton_code", &PointCloud::SortByMortonCode,
+                   "Reorders the points and all their attributes along a 3D "
+                   "Morton (Z-order) curve to improve memory locality. Returns "
+                   "the Int64 permutation, where element i is the original "
+                   "index of the point now at position i.");
     pointcloud.def("remove_radius_outliers", &PointCloud::RemoveRadiusOutliers,
                    "nb_points"_a, "search_radius"_a,
                    "Remove points that have less than nb_points neighbors in a "
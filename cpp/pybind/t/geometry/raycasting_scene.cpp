@@ -33,6 +33,52 @@ namespace t {
 namespace geometry {
 
 void pybind_raycasting_scene(py::module& m) {
+    py::class_<LidarModel> lidar_model(m, "LidarModel", R"doc(
+Describes the beam pattern and timing of a LiDAR sensor.
+
+The beams are defined in the sensor coordinate system with x pointing forward,
+y to the left and z up. The azimuth angle is measured in the xy-plane from the
+x-axis towards the y-axis. Rays are organized as {num_beams, num_columns}. A row
+corresponds to a beam (ring) and a column corresponds to an azimuth step.
+)doc");
+    py::enum_<LidarModel::ScanPattern>(lidar_model, "ScanPattern",
+                                       "Order in which the rays are fired.")
+            .value("Spinning", LidarModel::ScanPattern::Spinning,
+                   "All beams fire at once and the columns are swept over "
+                   "time.")
+            .value("SolidState", LidarModel::ScanPattern::SolidState,
+                   "The rows are scanned one after the other like a raster "
+                   "scan.")
+            .export_values();
+    py::detail::bind_copy_functions<LidarModel>(lidar_model);
+    lidar_model
+            .def(py::init<const core::Tensor&, int, double, double, double,
+                          LidarModel::ScanPattern, const core::Tensor&>(),
+                 "elevation_angles_deg"_a, "num_columns"_a = 1024,
+                 "azimuth_fov_deg"_a = 360.0, "azimuth_start_deg"_a = -180.0,
+                 "scan_duration"_a = 0.1,
+                 "scan_pattern"_a = LidarModel::ScanPattern::Spinning,
+                 "azimuth_offsets_deg"_a = core::Tensor())
+            .def_readwrite("elevation_angles_deg",
+                           &LidarModel::elevation_angles_deg_,
+                           "The elevation angle of each beam in degree with "
+                           "shape {num_beams}.")
+            .def_readwrite("azimuth_offsets_deg",
+                           &LidarModel::azimuth_offsets_deg_,
+                           "Per-beam azimuth offsets in degree with shape "
+                           "{num_beams}. An empty tensor means no offsets.")
+            .def_readwrite("num_columns", &LidarModel::num_columns_,
+                           "The number of azimuth steps per scan.")
+            .def_readwrite("azimuth_fov_deg", &LidarModel::azimuth_fov_deg_,
+                           "The horizontal field of view in degree.")
+            .def_readwrite("azimuth_start_deg",
+                           &LidarModel::azimuth_start_deg_,
+                           "The azimuth angle of the first column in degree.")
+            .def_readwrite("scan_duration", &LidarModel::scan_duration_,
+                           "The duration of a scan in seconds.")
+            .def_readwrite("scan_pattern", &LidarModel::scan_pattern_,
+                           "The order in which the rays are fired.");
+
     py::class_<RaycastingScene> raycasting_scene(m, "RaycastingScene", R"doc(
 A scene class with basic ray casting and closest point queries.
 
@@ -72,8 +118,21 @@ The following shows how to create a scene and compute ray intersections::
 
 )doc");
 
+    py::enum_<RaycastingScene::BuildQuality>(
+            raycasting_scene, "BuildQuality",
+            "Quality of the acceleration structure build.")
+            .value("Low", RaycastingScene::BuildQuality::Low,
+                   "Fast build for scenes that change every frame.")
+            .value("Medium", RaycastingScene::BuildQuality::Medium,
+                   "Balance between build time and query performance.")
+            .value("High", RaycastingScene::BuildQuality::High,
+                   "Slow build with the best query performance.")
+            .export_values();
+
     // Constructors.
-    raycasting_scene.def(py::init<>());
+    raycasting_scene.def(py::init<RaycastingScene::BuildQuality>(),
+                         "build_quality"_a =
+                                 RaycastingScene::BuildQuality::Medium);
 
     raycasting_scene.def(
             "add_triangles",
@@ -105,6 +164,99 @@ Returns:
     The geometry ID of the added mesh.
 )doc");
 
+    raycasting_scene.def("remove_geometry", &RaycastingScene::RemoveGeometry,
+                         "geometry_id"_a, R"doc(
+Removes a geometry or an instance from the scene.
+
+Args:
+    geometry_id (int): The ID of the geometry returned by add_triangles or
+        add_instance. The ID may be reused by geometry added later.
+)doc");
+
+    raycasting_scene.def("update_triangle_vertices",
+                         &RaycastingScene::UpdateTriangleVertices,
+                         "geometry_id"_a, "vertex_positions"_a, R"doc(
+Updates the vertex positions of a triangle mesh in the scene.
+
+The topology of the mesh is kept and the acceleration structure of the mesh is
+only refitted instead of rebuilt. This is intended for deforming meshes.
+
+Args:
+    geometry_id (int): The ID of a geometry returned by add_triangles.
+    vertex_positions (open3d.core.Tensor): Vertices as Tensor of dim {N,3} and
+        dtype Float32. N must match the number of vertices of the geometry.
+)doc");
+
+    raycasting_scene.def(
+            "add_prototype",
+            py::overload_cast<const core::Tensor&, const core::Tensor&>(
+                    &RaycastingScene::AddPrototype),
+            "vertex_positions"_a, "triangle_indices"_a, R"doc(
+Adds a triangle mesh prototype which can be instanced.
+
+The prototype is not part of the scene. It has its own acceleration structure,
+which is built once and shared by all its instances.
+
+Args:
+    vertex_positions (open3d.core.Tensor): Vertices as Tensor of dim {N,3} and
+        dtype Float32.
+    triangle_indices (open3d.core.Tensor): Triangles as Tensor of dim {M,3} and
+        dtype UInt32.
+
+Returns:
+    The ID of the prototype.
+)doc");
+
+    raycasting_scene.def("add_prototype",
+                         py::overload_cast<const TriangleMesh&>(
+                                 &RaycastingScene::AddPrototype),
+                         "mesh"_a, R"doc(
+Adds a triangle mesh prototype which can be instanced.
+
+Args:
+    mesh (open3d.t.geometry.TriangleMesh): A triangle mesh.
+
+Returns:
+    The ID of the prototype.
+)doc");
+
+    raycasting_scene.def(
+            "add_instance", &RaycastingScene::AddInstance, "prototype_id"_a,
+            "transform"_a = core::Tensor::Eye(4, core::Float32,
+                                              core::Device("CPU:0")),
+            R"doc(
+Adds an instance of a prototype to the scene.
+
+Args:
+    prototype_id (int): The ID of the prototype returned by add_prototype.
+    transform (open3d.core.Tensor): The 4x4 affine transformation from the
+        prototype to the world coordinate system.
+
+Returns:
+    The geometry ID of the instance. Queries report this ID for hits with the
+    instance. Primitive IDs refer to the prototype triangles.
+)doc");
+
+    raycasting_scene.def("set_instance_transform",
+                         &RaycastingScene::SetInstanceTransform,
+                         "geometry_id"_a, "transform"_a, R"doc(
+Sets the transformation of an instance.
+
+Only the top level of the acceleration structure is rebuilt, the acceleration
+structure of the prototype is reused.
+
+Args:
+    geometry_id (int): The geometry ID returned by add_instance.
+    transform (open3d.core.Tensor): The 4x4 affine transformation from the
+        prototype to the world coordinate system.
+)doc");
+
+    raycasting_scene.def_property(
+            "build_quality", &RaycastingScene::GetBuildQuality,
+            &RaycastingScene::SetBuildQuality,
+            "The quality of the acceleration structure build. The new quality "
+            "is used for the next build of the scene.");
+
     raycasting_scene.def("cast_rays", &RaycastingScene::CastRays, "rays"_a,
                          "nthreads"_a = 0,
                          R"doc(
@@ -293,6 +445,43 @@ Returns:
     or 1. A point is occupied or inside if the value is 1.
 )doc");
 
+    raycasting_scene.def("enable_signed_distance_cache",
+                         &RaycastingScene::EnableSignedDistanceCache,
+                         "voxel_size"_a, "max_error"_a, "max_level"_a = 3,
+                         "init_capacity"_a = 10000, R"doc(
+Enables a cache for signed distance and occupancy queries.
+
+The cache is a sparse voxel hash map which stores the signed distances at the
+corners of the cells that contain query points. Cells are filled lazily with
+exact queries and the signed distance is interpolated trilinearly within a cell.
+A cell is only used if the interpolated distance at its center is within the
+error bound of the exact distance. Otherwise the cell is subdivided up to
+max_level times, which refines the cache in a narrow band around surface
+features. Queries in cells that do not meet the error bound at the finest level
+are computed exactly. The cache is cleared when the scene changes.
+
+Args:
+    voxel_size (float): The cell size of the coarsest level.
+    max_error (float): The error bound for the interpolated distances.
+    max_level (int): The maximum number of subdivisions of a cell.
+    init_capacity (int): The initial capacity of the hash map.
+)doc");
+
+    raycasting_scene.def("disable_signed_distance_cache",
+                         &RaycastingScene::DisableSignedDistanceCache,
+                         "Disables the signed distance cache and frees its "
+                         "memory.");
+
+    raycasting_scene.def("is_signed_distance_cache_enabled",
+                         &RaycastingScene::IsSignedDistanceCacheEnabled,
+                         "Returns true if the signed distance cache is "
+                         "enabled.");
+
+    raycasting_scene.def("get_signed_distance_cache_size",
+                         &RaycastingScene::GetSignedDistanceCacheSize,
+                         "Returns the number of cells stored in the signed "
+                         "distance cache.");
+
     raycasting_scene.def_static(
             "create_rays_pinhole",
             py::overload_cast<const core::Tensor&, const core::Tensor&, int,
@@ -335,6 +524,73 @@ Returns:
     A tensor of shape {height_px, width_px, 6} with the rays.
 )doc");
 
+    raycasting_scene.def_static(
+            "create_rays_lidar", &RaycastingScene::CreateRaysLidar, "model"_a,
+            "start_pose"_a = core::Tensor::Eye(4, core::Float64,
+                                               core::Device("CPU:0")),
+            "end_pose"_a = core::Tensor::Eye(4, core::Float64,
+                                             core::Device("CPU:0")),
+            R"doc(
+Creates rays for a LiDAR sensor.
+
+The sensor pose is interpolated between the start and end pose using the
+timestamp of each ray to simulate the motion of the sensor during the scan.
+
+Args:
+    model (open3d.t.geometry.LidarModel): The LiDAR model.
+    start_pose (open3d.core.Tensor): The 4x4 sensor to world transformation at
+        the start of the scan.
+    end_pose (open3d.core.Tensor): The 4x4 sensor to world transformation at
+        the end of the scan.
+
+Returns:
+    A tensor of shape {num_beams, num_columns, 6} with the rays. The ray
+    directions are normalized.
+)doc");
+
+    raycasting_scene.def_static("create_timestamps_lidar",
+                                &RaycastingScene::CreateTimestampsLidar,
+                                "model"_a, R"doc(
+Computes the timestamps of the rays of a LiDAR sensor.
+
+Args:
+    model (open3d.t.geometry.LidarModel): The LiDAR model.
+
+Returns:
+    A Float64 tensor of shape {num_beams, num_columns} with the time in seconds
+    relative to the start of the scan.
+)doc");
+
+    raycasting_scene.def(
+            "cast_rays_lidar", &RaycastingScene::CastRaysLidar, "model"_a,
+            "start_pose"_a = core::Tensor::Eye(4, core::Float64,
+                                               core::Device("CPU:0")),
+            "end_pose"_a = core::Tensor::Eye(4, core::Float64,
+                                             core::Device("CPU:0")),
+            "max_range"_a = std::numeric_limits<float>::infinity(),
+            "nthreads"_a = 0, R"doc(
+Simulates a LiDAR scan and returns the hits as point cloud.
+
+The rays are generated on the fly and only the hits are stored. This avoids
+creating the ray tensor and the full size result tensors of cast_rays.
+
+Args:
+    model (open3d.t.geometry.LidarModel): The LiDAR model.
+    start_pose (open3d.core.Tensor): The 4x4 sensor to world transformation at
+        the start of the scan.
+    end_pose (open3d.core.Tensor): The 4x4 sensor to world transformation at
+        the end of the scan.
+    max_range (float): The maximum range of the sensor.
+    nthreads (int): The number of threads to use. Set to 0 for automatic.
+
+Returns:
+    A point cloud with the hit points in world coordinates. The point cloud has
+    the Float32 attributes ranges, intensities and timestamps with shape {N,1}
+    and the Int32 attribute rings with shape {N,1}. The intensity is the cosine
+    of the incidence angle as a simple proxy for the reflected intensity. Points
+    are ordered by beam and column.
+)doc");
+
     raycasting_scene.def_property_readonly_static(
             "INVALID_ID",
             [](py::object /* self */) -> uint32_t {
@@ -203,11 +203,40 @@ void pybind_voxel_block_grid(py::module& m) {
             "Extract triangle mesh at isosurface points.",
             "weight_threshold"_a = 3.0f, "estimated_vertex_number"_a = -1);
 
+    vbg.def("get_dirty_block_coordinates",
+            &VoxelBlockGrid::GetDirtyBlockCoordinates,
+            "Get coordinates of the blocks modified by integrate since the "
+            "last call to extract_triangle_mesh_chunks.");
+    vbg.def("extract_triangle_mesh_chunks",
+            &VoxelBlockGrid::ExtractTriangleMeshChunks,
+            "Specific operation for TSDF volumes."
+            "Incrementally extract triangle meshes of the blocks affected by "
+            "integrate since the last call. Returns a tuple of (N, 3) block "
+            "coordinates and a list of N mesh chunks, each replacing the "
+            "previous chunk of the same block.",
+            "weight_threshold"_a = 3.0f);
+
     vbg.def("save", &VoxelBlockGrid::Save,
-            "Save the voxel block grid to a npz file."
-            "file_name"_a);
+            "Save the voxel block grid to a npz file. If compress is True, "
+            "blocks are losslessly compressed with LZF and blocks with only "
+            "zero values are elided.",
+            "file_name"_a, "compress"_a = false);
     vbg.def_static("load", &VoxelBlockGrid::Load,
                    "Load a voxel block grid from a npz file.", "file_name"_a);
+
+    vbg.def("enable_streaming", &VoxelBlockGrid::EnableStreaming,
+            "Enable out-of-core streaming. The least recently touched blocks "
+            "are compressed and evicted to an on-disk block store when more "
+            "than max_active_blocks blocks are requested, and paged back in "
+            "when revisited.",
+            "block_store_dir"_a, "max_active_blocks"_a = -1);
+    vbg.def("disable_streaming", &VoxelBlockGrid::DisableStreaming,
+            "Disable streaming and page all the evicted blocks back in "
+            "memory.");
+    vbg.def("is_streaming", &VoxelBlockGrid::IsStreaming,
+            "Return True if streaming is enabled.");
+    vbg.def("get_num_evicted_blocks", &VoxelBlockGrid::GetNumEvictedBlocks,
+            "Get the number of blocks evicted to the on-disk block store.");
 }
 }  // namespace geometry
 }  // namespace t
@@ -28,6 +28,7 @@
 
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/t/io/sensor/RGBDSensor.h"
+#include "open3d/t/io/sensor/RGBDSequenceReader.h"
 #include "open3d/t/io/sensor/RGBDVideoReader.h"
 #ifdef BUILD_LIBREALSENSE
 #include "open3d/t/io/sensor/realsense/RSBagReader.h"
@@ -161,6 +162,71 @@ void pybind_sensor(py::module &m) {
     docstring::ClassMethodDocInject(m, "RGBDVideoReader", "save_frames",
                                     map_shared_argument_docstrings);
 
+    // Class RGBD sequence reader
+    py::class_<RGBDSequenceReader, std::unique_ptr<RGBDSequenceReader>,
+               RGBDVideoReader>
+            rgbd_sequence_reader(
+                    m, "RGBDSequenceReader",
+                    "Reader of RGBD frames stored as separate color and depth "
+                    "images, in a folder with 'color' (or 'rgb', 'image') and "
+                    "'depth' subfolders, or listed in a TUM RGB-D or ICL-NUIM "
+                    "style association file. Frames ahead are decoded by "
+                    "worker threads and returned in order.");
+    rgbd_sequence_reader
+            .def(py::init<size_t, int, const core::Device &>(),
+                 "buffer_size"_a = RGBDSequenceReader::DEFAULT_BUFFER_SIZE,
+                 "num_threads"_a = 4, "device"_a = core::Device("CPU:0"))
+            .def("is_opened", &RGBDSequenceReader::IsOpened,
+                 "Check if a sequence is opened.")
+            .def("open",
+                 py::overload_cast<const std::string &>(
+                         &RGBDSequenceReader::Open),
+                 py::call_guard<py::gil_scoped_release>(), "filename"_a,
+                 "Open an image folder or an association file.")
+            .def("open",
+                 py::overload_cast<const std::vector<std::string> &,
+                                   const std::vector<std::string> &,
+                                   const std::vector<uint64_t> &>(
+                         &RGBDSequenceReader::Open),
+                 py::call_guard<py::gil_scoped_release>(),
+                 "color_filenames"_a, "depth_filenames"_a,
+                 "timestamps"_a = std::vector<uint64_t>(),
+                 "Open a sequence of color and depth images, with timestamps "
+                 "in us, or 30 fps if empty.")
+            .def("close", &RGBDSequenceReader::Close,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Close the opened sequence.")
+            .def("is_eof", &RGBDSequenceReader::IsEOF,
+                 "Check if all the frames are read.")
+            .def_property_readonly("num_frames",
+                                   &RGBDSequenceReader::GetNumFrames,
+                                   "Number of frames in the sequence.")
+            .def_property(
+                    "metadata",
+                    py::overload_cast<>(&RGBDSequenceReader::GetMetadata,
+                                        py::const_),
+                    py::overload_cast<>(&RGBDSequenceReader::GetMetadata),
+                    "Get metadata of the sequence.")
+            .def("seek_timestamp", &RGBDSequenceReader::SeekTimestamp,
+                 "timestamp"_a,
+                 "Seek to the first frame at or after the timestamp (in us).")
+            .def("get_timestamp", &RGBDSequenceReader::GetTimestamp,
+                 "Get timestamp of the last frame read (in us).")
+            .def("next_frame", &RGBDSequenceReader::NextFrame,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Get the next frame, or an empty frame at the end of the "
+                 "sequence.")
+            .def("save_frames", &RGBDSequenceReader::SaveFrames,
+                 py::call_guard<py::gil_scoped_release>(), "frame_path"_a,
+                 "start_time_us"_a = 0, "end_time_us"_a = UINT64_MAX,
+                 "Save synchronized and aligned individual frames to "
+                 "subfolders.")
+            .def("__repr__", &RGBDSequenceReader::ToString);
+    docstring::ClassMethodDocInject(m, "RGBDSequenceReader", "seek_timestamp",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "RGBDSequenceReader", "save_frames",
+                                    map_shared_argument_docstrings);
+
     // Class RGBD sensor
     py::class_<RGBDSensor> rgbd_sensor(
             m, "RGBDSensor", "Interface class for control of RGBD cameras.");
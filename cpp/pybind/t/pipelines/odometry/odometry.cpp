@@ -27,6 +27,7 @@
 #include "pybind/t/pipelines/odometry/odometry.h"
 
 #include "open3d/t/pipelines/odometry/RGBDOdometry.h"
+#include "open3d/t/pipelines/odometry/RGBDPreprocessor.h"
 #include "pybind/docstring.h"
 
 namespace open3d {
@@ -126,6 +127,69 @@ void pybind_odometry_classes(py::module &m) {
                         olp.depth_outlier_trunc_, olp.depth_huber_delta_,
                         olp.intensity_huber_delta_);
             });
+
+    // open3d.t.pipelines.odometry.RGBDPyramid
+    py::class_<RGBDPyramid> rgbd_pyramid(
+            m, "RGBDPyramid",
+            "Multi-scale maps of an RGBD frame built by RGBDPreprocessor, "
+            "ordered from the coarsest to the finest level. Maps not required "
+            "by the odometry method are empty.");
+    py::detail::bind_copy_functions<RGBDPyramid>(rgbd_pyramid);
+    rgbd_pyramid.def(py::init<>())
+            .def_property_readonly("num_levels", &RGBDPyramid::NumLevels,
+                                   "Number of pyramid levels.")
+            .def_readonly("depth", &RGBDPyramid::depth_,
+                          "Float32 depth in meters, invalid pixels are NaN.")
+            .def_readonly("vertex_maps", &RGBDPyramid::vertex_maps_,
+                          "Float32 vertex maps.")
+            .def_readonly("normal_maps", &RGBDPyramid::normal_maps_,
+                          "Float32 normal maps.")
+            .def_readonly("depth_dx", &RGBDPyramid::depth_dx_,
+                          "Float32 depth gradients along x-axis.")
+            .def_readonly("depth_dy", &RGBDPyramid::depth_dy_,
+                          "Float32 depth gradients along y-axis.")
+            .def_readonly("intensity", &RGBDPyramid::intensity_,
+                          "Float32 intensity images.")
+            .def_readonly("intensity_dx", &RGBDPyramid::intensity_dx_,
+                          "Float32 intensity gradients along x-axis.")
+            .def_readonly("intensity_dy", &RGBDPyramid::intensity_dy_,
+                          "Float32 intensity gradients along y-axis.")
+            .def_readonly("intrinsics", &RGBDPyramid::intrinsics_,
+                          "Float64 intrinsic matrices.")
+            .def_readonly("color", &RGBDPyramid::color_,
+                          "Float32 color in [0, 1] at the finest level, if "
+                          "kept by the preprocessor.");
+
+    // open3d.t.pipelines.odometry.RGBDPreprocessor
+    py::class_<RGBDPreprocessor> rgbd_preprocessor(
+            m, "RGBDPreprocessor",
+            "Builds RGBDPyramid of RGBD frames for multi-scale odometry and "
+            "integration with fused kernels, reusing the output buffers.");
+    rgbd_preprocessor
+            .def(py::init<const core::Tensor &, int, float, float, Method,
+                          const OdometryLossParams &, bool>(),
+                 "intrinsics"_a, "num_levels"_a = 3, "depth_scale"_a = 1000.0f,
+                 "depth_max"_a = 3.0f, "method"_a = Method::Hybrid,
+                 "params"_a = OdometryLossParams(), "keep_color"_a = false)
+            .def("process",
+                 py::overload_cast<const t::geometry::RGBDImage &,
+                                   RGBDPyramid &>(&RGBDPreprocessor::Process,
+                                                  py::const_),
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Build the pyramid of an RGBD image in place, reusing its "
+                 "buffers.",
+                 "rgbd"_a, "pyramid"_a)
+            .def("process",
+                 py::overload_cast<const t::geometry::RGBDImage &>(
+                         &RGBDPreprocessor::Process, py::const_),
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Build and return the pyramid of an RGBD image.", "rgbd"_a)
+            .def_property_readonly("num_levels",
+                                   &RGBDPreprocessor::GetNumLevels)
+            .def_property_readonly("depth_scale",
+                                   &RGBDPreprocessor::GetDepthScale)
+            .def_property_readonly("depth_max", &RGBDPreprocessor::GetDepthMax)
+            .def_property_readonly("method", &RGBDPreprocessor::GetMethod);
 }
 
 // Odometry functions have similar arguments, sharing arg docstrings.
@@ -191,7 +255,14 @@ static const std::unordered_map<std::string, std::string>
                  "by CreateVertexMap before calling this function."}};
 
 void pybind_odometry_methods(py::module &m) {
-    m.def("rgbd_odometry_multi_scale", &RGBDOdometryMultiScale,
+    m.def("rgbd_odometry_multi_scale",
+          py::overload_cast<const t::geometry::RGBDImage &,
+                            const t::geometry::RGBDImage &,
+                            const core::Tensor &, const core::Tensor &,
+                            const float, const float,
+                            const std::vector<OdometryConvergenceCriteria> &,
+                            const Method, const OdometryLossParams &>(
+                  &RGBDOdometryMultiScale),
           py::call_guard<py::gil_scoped_release>(),
           "Function for Multi Scale RGBD odometry.", "source"_a, "target"_a,
           "intrinsics"_a,
@@ -201,6 +272,21 @@ void pybind_odometry_methods(py::module &m) {
           "criteria_list"_a =
                   std::vector<OdometryConvergenceCriteria>({10, 5, 3}),
           "method"_a = Method::Hybrid, "params"_a = OdometryLossParams());
+    m.def("rgbd_odometry_multi_scale",
+          py::overload_cast<const RGBDPyramid &, const RGBDPyramid &,
+                            const core::Tensor &,
+                            const std::vector<OdometryConvergenceCriteria> &,
+                            const Method, const OdometryLossParams &>(
+                  &RGBDOdometryMultiScale),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for Multi Scale RGBD odometry on pyramids built by "
+          "RGBDPreprocessor with the same method.",
+          "source"_a, "target"_a,
+          "init_source_to_target"_a =
+                  core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+          "criteria_list"_a =
+                  std::vector<OdometryConvergenceCriteria>({10, 5, 3}),
+          "method"_a = Method::Hybrid, "params"_a = OdometryLossParams());
     docstring::FunctionDocInject(m, "rgbd_odometry_multi_scale",
                                  map_shared_argument_docstrings);
 
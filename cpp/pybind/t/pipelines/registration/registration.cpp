@@ -272,6 +272,9 @@ static const std::unordered_map<std::string, std::string>
                  "``TransformationEstimationForColoredICP``, "
                  "``TransformationEstimationForGeneralizedICP``)"},
                 {"init_source_to_target", "Initial transformation estimation"},
+                {"init_source_to_targets",
+                 "List of initial transformation estimations, one for each "
+                 "pair. If empty, identity is used for all pairs."},
                 {"max_correspondence_distance",
                  "Maximum correspondence points-pair distance."},
                 {"max_correspondence_distances",
@@ -279,7 +282,10 @@ static const std::unordered_map<std::string, std::string>
                  "points-pair distances for multi-scale icp."},
                 {"option", "Registration option"},
                 {"source", "The source point cloud."},
+                {"sources", "List of source point clouds."},
                 {"target", "The target point cloud."},
+                {"targets",
+                 "List of target point clouds, same length as ``sources``."},
                 {"transformation",
                  "The 4x4 transformation matrix of type Float64 "
                  "to transform ``source`` to ``target``"},
@@ -317,6 +323,17 @@ void pybind_registration_methods(py::module &m) {
           "callback_after_iteration"_a = py::none());
     docstring::FunctionDocInject(m, "icp", map_shared_argument_docstrings);
 
+    m.def("batch_icp", &BatchICP, py::call_guard<py::gil_scoped_release>(),
+          "Function for ICP registration of many independent point cloud "
+          "pairs. The pairs are registered in parallel and a list of "
+          "results is returned, one for each pair.",
+          "sources"_a, "targets"_a, "max_correspondence_distance"_a,
+          "init_source_to_targets"_a = std::vector<core::Tensor>(),
+          "estimation_method"_a = TransformationEstimationPointToPoint(),
+          "criteria"_a = ICPConvergenceCriteria(), "voxel_size"_a = -1.0);
+    docstring::FunctionDocInject(m, "batch_icp",
+                                 map_shared_argument_docstrings);
+
     m.def("multi_scale_icp", &MultiScaleICP,
           py::call_guard<py::gil_scoped_release>(),
           "Function for Multi-Scale ICP registration", "source"_a, "target"_a,
@@ -26,6 +26,7 @@
 
 #include "open3d/t/pipelines/slam/Frame.h"
 #include "open3d/t/pipelines/slam/Model.h"
+#include "open3d/t/pipelines/slam/Pipeline.h"
 #include "pybind/docstring.h"
 
 namespace open3d {
@@ -95,7 +96,9 @@ void pybind_slam_model(py::module &m) {
     docstring::ClassMethodDocInject(m, "Model", "synthesize_model_frame",
                                     map_shared_argument_docstrings);
 
-    model.def("track_frame_to_model", &Model::TrackFrameToModel,
+    model.def("track_frame_to_model",
+              py::overload_cast<const Frame &, const Frame &, float, float,
+                                float>(&Model::TrackFrameToModel),
               py::call_guard<py::gil_scoped_release>(),
               "Track input frame against raycasted frame from model.",
               "input_frame"_a, "model_frame"_a, "depth_scale"_a = 1000.0,
@@ -162,11 +165,38 @@ void pybind_slam_frame(py::module &m) {
               "Get a 2D image from from the given key in the map.");
 }
 
+void pybind_slam_pipeline(py::module &m) {
+    py::class_<Pipeline> pipeline(
+            m, "Pipeline",
+            "Pipelined driver of dense SLAM. Frame decoding and preprocessing "
+            "run in their own threads with bounded queues, overlapping with "
+            "tracking, integration, and ray casting.");
+
+    pipeline.def(py::init<Model &, core::Tensor, float, float, float, float,
+                          int, bool>(),
+                 "model"_a, "intrinsics"_a, "depth_scale"_a = 1000.0,
+                 "depth_max"_a = 3.0, "depth_diff"_a = 0.07,
+                 "trunc_voxel_multiplier"_a = 8.0, "queue_size"_a = 4,
+                 "pipelined"_a = true, py::keep_alive<1, 2>());
+    pipeline.def("run",
+                 py::overload_cast<const std::vector<std::string> &,
+                                   const std::vector<std::string> &>(
+                         &Pipeline::Run),
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Process frames read from depth and color image files, and "
+                 "return the frame to world pose per frame.",
+                 "depth_paths"_a, "color_paths"_a);
+    pipeline.def("get_stage_latencies", &Pipeline::GetStageLatencies,
+                 "Get the average latency per frame in milliseconds of each "
+                 "stage in the last run.");
+}
+
 void pybind_slam(py::module &m) {
     py::module m_submodule =
             m.def_submodule("slam", "Tensor DenseSLAM pipeline.");
     pybind_slam_model(m_submodule);
     pybind_slam_frame(m_submodule);
+    pybind_slam_pipeline(m_submodule);
 }
 
 }  // namespace slam
@@ -34,6 +34,7 @@
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/FixedRadiusSearchImpl.h"
 #include "open3d/utility/Helper.h"
 #include "tests/Tests.h"
 #include "tests/core/CoreTest.h"
@@ -77,9 +78,14 @@ void ApplyPermutation(T* vec, const std::vector<size_t> p) {
     }
 }
 
-TEST(FixedRadiusIndex, SearchRadius) {
+class FixedRadiusIndexPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(FixedRadiusIndex,
+                         FixedRadiusIndexPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(FixedRadiusIndexPermuteDevices, SearchRadius) {
     // Define test data.
-    core::Device device = core::Device("CUDA:0");
+    core::Device device = GetParam();
     core::Tensor dataset_points = core::Tensor::Init<float>({{0.0, 0.0, 0.0},
                                                              {0.0, 0.0, 0.1},
                                                              {0.0, 0.0, 0.2},
@@ -136,9 +142,9 @@ TEST(FixedRadiusIndex, SearchRadius) {
     EXPECT_TRUE(neighbors_row_splits.AllClose(gt_neighbors_row_splits));
 }
 
-TEST(FixedRadiusIndex, SearchRadiusBatch) {
+TEST_P(FixedRadiusIndexPermuteDevices, SearchRadiusBatch) {
     // Define test data.
-    core::Device device = core::Device("CUDA:0");
+    core::Device device = GetParam();
     core::Tensor dataset_points = core::Tensor::Init<float>(
             {{0.719, 0.128, 0.431}, {0.764, 0.970, 0.678},
              {0.692, 0.786, 0.211}, {0.692, 0.969, 0.942},
@@ -313,9 +319,9 @@ TEST(FixedRadiusIndex, SearchRadiusBatch) {
              gt_neighbors_row_splits);
 }
 
-TEST(FixedRadiusIndex, SearchHybrid) {
+TEST_P(FixedRadiusIndexPermuteDevices, SearchHybrid) {
     // Define test data.
-    core::Device device = core::Device("CUDA:0");
+    core::Device device = GetParam();
     core::Tensor dataset_points = core::Tensor::Init<float>({{0.0, 0.0, 0.0},
                                                              {0.0, 0.0, 0.1},
                                                              {0.0, 0.0, 0.2},
@@ -375,9 +381,9 @@ TEST(FixedRadiusIndex, SearchHybrid) {
     EXPECT_TRUE(counts.AllClose(gt_counts));
 }
 
-TEST(FixedRadiusIndex, SearchHybridBatch) {
+TEST_P(FixedRadiusIndexPermuteDevices, SearchHybridBatch) {
     // Define test data.
-    core::Device device = core::Device("CUDA:0");
+    core::Device device = GetParam();
     core::Tensor dataset_points = core::Tensor::Init<float>(
             {{0.719, 0.128, 0.431}, {0.764, 0.970, 0.678},
              {0.692, 0.786, 0.211}, {0.692, 0.969, 0.942},
@@ -450,5 +456,17 @@ TEST(FixedRadiusIndex, SearchHybridBatch) {
     ExpectEQ(indices.ToFlatVector<int64_t>(), gt_indices64);
     ExpectEQ(indices.GetShape(), shape);
 }
+
+TEST(FixedRadiusIndex, BuildSpatialHashTableWithoutBatches) {
+    // Row splits without batch items result in a hash table without cells.
+    const int64_t points_row_splits[] = {0};
+    const uint32_t hash_table_splits[] = {0};
+    uint32_t hash_table_cell_splits[] = {1};
+    core::nns::impl::BuildSpatialHashTableCPU<float>(
+            0, nullptr, 1.f, 1, points_row_splits, hash_table_splits, 1,
+            hash_table_cell_splits, nullptr);
+    EXPECT_EQ(hash_table_cell_splits[0], 0u);
+}
+
 }  // namespace tests
 }  // namespace open3d
\ No newline at end of file
@@ -144,5 +144,58 @@ TEST(KDTreeFlann, SearchHybrid) {
     ExpectEQ(ref_distance2, distance2);
 }
 
+TEST(KDTreeFlann, BatchSearch) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    geometry::KDTreeFlann kdtree(pc);
+
+    std::vector<Eigen::Vector3d> queries(700);
+    Rand(queries, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 1);
+    Eigen::Map<const Eigen::MatrixXd> queries_mat(
+            reinterpret_cast<const double *>(queries.data()), 3,
+            queries.size());
+
+    // The output buffers are reused by all searches.
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    std::vector<int64_t> row_splits;
+    for (const auto &param :
+         std::vector<std::shared_ptr<geometry::KDTreeSearchParam>>{
+                 std::make_shared<geometry::KDTreeSearchParamKNN>(7),
+                 std::make_shared<geometry::KDTreeSearchParamRadius>(1.5),
+                 std::make_shared<geometry::KDTreeSearchParamHybrid>(1.5,
+                                                                    5)}) {
+        int64_t result = kdtree.Search(queries_mat, *param, indices, distance2,
+                                       row_splits);
+        ASSERT_EQ(row_splits.size(), queries.size() + 1);
+        EXPECT_EQ(result, row_splits.back());
+        EXPECT_EQ(indices.size(), size_t(result));
+        EXPECT_EQ(distance2.size(), size_t(result));
+
+        for (size_t i = 0; i < queries.size(); ++i) {
+            std::vector<int> ref_indices;
+            std::vector<double> ref_distance2;
+            int k = kdtree.Search(queries[i], *param, ref_indices,
+                                  ref_distance2);
+            ASSERT_EQ(row_splits[i + 1] - row_splits[i], k);
+            ExpectEQ(ref_indices,
+                     std::vector<int>(indices.begin() + row_splits[i],
+                                      indices.begin() + row_splits[i + 1]));
+            ExpectEQ(ref_distance2,
+                     std::vector<double>(
+                             distance2.begin() + row_splits[i],
+                             distance2.begin() + row_splits[i + 1]));
+        }
+    }
+
+    // Dimension mismatch.
+    Eigen::MatrixXd queries_2d = Eigen::MatrixXd::Zero(2, 10);
+    EXPECT_EQ(kdtree.SearchKNN(queries_2d, 1, indices, distance2, row_splits),
+              -1);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -656,6 +656,64 @@ TEST(PointCloud, SelectByIndex) {
                                 }));
 }
 
+TEST(PointCloud, SortByMortonCode) {
+    geometry::PointCloud pcd;
+    pcd.points_ = std::vector<Eigen::Vector3d>({
+            {1, 1, 0},
+            {0, 0, 1},
+            {0, 0, 0},
+            {1, 0, 0},
+    });
+    pcd.colors_ = std::vector<Eigen::Vector3d>({
+            {0.0, 0.0, 0.0},
+            {0.1, 0.1, 0.1},
+            {0.2, 0.2, 0.2},
+            {0.3, 0.3, 0.3},
+    });
+    pcd.normals_ = std::vector<Eigen::Vector3d>({
+            {10, 10, 10},
+            {11, 11, 11},
+            {12, 12, 12},
+            {13, 13, 13},
+    });
+    pcd.covariances_ = std::vector<Eigen::Matrix3d>({
+            1.0 * Eigen::Matrix3d::Identity(),
+            2.0 * Eigen::Matrix3d::Identity(),
+            Eigen::Matrix3d::Zero(),
+            3.0 * Eigen::Matrix3d::Identity(),
+    });
+
+    std::vector<size_t> permutation = pcd.SortByMortonCode();
+    EXPECT_EQ(permutation, std::vector<size_t>({2, 3, 0, 1}));
+    ExpectEQ(pcd.points_, std::vector<Eigen::Vector3d>({
+                                  {0, 0, 0},
+                                  {1, 0, 0},
+                                  {1, 1, 0},
+                                  {0, 0, 1},
+                          }));
+    ExpectEQ(pcd.colors_, std::vector<Eigen::Vector3d>({
+                                  {0.2, 0.2, 0.2},
+                                  {0.3, 0.3, 0.3},
+                                  {0.0, 0.0, 0.0},
+                                  {0.1, 0.1, 0.1},
+                          }));
+    ExpectEQ(pcd.normals_, std::vector<Eigen::Vector3d>({
+                                   {12, 12, 12},
+                                   {13, 13, 13},
+                                   {10, 10, 10},
+                                   {11, 11, 11},
+                           }));
+    ExpectEQ(pcd.covariances_, std::vector<Eigen::Matrix3d>({
+                                       Eigen::Matrix3d::Zero(),
+                                       3.0 * Eigen::Matrix3d::Identity(),
+                                       1.0 * Eigen::Matrix3d::Identity(),
+                                       2.0 * Eigen::Matrix3d::Identity(),
+                               }));
+
+    geometry::PointCloud pcd_empty;
+    EXPECT_TRUE(pcd_empty.SortByMortonCode().empty());
+}
+
 TEST(PointCloud, VoxelDownSample) {
     // voxel_size: 1
     // points_min_bound: (0.5, 0.5, 0.5)
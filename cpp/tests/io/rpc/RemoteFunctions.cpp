@@ -26,15 +26,22 @@
 
 #include "open3d/io/rpc/RemoteFunctions.h"
 
+#include <chrono>
+#include <mutex>
 #include <random>
+#include <thread>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/io/rpc/BufferConnection.h"
 #include "open3d/io/rpc/Connection.h"
+#include "open3d/io/rpc/DummyMessageProcessor.h"
 #include "open3d/io/rpc/DummyReceiver.h"
 #include "open3d/io/rpc/MessageUtils.h"
+#include "open3d/io/rpc/Messages.h"
+#include "open3d/io/rpc/PushConnection.h"
 #include "open3d/io/rpc/ZMQContext.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "tests/Tests.h"
 
 using namespace open3d::io::rpc;
@@ -53,6 +60,44 @@ public:
     virtual void TearDown() { DestroyZMQContext(); }
 };
 
+namespace {
+
+/// Stores the geometries of all received SetMeshData messages.
+class RecordingMessageProcessor : public DummyMessageProcessor {
+public:
+    using DummyMessageProcessor::ProcessMessage;
+
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::SetMeshData& msg,
+            const msgpack::object_handle& obj) override {
+        auto geometry = MeshDataToGeometry(msg.data);
+        const std::lock_guard<std::mutex> lock(mutex_);
+        geometries_.push_back(geometry);
+        return CreateStatusOKMsg();
+    }
+
+    /// Waits until \p num geometries have been received or 5s have passed.
+    std::vector<std::shared_ptr<t::geometry::Geometry>> WaitForGeometries(
+            size_t num) {
+        for (int i = 0; i < 500; ++i) {
+            {
+                const std::lock_guard<std::mutex> lock(mutex_);
+                if (geometries_.size() >= num) break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        const std::lock_guard<std::mutex> lock(mutex_);
+        return geometries_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<std::shared_ptr<t::geometry::Geometry>> geometries_;
+};
+
+}  // namespace
+
 TEST_F(RemoteFunctions, SendReceiveUnpackMessages) {
     {
         // start receiver
@@ -153,6 +198,65 @@ TEST_F(RemoteFunctions, SendReceiveUnpackMessages) {
     }
 }
 
+TEST_F(RemoteFunctions, PushConnection) {
+    auto processor = std::make_shared<RecordingMessageProcessor>();
+    ZMQReceiver receiver(connection_address, 500,
+                         ZMQReceiver::SocketType::PULL);
+    receiver.SetMessageProcessor(processor);
+    receiver.Start();
+
+    // Constant positions are compressed, random colors are sent as is.
+    const int64_t num_points = 2000;
+    core::Tensor positions =
+            core::Tensor::Zeros({num_points, 3}, core::Float32);
+    std::mt19937 rng;
+    rng.seed(123);
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    std::vector<float> color_values(num_points * 3);
+    for (auto& v : color_values) {
+        v = dist(rng);
+    }
+    core::Tensor colors(color_values, {num_points, 3}, core::Float32);
+
+    {
+        auto connection = std::make_shared<PushConnection>(
+                connection_address, 500, 500, /*batch_size=*/2,
+                /*compress=*/true);
+        for (int i = 0; i < 3; ++i) {
+            ASSERT_TRUE(SetMeshData(
+                    "points" + std::to_string(i), i, "", positions.Add(i),
+                    {{"colors", colors}}, core::Tensor({0}, core::Int32), {},
+                    core::Tensor({0}, core::Int32), {}, "", {}, {}, {}, "",
+                    connection));
+        }
+        // The third message waits for the next batch.
+        EXPECT_EQ(connection->GetNumPending(), 1);
+        ASSERT_TRUE(SetTime(1, connection));
+        EXPECT_EQ(connection->GetNumPending(), 0);
+
+        geometry::PointCloud pcd;
+        pcd.points_.push_back(Eigen::Vector3d(1, 2, 3));
+        ASSERT_TRUE(SetPointCloud(pcd, "legacy", 0, "", connection));
+        ASSERT_TRUE(connection->Flush());
+    }
+
+    auto geometries = processor->WaitForGeometries(4);
+    receiver.Stop();
+    ASSERT_EQ(geometries.size(), 4);
+    for (int i = 0; i < 3; ++i) {
+        auto pcd = std::dynamic_pointer_cast<t::geometry::PointCloud>(
+                geometries[i]);
+        ASSERT_TRUE(pcd);
+        EXPECT_TRUE(pcd->GetPointPositions().AllClose(positions.Add(i)));
+        EXPECT_TRUE(pcd->GetPointColors().AllClose(colors));
+    }
+    auto legacy = std::dynamic_pointer_cast<t::geometry::PointCloud>(
+            geometries[3]);
+    ASSERT_TRUE(legacy);
+    EXPECT_TRUE(legacy->GetPointPositions().AllClose(
+            core::Tensor::Init<double>({{1, 2, 3}})));
+}
+
 TEST_F(RemoteFunctions, SendGarbage) {
     std::mt19937 rng;
     rng.seed(123);
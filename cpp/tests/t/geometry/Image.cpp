@@ -173,6 +173,27 @@ TEST_P(ImagePermuteDevices, Copy) {
     EXPECT_TRUE(im_copy.AsTensor().AllClose(im.AsTensor()));
 }
 
+TEST_P(ImagePermuteDevices, Reset) {
+    core::Device device = GetParam();
+
+    t::geometry::Image im(48, 64, 1, core::UInt16, device);
+    const void* data_ptr = im.GetDataPtr();
+
+    // Memory is reused for the same parameters.
+    im.Reset(48, 64, 1, core::UInt16, device);
+    EXPECT_EQ(im.GetDataPtr(), data_ptr);
+
+    // Shared memory is never overwritten.
+    t::geometry::Image im_shared = im;
+    im.Reset(48, 64, 1, core::UInt16, device);
+    EXPECT_NE(im.GetDataPtr(), data_ptr);
+    EXPECT_EQ(im_shared.GetDataPtr(), data_ptr);
+
+    im.Reset(48, 64, 3, core::UInt8, device);
+    EXPECT_EQ(im.GetChannels(), 3);
+    EXPECT_EQ(im.GetDtype(), core::UInt8);
+}
+
 // a. Automatic scale determination for conversion from UInt8 / UInt16 ->
 // Float32/64
 // b. LinearTransform() with value saturation.
@@ -283,17 +304,13 @@ TEST_P(ImagePermuteDevices, FilterBilateral) {
                 core::Tensor(input_data, {5, 5, 1}, core::Float32, device);
 
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
-            ASSERT_THROW(im.FilterBilateral(3, 10, 10), std::runtime_error);
+        im = im.FilterBilateral(3, 10, 10);
+        if (device.IsCPU()) {
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_ipp, {5, 5, 1}, core::Float32, device)));
         } else {
-            im = im.FilterBilateral(3, 10, 10);
-            if (device.IsCPU()) {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_ipp, {5, 5, 1}, core::Float32, device)));
-            } else {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_npp, {5, 5, 1}, core::Float32, device)));
-            }
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_npp, {5, 5, 1}, core::Float32, device)));
         }
     }
 
@@ -323,17 +340,13 @@ TEST_P(ImagePermuteDevices, FilterBilateral) {
                 core::Tensor(input_data, {5, 5, 1}, core::UInt8, device);
 
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
-            ASSERT_THROW(im.FilterBilateral(3, 5, 5), std::runtime_error);
+        im = im.FilterBilateral(3, 5, 5);
+        if (device.IsCPU()) {
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_ipp, {5, 5, 1}, core::UInt8, device)));
         } else {
-            im = im.FilterBilateral(3, 5, 5);
-            if (device.IsCPU()) {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_ipp, {5, 5, 1}, core::UInt8, device)));
-            } else {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_npp, {5, 5, 1}, core::UInt8, device)));
-            }
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_npp, {5, 5, 1}, core::UInt8, device)));
         }
     }
 }
@@ -362,13 +375,9 @@ TEST_P(ImagePermuteDevices, FilterGaussian) {
         core::Tensor data =
                 core::Tensor(input_data, {5, 5, 1}, core::Float32, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
-            ASSERT_THROW(im.FilterGaussian(3), std::runtime_error);
-        } else {
-            im = im.FilterGaussian(3);
-            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                    output_ref, {5, 5, 1}, core::Float32, device)));
-        }
+        im = im.FilterGaussian(3);
+        EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                output_ref, {5, 5, 1}, core::Float32, device)));
     }
 
     {  // UInt8
@@ -396,17 +405,13 @@ TEST_P(ImagePermuteDevices, FilterGaussian) {
         core::Tensor data =
                 core::Tensor(input_data, {5, 5, 1}, core::UInt8, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
-            ASSERT_THROW(im.FilterGaussian(3), std::runtime_error);
+        im = im.FilterGaussian(3);
+        if (device.IsCPU()) {
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_ipp, {5, 5, 1}, core::UInt8, device)));
         } else {
-            im = im.FilterGaussian(3);
-            if (device.IsCPU()) {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_ipp, {5, 5, 1}, core::UInt8, device)));
-            } else {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_npp, {5, 5, 1}, core::UInt8, device)));
-            }
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_npp, {5, 5, 1}, core::UInt8, device)));
         }
     }
 }
@@ -436,13 +441,9 @@ TEST_P(ImagePermuteDevices, Filter) {
         core::Tensor kernel =
                 core::Tensor(kernel_data, {5, 5}, core::Float32, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
-            ASSERT_THROW(im.Filter(kernel), std::runtime_error);
-        } else {
-            t::geometry::Image im_new = im.Filter(kernel);
-            EXPECT_TRUE(
-                    im_new.AsTensor().Reverse().View({5, 5}).AllClose(kernel));
-        }
+        t::geometry::Image im_new = im.Filter(kernel);
+        EXPECT_TRUE(
+                im_new.AsTensor().Reverse().View({5, 5}).AllClose(kernel));
     }
 
     {  // UInt8
@@ -482,17 +483,13 @@ TEST_P(ImagePermuteDevices, Filter) {
         core::Tensor kernel =
                 core::Tensor(kernel_data, {5, 5}, core::Float32, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
-            ASSERT_THROW(im.Filter(kernel), std::runtime_error);
+        im = im.Filter(kernel);
+        if (device.IsCPU()) {
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_ipp, {5, 5, 1}, core::UInt8, device)));
         } else {
-            im = im.Filter(kernel);
-            if (device.IsCPU()) {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_ipp, {5, 5, 1}, core::UInt8, device)));
-            } else {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_npp, {5, 5, 1}, core::UInt8, device)));
-            }
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_npp, {5, 5, 1}, core::UInt8, device)));
         }
     }
 }
@@ -526,16 +523,12 @@ TEST_P(ImagePermuteDevices, FilterSobel) {
                 core::Tensor(input_data, {5, 5, 1}, core::Float32, device);
         t::geometry::Image im(data);
         t::geometry::Image dx, dy;
-        if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
-            ASSERT_THROW(im.FilterSobel(3), std::runtime_error);
-        } else {
-            std::tie(dx, dy) = im.FilterSobel(3);
+        std::tie(dx, dy) = im.FilterSobel(3);
 
-            EXPECT_TRUE(dx.AsTensor().AllClose(core::Tensor(
-                    output_dx_ref, {5, 5, 1}, core::Float32, device)));
-            EXPECT_TRUE(dy.AsTensor().AllClose(core::Tensor(
-                    output_dy_ref, {5, 5, 1}, core::Float32, device)));
-        }
+        EXPECT_TRUE(dx.AsTensor().AllClose(core::Tensor(
+                output_dx_ref, {5, 5, 1}, core::Float32, device)));
+        EXPECT_TRUE(dy.AsTensor().AllClose(core::Tensor(
+                output_dy_ref, {5, 5, 1}, core::Float32, device)));
     }
 
     {  // UInt8 -> Int16
@@ -544,20 +537,16 @@ TEST_P(ImagePermuteDevices, FilterSobel) {
                         .To(core::UInt8);
         t::geometry::Image im(data);
         t::geometry::Image dx, dy;
-        if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
-            ASSERT_THROW(im.FilterSobel(3), std::runtime_error);
-        } else {
-            std::tie(dx, dy) = im.FilterSobel(3);
-
-            EXPECT_TRUE(dx.AsTensor().AllClose(
-                    core::Tensor(output_dx_ref, {5, 5, 1}, core::Float32,
-                                 device)
-                            .To(core::Int16)));
-            EXPECT_TRUE(dy.AsTensor().AllClose(
-                    core::Tensor(output_dy_ref, {5, 5, 1}, core::Float32,
-                                 device)
-                            .To(core::Int16)));
-        }
+        std::tie(dx, dy) = im.FilterSobel(3);
+
+        EXPECT_TRUE(dx.AsTensor().AllClose(
+                core::Tensor(output_dx_ref, {5, 5, 1}, core::Float32,
+                             device)
+                        .To(core::Int16)));
+        EXPECT_TRUE(dy.AsTensor().AllClose(
+                core::Tensor(output_dy_ref, {5, 5, 1}, core::Float32,
+                             device)
+                        .To(core::Int16)));
     }
 }
 
@@ -582,15 +571,9 @@ TEST_P(ImagePermuteDevices, Resize) {
         core::Tensor data =
                 core::Tensor(input_data, {6, 6, 1}, core::Float32, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
-            ASSERT_THROW(
-                    im.Resize(0.5, t::geometry::Image::InterpType::Nearest),
-                    std::runtime_error);
-        } else {
-            im = im.Resize(0.5, t::geometry::Image::InterpType::Nearest);
-            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                    output_ref, {3, 3, 1}, core::Float32, device)));
-        }
+        im = im.Resize(0.5, t::geometry::Image::InterpType::Nearest);
+        EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                output_ref, {3, 3, 1}, core::Float32, device)));
     }
     {  // UInt8
         // clang-format off
@@ -614,37 +597,32 @@ TEST_P(ImagePermuteDevices, Resize) {
         core::Tensor data =
                 core::Tensor(input_data, {6, 6, 1}, core::UInt8, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
-            ASSERT_THROW(im.Resize(0.5, t::geometry::Image::InterpType::Super),
-                         std::runtime_error);
+        t::geometry::Image im_low =
+                im.Resize(0.5, t::geometry::Image::InterpType::Super);
+        utility::LogInfo("Super: {}",
+                         im_low.AsTensor().View({3, 3}).ToString());
+
+        if (device.IsCPU()) {
+            EXPECT_TRUE(im_low.AsTensor().AllClose(core::Tensor(
+                    output_ref_ipp, {3, 3, 1}, core::UInt8, device)));
         } else {
-            t::geometry::Image im_low =
-                    im.Resize(0.5, t::geometry::Image::InterpType::Super);
-            utility::LogInfo("Super: {}",
+            EXPECT_TRUE(im_low.AsTensor().AllClose(core::Tensor(
+                    output_ref_npp, {3, 3, 1}, core::UInt8, device)));
+
+            // Check output in the CI to see if other inteprolations works
+            // with other platforms
+            im_low = im.Resize(0.5, t::geometry::Image::InterpType::Linear);
+            utility::LogInfo("Linear(impl. dependent): {}",
+                             im_low.AsTensor().View({3, 3}).ToString());
+
+            im_low = im.Resize(0.5, t::geometry::Image::InterpType::Cubic);
+            utility::LogInfo("Cubic(impl. dependent): {}",
                              im_low.AsTensor().View({3, 3}).ToString());
 
-            if (device.IsCPU()) {
-                EXPECT_TRUE(im_low.AsTensor().AllClose(core::Tensor(
-                        output_ref_ipp, {3, 3, 1}, core::UInt8, device)));
-            } else {
-                EXPECT_TRUE(im_low.AsTensor().AllClose(core::Tensor(
-                        output_ref_npp, {3, 3, 1}, core::UInt8, device)));
-
-                // Check output in the CI to see if other inteprolations works
-                // with other platforms
-                im_low = im.Resize(0.5, t::geometry::Image::InterpType::Linear);
-                utility::LogInfo("Linear(impl. dependent): {}",
-                                 im_low.AsTensor().View({3, 3}).ToString());
-
-                im_low = im.Resize(0.5, t::geometry::Image::InterpType::Cubic);
-                utility::LogInfo("Cubic(impl. dependent): {}",
-                                 im_low.AsTensor().View({3, 3}).ToString());
-
-                im_low =
-                        im.Resize(0.5, t::geometry::Image::InterpType::Lanczos);
-                utility::LogInfo("Lanczos(impl. dependent): {}",
-                                 im_low.AsTensor().View({3, 3}).ToString());
-            }
+            im_low =
+                    im.Resize(0.5, t::geometry::Image::InterpType::Lanczos);
+            utility::LogInfo("Lanczos(impl. dependent): {}",
+                             im_low.AsTensor().View({3, 3}).ToString());
         }
     }
 }
@@ -671,13 +649,9 @@ TEST_P(ImagePermuteDevices, PyrDown) {
                 core::Tensor(input_data, {6, 6, 1}, core::Float32, device);
         t::geometry::Image im(data);
 
-        if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
-            ASSERT_THROW(im.PyrDown(), std::runtime_error);
-        } else {
-            im = im.PyrDown();
-            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                    output_ref, {3, 3, 1}, core::Float32, device)));
-        }
+        im = im.PyrDown();
+        EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                output_ref, {3, 3, 1}, core::Float32, device)));
     }
 
     {  // UInt8
@@ -703,17 +677,13 @@ TEST_P(ImagePermuteDevices, PyrDown) {
                 core::Tensor(input_data, {6, 6, 1}, core::UInt8, device);
         t::geometry::Image im(data);
 
-        if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
-            ASSERT_THROW(im.PyrDown(), std::runtime_error);
+        im = im.PyrDown();
+        if (device.IsCPU()) {
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_ipp, {3, 3, 1}, core::UInt8, device)));
         } else {
-            im = im.PyrDown();
-            if (device.IsCPU()) {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_ipp, {3, 3, 1}, core::UInt8, device)));
-            } else {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_npp, {3, 3, 1}, core::UInt8, device)));
-            }
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_npp, {3, 3, 1}, core::UInt8, device)));
         }
     }
 }
@@ -751,45 +721,83 @@ TEST_P(ImagePermuteDevices, Dilate) {
     core::Tensor t_input_uint8_t =
             t_input.To(core::UInt8);  // normal static_cast is OK
     t::geometry::Image input_uint8_t(t_input_uint8_t);
-    if (!t::geometry::Image::HAVE_IPPICV &&
-        device.IsCPU()) {  // Not Implemented
-        ASSERT_THROW(input_uint8_t.Dilate(kernel_size), std::runtime_error);
-    } else {
-        output = input_uint8_t.Dilate(kernel_size);
-        EXPECT_EQ(output.GetRows(), input.GetRows());
-        EXPECT_EQ(output.GetCols(), input.GetCols());
-        EXPECT_EQ(output.GetChannels(), input.GetChannels());
-        EXPECT_THAT(output.AsTensor().ToFlatVector<uint8_t>(),
-                    ElementsAreArray(output_ref));
-    }
+    output = input_uint8_t.Dilate(kernel_size);
+    EXPECT_EQ(output.GetRows(), input.GetRows());
+    EXPECT_EQ(output.GetCols(), input.GetCols());
+    EXPECT_EQ(output.GetChannels(), input.GetChannels());
+    EXPECT_THAT(output.AsTensor().ToFlatVector<uint8_t>(),
+                ElementsAreArray(output_ref));
 
     // UInt16
     core::Tensor t_input_uint16_t =
             t_input.To(core::UInt16);  // normal static_cast is OK
     t::geometry::Image input_uint16_t(t_input_uint16_t);
-    if (!t::geometry::Image::HAVE_IPPICV &&
-        device.IsCPU()) {  // Not Implemented
-        ASSERT_THROW(input_uint16_t.Dilate(kernel_size), std::runtime_error);
-    } else {
-        output = input_uint16_t.Dilate(kernel_size);
-        EXPECT_EQ(output.GetRows(), input.GetRows());
-        EXPECT_EQ(output.GetCols(), input.GetCols());
-        EXPECT_EQ(output.GetChannels(), input.GetChannels());
-        EXPECT_THAT(output.AsTensor().ToFlatVector<uint16_t>(),
-                    ElementsAreArray(output_ref));
-    }
+    output = input_uint16_t.Dilate(kernel_size);
+    EXPECT_EQ(output.GetRows(), input.GetRows());
+    EXPECT_EQ(output.GetCols(), input.GetCols());
+    EXPECT_EQ(output.GetChannels(), input.GetChannels());
+    EXPECT_THAT(output.AsTensor().ToFlatVector<uint16_t>(),
+                ElementsAreArray(output_ref));
 
     // Float32
-    if (!t::geometry::Image::HAVE_IPPICV &&
-        device.IsCPU()) {  // Not Implemented
-        ASSERT_THROW(input.Dilate(kernel_size), std::runtime_error);
-    } else {
-        output = input.Dilate(kernel_size);
-        EXPECT_EQ(output.GetRows(), input.GetRows());
-        EXPECT_EQ(output.GetCols(), input.GetCols());
-        EXPECT_EQ(output.GetChannels(), input.GetChannels());
-        EXPECT_THAT(output.AsTensor().ToFlatVector<float>(),
-                    ElementsAreArray(output_ref));
+    output = input.Dilate(kernel_size);
+    EXPECT_EQ(output.GetRows(), input.GetRows());
+    EXPECT_EQ(output.GetCols(), input.GetCols());
+    EXPECT_EQ(output.GetChannels(), input.GetChannels());
+    EXPECT_THAT(output.AsTensor().ToFlatVector<float>(),
+                ElementsAreArray(output_ref));
+}
+
+// The portable CPU kernels must agree with IPP up to rounding of integer
+// outputs.
+TEST(Image, PortableCPUFiltersMatchIPP) {
+    if (!t::geometry::Image::HAVE_IPPICV) {
+        GTEST_SKIP() << "Not built with IPP.";
+    }
+
+    data::SampleRedwoodRGBDImages redwood_data;
+    t::geometry::Image color =
+            *t::io::CreateImageFromFile(redwood_data.GetColorPaths()[0]);
+    t::geometry::Image depth =
+            t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[0])
+                    ->To(core::Float32, false, 1.0 / 1000.0);
+
+    auto run_filters = [&]() {
+        return std::vector<t::geometry::Image>{
+                color.RGBToGray(),
+                color.FilterGaussian(5),
+                depth.FilterGaussian(5, 1.5),
+                color.Dilate(3),
+                depth.Dilate(5),
+                depth.FilterSobel(3).first,
+                depth.FilterSobel(5).second,
+                color.Resize(0.5, t::geometry::Image::InterpType::Nearest),
+                depth.Resize(0.25, t::geometry::Image::InterpType::Super),
+                color.PyrDown(),
+                depth.PyrDown()};
+    };
+
+    t::geometry::Image::SetIPPEnabled(false);
+    EXPECT_FALSE(t::geometry::Image::IsIPPEnabled());
+    const std::vector<t::geometry::Image> portable = run_filters();
+    t::geometry::Image::SetIPPEnabled(true);
+    EXPECT_TRUE(t::geometry::Image::IsIPPEnabled());
+    const std::vector<t::geometry::Image> ipp = run_filters();
+
+    ASSERT_EQ(portable.size(), ipp.size());
+    for (size_t i = 0; i < ipp.size(); ++i) {
+        const core::Tensor &a = portable[i].AsTensor();
+        const core::Tensor &b = ipp[i].AsTensor();
+        ASSERT_EQ(a.GetShape(), b.GetShape());
+        ASSERT_EQ(a.GetDtype(), b.GetDtype());
+        if (a.GetDtype() == core::Float32) {
+            EXPECT_TRUE(a.AllClose(b, 1e-4, 1e-4)) << "Filter " << i;
+        } else {
+            const core::Tensor diff =
+                    (a.To(core::Int32) - b.To(core::Int32)).Abs();
+            EXPECT_LE(diff.Max({0, 1, 2}).Item<int32_t>(), 1)
+                    << "Filter " << i;
+        }
     }
 }
 
@@ -905,22 +913,16 @@ TEST_P(ImagePermuteDevices, DISABLED_CreateNormalMap_Visual) {
     // We have to apply a bilateral filter, otherwise normals would be too
     // noisy.
     auto depth_clipped = depth.ClipTransform(1000.0, 0.0, 3.0, invalid_fill);
-    if (!t::geometry::Image::HAVE_IPPICV &&
-        device.IsCPU()) {  // Not Implemented
-        ASSERT_THROW(depth_clipped.FilterBilateral(5, 5.0, 10.0),
-                     std::runtime_error);
-    } else {
-        auto depth_bilateral = depth_clipped.FilterBilateral(5, 5.0, 10.0);
-        auto vertex_map_for_normal =
-                depth_bilateral.CreateVertexMap(intrinsic_t, invalid_fill);
-        auto normal_map = vertex_map_for_normal.CreateNormalMap(invalid_fill);
-
-        // Use abs for better visualization
-        normal_map.AsTensor() = normal_map.AsTensor().Abs();
-        visualization::DrawGeometries(
-                {std::make_shared<open3d::geometry::Image>(
-                        normal_map.ToLegacy())});
-    }
+    auto depth_bilateral = depth_clipped.FilterBilateral(5, 5.0, 10.0);
+    auto vertex_map_for_normal =
+            depth_bilateral.CreateVertexMap(intrinsic_t, invalid_fill);
+    auto normal_map = vertex_map_for_normal.CreateNormalMap(invalid_fill);
+
+    // Use abs for better visualization
+    normal_map.AsTensor() = normal_map.AsTensor().Abs();
+    visualization::DrawGeometries(
+            {std::make_shared<open3d::geometry::Image>(
+                    normal_map.ToLegacy())});
 }
 
 TEST_P(ImagePermuteDevices, DISABLED_ColorizeDepth) {
@@ -750,6 +750,47 @@ TEST_P(PointCloudPermuteDevices, SelectByIndex) {
                                       device)));
 }
 
+TEST_P(PointCloudPermuteDevices, SortByMortonCode) {
+    core::Device device = GetParam();
+
+    const core::Tensor points = core::Tensor::Init<float>({{1, 1, 1},
+                                                           {0, 1, 0},
+                                                           {1, 0, 1},
+                                                           {0, 0, 0},
+                                                           {1, 1, 0},
+                                                           {0, 0, 1},
+                                                           {1, 0, 0},
+                                                           {0, 1, 1}},
+                                                          device);
+    const core::Tensor colors = points * 0.5;
+    t::geometry::PointCloud pcd(points);
+    pcd.SetPointColors(colors);
+
+    const core::Tensor permutation = pcd.SortByMortonCode();
+    EXPECT_TRUE(permutation.AllEqual(core::Tensor::Init<int64_t>(
+            {3, 6, 1, 4, 5, 2, 7, 0}, device)));
+    EXPECT_TRUE(pcd.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0, 0, 0},
+                                       {1, 0, 0},
+                                       {0, 1, 0},
+                                       {1, 1, 0},
+                                       {0, 0, 1},
+                                       {1, 0, 1},
+                                       {0, 1, 1},
+                                       {1, 1, 1}},
+                                      device)));
+    EXPECT_TRUE(pcd.GetPointColors().AllClose(pcd.GetPointPositions() * 0.5));
+
+    // The permutation restores the original order.
+    core::Tensor restored = core::Tensor::Empty({8, 3}, core::Float32, device);
+    restored.IndexSet({permutation}, pcd.GetPointPositions());
+    EXPECT_TRUE(restored.AllClose(points));
+
+    // Empty point cloud.
+    t::geometry::PointCloud pcd_empty(device);
+    EXPECT_EQ(pcd_empty.SortByMortonCode().GetLength(), 0);
+}
+
 TEST_P(PointCloudPermuteDevices, VoxelDownSample) {
     core::Device device = GetParam();
 
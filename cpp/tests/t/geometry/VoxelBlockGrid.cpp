@@ -26,6 +26,9 @@
 
 #include "open3d/t/geometry/VoxelBlockGrid.h"
 
+#include <map>
+#include <tuple>
+
 #include "core/CoreTest.h"
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
@@ -91,7 +94,7 @@ static std::vector<core::HashBackendType> EnumerateBackends(
 }
 
 static VoxelBlockGrid Integrate(const core::HashBackendType &backend,
-                                const core::Dtype &dtype,
+                                const std::vector<core::Dtype> &attr_dtypes,
                                 const core::Device &device,
                                 const int resolution) {
     core::Tensor intrinsic = GetIntrinsicTensor();
@@ -99,9 +102,9 @@ static VoxelBlockGrid Integrate(const core::HashBackendType &backend,
     const float depth_scale = 1000.0;
     const float depth_max = 3.0;
 
-    auto vbg = VoxelBlockGrid({"tsdf", "weight", "color"},
-                              {core::Float32, dtype, dtype}, {{1}, {1}, {3}},
-                              3.0 / 512, resolution, 10000, device, backend);
+    auto vbg = VoxelBlockGrid({"tsdf", "weight", "color"}, attr_dtypes,
+                              {{1}, {1}, {3}}, 3.0 / 512, resolution, 10000,
+                              device, backend);
 
     data::SampleRedwoodRGBDImages redwood_data;
     for (size_t i = 0; i < extrinsics.size(); ++i) {
@@ -123,6 +126,14 @@ static VoxelBlockGrid Integrate(const core::HashBackendType &backend,
     return vbg;
 }
 
+static VoxelBlockGrid Integrate(const core::HashBackendType &backend,
+                                const core::Dtype &dtype,
+                                const core::Device &device,
+                                const int resolution) {
+    return Integrate(backend, {core::Float32, dtype, dtype}, device,
+                     resolution);
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, Construct) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends = EnumerateBackends(device);
@@ -282,6 +293,96 @@ TEST_P(VoxelBlockGridPermuteDevices, Integrate) {
     }
 }
 
+TEST_P(VoxelBlockGridPermuteDevices, IntegrateQuantized) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    // Quantization only perturbs the zero crossings slightly.
+    const int64_t kPoints = 225628;
+    for (auto backend : backends) {
+        for (auto &weight_dtype :
+             std::vector<core::Dtype>{core::UInt16, core::UInt8}) {
+            auto vbg = Integrate(backend,
+                                 {core::Int16, weight_dtype, core::UInt8},
+                                 device, 8);
+            EXPECT_EQ(vbg.GetAttribute("tsdf").GetDtype(), core::Int16);
+
+            auto pcd = vbg.ExtractPointCloud();
+            EXPECT_NEAR(pcd.GetPointPositions().GetLength(), kPoints,
+                        kPoints * 0.01);
+            EXPECT_TRUE(pcd.HasPointColors());
+
+            auto mesh = vbg.ExtractTriangleMesh();
+            EXPECT_GT(mesh.GetTriangleIndices().GetLength(), 0);
+        }
+    }
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, ExtractTriangleMeshChunks) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    core::Tensor intrinsic = GetIntrinsicTensor();
+    std::vector<core::Tensor> extrinsics = GetExtrinsicTensors();
+    const float depth_scale = 1000.0;
+    const float depth_max = 3.0;
+    const int resolution = 16;
+
+    data::SampleRedwoodRGBDImages redwood_data;
+    for (auto backend : backends) {
+        auto vbg = VoxelBlockGrid({"tsdf", "weight", "color"},
+                                  {core::Float32, core::UInt16, core::UInt16},
+                                  {{1}, {1}, {3}}, 3.0 / 512, resolution,
+                                  10000, device, backend);
+        EXPECT_EQ(vbg.GetDirtyBlockCoordinates().GetLength(), 0);
+
+        // Block coordinates -> number of triangles in the latest chunk.
+        std::map<std::tuple<int, int, int>, int64_t> chunk_sizes;
+        for (size_t i = 0; i < extrinsics.size(); ++i) {
+            Image depth =
+                    t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[i])
+                            ->To(device);
+            Image color =
+                    t::io::CreateImageFromFile(redwood_data.GetColorPaths()[i])
+                            ->To(device);
+
+            core::Tensor frustum_block_coords = vbg.GetUniqueBlockCoordinates(
+                    depth, intrinsic, extrinsics[i], depth_scale, depth_max,
+                    /*trunc_multiplier=*/4.0);
+            vbg.Integrate(frustum_block_coords, depth, color, intrinsic,
+                          extrinsics[i], depth_scale, depth_max,
+                          /*trunc multiplier*/ resolution * 0.5);
+            EXPECT_EQ(vbg.GetDirtyBlockCoordinates().GetLength(),
+                      frustum_block_coords.GetLength());
+
+            core::Tensor chunk_coords;
+            std::vector<TriangleMesh> chunks;
+            std::tie(chunk_coords, chunks) = vbg.ExtractTriangleMeshChunks();
+            EXPECT_EQ(chunk_coords.GetLength(),
+                      static_cast<int64_t>(chunks.size()));
+            EXPECT_EQ(vbg.GetDirtyBlockCoordinates().GetLength(), 0);
+
+            core::Tensor chunk_coords_host =
+                    chunk_coords.To(core::Device("CPU:0")).Contiguous();
+            const int *coords_ptr = chunk_coords_host.GetDataPtr<int>();
+            for (size_t c = 0; c < chunks.size(); ++c) {
+                chunk_sizes[std::make_tuple(coords_ptr[3 * c + 0],
+                                            coords_ptr[3 * c + 1],
+                                            coords_ptr[3 * c + 2])] =
+                        chunks[c].GetTriangleIndices().GetLength();
+            }
+
+            // Patched chunks add up to the full mesh.
+            int64_t num_triangles = 0;
+            for (auto &it : chunk_sizes) {
+                num_triangles += it.second;
+            }
+            auto mesh = vbg.ExtractTriangleMesh();
+            EXPECT_EQ(num_triangles, mesh.GetTriangleIndices().GetLength());
+        }
+    }
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, IO) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends = EnumerateBackends(device);
@@ -303,6 +404,118 @@ TEST_P(VoxelBlockGridPermuteDevices, IO) {
     }
 }
 
+TEST_P(VoxelBlockGridPermuteDevices, CompressedIO) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    std::string file_name = "tmp.npz";
+    std::string compressed_file_name = "tmp_compressed.npz";
+    for (auto backend : backends) {
+        auto vbg = Integrate(backend, {core::Int16, core::UInt8, core::UInt8},
+                             device, 16);
+        // Never observed blocks are elided in the compressed file.
+        vbg.GetHashMap().Activate(
+                core::Tensor::Init<int>({{1000, 1000, 1000}}, device));
+        vbg.Save(file_name);
+        vbg.Save(compressed_file_name, /*compress=*/true);
+
+        utility::filesystem::CFile file, compressed_file;
+        ASSERT_TRUE(file.Open(file_name, "rb"));
+        ASSERT_TRUE(compressed_file.Open(compressed_file_name, "rb"));
+        EXPECT_LT(compressed_file.GetFileSize(), file.GetFileSize());
+        file.Close();
+        compressed_file.Close();
+
+        auto vbg_loaded = VoxelBlockGrid::Load(compressed_file_name);
+        core::HashMap hashmap = vbg.GetHashMap();
+        core::HashMap hashmap_loaded = vbg_loaded.GetHashMap();
+        EXPECT_EQ(hashmap.Size(), hashmap_loaded.Size());
+
+        // Compression is lossless.
+        core::Tensor buf_indices = hashmap.GetActiveIndices().To(core::Int64);
+        core::Tensor keys = hashmap.GetKeyTensor().IndexGet({buf_indices});
+        core::Tensor buf_indices_loaded, masks_loaded;
+        hashmap_loaded.Find(keys, buf_indices_loaded, masks_loaded);
+        EXPECT_TRUE(masks_loaded.All());
+        buf_indices_loaded = buf_indices_loaded.To(core::Int64);
+        for (const std::string &attr : {"tsdf", "weight", "color"}) {
+            core::Tensor value =
+                    vbg.GetAttribute(attr).IndexGet({buf_indices});
+            core::Tensor value_loaded = vbg_loaded.GetAttribute(attr).IndexGet(
+                    {buf_indices_loaded});
+            EXPECT_TRUE(value.AllEqual(value_loaded));
+        }
+
+        utility::filesystem::RemoveFile(file_name);
+        utility::filesystem::RemoveFile(compressed_file_name);
+    }
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, Streaming) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    core::Tensor intrinsic = GetIntrinsicTensor();
+    std::vector<core::Tensor> extrinsics = GetExtrinsicTensors();
+    const float depth_scale = 1000.0;
+    const float depth_max = 3.0;
+    const int resolution = 16;
+
+    data::SampleRedwoodRGBDImages redwood_data;
+    std::string block_store_dir = "tmp_block_store";
+    std::string file_name = "tmp_streaming.npz";
+    for (auto backend : backends) {
+        auto vbg_ref = Integrate(backend, core::UInt16, device, resolution);
+        int64_t num_blocks = vbg_ref.GetHashMap().Size();
+
+        auto vbg = VoxelBlockGrid({"tsdf", "weight", "color"},
+                                  {core::Float32, core::UInt16, core::UInt16},
+                                  {{1}, {1}, {3}}, 3.0 / 512, resolution,
+                                  10000, device, backend);
+        vbg.EnableStreaming(block_store_dir, num_blocks / 2);
+        EXPECT_TRUE(vbg.IsStreaming());
+
+        for (size_t i = 0; i < extrinsics.size(); ++i) {
+            Image depth =
+                    t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[i])
+                            ->To(device);
+            Image color =
+                    t::io::CreateImageFromFile(redwood_data.GetColorPaths()[i])
+                            ->To(device);
+
+            core::Tensor frustum_block_coords = vbg.GetUniqueBlockCoordinates(
+                    depth, intrinsic, extrinsics[i], depth_scale, depth_max,
+                    /*trunc_multiplier=*/4.0);
+            vbg.Integrate(frustum_block_coords, depth, color, intrinsic,
+                          extrinsics[i], depth_scale, depth_max,
+                          /*trunc multiplier*/ resolution * 0.5);
+        }
+        EXPECT_GT(vbg.GetNumEvictedBlocks(), 0);
+        EXPECT_EQ(vbg.GetHashMap().Size() + vbg.GetNumEvictedBlocks(),
+                  num_blocks);
+
+        // Evicted blocks are included in the saved grid.
+        vbg.Save(file_name);
+        auto vbg_loaded = VoxelBlockGrid::Load(file_name);
+        EXPECT_EQ(vbg_loaded.GetHashMap().Size(), num_blocks);
+        utility::filesystem::RemoveFile(file_name);
+
+        // Paged-in blocks are bit-exact, so the surfaces are identical.
+        vbg.DisableStreaming();
+        EXPECT_FALSE(vbg.IsStreaming());
+        EXPECT_EQ(vbg.GetNumEvictedBlocks(), 0);
+        EXPECT_EQ(vbg.GetHashMap().Size(), num_blocks);
+
+        auto pcd_ref = vbg_ref.ExtractPointCloud();
+        auto pcd = vbg.ExtractPointCloud();
+        auto pcd_loaded = vbg_loaded.ExtractPointCloud();
+        EXPECT_EQ(pcd.GetPointPositions().GetLength(),
+                  pcd_ref.GetPointPositions().GetLength());
+        EXPECT_EQ(pcd_loaded.GetPointPositions().GetLength(),
+                  pcd_ref.GetPointPositions().GetLength());
+    }
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, RayCasting) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends =
@@ -363,6 +576,150 @@ TEST_P(VoxelBlockGridPermuteDevices, RayCasting) {
     }
 }
 
+// The block occupancy used to skip empty space is updated by Integrate after
+// the first ray casting, and rebuilt from scratch when invalidated. Both must
+// give the same result as a grid ray casted only once.
+TEST_P(VoxelBlockGridPermuteDevices, RayCastingEmptySpaceSkipping) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends =
+            EnumerateBackends(device, /* include_slab = */ false);
+
+    core::Tensor intrinsic = GetIntrinsicTensor();
+    std::vector<core::Tensor> extrinsics = GetExtrinsicTensors();
+    const float depth_scale = 1000.0;
+    const float depth_min = 0.1;
+    const float depth_max = 3.0;
+    const int resolution = 8;
+    const std::vector<std::string> attrs = {"depth", "vertex", "normal",
+                                            "color"};
+
+    data::SampleRedwoodRGBDImages redwood_data;
+    for (auto backend : backends) {
+        auto vbg_ref = Integrate(backend, core::UInt16, device, resolution);
+
+        auto vbg = VoxelBlockGrid({"tsdf", "weight", "color"},
+                                  {core::Float32, core::UInt16, core::UInt16},
+                                  {{1}, {1}, {3}}, 3.0 / 512, resolution,
+                                  10000, device, backend);
+        for (size_t i = 0; i < extrinsics.size(); ++i) {
+            Image depth =
+                    t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[i])
+                            ->To(device);
+            Image color =
+                    t::io::CreateImageFromFile(redwood_data.GetColorPaths()[i])
+                            ->To(device);
+
+            core::Tensor frustum_block_coords = vbg.GetUniqueBlockCoordinates(
+                    depth, intrinsic, extrinsics[i], depth_scale, depth_max,
+                    /*trunc_multiplier=*/4.0);
+            vbg.Integrate(frustum_block_coords, depth, color, intrinsic,
+                          extrinsics[i], depth_scale, depth_max,
+                          /*trunc multiplier*/ resolution * 0.5);
+            vbg.RayCast(frustum_block_coords, intrinsic, extrinsics[i],
+                        depth.GetCols(), depth.GetRows(), attrs, depth_scale,
+                        depth_min, depth_max, 1.0);
+        }
+
+        const int i = 0;
+        Image depth =
+                t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[i])
+                        ->To(device);
+        core::Tensor frustum_block_coords = vbg_ref.GetUniqueBlockCoordinates(
+                depth, intrinsic, extrinsics[i], depth_scale, depth_max);
+        auto RayCast = [&](VoxelBlockGrid &grid) {
+            return grid.RayCast(frustum_block_coords, intrinsic, extrinsics[i],
+                                depth.GetCols(), depth.GetRows(), attrs,
+                                depth_scale, depth_min, depth_max, 1.0);
+        };
+
+        auto result_ref = RayCast(vbg_ref);
+        auto result_updated = RayCast(vbg);
+        for (const auto &attr : attrs) {
+            EXPECT_TRUE(result_updated.at(attr).AllEqual(result_ref.at(attr)))
+                    << attr;
+        }
+        const int64_t num_hits = result_ref.at("depth")
+                                         .Gt(0)
+                                         .To(core::Int64)
+                                         .Sum({0, 1, 2})
+                                         .Item<int64_t>();
+        EXPECT_GT(num_hits, 0);
+    }
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, RayCastingAfterHashMapInsertion) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends =
+            EnumerateBackends(device, /* include_slab = */ false);
+
+    core::Tensor intrinsic = GetIntrinsicTensor();
+    std::vector<core::Tensor> extrinsics = GetExtrinsicTensors();
+    const float depth_scale = 1000.0;
+    const float depth_min = 0.1;
+    const float depth_max = 3.0;
+    const int resolution = 8;
+    const std::vector<std::string> attrs = {"depth", "vertex", "normal",
+                                            "color"};
+
+    data::SampleRedwoodRGBDImages redwood_data;
+    for (auto backend : backends) {
+        auto vbg_ref = Integrate(backend, core::UInt16, device, resolution);
+
+        core::HashMap hashmap_ref = vbg_ref.GetHashMap();
+        core::Tensor active_indices =
+                hashmap_ref.GetActiveIndices().To(core::Int64);
+        core::Tensor keys = hashmap_ref.GetKeyTensor().IndexGet(
+                {active_indices});
+        std::vector<core::Tensor> values;
+        for (const core::Tensor &value : hashmap_ref.GetValueTensors()) {
+            values.push_back(value.IndexGet({active_indices}));
+        }
+
+        // Every other block is inserted after the first RayCast has built
+        // the block occupancy.
+        const int64_t n = keys.GetLength();
+        core::Tensor even = core::Tensor::Arange(0, n, 2, core::Int64, device);
+        core::Tensor odd = core::Tensor::Arange(1, n, 2, core::Int64, device);
+        auto Insert = [&](core::HashMap hashmap, const core::Tensor &indices) {
+            std::vector<core::Tensor> selected_values;
+            for (const core::Tensor &value : values) {
+                selected_values.push_back(value.IndexGet({indices}));
+            }
+            core::Tensor buf_indices, masks;
+            hashmap.Insert(keys.IndexGet({indices}), selected_values,
+                           buf_indices, masks);
+        };
+
+        auto vbg = VoxelBlockGrid({"tsdf", "weight", "color"},
+                                  {core::Float32, core::UInt16, core::UInt16},
+                                  {{1}, {1}, {3}}, 3.0 / 512, resolution,
+                                  10000, device, backend);
+
+        const int i = 0;
+        Image depth =
+                t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[i])
+                        ->To(device);
+        core::Tensor frustum_block_coords = vbg_ref.GetUniqueBlockCoordinates(
+                depth, intrinsic, extrinsics[i], depth_scale, depth_max);
+        auto RayCast = [&](VoxelBlockGrid &grid) {
+            return grid.RayCast(frustum_block_coords, intrinsic, extrinsics[i],
+                                depth.GetCols(), depth.GetRows(), attrs,
+                                depth_scale, depth_min, depth_max, 1.0);
+        };
+
+        Insert(vbg.GetHashMap(), even);
+        RayCast(vbg);
+        Insert(vbg.GetHashMap(), odd);
+        EXPECT_EQ(vbg.GetHashMap().Size(), n);
+
+        auto result_ref = RayCast(vbg_ref);
+        auto result = RayCast(vbg);
+        for (const auto &attr : attrs) {
+            EXPECT_TRUE(result.at(attr).AllEqual(result_ref.at(attr))) << attr;
+        }
+    }
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, DISABLED_RayCastingVisualize) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends =
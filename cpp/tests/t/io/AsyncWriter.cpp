@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/AsyncWriter.h"
+
+#include <atomic>
+#include <chrono>
+
+#include "open3d/utility/FileSystem.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(AsyncWriter, SnapshotOnEnqueue) {
+    const std::string dir = utility::filesystem::GetTempDirectoryPath();
+    const std::string pcd_file_name = dir + "/test_async.ply";
+    const std::string image_file_name = dir + "/test_async.png";
+
+    t::geometry::PointCloud pcd(
+            core::Tensor::Arange(0, 3000, 1, core::Float32).Reshape({1000, 3}));
+    t::geometry::Image image(
+            core::Tensor::Arange(0, 64 * 48, 1, core::Int32)
+                    .Reshape({48, 64, 1})
+                    .To(core::UInt16));
+    const t::geometry::PointCloud pcd_expected = pcd.Clone();
+    const t::geometry::Image image_expected = image.Clone();
+
+    t::io::AsyncWriter writer;
+    writer.WritePointCloud(pcd_file_name, pcd);
+    writer.WriteImage(image_file_name, image);
+    // In-place changes after enqueueing are not written.
+    pcd.GetPointPositions().Fill(-1);
+    image.AsTensor().Fill(0);
+    EXPECT_TRUE(writer.Flush());
+    EXPECT_EQ(writer.GetNumPending(), 0);
+
+    t::geometry::PointCloud pcd_read;
+    ASSERT_TRUE(t::io::ReadPointCloud(pcd_file_name, pcd_read));
+    EXPECT_TRUE(pcd_read.GetPointPositions().AllClose(
+            pcd_expected.GetPointPositions()));
+    t::geometry::Image image_read;
+    ASSERT_TRUE(t::io::ReadImage(image_file_name, image_read));
+    EXPECT_TRUE(image_read.AsTensor().AllEqual(image_expected.AsTensor()));
+
+    utility::filesystem::RemoveFile(pcd_file_name);
+    utility::filesystem::RemoveFile(image_file_name);
+}
+
+TEST(AsyncWriter, SaveVoxelBlockGrid) {
+    const std::string file_name =
+            utility::filesystem::GetTempDirectoryPath() + "/test_async.npz";
+    core::Device device("CPU:0");
+    t::geometry::VoxelBlockGrid vbg({"tsdf", "weight"},
+                                    {core::Float32, core::Float32}, {{1}, {1}},
+                                    0.01, 4, 10, device);
+    vbg.GetHashMap().Activate(
+            core::Tensor::Init<int>({{0, 0, 0}, {1, 2, 3}}, device));
+    vbg.GetAttribute("tsdf").Fill(1);
+
+    t::io::AsyncWriter writer;
+    writer.SaveVoxelBlockGrid(file_name, vbg, /*compress=*/true);
+    vbg.GetAttribute("tsdf").Fill(2);
+    EXPECT_TRUE(writer.Flush());
+
+    t::geometry::VoxelBlockGrid vbg_loaded =
+            t::geometry::VoxelBlockGrid::Load(file_name);
+    core::Tensor buf_indices =
+            vbg_loaded.GetHashMap().GetActiveIndices().To(core::Int64);
+    EXPECT_EQ(buf_indices.GetLength(), 2);
+    core::Tensor tsdf = vbg_loaded.GetAttribute("tsdf").IndexGet({buf_indices});
+    EXPECT_TRUE(tsdf.AllClose(core::Tensor::Ones(tsdf.GetShape(),
+                                                 core::Float32, device)));
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST(AsyncWriter, FlushAndCallbacks) {
+    std::atomic<int> num_run(0), num_succeeded(0), num_failed(0);
+    {
+        t::io::AsyncWriter writer(/*num_threads=*/2, /*max_queue_size=*/1);
+        for (int i = 0; i < 10; ++i) {
+            writer.Enqueue(
+                    [&num_run, i]() {
+                        std::this_thread::sleep_for(
+                                std::chrono::milliseconds(1));
+                        ++num_run;
+                        if (i == 3) {
+                            throw std::runtime_error("Task failed.");
+                        }
+                        return i != 5;
+                    },
+                    [&](bool success) {
+                        ++(success ? num_succeeded : num_failed);
+                    });
+            EXPECT_LE(writer.GetNumPending(), 3);
+        }
+        EXPECT_FALSE(writer.Flush());
+        EXPECT_EQ(writer.GetNumPending(), 0);
+        EXPECT_EQ(num_run, 10);
+        EXPECT_EQ(num_succeeded, 8);
+        EXPECT_EQ(num_failed, 2);
+
+        // Failures are reported once.
+        EXPECT_TRUE(writer.Flush());
+
+        // Pending tasks complete on destruction.
+        writer.Enqueue([&num_run]() {
+            ++num_run;
+            return true;
+        });
+    }
+    EXPECT_EQ(num_run, 11);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -234,6 +234,57 @@ TEST(ImageIO, DifferentDtype) {
                               t::geometry::Image(100, 200, 3, core::Bool)));
 }
 
+TEST(ImageIO, DepthImage) {
+    const std::string tmp_path = utility::filesystem::GetTempDirectoryPath();
+    // Smooth depth with invalid pixels, spanning several RVL bands.
+    std::vector<uint16_t> values(100 * 120);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<uint16_t>((i % 977) * 67);
+    }
+    core::Tensor depth(values, {100, 120, 1}, core::UInt16);
+    depth.Slice(0, 10, 20).Slice(1, 30, 90).Fill(0);
+    depth.Slice(0, 99, 100).Fill(0);
+    const t::geometry::Image image(depth);
+
+    for (const std::string ext : {"png", "rvl"}) {
+        for (int quality : {t::io::kOpen3DImageIODefaultQuality, 1}) {
+            const std::string file_name =
+                    tmp_path + "/test_imageio_depth." + ext;
+            ASSERT_TRUE(t::io::WriteImage(file_name, image, quality));
+            t::geometry::Image read_image;
+            ASSERT_TRUE(t::io::ReadImage(file_name, read_image));
+            EXPECT_EQ(read_image.GetDtype(), core::UInt16);
+            EXPECT_TRUE(read_image.AsTensor().AllEqual(image.AsTensor()));
+        }
+    }
+
+    using Filter = t::io::DepthPNGWriteOption::Filter;
+    for (Filter filter : {Filter::None, Filter::Sub, Filter::Up,
+                          Filter::Average, Filter::Paeth, Filter::All}) {
+        for (bool run_length : {true, false}) {
+            t::io::DepthPNGWriteOption option;
+            option.filter = filter;
+            option.run_length = run_length;
+            const std::string file_name =
+                    tmp_path + "/test_imageio_depth_option.png";
+            ASSERT_TRUE(t::io::WriteDepthImageToPNG(file_name, image, option));
+            t::geometry::Image read_image;
+            ASSERT_TRUE(t::io::ReadImageFromPNG(file_name, read_image));
+            EXPECT_TRUE(read_image.AsTensor().AllEqual(image.AsTensor()));
+        }
+    }
+
+    // RVL and depth PNG options only support single channel UInt16 images.
+    EXPECT_FALSE(t::io::WriteImage(tmp_path + "/test_imageio_depth.rvl",
+                                   t::geometry::Image(10, 20, 1, core::UInt8)));
+    EXPECT_FALSE(
+            t::io::WriteImage(tmp_path + "/test_imageio_depth.rvl",
+                              t::geometry::Image(10, 20, 3, core::UInt16)));
+    EXPECT_FALSE(t::io::WriteDepthImageToPNG(
+            tmp_path + "/test_imageio_depth.png",
+            t::geometry::Image(10, 20, 3, core::UInt16)));
+}
+
 TEST(ImageIO, CornerCases) {
     const std::string tmp_path = utility::filesystem::GetTempDirectoryPath();
     EXPECT_ANY_THROW(
@@ -0,0 +1,189 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/O3DTIO.h"
+
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+// Points along the x axis, so that chunks have disjoint bounding boxes.
+static t::geometry::TensorMap CreatePointGroup(int64_t num_points) {
+    t::geometry::TensorMap point("positions");
+    core::Tensor x = core::Tensor::Arange(0, num_points, 1, core::Float64);
+    point["positions"] = core::Tensor::Zeros({num_points, 3}, core::Float64);
+    point["positions"].SetItem(
+            {core::TensorKey::Slice(core::None, core::None, core::None),
+             core::TensorKey::Index(0)},
+            x);
+    point["colors"] = core::Tensor::Arange(0, num_points * 3, 1, core::Int64)
+                              .Reshape({num_points, 3})
+                              .To(core::UInt8);
+    point["intensities"] = (x * 0.1).Reshape({num_points, 1});
+    return point;
+}
+
+TEST(O3DTIO, WriteReadRoundTrip) {
+    const std::string file_name =
+            utility::filesystem::GetTempDirectoryPath() + "/test.o3dt";
+    const t::geometry::TensorMap point = CreatePointGroup(1000);
+
+    for (bool compressed : {false, true}) {
+        t::io::WriteO3DTOption option;
+        option.chunk_size = 64;
+        option.compressed = compressed;
+        t::io::WriteO3DT(file_name, {{"point", point}}, option);
+
+        const auto groups = t::io::ReadO3DT(file_name);
+        ASSERT_EQ(groups.count("point"), 1);
+        const t::geometry::TensorMap &point_read = groups.at("point");
+        EXPECT_EQ(point_read.GetPrimaryKey(), "positions");
+        EXPECT_EQ(point_read.size(), 3);
+        for (const auto &kv : point) {
+            EXPECT_EQ(point_read.at(kv.first).GetDtype(),
+                      kv.second.GetDtype());
+            EXPECT_TRUE(point_read.at(kv.first).AllEqual(kv.second));
+        }
+    }
+}
+
+TEST(O3DTIO, Quantization) {
+    const std::string file_name =
+            utility::filesystem::GetTempDirectoryPath() + "/test.o3dt";
+    const t::geometry::TensorMap point = CreatePointGroup(1000);
+
+    t::io::WriteO3DTOption option;
+    option.chunk_size = 100;
+    option.compressed = true;
+    option.quantization_steps["intensities"] = 1e-3;
+    t::io::WriteO3DT(file_name, {{"point", point}}, option);
+
+    const auto groups = t::io::ReadO3DT(file_name);
+    const t::geometry::TensorMap &point_read = groups.at("point");
+    EXPECT_TRUE(point_read.at("positions").AllEqual(point.at("positions")));
+    EXPECT_TRUE(point_read.at("intensities")
+                        .AllClose(point.at("intensities"), 0, 5e-4));
+
+    // Non-float attributes can't be quantized.
+    option.quantization_steps["colors"] = 1;
+    EXPECT_ANY_THROW(t::io::WriteO3DT(file_name, {{"point", point}}, option));
+}
+
+TEST(O3DTIO, AttributeProjection) {
+    const std::string file_name =
+            utility::filesystem::GetTempDirectoryPath() + "/test.o3dt";
+    const t::geometry::TensorMap point = CreatePointGroup(100);
+    t::io::WriteO3DT(file_name, {{"point", point}});
+
+    t::io::ReadO3DTOption option;
+    option.attributes = {"positions"};
+    auto groups = t::io::ReadO3DT(file_name, option);
+    EXPECT_EQ(groups.at("point").size(), 1);
+    EXPECT_TRUE(groups.at("point").at("positions").AllEqual(
+            point.at("positions")));
+
+    // The primary key is read along with other attributes.
+    option.attributes = {"colors"};
+    groups = t::io::ReadO3DT(file_name, option);
+    EXPECT_EQ(groups.at("point").size(), 2);
+    EXPECT_TRUE(groups.at("point").Contains("positions"));
+    EXPECT_TRUE(groups.at("point").at("colors").AllEqual(point.at("colors")));
+
+    option.attributes = {"normals"};
+    groups = t::io::ReadO3DT(file_name, option);
+    EXPECT_TRUE(groups.at("point").empty());
+}
+
+TEST(O3DTIO, SpatialFilter) {
+    const std::string file_name =
+            utility::filesystem::GetTempDirectoryPath() + "/test.o3dt";
+    const t::geometry::TensorMap point = CreatePointGroup(100);
+    t::io::WriteO3DTOption write_option;
+    write_option.chunk_size = 10;
+    t::io::WriteO3DT(file_name, {{"point", point}}, write_option);
+
+    // x in [25, 34] intersects the chunks of points 20-29 and 30-39.
+    t::io::ReadO3DTOption option;
+    option.min_bound = Eigen::Vector3d(25, -1, -1);
+    option.max_bound = Eigen::Vector3d(34, 1, 1);
+    const auto groups = t::io::ReadO3DT(file_name, option);
+    const t::geometry::TensorMap &point_read = groups.at("point");
+    EXPECT_EQ(point_read.at("positions").GetLength(), 20);
+    EXPECT_TRUE(point_read.at("positions").AllEqual(
+            point.at("positions").Slice(0, 20, 40)));
+    EXPECT_TRUE(point_read.at("intensities")
+                        .AllEqual(point.at("intensities").Slice(0, 20, 40)));
+
+    option.min_bound = Eigen::Vector3d(0, 2, 0);
+    option.max_bound = Eigen::Vector3d(100, 3, 0);
+    EXPECT_EQ(t::io::ReadO3DT(file_name, option)
+                      .at("point")
+                      .at("positions")
+                      .GetLength(),
+              0);
+}
+
+TEST(O3DTIO, ReadWriteTriangleMesh) {
+    const std::string file_name =
+            utility::filesystem::GetTempDirectoryPath() + "/test_mesh.o3dt";
+    t::geometry::TriangleMesh mesh = t::geometry::TriangleMesh::FromLegacy(
+            *geometry::TriangleMesh::CreateBox());
+    mesh.SetVertexColors(mesh.GetVertexPositions());
+    EXPECT_TRUE(t::io::WriteTriangleMesh(file_name, mesh, false, true));
+
+    t::geometry::TriangleMesh mesh_read;
+    EXPECT_TRUE(t::io::ReadTriangleMesh(file_name, mesh_read));
+    EXPECT_TRUE(
+            mesh_read.GetVertexPositions().AllEqual(mesh.GetVertexPositions()));
+    EXPECT_TRUE(mesh_read.GetVertexColors().AllEqual(mesh.GetVertexColors()));
+    EXPECT_TRUE(
+            mesh_read.GetTriangleIndices().AllEqual(mesh.GetTriangleIndices()));
+
+    // Post-processing is only available for the formats read by ASSIMP.
+    open3d::io::ReadTriangleMeshOptions options;
+    options.enable_post_processing = true;
+    EXPECT_TRUE(t::io::ReadTriangleMesh(file_name, mesh_read, options));
+    EXPECT_TRUE(
+            mesh_read.GetVertexPositions().AllEqual(mesh.GetVertexPositions()));
+
+    // Skipping attributes the mesh does not have is not an error.
+    mesh.RemoveVertexAttr("colors");
+    EXPECT_TRUE(t::io::WriteTriangleMesh(file_name, mesh, false, true,
+                                         /*write_vertex_normals=*/false,
+                                         /*write_vertex_colors=*/false,
+                                         /*write_triangle_uvs=*/false));
+    EXPECT_TRUE(t::io::ReadTriangleMesh(file_name, mesh_read));
+    EXPECT_FALSE(mesh_read.HasVertexColors());
+    EXPECT_FALSE(mesh_read.HasVertexNormals());
+}
+
+}  // namespace tests
+}  // namespace open3d
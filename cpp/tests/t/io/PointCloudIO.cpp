@@ -28,6 +28,7 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <fstream>
 #include <iostream>
 
@@ -37,6 +38,7 @@
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/data/Dataset.h"
+#include "open3d/io/PointCloudIO.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/utility/FileSystem.h"
 #include "tests/Tests.h"
@@ -86,6 +88,14 @@ const std::vector<ReadWritePCArgs> pcArgs({
          IsAscii::ASCII,
          Compressed::UNCOMPRESSED,
          {{"positions", 1e-5}, {"intensities", 1e-5}}},  // 1
+        {"test.o3dt",
+         IsAscii::BINARY,
+         Compressed::UNCOMPRESSED,
+         {{"positions", 0}, {"intensities", 0}}},  // 2
+        {"test_compressed.o3dt",
+         IsAscii::BINARY,
+         Compressed::COMPRESSED,
+         {{"positions", 0}, {"intensities", 0}}},  // 3
 });
 
 class ReadWriteTPC : public testing::TestWithParam<ReadWritePCArgs> {};
@@ -219,6 +229,84 @@ TEST(TPointCloudIO, ReadPointCloudFromPLY3) {
     EXPECT_FALSE(pcd.HasPointAttr("intensity"));
 }
 
+// Bulk reading of binary_big_endian, with elements before and after vertices.
+TEST(TPointCloudIO, ReadPointCloudFromPLY4) {
+    std::string filename_out = utility::filesystem::GetTempDirectoryPath() +
+                               "/test_sample_big_endian.ply";
+    std::string header =
+            "ply\n"
+            "format binary_big_endian 1.0\n"
+            "element camera 1\n"
+            "property float scale\n"
+            "element vertex 2\n"
+            "property double x\n"
+            "property double y\n"
+            "property double z\n"
+            "property short intensity\n"
+            "property uchar red\n"
+            "property uchar green\n"
+            "property uchar blue\n"
+            "property float curvature\n"
+            "element face 1\n"
+            "property list uchar int vertex_indices\n"
+            "end_header\n";
+    std::vector<char> bytes(header.begin(), header.end());
+    auto append = [&bytes](auto value) {
+        const char *ptr = reinterpret_cast<const char *>(&value);
+        const uint16_t one = 1;
+        const bool little_endian = *reinterpret_cast<const char *>(&one) == 1;
+        for (size_t i = 0; i < sizeof(value); ++i) {
+            bytes.push_back(little_endian ? ptr[sizeof(value) - 1 - i]
+                                          : ptr[i]);
+        }
+    };
+    append(1.0f);
+    append(0.5);
+    append(-1.25);
+    append(2.0);
+    append(int16_t(7));
+    append(uint8_t(255));
+    append(uint8_t(0));
+    append(uint8_t(51));
+    append(0.25f);
+    append(-3.0);
+    append(4.5);
+    append(1e-3);
+    append(int16_t(-7));
+    append(uint8_t(1));
+    append(uint8_t(2));
+    append(uint8_t(3));
+    append(-0.5f);
+    append(uint8_t(3));
+    append(int32_t(0));
+    append(int32_t(1));
+    append(int32_t(0));
+    std::ofstream outfile(filename_out, std::ios::binary);
+    outfile.write(bytes.data(), bytes.size());
+    outfile.close();
+
+    t::geometry::PointCloud pcd;
+    EXPECT_TRUE(t::io::ReadPointCloud(filename_out, pcd,
+                                      {"auto", false, false, true}));
+    EXPECT_FALSE(pcd.HasPointAttr("intensity"));
+    EXPECT_TRUE(pcd.GetPointPositions().AllClose(core::Tensor::Init<double>(
+            {{0.5, -1.25, 2.0}, {-3.0, 4.5, 1e-3}})));
+    EXPECT_TRUE(pcd.GetPointColors().AllEqual(
+            core::Tensor::Init<uint8_t>({{255, 0, 51}, {1, 2, 3}})));
+    EXPECT_TRUE(pcd.GetPointAttr("curvature")
+                        .AllClose(core::Tensor::Init<float>({{0.25}, {-0.5}})));
+
+    // The legacy reader shares the bulk reading path.
+    geometry::PointCloud pcd_legacy;
+    EXPECT_TRUE(io::ReadPointCloud(filename_out, pcd_legacy,
+                                   {"auto", false, false, true}));
+    ASSERT_EQ(pcd_legacy.points_.size(), 2u);
+    EXPECT_EQ(pcd_legacy.points_[1], Eigen::Vector3d(-3.0, 4.5, 1e-3));
+    ASSERT_EQ(pcd_legacy.colors_.size(), 2u);
+    EXPECT_EQ(pcd_legacy.colors_[0], Eigen::Vector3d(1.0, 0.0, 51 / 255.0));
+    EXPECT_TRUE(pcd_legacy.normals_.empty());
+}
+
 // Read write empty point cloud.
 TEST(TPointCloudIO, ReadWriteEmptyPTS) {
     t::geometry::PointCloud pcd, pcd_read;
@@ -326,6 +414,28 @@ TEST(TPointCloudIO, WritePTSColorConversion2) {
               std::vector<uint8_t>({255, 0, 0, 255, 0, 255}));
 }
 
+// Invalid lines are skipped and do not leave rows behind.
+TEST(TPointCloudIO, ReadXYZISkipInvalidLines) {
+    t::geometry::PointCloud pcd;
+    std::string file_name =
+            utility::filesystem::GetTempDirectoryPath() + "/test_skip.xyzi";
+    std::ofstream out(file_name);
+    out << "1 2 3 0.5\n"
+        << "\n"
+        << "# comment\n"
+        << "4 5\n"
+        << "  -1e-3\t.5 6. inf  extra tokens\n";
+    out.close();
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd,
+                                      {"auto", false, false, true}));
+    EXPECT_TRUE(pcd.GetPointPositions().AllClose(
+            core::Tensor::Init<double>({{1, 2, 3}, {-1e-3, 0.5, 6}})));
+    EXPECT_EQ(pcd.GetPointAttr("intensities").GetShape(),
+              core::SizeVector({2, 1}));
+    EXPECT_EQ(pcd.GetPointAttr("intensities")[0].Item<double>(), 0.5);
+    EXPECT_TRUE(std::isinf(pcd.GetPointAttr("intensities")[1].Item<double>()));
+}
+
 TEST(TPointCloudIO, ReadWritePointCloudAsNPZ) {
     // Read PointCloud from PLY file.
     t::geometry::PointCloud pcd_ply;
@@ -488,5 +598,36 @@ TEST(TPointCloudIO, ReadWritePointCloudAsPCD) {
     EXPECT_TRUE(ascii_f32_pcd.GetPointColors().AllClose(color_uint8));
 }
 
+TEST(TPointCloudIO, ReadWriteLargeBinaryPCD) {
+    // More than one LZF block of binary_compressed data.
+    const int64_t num_points = 200000;
+    t::geometry::PointCloud pcd(
+            core::Tensor::Arange(0, num_points * 3, 1, core::Float64)
+                    .Reshape({num_points, 3}) *
+            0.5);
+    pcd.SetPointColors(core::Tensor::Arange(0, num_points * 3, 1, core::Int64)
+                               .Reshape({num_points, 3})
+                               .To(core::UInt8));
+    pcd.SetPointAttr("intensities",
+                     core::Tensor::Arange(0, num_points, 1, core::Float32)
+                             .Reshape({num_points, 1}));
+
+    const std::string tmp_path = utility::filesystem::GetTempDirectoryPath();
+    for (bool compressed : {false, true}) {
+        const std::string filename =
+                tmp_path + "/test_pcd_pointcloud_large.pcd";
+        EXPECT_TRUE(t::io::WritePointCloud(
+                filename, pcd,
+                open3d::io::WritePointCloudOption(
+                        /*ascii*/ false, compressed, false, {})));
+
+        t::geometry::PointCloud pcd_read;
+        EXPECT_TRUE(t::io::ReadPointCloud(filename, pcd_read));
+        for (auto &kv : pcd.GetPointAttr()) {
+            EXPECT_TRUE(kv.second.AllEqual(pcd_read.GetPointAttr(kv.first)));
+        }
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,209 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudStreamIO.h"
+
+#include <fstream>
+
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+static t::geometry::PointCloud CreatePointCloud(int64_t num_points) {
+    t::geometry::PointCloud pcd(
+            core::Tensor::Arange(0, num_points * 3, 1, core::Float64)
+                    .Reshape({num_points, 3}) *
+            0.25);
+    pcd.SetPointColors(core::Tensor::Arange(0, num_points * 3, 1, core::Int64)
+                               .Reshape({num_points, 3})
+                               .To(core::UInt8));
+    pcd.SetPointAttr("intensities",
+                     core::Tensor::Arange(0, num_points, 1, core::Float64)
+                                     .Reshape({num_points, 1}) *
+                             0.5);
+    return pcd;
+}
+
+static t::geometry::PointCloud ReadAll(t::io::PointCloudReader &reader,
+                                       int64_t batch_size,
+                                       std::vector<int64_t> &batch_sizes) {
+    t::geometry::PointCloud pcd;
+    for (auto batch = reader.Next(batch_size); !batch.IsEmpty();
+         batch = reader.Next(batch_size)) {
+        batch_sizes.push_back(batch.GetPointPositions().GetLength());
+        pcd = pcd.IsEmpty() ? batch : pcd.Append(batch);
+    }
+    return pcd;
+}
+
+TEST(PointCloudStreamIO, ReadInBatches) {
+    const std::string dir = utility::filesystem::GetTempDirectoryPath();
+    const t::geometry::PointCloud pcd = CreatePointCloud(1000);
+
+    // Streamed formats, and compressed PCD, which is read as a whole.
+    const std::vector<std::tuple<std::string, bool, bool>> cases = {
+            {"ply", false, false}, {"pcd", false, false},
+            {"pcd", true, false},  {"pcd", false, true},
+            {"pts", true, false},  {"xyzi", true, false}};
+    for (const auto &c : cases) {
+        const std::string file_name = dir + "/test_stream." + std::get<0>(c);
+        open3d::io::WritePointCloudOption write_option;
+        write_option.write_ascii =
+                open3d::io::WritePointCloudOption::IsAscii(std::get<1>(c));
+        write_option.compressed =
+                open3d::io::WritePointCloudOption::Compressed(std::get<2>(c));
+        ASSERT_TRUE(t::io::WritePointCloud(file_name, pcd, write_option));
+        t::geometry::PointCloud expected;
+        ASSERT_TRUE(t::io::ReadPointCloud(file_name, expected));
+
+        for (bool prefetch : {true, false}) {
+            t::io::PointCloudReader reader;
+            ASSERT_TRUE(reader.Open(file_name, "auto", prefetch));
+            if (std::get<0>(c) != "xyzi") {
+                EXPECT_EQ(reader.GetNumPoints(), 1000);
+            }
+            std::vector<int64_t> batch_sizes;
+            const t::geometry::PointCloud pcd_read =
+                    ReadAll(reader, 300, batch_sizes);
+            EXPECT_EQ(batch_sizes, std::vector<int64_t>({300, 300, 300, 100}));
+            ASSERT_EQ(pcd_read.GetPointAttr().size(),
+                      expected.GetPointAttr().size());
+            for (const auto &kv : expected.GetPointAttr()) {
+                EXPECT_TRUE(pcd_read.GetPointAttr(kv.first).AllEqual(
+                        kv.second));
+            }
+        }
+    }
+}
+
+TEST(PointCloudStreamIO, ReadASCIIWithUnparsableLines) {
+    // Lines that cannot be parsed are skipped as by ReadPointCloud.
+    const std::string dir = utility::filesystem::GetTempDirectoryPath();
+    const std::vector<std::pair<std::string, std::string>> cases = {
+            {"xyz", "# x y z\n0 1 2\nnot a point\n3 4 5\n6 7 8\n"},
+            {"xyzn", "x y z nx ny nz\n0 1 2 0 0 1\n3 4 5 0 1 0\n"
+                     "# comment\n6 7 8 1 0 0\n"},
+            {"xyzrgb", "0 1 2 0.5 0.25 1\nx y z r g b\n3 4 5 1 0 0\n"
+                       "6 7 8 0 1 0\n"}};
+    for (const auto &c : cases) {
+        const std::string file_name = dir + "/test_stream." + c.first;
+        {
+            std::ofstream file(file_name);
+            file << c.second;
+        }
+        t::geometry::PointCloud expected;
+        ASSERT_TRUE(t::io::ReadPointCloud(file_name, expected));
+        ASSERT_EQ(expected.GetPointPositions().GetLength(), 3);
+
+        t::io::PointCloudReader reader;
+        ASSERT_TRUE(reader.Open(file_name));
+        std::vector<int64_t> batch_sizes;
+        const t::geometry::PointCloud pcd_read =
+                ReadAll(reader, 2, batch_sizes);
+        EXPECT_EQ(batch_sizes, std::vector<int64_t>({2, 1})) << c.first;
+        ASSERT_EQ(pcd_read.GetPointAttr().size(),
+                  expected.GetPointAttr().size());
+        for (const auto &kv : expected.GetPointAttr()) {
+            EXPECT_TRUE(pcd_read.GetPointAttr(kv.first).AllEqual(kv.second))
+                    << c.first << " " << kv.first;
+        }
+    }
+}
+
+TEST(PointCloudStreamIO, ReadVaryingBatchSizes) {
+    const std::string file_name =
+            utility::filesystem::GetTempDirectoryPath() + "/test_stream.ply";
+    const t::geometry::PointCloud pcd = CreatePointCloud(1000);
+    ASSERT_TRUE(t::io::WritePointCloud(file_name, pcd));
+
+    t::io::PointCloudReader reader;
+    ASSERT_TRUE(reader.Open(file_name));
+    // The prefetched batch of 100 points is split and completed.
+    EXPECT_TRUE(reader.Next(100).GetPointPositions().AllEqual(
+            pcd.GetPointPositions().Slice(0, 0, 100)));
+    EXPECT_TRUE(reader.Next(50).GetPointPositions().AllEqual(
+            pcd.GetPointPositions().Slice(0, 100, 150)));
+    EXPECT_TRUE(reader.Next(400).GetPointPositions().AllEqual(
+            pcd.GetPointPositions().Slice(0, 150, 550)));
+    EXPECT_TRUE(reader.Next(1000).GetPointPositions().AllEqual(
+            pcd.GetPointPositions().Slice(0, 550, 1000)));
+    EXPECT_TRUE(reader.Next(1000).IsEmpty());
+    EXPECT_ANY_THROW(reader.Next(0));
+    reader.Close();
+    EXPECT_FALSE(reader.IsOpened());
+}
+
+TEST(PointCloudStreamIO, WriteInBatches) {
+    const std::string dir = utility::filesystem::GetTempDirectoryPath();
+    const t::geometry::PointCloud pcd = CreatePointCloud(1000);
+
+    for (const std::string extension : {"ply", "pcd", "pts", "xyzi"}) {
+        const std::string file_name = dir + "/test_stream." + extension;
+        t::io::PointCloudWriter writer;
+        ASSERT_TRUE(writer.Open(file_name));
+        for (int64_t begin = 0; begin < 1000; begin += 300) {
+            const int64_t end = std::min(begin + 300, int64_t(1000));
+            t::geometry::PointCloud batch;
+            for (const auto &kv : pcd.GetPointAttr()) {
+                batch.SetPointAttr(kv.first, kv.second.Slice(0, begin, end));
+            }
+            ASSERT_TRUE(writer.Write(batch));
+        }
+        EXPECT_EQ(writer.GetNumPoints(), 1000);
+        ASSERT_TRUE(writer.Close());
+
+        t::geometry::PointCloud pcd_read;
+        ASSERT_TRUE(t::io::ReadPointCloud(file_name, pcd_read));
+        EXPECT_TRUE(pcd_read.GetPointPositions().AllClose(
+                pcd.GetPointPositions()));
+        EXPECT_TRUE(pcd_read.GetPointAttr("intensities")
+                            .AllClose(pcd.GetPointAttr("intensities")));
+        if (extension != "xyzi") {
+            EXPECT_TRUE(pcd_read.GetPointColors().AllEqual(
+                    pcd.GetPointColors()));
+        }
+    }
+}
+
+TEST(PointCloudStreamIO, WriteMismatchedBatch) {
+    const std::string file_name =
+            utility::filesystem::GetTempDirectoryPath() + "/test_stream.ply";
+    const t::geometry::PointCloud pcd = CreatePointCloud(100);
+
+    t::io::PointCloudWriter writer;
+    ASSERT_TRUE(writer.Open(file_name));
+    ASSERT_TRUE(writer.Write(pcd));
+    EXPECT_FALSE(writer.Write(t::geometry::PointCloud(
+            pcd.GetPointPositions().To(core::Float32))));
+    EXPECT_EQ(writer.GetNumPoints(), 100);
+    EXPECT_TRUE(writer.Close());
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -26,6 +26,8 @@
 
 #include "open3d/t/io/TriangleMeshIO.h"
 
+#include <fstream>
+
 #include "open3d/data/Dataset.h"
 #include "open3d/io/TriangleMeshIO.h"
 #include "open3d/t/geometry/TriangleMesh.h"
@@ -65,33 +67,231 @@ TEST(TriangleMeshIO, ReadWriteTriangleMeshOBJ) {
     t::geometry::TriangleMesh mesh, mesh_read;
     EXPECT_TRUE(t::io::ReadTriangleMesh(filename, mesh));
 
-    core::Tensor vertices = core::Tensor::Init<float>({{0.0, 1.0, 0.0},
-                                                       {1.0, 1.0, 1.0},
-                                                       {1.0, 1.0, 0.0},
-                                                       {0.0, 1.0, 1.0},
-                                                       {0.0, 0.0, 0.0},
-                                                       {0.0, 0.0, 1.0},
+    // Vertices and triangles are read in the order of the file.
+    EXPECT_TRUE(mesh.GetVertexPositions().AllClose(
+            cube_mesh.GetVertexPositions()));
+    EXPECT_TRUE(mesh.GetTriangleIndices().AllClose(
+            cube_mesh.GetTriangleIndices()));
+}
+
+TEST(TriangleMeshIO, ReadTriangleMeshOBJ) {
+    // A quad and a triangle with relative indices, texture coordinates and
+    // normals.
+    const std::string filename =
+            utility::filesystem::GetTempDirectoryPath() + "/quad.obj";
+    {
+        std::ofstream file(filename);
+        file << "# quad\n"
+                "o quad\n"
+                "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+                "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+                "vn 0 0 1\n"
+                "usemtl none\n"
+                "f 1/1/1 2/2/1 3/3/1 4/4/1\n"
+                "v 0 0 1\n"
+                "f -5/-4/-1 -3/-2/-1 -1/-1/-1\n";
+    }
+    t::geometry::TriangleMesh mesh;
+    EXPECT_TRUE(t::io::ReadTriangleMesh(filename, mesh));
+
+    core::Tensor vertices = core::Tensor::Init<float>({{0.0, 0.0, 0.0},
                                                        {1.0, 0.0, 0.0},
-                                                       {1.0, 0.0, 1.0}});
+                                                       {1.0, 1.0, 0.0},
+                                                       {0.0, 1.0, 0.0},
+                                                       {0.0, 0.0, 1.0}});
     EXPECT_TRUE(mesh.GetVertexPositions().AllClose(vertices));
-
-    core::Tensor triangles = core::Tensor::Init<int64_t>({{0, 1, 2},
-                                                          {0, 3, 1},
-                                                          {4, 5, 0},
-                                                          {5, 3, 0},
-                                                          {4, 6, 5},
-                                                          {6, 7, 5},
-                                                          {6, 2, 1},
-                                                          {6, 1, 7},
-                                                          {5, 7, 1},
-                                                          {5, 1, 3},
-                                                          {4, 0, 6},
-                                                          {6, 0, 2}});
+    core::Tensor triangles =
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {0, 2, 3}, {0, 2, 4}});
     EXPECT_TRUE(mesh.GetTriangleIndices().AllClose(triangles));
+    core::Tensor texture_uvs = core::Tensor::Init<float>(
+            {{{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}},
+             {{0.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}},
+             {{0.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}}});
+    EXPECT_TRUE(mesh.GetTriangleAttr("texture_uvs").AllClose(texture_uvs));
+    core::Tensor normals = core::Tensor::Init<float>({0.0, 0.0, 1.0});
+    EXPECT_TRUE(mesh.GetVertexNormals().AllClose(
+            normals.Reshape({1, 3}).Expand({5, 3})));
+
+    // Out of range indices are rejected.
+    {
+        std::ofstream file(filename);
+        file << "v 0 0 0\nv 1 0 0\nv 1 1 0\nf 1 2 4\n";
+    }
+    EXPECT_FALSE(t::io::ReadTriangleMesh(filename, mesh));
+}
+
+TEST(TriangleMeshIO, ReadTriangleMeshOBJFaceNormals) {
+    // A cube with one normal per face. Each corner of the cube is referenced
+    // with three normals and is split into three vertices.
+    const std::vector<std::vector<int64_t>> faces = {
+            {0, 4, 6, 2}, {1, 3, 7, 5}, {0, 1, 5, 4},
+            {2, 6, 7, 3}, {0, 2, 3, 1}, {4, 5, 7, 6}};
+    const std::string filename =
+            utility::filesystem::GetTempDirectoryPath() + "/cube.obj";
+    {
+        std::ofstream file(filename);
+        for (int v = 0; v < 8; ++v) {
+            file << "v " << (v & 1) << " " << ((v >> 1) & 1) << " "
+                 << ((v >> 2) & 1) << "\n";
+        }
+        file << "vn -1 0 0\nvn 1 0 0\nvn 0 -1 0\nvn 0 1 0\nvn 0 0 -1\n"
+                "vn 0 0 1\n";
+        for (size_t f = 0; f < faces.size(); ++f) {
+            file << "f";
+            for (int64_t v : faces[f]) {
+                file << " " << v + 1 << "//" << f + 1;
+            }
+            file << "\n";
+        }
+    }
+    t::geometry::TriangleMesh mesh;
+    EXPECT_TRUE(t::io::ReadTriangleMesh(filename, mesh));
+    EXPECT_EQ(mesh.GetVertexPositions().GetLength(), 24);
+    EXPECT_EQ(mesh.GetVertexNormals().GetLength(), 24);
+
+    std::vector<float> corner_positions;
+    std::vector<float> corner_normals;
+    for (size_t f = 0; f < faces.size(); ++f) {
+        for (size_t i : {0, 1, 2, 0, 2, 3}) {
+            const int64_t v = faces[f][i];
+            corner_positions.insert(
+                    corner_positions.end(),
+                    {float(v & 1), float((v >> 1) & 1), float((v >> 2) & 1)});
+            std::vector<float> normal(3, 0.f);
+            normal[f / 2] = f % 2 ? 1.f : -1.f;
+            corner_normals.insert(corner_normals.end(), normal.begin(),
+                                  normal.end());
+        }
+    }
+    core::Tensor corners = mesh.GetTriangleIndices().Reshape({-1});
+    EXPECT_TRUE(mesh.GetVertexPositions().IndexGet({corners}).AllClose(
+            core::Tensor(corner_positions, {36, 3}, core::Float32)));
+    EXPECT_TRUE(mesh.GetVertexNormals().IndexGet({corners}).AllClose(
+            core::Tensor(corner_normals, {36, 3}, core::Float32)));
+
+    // Post-processing falls back to ASSIMP, which joins the same vertices.
+    open3d::io::ReadTriangleMeshOptions options;
+    options.enable_post_processing = true;
+    EXPECT_TRUE(t::io::ReadTriangleMesh(filename, mesh, options));
+    EXPECT_EQ(mesh.GetVertexPositions().GetLength(), 24);
+}
+
+TEST(TriangleMeshIO, ReadTriangleMeshOBJChunks) {
+    // A strip of quads in a file larger than the 1MB chunks the reader
+    // parses in parallel, with texture coordinate and normal indices
+    // relative to the single vt and vn at the top of the file.
+    const int64_t num_quads = 20000;
+    const std::string filename =
+            utility::filesystem::GetTempDirectoryPath() + "/strip.obj";
+    {
+        std::ofstream file(filename);
+        file << "vt 0.5 0.5\nvn 0 0 1\nv 0 0 0\nv 0 1 0\n";
+        for (int64_t i = 1; i <= num_quads; ++i) {
+            file << "v " << i << " 0 0\nv " << i << " 1 0\n"
+                 << "f -4/-1/-1 -2/-1/-1 -1/-1/-1 -3/-1/-1\n";
+        }
+    }
+    ASSERT_GT(std::ifstream(filename, std::ios::ate).tellg(), 1 << 20);
+
+    t::geometry::TriangleMesh mesh;
+    EXPECT_TRUE(t::io::ReadTriangleMesh(filename, mesh));
+    const int64_t num_vertices = 2 * num_quads + 2;
+    EXPECT_EQ(mesh.GetVertexPositions().GetLength(), num_vertices);
+
+    std::vector<int64_t> triangles;
+    for (int64_t i = 1; i <= num_quads; ++i) {
+        const int64_t v = 2 * i - 2;
+        triangles.insert(triangles.end(),
+                         {v, v + 2, v + 3, v, v + 3, v + 1});
+    }
+    EXPECT_TRUE(mesh.GetTriangleIndices().AllEqual(
+            core::Tensor(triangles, {2 * num_quads, 3}, core::Int64)));
+    EXPECT_TRUE(mesh.GetTriangleAttr("texture_uvs")
+                        .AllClose(core::Tensor::Full({2 * num_quads, 3, 2},
+                                                     0.5, core::Float32)));
+    core::Tensor normals = core::Tensor::Init<float>({0.0, 0.0, 1.0});
+    EXPECT_TRUE(mesh.GetVertexNormals().AllClose(
+            normals.Reshape({1, 3}).Expand({num_vertices, 3})));
+}
+
+TEST(TriangleMeshIO, ReadTriangleMeshGLTF) {
+    auto cube_mesh = t::geometry::TriangleMesh::FromLegacy(
+            geometry::TriangleMesh::CreateBox()->ComputeVertexNormals());
+    const std::string filename =
+            utility::filesystem::GetTempDirectoryPath() + "/cube.glb";
+    EXPECT_TRUE(t::io::WriteTriangleMesh(filename, cube_mesh));
+    t::geometry::TriangleMesh mesh;
+    EXPECT_TRUE(t::io::ReadTriangleMesh(filename, mesh));
+    EXPECT_TRUE(mesh.GetVertexPositions().AllClose(
+            cube_mesh.GetVertexPositions()));
+    EXPECT_TRUE(mesh.GetVertexNormals().AllClose(
+            cube_mesh.GetVertexNormals()));
+    EXPECT_TRUE(mesh.GetTriangleIndices().AllClose(
+            cube_mesh.GetTriangleIndices()));
 }
 
 // TODO: Add tests for triangle_uvs, materials, triangle_material_ids and
 // textures once these are supported.
+TEST(TriangleMeshIO, ReadTriangleMeshGLTFNodeTransforms) {
+    // A tilted triangle instanced by nodes with non-uniform scales and a
+    // rotation. The normals must stay perpendicular to the transformed
+    // triangles.
+    const std::string dir = utility::filesystem::GetTempDirectoryPath();
+    {
+        const float data[18] = {1, 0, 0, 0, 1, 0, 0, 0, 1,
+                                1, 1, 1, 1, 1, 1, 1, 1, 1};
+        std::ofstream file(dir + "/triangle.bin", std::ios::binary);
+        file.write(reinterpret_cast<const char *>(data), sizeof(data));
+    }
+    const std::string filename = dir + "/triangle.gltf";
+    {
+        std::ofstream file(filename);
+        file << R"({
+  "asset": {"version": "2.0"},
+  "buffers": [{"uri": "triangle.bin", "byteLength": 72}],
+  "bufferViews": [{"buffer": 0, "byteOffset": 0, "byteLength": 36},
+                  {"buffer": 0, "byteOffset": 36, "byteLength": 36}],
+  "accessors": [
+    {"bufferView": 0, "componentType": 5126, "count": 3, "type": "VEC3",
+     "min": [0, 0, 0], "max": [1, 1, 1]},
+    {"bufferView": 1, "componentType": 5126, "count": 3, "type": "VEC3"}],
+  "meshes": [{"primitives": [
+    {"attributes": {"POSITION": 0, "NORMAL": 1}, "mode": 4}]}],
+  "nodes": [
+    {"mesh": 0, "scale": [2, 1, 1]},
+    {"mesh": 0, "rotation": [0, 0, 0.70710678, 0.70710678],
+     "scale": [1, 3, 1], "translation": [1, 2, 3]},
+    {"scale": [1, 1, 0.5], "children": [1]}],
+  "scenes": [{"nodes": [0, 2]}],
+  "scene": 0
+})";
+    }
+    t::geometry::TriangleMesh mesh;
+    EXPECT_TRUE(t::io::ReadTriangleMesh(filename, mesh));
+    ASSERT_EQ(mesh.GetTriangleIndices().GetLength(), 2);
+
+    core::Tensor positions = mesh.GetVertexPositions();
+    core::Tensor normals = mesh.GetVertexNormals();
+    core::Tensor triangles = mesh.GetTriangleIndices();
+    for (int64_t t = 0; t < 2; ++t) {
+        Eigen::Vector3d p[3];
+        for (int c = 0; c < 3; ++c) {
+            const int64_t v = triangles[t][c].Item<int64_t>();
+            for (int i = 0; i < 3; ++i) {
+                p[c](i) = positions[v][i].Item<float>();
+            }
+        }
+        const Eigen::Vector3d face_normal =
+                (p[1] - p[0]).cross(p[2] - p[0]).normalized();
+        for (int c = 0; c < 3; ++c) {
+            const int64_t v = triangles[t][c].Item<int64_t>();
+            for (int i = 0; i < 3; ++i) {
+                EXPECT_NEAR(normals[v][i].Item<float>(), face_normal(i), 1e-5);
+            }
+        }
+    }
+}
+
 TEST(TriangleMeshIO, TriangleMeshLegecyCompatibility) {
     t::geometry::TriangleMesh mesh_tensor, mesh_tensor_read;
     geometry::TriangleMesh mesh_legacy, mesh_legacy_read;
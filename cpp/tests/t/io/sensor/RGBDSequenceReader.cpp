@@ -0,0 +1,130 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/RGBDSequenceReader.h"
+
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+/// Write num_frames color and depth images filled with the frame index.
+static void WriteFrames(const std::string &folder, int num_frames) {
+    utility::filesystem::MakeDirectoryHierarchy(folder + "/color");
+    utility::filesystem::MakeDirectoryHierarchy(folder + "/depth");
+    for (int i = 0; i < num_frames; ++i) {
+        t::geometry::Image color(6, 8, 3, core::UInt8);
+        color.AsTensor().Fill(i);
+        t::geometry::Image depth(6, 8, 1, core::UInt16);
+        depth.AsTensor().Fill(i * 100);
+        ASSERT_TRUE(t::io::WriteImage(
+                fmt::format("{}/color/{:05d}.png", folder, i), color));
+        ASSERT_TRUE(t::io::WriteImage(
+                fmt::format("{}/depth/{:05d}.png", folder, i), depth));
+    }
+}
+
+static void ExpectFrame(const t::geometry::RGBDImage &rgbd, int i) {
+    ASSERT_FALSE(rgbd.IsEmpty());
+    EXPECT_TRUE(rgbd.color_.AsTensor().AllEqual(
+            core::Tensor::Full({6, 8, 3}, i, core::UInt8)));
+    EXPECT_TRUE(rgbd.depth_.AsTensor().AllEqual(
+            core::Tensor::Full({6, 8, 1}, i * 100, core::UInt16)));
+}
+
+TEST(RGBDSequenceReader, ReadFolder) {
+    const std::string folder =
+            utility::filesystem::GetTempDirectoryPath() + "/test_sequence";
+    WriteFrames(folder, 10);
+
+    // Lookahead smaller and larger than the sequence.
+    for (size_t buffer_size : {size_t(2), size_t(16)}) {
+        t::io::RGBDSequenceReader reader(buffer_size, 3);
+        ASSERT_TRUE(reader.Open(folder));
+        EXPECT_EQ(reader.GetNumFrames(), 10);
+        EXPECT_EQ(reader.GetMetadata().width_, 8);
+        EXPECT_EQ(reader.GetMetadata().height_, 6);
+        EXPECT_EQ(reader.GetMetadata().depth_dt_, core::UInt16);
+
+        int i = 0;
+        while (!reader.IsEOF()) {
+            ExpectFrame(reader.NextFrame(), i);
+            EXPECT_EQ(reader.GetTimestamp(),
+                      static_cast<uint64_t>(std::round(i * 1e6 / 30)));
+            ++i;
+        }
+        EXPECT_EQ(i, 10);
+        EXPECT_TRUE(reader.NextFrame().IsEmpty());
+
+        // Seeking discards the frames decoded ahead.
+        ASSERT_TRUE(reader.SeekTimestamp(200000));
+        EXPECT_FALSE(reader.IsEOF());
+        ExpectFrame(reader.NextFrame(), 6);
+        ASSERT_TRUE(reader.SeekTimestamp(0));
+        ExpectFrame(reader.NextFrame(), 0);
+        ExpectFrame(reader.NextFrame(), 1);
+        EXPECT_FALSE(reader.SeekTimestamp(UINT64_MAX));
+        reader.Close();
+        EXPECT_FALSE(reader.IsOpened());
+    }
+
+    utility::filesystem::DeleteDirectory(folder);
+}
+
+TEST(RGBDSequenceReader, ReadAssociationFile) {
+    const std::string folder =
+            utility::filesystem::GetTempDirectoryPath() + "/test_sequence";
+    WriteFrames(folder, 4);
+
+    // ICL-NUIM style, with depth first and frame indices.
+    const std::string filename = folder + "/associations.txt";
+    {
+        utility::filesystem::CFile file;
+        ASSERT_TRUE(file.Open(filename, "w"));
+        fprintf(file.GetFILE(), "# depth rgb\n");
+        for (int i = 3; i >= 0; i -= 1) {
+            fprintf(file.GetFILE(), "%d depth/%05d.png %d color/%05d.png\n",
+                    3 - i, i, 3 - i, i);
+        }
+    }
+
+    std::unique_ptr<t::io::RGBDVideoReader> reader =
+            t::io::RGBDVideoReader::Create(filename);
+    ASSERT_TRUE(reader->IsOpened());
+    for (int i = 3; i >= 0; --i) {
+        ExpectFrame(reader->NextFrame(), i);
+    }
+    EXPECT_TRUE(reader->IsEOF());
+    EXPECT_EQ(reader->GetTimestamp(), 100000u);
+
+    reader.reset();
+    utility::filesystem::DeleteDirectory(folder);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -34,6 +34,7 @@
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/io/ImageIO.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/pipelines/odometry/RGBDPreprocessor.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 #include "tests/Tests.h"
 
@@ -155,6 +156,7 @@ TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScalePointToPlane) {
             t::pipelines::odometry::Method::Hybrid};
 
     core::Tensor intrinsic_t = CreateIntrisicTensor();
+    const core::Tensor intrinsic_ref = intrinsic_t.Clone();
     core::Tensor trans =
             core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
     auto result = t::pipelines::odometry::RGBDOdometryMultiScale(
@@ -188,6 +190,27 @@ TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScalePointToPlane) {
             result.transformation_.To(host, core::Float64).Inverse());
     core::Tensor Ttrans = Tdiff.Slice(0, 0, 3).Slice(1, 3, 4);
     EXPECT_LE(Ttrans.T().Matmul(Ttrans).Item<double>(), 5e-5);
+
+    // A precomputed source pyramid gives the same result.
+    std::vector<core::Tensor> src_vertex_maps =
+            t::pipelines::odometry::CreateVertexMapPyramid(
+                    src.depth_, intrinsic_t, depth_scale, depth_max, 3,
+                    t::pipelines::odometry::OdometryLossParams(depth_diff));
+    EXPECT_EQ(src_vertex_maps.size(), 3u);
+    EXPECT_EQ(src_vertex_maps[2].GetShape(),
+              core::SizeVector({src_depth.GetRows(), src_depth.GetCols(), 3}));
+    auto result_pyramid =
+            t::pipelines::odometry::RGBDOdometryMultiScalePointToPlane(
+                    src_vertex_maps, dst, intrinsic_t, trans, depth_scale,
+                    depth_max,
+                    std::vector<t::pipelines::odometry::
+                                        OdometryConvergenceCriteria>{10, 5, 3},
+                    t::pipelines::odometry::OdometryLossParams(depth_diff));
+    EXPECT_TRUE(result_pyramid.transformation_.AllClose(
+            result.transformation_, 1e-6, 1e-6));
+
+    // The image pyramids are built without modifying the intrinsics.
+    EXPECT_TRUE(intrinsic_t.AllEqual(intrinsic_ref));
 }
 
 TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScaleIntensity) {
@@ -323,5 +346,83 @@ TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScaleHybrid) {
     core::Tensor Ttrans = Tdiff.Slice(0, 0, 3).Slice(1, 3, 4);
     EXPECT_LE(Ttrans.T().Matmul(Ttrans).Item<double>(), 5e-5);
 }
+
+TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScalePyramid) {
+    core::Device device = GetParam();
+
+    const float depth_scale = 1000.0;
+    const float depth_max = 3.0;
+    const float depth_diff = 0.07;
+
+    data::SampleRedwoodRGBDImages redwood_data;
+    t::geometry::RGBDImage src, dst;
+    src.color_ = t::io::CreateImageFromFile(redwood_data.GetColorPaths()[0])
+                         ->To(device);
+    dst.color_ = t::io::CreateImageFromFile(redwood_data.GetColorPaths()[2])
+                         ->To(device);
+    src.depth_ = t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[0])
+                         ->To(device);
+    dst.depth_ = t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[2])
+                         ->To(device);
+
+    core::Device host("CPU:0");
+    core::Tensor T0 = core::Tensor::Init<double>(
+            {{-0.2739592186924325, 0.021819345900466677, -0.9614937663021573,
+              -0.31057997014702826},
+             {8.33962904204855e-19, -0.9997426093226981, -0.02268733357278151,
+              0.5730122438481298},
+             {-0.9617413095492113, -0.006215404179813816, 0.27388870414358013,
+              2.1264800183565487},
+             {0.0, 0.0, 0.0, 1.0}},
+            host);
+    core::Tensor T2 = core::Tensor::Init<double>(
+            {{-0.26535185454036697, 0.04522708142999141, -0.9630902888085378,
+              -0.3097373196756845},
+             {1.6706953334814538e-18, -0.9988991819470762,
+              -0.046908680491589354, 0.6204495589484211},
+             {-0.9641516443443884, -0.012447305362484767, 0.2650597504285121,
+              2.1247894438735306},
+             {0.0, 0.0, 0.0, 1.0}},
+            host);
+
+    core::Tensor intrinsic_t = CreateIntrisicTensor();
+    t::pipelines::odometry::OdometryLossParams params(depth_diff);
+    for (auto method : {t::pipelines::odometry::Method::PointToPlane,
+                        t::pipelines::odometry::Method::Intensity,
+                        t::pipelines::odometry::Method::Hybrid}) {
+        t::pipelines::odometry::RGBDPreprocessor preprocessor(
+                intrinsic_t, 3, depth_scale, depth_max, method, params);
+        t::pipelines::odometry::RGBDPyramid src_pyramid =
+                preprocessor.Process(src);
+        t::pipelines::odometry::RGBDPyramid dst_pyramid;
+        preprocessor.Process(dst, dst_pyramid);
+        EXPECT_EQ(dst_pyramid.NumLevels(), 3);
+        EXPECT_EQ(dst_pyramid.vertex_maps_[2].GetShape(),
+                  core::SizeVector({src.depth_.GetRows(),
+                                    src.depth_.GetCols(), 3}));
+        EXPECT_EQ(dst_pyramid.depth_[0].GetShape(),
+                  core::SizeVector({src.depth_.GetRows() / 4,
+                                    src.depth_.GetCols() / 4, 1}));
+
+        // Buffers are reused for frames of the same size.
+        const void* depth_ptr = dst_pyramid.depth_[2].GetDataPtr();
+        preprocessor.Process(dst, dst_pyramid);
+        EXPECT_EQ(dst_pyramid.depth_[2].GetDataPtr(), depth_ptr);
+
+        auto result = t::pipelines::odometry::RGBDOdometryMultiScale(
+                src_pyramid, dst_pyramid,
+                core::Tensor::Eye(4, core::Float64, host),
+                std::vector<
+                        t::pipelines::odometry::OdometryConvergenceCriteria>{
+                        10, 5, 3},
+                method, params);
+
+        core::Tensor Tdiff = T2.Inverse().Matmul(T0).Matmul(
+                result.transformation_.To(host, core::Float64).Inverse());
+        core::Tensor Ttrans = Tdiff.Slice(0, 0, 3).Slice(1, 3, 4);
+        EXPECT_LE(Ttrans.T().Matmul(Ttrans).Item<double>(), 5e-5);
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
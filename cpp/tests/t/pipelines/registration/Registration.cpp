@@ -35,6 +35,7 @@
 #include "open3d/pipelines/registration/Registration.h"
 #include "open3d/pipelines/registration/RobustKernel.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/pipelines/kernel/Registration.h"
 #include "open3d/t/pipelines/registration/RobustKernel.h"
 #include "open3d/t/pipelines/registration/RobustKernelImpl.h"
 #include "tests/Tests.h"
@@ -311,6 +312,97 @@ TEST_P(RegistrationPermuteDevices, ICPPointToPlane) {
     }
 }
 
+TEST_P(RegistrationPermuteDevices, BatchICP) {
+    core::Device device = GetParam();
+
+    for (auto dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud source_tpcd(device), target_tpcd(device);
+        std::tie(source_tpcd, target_tpcd) = GetTestPointClouds(dtype, device);
+
+        core::Tensor initial_transform_t =
+                core::Tensor::Init<double>({{0.862, 0.011, -0.507, 0.5},
+                                            {-0.139, 0.967, -0.215, 0.7},
+                                            {0.487, 0.255, 0.835, -1.4},
+                                            {0.0, 0.0, 0.0, 1.0}},
+                                           core::Device("CPU:0"));
+        std::vector<core::Tensor> init_transforms = {
+                initial_transform_t,
+                core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+                initial_transform_t};
+
+        std::vector<t::geometry::PointCloud> sources(3, source_tpcd);
+        std::vector<t::geometry::PointCloud> targets(3, target_tpcd);
+
+        double max_correspondence_dist = 1.5;
+        t_reg::TransformationEstimationPointToPlane estimation;
+        t_reg::ICPConvergenceCriteria criteria(1e-6, 1e-6, 5);
+
+        std::vector<t_reg::RegistrationResult> results = t_reg::BatchICP(
+                sources, targets, max_correspondence_dist, init_transforms,
+                estimation, criteria);
+
+        ASSERT_EQ(results.size(), 3u);
+        for (size_t i = 0; i < results.size(); ++i) {
+            t_reg::RegistrationResult expected = t_reg::ICP(
+                    source_tpcd, target_tpcd, max_correspondence_dist,
+                    init_transforms[i], estimation, criteria);
+            // Reductions may be summed in a different order when run
+            // single-threaded, hence the tolerances.
+            EXPECT_NEAR(results[i].fitness_, expected.fitness_, 1e-6);
+            EXPECT_NEAR(results[i].inlier_rmse_, expected.inlier_rmse_, 1e-5);
+            EXPECT_TRUE(results[i].transformation_.AllClose(
+                    expected.transformation_, 1e-4, 1e-5));
+        }
+
+        // Mismatched number of sources and targets.
+        targets.pop_back();
+        EXPECT_ANY_THROW(t_reg::BatchICP(sources, targets,
+                                         max_correspondence_dist));
+    }
+}
+
+TEST(Registration, ComputePosePointToPlaneFused) {
+    core::Device device("CPU:0");
+
+    for (auto dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud source_tpcd(device), target_tpcd(device);
+        std::tie(source_tpcd, target_tpcd) = GetTestPointClouds(dtype, device);
+
+        double max_correspondence_dist = 1.5;
+        t_reg::RobustKernel kernel(t_reg::RobustKernelMethod::HuberLoss,
+                                   /*scale parameter =*/0.5,
+                                   /*shape parameter =*/1.0);
+
+        core::nns::NearestNeighborSearch target_nns(
+                target_tpcd.GetPointPositions());
+        target_nns.HybridIndex(max_correspondence_dist);
+
+        // Reference: explicit correspondences followed by the reduction.
+        core::Tensor corres, distances, counts;
+        std::tie(corres, distances, counts) = target_nns.HybridSearch(
+                source_tpcd.GetPointPositions(), max_correspondence_dist, 1);
+        corres = corres.To(core::Int64);
+        core::Tensor pose_ref = t::pipelines::kernel::ComputePosePointToPlane(
+                source_tpcd.GetPointPositions(),
+                target_tpcd.GetPointPositions(), target_tpcd.GetPointNormals(),
+                corres, kernel);
+        t_reg::RegistrationResult result_ref = t_reg::EvaluateRegistration(
+                source_tpcd, target_tpcd, max_correspondence_dist,
+                core::Tensor::Eye(4, core::Float64, device));
+
+        double fitness = 0.0, inlier_rmse = 0.0;
+        core::Tensor pose = t::pipelines::kernel::ComputePosePointToPlaneFused(
+                source_tpcd.GetPointPositions(),
+                target_tpcd.GetPointPositions(), target_tpcd.GetPointNormals(),
+                target_nns, max_correspondence_dist, kernel, fitness,
+                inlier_rmse);
+
+        EXPECT_TRUE(pose.AllClose(pose_ref, 1e-4, 1e-5));
+        EXPECT_NEAR(fitness, result_ref.fitness_, 1e-6);
+        EXPECT_NEAR(inlier_rmse, result_ref.inlier_rmse_, 1e-5);
+    }
+}
+
 TEST_P(RegistrationPermuteDevices, ICPColored) {
     core::Device device = GetParam();
 
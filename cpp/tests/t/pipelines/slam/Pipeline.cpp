@@ -0,0 +1,166 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slam/Pipeline.h"
+
+#include <cmath>
+#include <memory>
+
+#include "core/CoreTest.h"
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/data/Dataset.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/t/pipelines/slam/Frame.h"
+#include "open3d/t/pipelines/slam/Model.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class SLAMPipelinePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(SLAMPipeline,
+                         SLAMPipelinePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static core::Tensor GetPrimeSenseIntrinsicTensor() {
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    return core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+}
+
+// The frame loop of the DenseSLAM example, using Model directly.
+static std::vector<core::Tensor> RunModelLoop(
+        t::pipelines::slam::Model &model,
+        const core::Tensor &intrinsic,
+        const std::vector<std::string> &depth_paths,
+        const std::vector<std::string> &color_paths,
+        const core::Device &device) {
+    const float depth_scale = 1000.0, depth_max = 3.0, depth_diff = 0.07;
+    const float trunc_voxel_multiplier = 8.0;
+    std::vector<core::Tensor> poses;
+    std::shared_ptr<t::pipelines::slam::Frame> input_frame, raycast_frame;
+    core::Tensor T_frame_to_model = model.GetCurrentFramePose();
+    for (size_t i = 0; i < depth_paths.size(); ++i) {
+        t::geometry::Image depth =
+                t::io::CreateImageFromFile(depth_paths[i])->To(device);
+        t::geometry::Image color =
+                t::io::CreateImageFromFile(color_paths[i])->To(device);
+        if (input_frame == nullptr) {
+            input_frame = std::make_shared<t::pipelines::slam::Frame>(
+                    depth.GetRows(), depth.GetCols(), intrinsic, device);
+            raycast_frame = std::make_shared<t::pipelines::slam::Frame>(
+                    depth.GetRows(), depth.GetCols(), intrinsic, device);
+        }
+        input_frame->SetDataFromImage("depth", depth);
+        input_frame->SetDataFromImage("color", color);
+
+        bool tracking_success = true;
+        if (i > 0) {
+            auto result = model.TrackFrameToModel(*input_frame, *raycast_frame,
+                                                  depth_scale, depth_max,
+                                                  depth_diff);
+            core::Tensor translation =
+                    result.transformation_.Slice(0, 0, 3).Slice(1, 3, 4);
+            double translation_norm = std::sqrt(
+                    (translation * translation).Sum({0, 1}).Item<double>());
+            if (result.fitness_ >= 0.1 && translation_norm < 0.15) {
+                T_frame_to_model =
+                        T_frame_to_model.Matmul(result.transformation_);
+            } else {
+                tracking_success = false;
+            }
+        }
+
+        model.UpdateFramePose(static_cast<int>(i), T_frame_to_model);
+        if (tracking_success) {
+            model.Integrate(*input_frame, depth_scale, depth_max,
+                            trunc_voxel_multiplier);
+        }
+        model.SynthesizeModelFrame(*raycast_frame, depth_scale, 0.1,
+                                   depth_max, trunc_voxel_multiplier, false);
+        poses.push_back(T_frame_to_model);
+    }
+    return poses;
+}
+
+TEST_P(SLAMPipelinePermuteDevices, Run) {
+    core::Device device = GetParam();
+    if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
+        return;
+    }
+
+    data::SampleRedwoodRGBDImages redwood_data;
+    core::Tensor intrinsic = GetPrimeSenseIntrinsicTensor();
+    const core::Tensor intrinsic_ref = intrinsic.Clone();
+    core::Tensor T_init =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+
+    // The pipeline must track the same poses as the Model based frame loop.
+    t::pipelines::slam::Model model_sequential(3.0 / 512, 16, 10000, T_init,
+                                               device);
+    std::vector<core::Tensor> poses_sequential = RunModelLoop(
+            model_sequential, intrinsic, redwood_data.GetDepthPaths(),
+            redwood_data.GetColorPaths(), device);
+
+    t::pipelines::slam::Model model_pipelined(3.0 / 512, 16, 10000, T_init,
+                                              device);
+    t::pipelines::slam::Pipeline pipeline_pipelined(
+            model_pipelined, intrinsic, 1000.0, 3.0, 0.07, 8.0,
+            /*queue_size=*/2, /*pipelined=*/true);
+    std::vector<core::Tensor> poses_pipelined = pipeline_pipelined.Run(
+            redwood_data.GetDepthPaths(), redwood_data.GetColorPaths());
+    EXPECT_TRUE(intrinsic.AllEqual(intrinsic_ref));
+
+    ASSERT_EQ(poses_sequential.size(), redwood_data.GetDepthPaths().size());
+    ASSERT_EQ(poses_pipelined.size(), poses_sequential.size());
+    for (size_t i = 0; i < poses_sequential.size(); ++i) {
+        EXPECT_TRUE(poses_pipelined[i].AllClose(poses_sequential[i], 1e-5,
+                                                1e-5));
+    }
+    EXPECT_EQ(model_pipelined.GetHashMap().Size(),
+              model_sequential.GetHashMap().Size());
+
+    std::unordered_map<std::string, double> latencies =
+            pipeline_pipelined.GetStageLatencies();
+    for (const std::string stage :
+         {"decode", "preprocess", "track", "integrate", "raycast"}) {
+        ASSERT_EQ(latencies.count(stage), 1u);
+        EXPECT_GE(latencies.at(stage), 0.0);
+    }
+
+    // Unreadable frames stop the pipeline with an exception.
+    EXPECT_ANY_THROW(pipeline_pipelined.Run({"/not/a/depth.png"},
+                                            {"/not/a/color.jpg"}));
+}
+
+}  // namespace tests
+}  // namespace open3d
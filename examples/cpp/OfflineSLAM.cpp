@@ -157,14 +157,20 @@ int main(int argc, char* argv[]) {
     t::pipelines::slam::Frame raycast_frame(
             ref_depth.GetRows(), ref_depth.GetCols(), intrinsic_t, device);
 
+    // Frames are decoded and moved to the device ahead in the background.
+    t::io::RGBDSequenceReader reader(
+            t::io::RGBDSequenceReader::DEFAULT_BUFFER_SIZE, 4, device);
+    if (!reader.Open(color_filenames, depth_filenames)) {
+        utility::LogError("Unable to read the color and depth images.");
+    }
+
     // Iterate over frames
     for (size_t i = 0; i < iterations; ++i) {
         utility::LogInfo("Processing {}/{}...", i, iterations);
         // Load image into frame
-        Image input_depth = *t::io::CreateImageFromFile(depth_filenames[i]);
-        Image input_color = *t::io::CreateImageFromFile(color_filenames[i]);
-        input_frame.SetDataFromImage("depth", input_depth);
-        input_frame.SetDataFromImage("color", input_color);
+        t::geometry::RGBDImage input_rgbd = reader.NextFrame();
+        input_frame.SetDataFromImage("depth", input_rgbd.depth_);
+        input_frame.SetDataFromImage("color", input_rgbd.color_);
 
         bool tracking_success = true;
         if (i > 0) {
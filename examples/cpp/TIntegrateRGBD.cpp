@@ -125,6 +125,13 @@ int main(int argc, char* argv[]) {
             {core::Dtype::Float32, core::Dtype::Float32, core::Dtype::Float32},
             {{1}, {1}, {3}}, voxel_size, 16, block_count, device);
 
+    // Frames are decoded and moved to the device ahead in the background.
+    t::io::RGBDSequenceReader reader(
+            t::io::RGBDSequenceReader::DEFAULT_BUFFER_SIZE, 4, device);
+    if (!reader.Open(color_filenames, depth_filenames)) {
+        utility::LogError("Unable to read the color and depth images.");
+    }
+
     double time_total = 0;
     double time_int = 0;
     double time_raycasting = 0;
@@ -135,19 +142,12 @@ int main(int argc, char* argv[]) {
         // Load image
         utility::Timer timer_io;
         timer_io.Start();
-        t::geometry::Image depth =
-                (*t::io::CreateImageFromFile(depth_filenames[i]));
-        t::geometry::Image color =
-                (*t::io::CreateImageFromFile(color_filenames[i]));
+        t::geometry::RGBDImage rgbd = reader.NextFrame();
+        t::geometry::Image depth = rgbd.depth_;
+        t::geometry::Image color = rgbd.color_;
         timer_io.Stop();
         utility::LogInfo("IO takes {}", timer_io.GetDuration());
 
-        timer_io.Start();
-        depth = depth.To(device);
-        color = color.To(device);
-        timer_io.Stop();
-        utility::LogInfo("Conversion takes {}", timer_io.GetDuration());
-
         Eigen::Matrix4d extrinsic = trajectory->parameters_[i].extrinsic_;
         Tensor extrinsic_t =
                 core::eigen_converter::EigenMatrixToTensor(extrinsic);
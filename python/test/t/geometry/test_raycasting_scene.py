@@ -233,6 +233,216 @@ def test_compute_occupancy():
     np.testing.assert_allclose(ans.numpy(), [1.0, 0.0])
 
 
+def test_remove_geometry():
+    vertices = o3d.core.Tensor([[0, 0, 0], [1, 0, 0], [1, 1, 0]],
+                               dtype=o3d.core.float32)
+    triangles = o3d.core.Tensor([[0, 1, 2]], dtype=o3d.core.uint32)
+
+    scene = o3d.t.geometry.RaycastingScene()
+    geom_id = scene.add_triangles(vertices, triangles)
+    other_id = scene.add_triangles(
+        vertices + o3d.core.Tensor([0, 0, -1], dtype=o3d.core.float32),
+        triangles)
+
+    rays = o3d.core.Tensor([[0.2, 0.1, 1, 0, 0, -1]], dtype=o3d.core.float32)
+    assert geom_id == scene.cast_rays(rays)['geometry_ids'][0]
+
+    scene.remove_geometry(geom_id)
+    ans = scene.cast_rays(rays)
+    assert other_id == ans['geometry_ids'][0]
+    assert np.isclose(ans['t_hit'][0].item(), 2.0)
+
+    with pytest.raises(RuntimeError):
+        scene.remove_geometry(geom_id)
+
+
+def test_instances():
+    cube = o3d.t.geometry.TriangleMesh.from_legacy(
+        o3d.geometry.TriangleMesh.create_box())
+
+    scene = o3d.t.geometry.RaycastingScene()
+    prototype_id = scene.add_prototype(cube)
+    transform = np.eye(4, dtype=np.float32)
+    transform[:3, 3] = [2, 0, 0]
+    inst_a = scene.add_instance(prototype_id)
+    inst_b = scene.add_instance(prototype_id,
+                                o3d.core.Tensor.from_numpy(transform))
+
+    rays = o3d.core.Tensor([[0.5, 0.5, -1, 0, 0, 1], [2.5, 0.5, -1, 0, 0, 1]],
+                           dtype=o3d.core.float32)
+    ans = scene.cast_rays(rays)
+    np.testing.assert_equal(ans['geometry_ids'].numpy(), [inst_a, inst_b])
+    np.testing.assert_allclose(ans['t_hit'].numpy(), [1.0, 1.0])
+    np.testing.assert_allclose(ans['primitive_normals'].numpy(),
+                               [[0, 0, -1], [0, 0, -1]],
+                               atol=1e-6)
+    np.testing.assert_equal(scene.count_intersections(rays).numpy(), [2, 2])
+
+    query_points = o3d.core.Tensor([[2.5, 0.5, 2]], dtype=o3d.core.float32)
+    ans = scene.compute_closest_points(query_points)
+    assert inst_b == ans['geometry_ids'][0]
+    np.testing.assert_allclose(ans['points'].numpy(), [[2.5, 0.5, 1]],
+                               atol=1e-6)
+
+    # Move the second instance up and rotate it by 90 degrees around x.
+    transform = np.array(
+        [[1, 0, 0, 2], [0, 0, -1, 0], [0, 1, 0, 1], [0, 0, 0, 1]],
+        dtype=np.float32)
+    scene.set_instance_transform(inst_b, o3d.core.Tensor.from_numpy(transform))
+    rays = o3d.core.Tensor([[2.5, -0.5, -1, 0, 0, 1]], dtype=o3d.core.float32)
+    ans = scene.cast_rays(rays)
+    assert inst_b == ans['geometry_ids'][0]
+    np.testing.assert_allclose(ans['t_hit'].numpy(), [2.0])
+    np.testing.assert_allclose(ans['primitive_normals'].numpy(), [[0, 0, -1]],
+                               atol=1e-6)
+
+
+def test_update_triangle_vertices():
+    vertices = o3d.core.Tensor([[0, 0, 0], [1, 0, 0], [1, 1, 0]],
+                               dtype=o3d.core.float32)
+    triangles = o3d.core.Tensor([[0, 1, 2]], dtype=o3d.core.uint32)
+
+    scene = o3d.t.geometry.RaycastingScene()
+    geom_id = scene.add_triangles(vertices, triangles)
+
+    rays = o3d.core.Tensor([[0.2, 0.1, 1, 0, 0, -1]], dtype=o3d.core.float32)
+    assert np.isclose(scene.cast_rays(rays)['t_hit'][0].item(), 1.0)
+
+    scene.update_triangle_vertices(
+        geom_id,
+        vertices + o3d.core.Tensor([0, 0, 0.5], dtype=o3d.core.float32))
+    ans = scene.cast_rays(rays)
+    assert geom_id == ans['geometry_ids'][0]
+    assert np.isclose(ans['t_hit'][0].item(), 0.5)
+
+    with pytest.raises(RuntimeError):
+        scene.update_triangle_vertices(geom_id, vertices[:2])
+
+
+@pytest.mark.parametrize("build_quality",
+                         (o3d.t.geometry.RaycastingScene.BuildQuality.Low,
+                          o3d.t.geometry.RaycastingScene.BuildQuality.Medium,
+                          o3d.t.geometry.RaycastingScene.BuildQuality.High))
+def test_build_quality(build_quality):
+    cube = o3d.t.geometry.TriangleMesh.from_legacy(
+        o3d.geometry.TriangleMesh.create_box())
+
+    scene = o3d.t.geometry.RaycastingScene(build_quality)
+    assert build_quality == scene.build_quality
+    scene.add_triangles(cube)
+
+    rays = o3d.core.Tensor([[0.5, 0.5, -1, 0, 0, 1], [0.5, 0.5, 0.5, 0, 0, 1],
+                            [10, 10, 10, 1, 0, 0]],
+                           dtype=o3d.core.float32)
+    np.testing.assert_equal(scene.count_intersections(rays).numpy(), [2, 1, 0])
+
+    scene.build_quality = o3d.t.geometry.RaycastingScene.BuildQuality.High
+    np.testing.assert_equal(scene.count_intersections(rays).numpy(), [2, 1, 0])
+
+
+def test_create_rays_lidar():
+    model = o3d.t.geometry.LidarModel(o3d.core.Tensor([-10, 0, 10],
+                                                      dtype=o3d.core.float32),
+                                      num_columns=8,
+                                      scan_duration=0.1)
+    rays = o3d.t.geometry.RaycastingScene.create_rays_lidar(model)
+    assert rays.shape == (3, 8, 6)
+    np.testing.assert_allclose(np.linalg.norm(rays[..., 3:].numpy(), axis=-1),
+                               np.ones((3, 8)),
+                               rtol=1e-6)
+    np.testing.assert_allclose(rays[1, :, 5].numpy(), np.zeros(8), atol=1e-6)
+
+    timestamps = o3d.t.geometry.RaycastingScene.create_timestamps_lidar(model)
+    np.testing.assert_allclose(timestamps[0].numpy(), np.arange(8) * 0.1 / 8)
+    np.testing.assert_allclose(timestamps[:, 3].numpy(), [0.0375] * 3)
+
+    # The sensor moves 1m along x during the scan.
+    end_pose = np.eye(4)
+    end_pose[0, 3] = 1
+    rays = o3d.t.geometry.RaycastingScene.create_rays_lidar(
+        model, end_pose=o3d.core.Tensor(end_pose))
+    np.testing.assert_allclose(rays[0, :, 0].numpy(), np.arange(8) / 8)
+
+    model.scan_pattern = o3d.t.geometry.LidarModel.ScanPattern.SolidState
+    timestamps = o3d.t.geometry.RaycastingScene.create_timestamps_lidar(model)
+    np.testing.assert_allclose(timestamps[:, 0].numpy(), np.arange(3) * 0.1 / 3)
+
+
+def test_cast_rays_lidar():
+    cube = o3d.t.geometry.TriangleMesh.from_legacy(
+        o3d.geometry.TriangleMesh.create_box())
+    cube.vertex['positions'] = cube.vertex['positions'] * 4 - 2
+
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(cube)
+
+    model = o3d.t.geometry.LidarModel(o3d.core.Tensor([-5, 0, 5],
+                                                      dtype=o3d.core.float32),
+                                      num_columns=360)
+    pcd = scene.cast_rays_lidar(model)
+
+    # The sensor is inside the box, all rays hit.
+    rays = o3d.t.geometry.RaycastingScene.create_rays_lidar(model)
+    ans = scene.cast_rays(rays)
+    assert len(pcd.point['positions']) == 3 * 360
+    np.testing.assert_allclose(pcd.point['ranges'].numpy().ravel(),
+                               ans['t_hit'].numpy().ravel(),
+                               rtol=1e-5)
+    np.testing.assert_allclose(np.linalg.norm(pcd.point['positions'].numpy(),
+                                              axis=-1),
+                               ans['t_hit'].numpy().ravel(),
+                               rtol=1e-5)
+    np.testing.assert_equal(pcd.point['rings'].numpy().ravel(),
+                            np.repeat(np.arange(3), 360))
+    intensities = pcd.point['intensities'].numpy()
+    assert (intensities > 0).all() and (intensities <= 1).all()
+
+    # Rays longer than the max range are dropped.
+    pcd = scene.cast_rays_lidar(model, max_range=2.5)
+    assert 0 < len(pcd.point['positions']) < 3 * 360
+    assert (pcd.point['ranges'].numpy() <= 2.5).all()
+
+
+def test_signed_distance_cache():
+    sphere = o3d.t.geometry.TriangleMesh.from_legacy(
+        o3d.geometry.TriangleMesh.create_sphere(resolution=40))
+
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(sphere)
+
+    rs = np.random.RandomState(123)
+    query_points = o3d.core.Tensor.from_numpy(
+        rs.uniform(-2, 2, size=(2000, 3)).astype(np.float32))
+    expected_sdf = scene.compute_signed_distance(query_points).numpy()
+    expected_occupancy = scene.compute_occupancy(query_points).numpy()
+
+    max_error = 0.01
+    scene.enable_signed_distance_cache(voxel_size=0.5, max_error=max_error)
+    assert scene.is_signed_distance_cache_enabled()
+    sdf = scene.compute_signed_distance(query_points).numpy()
+    # The error bound is only checked at the cell centers.
+    np.testing.assert_allclose(sdf, expected_sdf, atol=4 * max_error)
+    num_cells = scene.get_signed_distance_cache_size()
+    assert num_cells > 0
+
+    # Repeated queries are answered from the cache.
+    sdf_cached = scene.compute_signed_distance(query_points).numpy()
+    np.testing.assert_equal(sdf_cached, sdf)
+    assert num_cells == scene.get_signed_distance_cache_size()
+
+    occupancy = scene.compute_occupancy(query_points).numpy()
+    away_from_surface = np.abs(expected_sdf) > 4 * max_error
+    np.testing.assert_equal(occupancy[away_from_surface],
+                            expected_occupancy[away_from_surface])
+
+    # Changing the scene clears the cache.
+    scene.add_triangles(sphere)
+    assert scene.get_signed_distance_cache_size() == 0
+
+    scene.disable_signed_distance_cache()
+    assert not scene.is_signed_distance_cache_enabled()
+
+
 @pytest.mark.parametrize("shape", ([11], [1, 2, 3], [32, 14]))
 def test_output_shapes(shape):
     vertices = o3d.core.Tensor([[0, 0, 0], [1, 0, 0], [1, 1, 0]],